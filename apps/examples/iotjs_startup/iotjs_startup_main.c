@@ -19,6 +19,10 @@
 
 #include <tinyara/config.h>
 #include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <unistd.h>
+#include <time.h>
 #include <libgen.h>
 #include <wifi_manager/wifi_manager.h>
 
@@ -113,6 +117,57 @@ static void iotjs_startup_wifi_connect(void)
 }
 #endif
 
+#ifdef CONFIG_EXAMPLES_IOTJS_STARTUP_BENCH
+/* Run a script to its end and print how long it took */
+
+static void iotjs_startup_bench_run(char *script)
+{
+	char *targv[3];
+	int targc = 0;
+	struct timespec start;
+	struct timespec end;
+	long long elapsed;
+
+	if (access(script, R_OK) != 0) {
+		printf("bench: %s not found\n", script);
+		return;
+	}
+
+	targv[targc++] = "iotjs";
+#ifdef CONFIG_IOTJS_JERRY_MEMSTAT
+	/* JerryScript prints the peak heap usage when it exits */
+	targv[targc++] = "--memstat";
+#endif
+	targv[targc++] = script;
+
+	clock_gettime(CLOCK_REALTIME, &start);
+	iotjs(targc, targv);
+	clock_gettime(CLOCK_REALTIME, &end);
+
+	elapsed = (long long)(end.tv_sec - start.tv_sec) * 1000 + (end.tv_nsec - start.tv_nsec) / 1000000;
+	printf("bench: %s ran in %lld msec\n", script, elapsed);
+}
+
+/* Compare the main script loaded from its source and from its snapshot */
+
+static void iotjs_startup_bench(void)
+{
+	char snapshot[PATH_MAX];
+	char *ext;
+
+	strncpy(snapshot, CONFIG_EXAMPLES_IOTJS_STARTUP_JS_FILE, sizeof(snapshot) - sizeof(".snapshot"));
+	snapshot[sizeof(snapshot) - sizeof(".snapshot")] = '\0';
+	ext = strrchr(snapshot, '.');
+	if (ext != NULL && strcmp(ext, ".js") == 0) {
+		*ext = '\0';
+	}
+	strcat(snapshot, ".snapshot");
+
+	iotjs_startup_bench_run(CONFIG_EXAMPLES_IOTJS_STARTUP_JS_FILE);
+	iotjs_startup_bench_run(snapshot);
+}
+#endif
+
 #ifdef CONFIG_BUILD_KERNEL
 int main(int argc, FAR char *argv[])
 #else
@@ -128,6 +183,13 @@ int iotjs_startup_main(int argc, char *argv[])
 	iotjs_startup_wifi_connect();
 #else
 	g_is_connected = true;
+#endif
+#ifdef CONFIG_EXAMPLES_IOTJS_STARTUP_BENCH
+	while (!g_is_connected) {
+		sleep(1);
+	}
+	iotjs_startup_bench();
+	return 0;
 #endif
 	for (;;) {
 		if (g_is_connected) {
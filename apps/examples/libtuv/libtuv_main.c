@@ -17,6 +17,8 @@
  ****************************************************************************/
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <libtuvapi.h>
 #include <libtuv/uv.h>
 
@@ -97,6 +99,10 @@ int libtuv_main(int argc, FAR char *argv[])
 	int fd_watch = -1;
 	struct sockaddr_in sin;
 
+	if (argc > 1 && !strcmp(argv[1], "threadpool")) {
+		return libtuv_threadpool_bench(argc > 2 ? atoi(argv[2]) : 0);
+	}
+
 	bzero(&sin, sizeof(sin));
 	sin.sin_family = AF_INET;
 	sin.sin_addr.s_addr = htonl(INADDR_ANY);
@@ -0,0 +1,228 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/*
+ * Threadpool benchmark: submits the same mix of file system (I/O class) and
+ * uv_queue_work (CPU class) requests to the pool once with a single shared
+ * queue and once with per-worker queues and work stealing, and reports the
+ * throughput and the latency from submission to completion of each class.
+ */
+
+#include <tinyara/config.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <libtuvapi.h>
+#include <libtuv/uv.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define TP_BENCH_DEFAULT_NWORK  200
+#define TP_BENCH_MAX_NWORK      2000
+#define TP_BENCH_SPIN           20000
+#define TP_BENCH_PATH           "/"
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct tp_bench_class_s {
+	int done;
+	uint64_t total_latency;
+	uint64_t max_latency;
+};
+
+struct tp_bench_req_s {
+	union {
+		uv_work_t work;
+		uv_fs_t fs;
+	} u;
+	uint64_t submitted;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct tp_bench_class_s g_io;
+static struct tp_bench_class_s g_cpu;
+static volatile uint32_t g_sink;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static uint64_t tp_bench_usec(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void tp_bench_account(struct tp_bench_class_s *cls, uint64_t submitted)
+{
+	uint64_t latency = tp_bench_usec() - submitted;
+
+	cls->done++;
+	cls->total_latency += latency;
+	if (latency > cls->max_latency) {
+		cls->max_latency = latency;
+	}
+}
+
+static void tp_bench_work_cb(uv_work_t *req)
+{
+	uint32_t acc = (uint32_t)(uintptr_t)req;
+	int i;
+
+	for (i = 0; i < TP_BENCH_SPIN; i++) {
+		acc = acc * 1103515245 + 12345;
+	}
+	g_sink = acc;
+}
+
+static void tp_bench_after_work_cb(uv_work_t *req, int status)
+{
+	struct tp_bench_req_s *r = container_of(req, struct tp_bench_req_s, u.work);
+
+	tp_bench_account(&g_cpu, r->submitted);
+}
+
+static void tp_bench_fs_cb(uv_fs_t *req)
+{
+	struct tp_bench_req_s *r = container_of(req, struct tp_bench_req_s, u.fs);
+
+	tp_bench_account(&g_io, r->submitted);
+	uv_fs_req_cleanup(req);
+}
+
+static void tp_bench_report(const char *name, struct tp_bench_class_s *cls)
+{
+	printf("  %-3s : %4d done, avg latency %8llu usec, max %8llu usec\n", name, cls->done,
+		   (unsigned long long)(cls->done ? cls->total_latency / cls->done : 0), (unsigned long long)cls->max_latency);
+}
+
+#ifdef CONFIG_LIBTUV_THREADPOOL_STATS
+static void tp_bench_report_pool(void)
+{
+	uv_threadpool_stats_t stats[8];
+	int n;
+	int i;
+
+	n = uv_threadpool_stats(stats, sizeof(stats) / sizeof(stats[0]));
+	for (i = 0; i < n; i++) {
+		printf("  worker %d : executed %u, stolen %u, max queued %u, avg wait %llu usec\n", i, stats[i].executed,
+			   stats[i].stolen, stats[i].max_queued,
+			   (unsigned long long)(stats[i].executed ? stats[i].total_latency / stats[i].executed / 1000 : 0));
+	}
+}
+#endif
+
+static int tp_bench_run(const char *steal, struct tp_bench_req_s *reqs, int nwork)
+{
+	uv_loop_t loop;
+	uint64_t start;
+	uint64_t elapsed;
+	int ret;
+	int i;
+
+	/* The pool reads UV_THREADPOOL_STEAL when it is started again */
+	uv_cleanup();
+	setenv("UV_THREADPOOL_STEAL", steal, 1);
+
+	memset(&g_io, 0, sizeof(g_io));
+	memset(&g_cpu, 0, sizeof(g_cpu));
+
+	if (uv_loop_init(&loop) != 0) {
+		printf("fail to init loop\n");
+		return -1;
+	}
+
+	start = tp_bench_usec();
+	for (i = 0; i < nwork; i++) {
+		reqs[i].submitted = tp_bench_usec();
+		if (i & 1) {
+			ret = uv_queue_work(&loop, &reqs[i].u.work, tp_bench_work_cb, tp_bench_after_work_cb);
+		} else {
+			ret = uv_fs_stat(&loop, &reqs[i].u.fs, TP_BENCH_PATH, tp_bench_fs_cb);
+		}
+		if (ret != 0) {
+			printf("fail to submit request %d : %d\n", i, ret);
+			break;
+		}
+	}
+
+	uv_run(&loop, UV_RUN_DEFAULT);
+	elapsed = tp_bench_usec() - start;
+	if (elapsed == 0) {
+		elapsed = 1;
+	}
+
+	printf("\n%s queue : %d requests in %llu usec, %llu requests/s\n", *steal == '1' ? "work stealing" : "shared", g_io.done + g_cpu.done,
+		   (unsigned long long)elapsed, (unsigned long long)(g_io.done + g_cpu.done) * 1000000 / elapsed);
+	tp_bench_report("io", &g_io);
+	tp_bench_report("cpu", &g_cpu);
+#ifdef CONFIG_LIBTUV_THREADPOOL_STATS
+	tp_bench_report_pool();
+#endif
+
+	uv_loop_close(&loop);
+
+	return i == nwork ? 0 : -1;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+int libtuv_threadpool_bench(int nwork)
+{
+	struct tp_bench_req_s *reqs;
+	int ret;
+
+	if (nwork <= 0) {
+		nwork = TP_BENCH_DEFAULT_NWORK;
+	}
+	if (nwork > TP_BENCH_MAX_NWORK) {
+		nwork = TP_BENCH_MAX_NWORK;
+	}
+
+	reqs = (struct tp_bench_req_s *)calloc(nwork, sizeof(struct tp_bench_req_s));
+	if (reqs == NULL) {
+		printf("fail to allocate %d requests\n", nwork);
+		return -1;
+	}
+
+	printf("libtuv threadpool : %d requests, half stat(\"%s\") and half %d round cpu work\n", nwork, TP_BENCH_PATH, TP_BENCH_SPIN);
+
+	ret = tp_bench_run("0", reqs, nwork);
+	if (ret == 0) {
+		ret = tp_bench_run("1", reqs, nwork);
+	}
+
+	uv_cleanup();
+	unsetenv("UV_THREADPOOL_STEAL");
+	free(reqs);
+
+	return ret;
+}
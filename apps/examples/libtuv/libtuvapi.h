@@ -35,3 +35,4 @@ void libtuv_loop_quit(void);
 int libtuv_add_timeout_callback(unsigned int msec, timeout_callback func, void *user_data);
 int libtuv_add_fd_watch(int fd, enum watch_io io, watch_callback func, void *user_data, int *watch_id);
 int libtuv_add_idle_callback(idle_callback func, void *user_data);
+int libtuv_threadpool_bench(int nwork);
@@ -63,6 +63,7 @@
 
 #define EXEC_NORMAL   0
 #define EXEC_INFINITE 1
+#define EXEC_PERF     2
 
 static volatile bool inf_flag;
 static volatile bool is_running;
@@ -132,13 +133,14 @@ int messaging_main(int argc, char *argv[])
 	int option;
 	char *cmd_arg = NULL;
 	char *cnt_arg = NULL;
+	char *perf_arg = NULL;
 	int execution_type = EXEC_NORMAL;
 
 	if (argc >= 4 || argc == 2) {
 		goto usage;
 	}
 
-	while ((option = getopt(argc, argv, "r:n:")) != ERROR) {
+	while ((option = getopt(argc, argv, "r:n:b:")) != ERROR) {
 		switch (option) {
 		case 'r':
 			execution_type = EXEC_INFINITE;
@@ -148,6 +150,10 @@ int messaging_main(int argc, char *argv[])
 			execution_type = EXEC_NORMAL;
 			cnt_arg = optarg;
 			break;
+		case 'b':
+			execution_type = EXEC_PERF;
+			perf_arg = optarg;
+			break;
 		case '?':
 		default:
 			goto usage;
@@ -172,6 +178,19 @@ int messaging_main(int argc, char *argv[])
 			goto usage;
 		}
 
+	} else if (execution_type == EXEC_PERF) {
+		if (is_running) {
+			goto already_running;
+		}
+
+		repetition_num = atoi(perf_arg);
+		if (repetition_num <= 0) {
+			goto usage;
+		}
+
+		is_running = true;
+		messaging_perf_sample(repetition_num);
+		is_running = false;
 	} else {
 		if (is_running) {
 			goto already_running;
@@ -196,6 +215,7 @@ usage:
 	printf(" -r start : Execute messaging sample infinitely until stop cmd.\n");
 	printf("    stop  : Stop the messaging sample infinite execution.\n");
 	printf(" -n COUNT : Execute messaging sample COUNT-iterations.\n");
+	printf(" -b COUNT : Measure messaging throughput and latency with COUNT messages per run.\n");
 	return -1;
 already_running:
 	printf("There is already running Messaging Sample.\n");
@@ -0,0 +1,260 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * apps/examples/messaging_sample/messaging_perf.c
+ *
+ * Throughput and latency of the messaging framework: unicast noreply
+ * messages, sync send/reply round trips and multicast messages, each with
+ * a small and a large message.
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <time.h>
+#include <semaphore.h>
+#include <sys/types.h>
+#include <messaging/messaging.h>
+#include "messaging_sample_internal.h"
+
+#define PERF_PORT "perf_port"
+
+#define MSG_PRIO 10
+#define TASK_PRIO 100
+#define STACKSIZE 2048
+
+#define PERF_SMALL_MSG 16
+#define PERF_LARGE_MSG 1024
+#define PERF_NRECEIVERS 3
+#define PERF_TIMEOUT_SEC 10
+
+/* Large messages pass through the message queue only by reference or if
+ * the message queue can hold them.
+ */
+#if defined(CONFIG_MESSAGING_SHARED_BUF) || (PERF_LARGE_MSG + 16 <= CONFIG_MQ_MAXMSGSIZE)
+#define PERF_HAVE_LARGE_MSG
+#endif
+
+extern int fail_cnt;
+
+static sem_t g_perf_ready;
+static sem_t g_perf_done;
+static sem_t g_perf_stop;
+static int g_perf_expected;
+static bool g_perf_reply;
+
+static uint64_t perf_usec(const struct timespec *from, const struct timespec *to)
+{
+	return (uint64_t)(to->tv_sec - from->tv_sec) * 1000000 + (to->tv_nsec - from->tv_nsec) / 1000;
+}
+
+static void perf_sem_wait(sem_t *sem)
+{
+	while (sem_wait(sem) != OK && errno == EINTR) {
+	}
+}
+
+static void perf_recv_callback(msg_reply_type_t msg_type, msg_recv_buf_t *recv_data, void *cb_data)
+{
+	int *count = (int *)cb_data;
+	msg_send_data_t reply;
+
+	if (g_perf_reply) {
+		reply.msg = recv_data->buf;
+		reply.msglen = PERF_SMALL_MSG;
+		reply.priority = MSG_PRIO;
+		(void)messaging_reply(PERF_PORT, recv_data->sender_pid, &reply);
+	}
+
+	if (++(*count) == g_perf_expected) {
+		sem_post(&g_perf_done);
+	}
+}
+
+static int perf_receiver(int argc, FAR char *argv[])
+{
+	int ret = ERROR;
+	int count = 0;
+	msg_recv_buf_t recv_buf;
+	msg_callback_info_t cb_info;
+
+	recv_buf.buflen = atoi(argv[1]);
+	recv_buf.buf = (char *)malloc(recv_buf.buflen);
+	if (recv_buf.buf != NULL) {
+		cb_info.cb_func = perf_recv_callback;
+		cb_info.cb_data = &count;
+		ret = messaging_recv_nonblock(PERF_PORT, &recv_buf, &cb_info);
+	}
+
+	if (ret != OK) {
+		printf("Fail to receive with non-block mode.\n");
+	}
+	sem_post(&g_perf_ready);
+
+	/* Messages are received in the callback until the sender is done. */
+	perf_sem_wait(&g_perf_stop);
+
+	if (ret == OK) {
+		messaging_cleanup(PERF_PORT);
+	}
+	free(recv_buf.buf);
+	sem_post(&g_perf_ready);
+	return ret;
+}
+
+static void perf_run(const char *name, int msglen, int nreceivers, bool sync, int count)
+{
+	int idx;
+	int nerrors = 0;
+	int ndone = 0;
+	int ret;
+	char size_arg[12];
+	char *recv_argv[2];
+	char *send_buf;
+	char reply_msg[PERF_SMALL_MSG];
+	uint64_t elapsed;
+	uint64_t latency = 0;
+	struct timespec start;
+	struct timespec end;
+	struct timespec before;
+	struct timespec deadline;
+	msg_send_data_t send_data;
+	msg_recv_buf_t reply_buf;
+
+	send_buf = (char *)malloc(msglen);
+	if (send_buf == NULL) {
+		fail_cnt++;
+		printf("Fail to allocate the perf message.\n");
+		return;
+	}
+	memset(send_buf, 'M', msglen);
+
+	g_perf_expected = count;
+	g_perf_reply = sync;
+
+	snprintf(size_arg, sizeof(size_arg), "%d", msglen);
+	recv_argv[0] = size_arg;
+	recv_argv[1] = NULL;
+
+	for (idx = 0; idx < nreceivers; idx++) {
+		if (task_create("perf_recv", TASK_PRIO, STACKSIZE, perf_receiver, recv_argv) < 0) {
+			fail_cnt++;
+			printf("Fail to create perf receiver task.\n");
+			nreceivers = idx;
+			break;
+		}
+	}
+
+	for (idx = 0; idx < nreceivers; idx++) {
+		perf_sem_wait(&g_perf_ready);
+	}
+
+	send_data.msg = send_buf;
+	send_data.msglen = msglen;
+	send_data.priority = MSG_PRIO;
+	reply_buf.buf = reply_msg;
+	reply_buf.buflen = PERF_SMALL_MSG;
+
+	clock_gettime(CLOCK_REALTIME, &start);
+
+	for (idx = 0; idx < count; idx++) {
+		if (sync) {
+			clock_gettime(CLOCK_REALTIME, &before);
+			ret = messaging_send_sync(PERF_PORT, &send_data, &reply_buf);
+			clock_gettime(CLOCK_REALTIME, &end);
+			latency += perf_usec(&before, &end);
+		} else if (nreceivers > 1) {
+			ret = messaging_multicast(PERF_PORT, &send_data);
+		} else {
+			ret = messaging_send(PERF_PORT, &send_data);
+		}
+
+		if (ret < 0) {
+			nerrors++;
+		}
+	}
+
+	/* Wait until every receiver got every message. */
+	clock_gettime(CLOCK_REALTIME, &deadline);
+	deadline.tv_sec += PERF_TIMEOUT_SEC;
+	while (ndone < nreceivers) {
+		if (sem_timedwait(&g_perf_done, &deadline) == OK) {
+			ndone++;
+		} else if (errno != EINTR) {
+			break;
+		}
+	}
+
+	clock_gettime(CLOCK_REALTIME, &end);
+	elapsed = perf_usec(&start, &end);
+	if (elapsed == 0) {
+		elapsed = 1;
+	}
+
+	printf("%-10s %5d bytes x %d receivers : %7llu msgs/s, %7llu KB/s", name, msglen, nreceivers, (unsigned long long)count * nreceivers * 1000000 / elapsed, (unsigned long long)count * nreceivers * msglen * 1000000 / 1024 / elapsed);
+	if (sync) {
+		printf(", avg round trip %llu usec", (unsigned long long)(latency / count));
+	}
+	printf(", %d errors%s\n", nerrors, ndone < nreceivers ? ", messages lost" : "");
+
+	if (nerrors > 0 || ndone < nreceivers) {
+		fail_cnt++;
+	}
+
+	for (idx = 0; idx < nreceivers; idx++) {
+		sem_post(&g_perf_stop);
+	}
+	for (idx = 0; idx < nreceivers; idx++) {
+		perf_sem_wait(&g_perf_ready);
+	}
+
+	/* Drop completions posted by receivers which finished after the timeout. */
+	while (sem_trywait(&g_perf_done) == OK) {
+	}
+
+	free(send_buf);
+}
+
+void messaging_perf_sample(int count)
+{
+	printf("\n--- Messaging performance : %d messages per run. ---\n", count);
+
+	sem_init(&g_perf_ready, 0, 0);
+	sem_init(&g_perf_done, 0, 0);
+	sem_init(&g_perf_stop, 0, 0);
+
+	perf_run("unicast", PERF_SMALL_MSG, 1, false, count);
+	perf_run("sync", PERF_SMALL_MSG, 1, true, count);
+	perf_run("multicast", PERF_SMALL_MSG, PERF_NRECEIVERS, false, count);
+#ifdef PERF_HAVE_LARGE_MSG
+	perf_run("unicast", PERF_LARGE_MSG, 1, false, count);
+	perf_run("sync", PERF_LARGE_MSG, 1, true, count);
+	perf_run("multicast", PERF_LARGE_MSG, PERF_NRECEIVERS, false, count);
+#endif
+
+	sem_destroy(&g_perf_ready);
+	sem_destroy(&g_perf_done);
+	sem_destroy(&g_perf_stop);
+}
@@ -21,5 +21,6 @@
 void noreply_nonblock_messaging_sample(void);
 void sync_block_messaging_sample(void);
 void multicast_messaging_sample(void);
+void messaging_perf_sample(int count);
 
 #endif
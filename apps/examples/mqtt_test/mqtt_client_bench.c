@@ -0,0 +1,260 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/**
+ * @file mqtt_client_bench.c
+ * @brief the program for measuring the mqtt publish throughput
+ */
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <semaphore.h>
+#include <time.h>
+#include <errno.h>
+#include <tinyara/clock.h>
+
+#include <network/mqtt/mqtt_api.h>
+
+/****************************************************************************
+ * Definitions
+ ****************************************************************************/
+#define MQTT_CLIENT_BENCH_COMMAND_NAME	"mqtt_bench"
+#define MQTT_BENCH_TOPIC				"tizenrt/bench"
+#define MQTT_BENCH_PORT					1883
+#define MQTT_BENCH_KEEPALIVE			60
+#define MQTT_BENCH_WAIT_SEC				30
+
+#define MQTT_BENCH_DEFAULT_COUNT		1000
+#define MQTT_BENCH_DEFAULT_SIZE			32
+#define MQTT_BENCH_MAX_BATCH			64
+
+/****************************************************************************
+ * External Function Prototype
+ ****************************************************************************/
+extern char *mqtt_generate_client_id(const char *id_base);
+
+/****************************************************************************
+ * Global Valiables
+ ****************************************************************************/
+static sem_t g_mqtt_bench_conn_sem;
+static sem_t g_mqtt_bench_done_sem;
+static volatile int g_mqtt_bench_published;
+static int g_mqtt_bench_count;
+
+/****************************************************************************
+ * Static Functions
+ ****************************************************************************/
+static void bench_connect_callback(void *client, int result)
+{
+	if (result != MQTT_CONN_ACCEPTED) {
+		fprintf(stderr, "Error: connection refused. (result: %d)\n", result);
+	}
+	sem_post(&g_mqtt_bench_conn_sem);
+}
+
+static void bench_publish_callback(void *client, int msg_id)
+{
+	if (++g_mqtt_bench_published == g_mqtt_bench_count) {
+		sem_post(&g_mqtt_bench_done_sem);
+	}
+}
+
+static int bench_wait(sem_t *sem)
+{
+	struct timespec abstime;
+
+	(void)clock_gettime(CLOCK_REALTIME, &abstime);
+	abstime.tv_sec += MQTT_BENCH_WAIT_SEC;
+	while (sem_timedwait(sem, &abstime) != 0) {
+		if (get_errno() == ETIMEDOUT) {
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static int bench_heap_used(void)
+{
+	struct mallinfo info;
+
+#ifdef CONFIG_CAN_PASS_STRUCTS
+	info = mallinfo();
+#else
+	(void)mallinfo(&info);
+#endif
+	return info.uordblks;
+}
+
+static void print_usage(void)
+{
+	printf("Usage: %s <host> [count] [size] [qos] [batch]\n", MQTT_CLIENT_BENCH_COMMAND_NAME);
+	printf("  Publish <count> messages of <size> bytes on \"%s\" and report the throughput.\n", MQTT_BENCH_TOPIC);
+	printf("  <batch> messages are given to mqtt_publish_batch() at once, 1 uses mqtt_publish().\n");
+	printf("  Defaults: count %d, size %d, qos 0, batch 1 (max %d)\n", MQTT_BENCH_DEFAULT_COUNT, MQTT_BENCH_DEFAULT_SIZE, MQTT_BENCH_MAX_BATCH);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, char *argv[])
+#else
+int mqtt_client_bench_main(int argc, char *argv[])
+#endif
+{
+	int result = -1;
+	int count = MQTT_BENCH_DEFAULT_COUNT;
+	int size = MQTT_BENCH_DEFAULT_SIZE;
+	int qos = 0;
+	int batch = 1;
+	int sent;
+	int n;
+	int i;
+	char *payload = NULL;
+	mqtt_msg_t *msgs = NULL;
+	mqtt_client_t *handle = NULL;
+	mqtt_client_config_t config;
+	struct timespec start;
+	struct timespec end;
+	int heap_before;
+	int heap_after;
+	uint32_t elapsed_ms;
+
+	if (argc < 2) {
+		print_usage();
+		return 0;
+	}
+	if (argc > 2) {
+		count = atoi(argv[2]);
+	}
+	if (argc > 3) {
+		size = atoi(argv[3]);
+	}
+	if (argc > 4) {
+		qos = atoi(argv[4]);
+	}
+	if (argc > 5) {
+		batch = atoi(argv[5]);
+	}
+	if (count <= 0 || size < 0 || qos < 0 || qos > 2 || batch <= 0 || batch > MQTT_BENCH_MAX_BATCH) {
+		print_usage();
+		return -1;
+	}
+
+	memset(&config, 0, sizeof(config));
+	sem_init(&g_mqtt_bench_conn_sem, 0, 0);
+	sem_init(&g_mqtt_bench_done_sem, 0, 0);
+	sem_setprotocol(&g_mqtt_bench_conn_sem, SEM_PRIO_NONE);
+	sem_setprotocol(&g_mqtt_bench_done_sem, SEM_PRIO_NONE);
+	g_mqtt_bench_published = 0;
+	g_mqtt_bench_count = count;
+
+	payload = (char *)malloc(size + 1);
+	msgs = (mqtt_msg_t *)malloc(sizeof(mqtt_msg_t) * batch);
+	if (payload == NULL || msgs == NULL) {
+		fprintf(stderr, "Error: out of memory.\n");
+		goto done;
+	}
+	memset(payload, 'x', size);
+	payload[size] = '\0';
+
+	config.client_id = mqtt_generate_client_id(MQTT_CLIENT_BENCH_COMMAND_NAME);
+	config.protocol_version = MQTT_PROTOCOL_VERSION_311;
+	config.clean_session = true;
+	config.on_connect = bench_connect_callback;
+	config.on_publish = bench_publish_callback;
+
+	handle = mqtt_init_client(&config);
+	if (handle == NULL) {
+		fprintf(stderr, "Error: mqtt_init_client() failed.\n");
+		goto done;
+	}
+
+	if (mqtt_connect(handle, argv[1], MQTT_BENCH_PORT, MQTT_BENCH_KEEPALIVE) != 0 || bench_wait(&g_mqtt_bench_conn_sem) != 0 || handle->state != MQTT_CLIENT_STATE_CONNECTED) {
+		fprintf(stderr, "Error: fail to connect to %s.\n", argv[1]);
+		goto done;
+	}
+
+	heap_before = bench_heap_used();
+	(void)clock_gettime(CLOCK_REALTIME, &start);
+
+	for (sent = 0; sent < count; sent += n) {
+		n = count - sent < batch ? count - sent : batch;
+		if (batch == 1) {
+			if (mqtt_publish(handle, MQTT_BENCH_TOPIC, payload, size, qos, 0) != 0) {
+				fprintf(stderr, "Error: mqtt_publish() failed after %d messages.\n", sent);
+				goto done;
+			}
+			continue;
+		}
+
+		for (i = 0; i < n; i++) {
+			msgs[i].topic = MQTT_BENCH_TOPIC;
+			msgs[i].payload = payload;
+			msgs[i].payload_len = size;
+			msgs[i].qos = qos;
+			msgs[i].retain = 0;
+		}
+		if (mqtt_publish_batch(handle, msgs, n) != 0) {
+			fprintf(stderr, "Error: mqtt_publish_batch() failed after %d messages.\n", sent);
+			goto done;
+		}
+	}
+
+	if (bench_wait(&g_mqtt_bench_done_sem) != 0) {
+		fprintf(stderr, "Error: only %d of %d messages completed.\n", g_mqtt_bench_published, count);
+		goto done;
+	}
+
+	(void)clock_gettime(CLOCK_REALTIME, &end);
+	heap_after = bench_heap_used();
+
+	elapsed_ms = (end.tv_sec - start.tv_sec) * MSEC_PER_SEC + (end.tv_nsec - start.tv_nsec) / NSEC_PER_MSEC;
+	if (elapsed_ms == 0) {
+		elapsed_ms = 1;
+	}
+	printf("%d messages of %d bytes, qos %d, batch %d\n", count, size, qos, batch);
+	printf("  time       : %u ms\n", elapsed_ms);
+	printf("  throughput : %u msgs/s, %u bytes/s\n", (uint32_t)((uint64_t)count * MSEC_PER_SEC / elapsed_ms), (uint32_t)((uint64_t)count * size * MSEC_PER_SEC / elapsed_ms));
+	printf("  heap used  : %d bytes before, %d bytes after\n", heap_before, heap_after);
+
+	/* result is success */
+	result = 0;
+
+done:
+	if (handle) {
+		if (handle->state == MQTT_CLIENT_STATE_CONNECTED) {
+			mqtt_disconnect(handle);
+		}
+		mqtt_deinit_client(handle);
+	}
+	if (config.client_id) {
+		free(config.client_id);
+	}
+	free(msgs);
+	free(payload);
+	sem_destroy(&g_mqtt_bench_conn_sem);
+	sem_destroy(&g_mqtt_bench_done_sem);
+
+	return result;
+}
@@ -0,0 +1,253 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file aio_performance_main.c
+
+#include <tinyara/config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <errno.h>
+#include <time.h>
+#include <aio.h>
+
+#define BLOCKSIZE	CONFIG_EXAMPLES_AIO_PERFORMANCE_BLOCKSIZE
+#define NREQUESTS	CONFIG_EXAMPLES_AIO_PERFORMANCE_NREQUESTS
+#define DEPTH		CONFIG_EXAMPLES_AIO_PERFORMANCE_DEPTH
+
+struct aio_perf_slot_s {
+	struct aiocb cb;
+	struct timespec start;
+	char buf[BLOCKSIZE];
+};
+
+static struct aio_perf_slot_s g_slots[DEPTH];
+
+/*
+ * @fn                   :aio_perf_usec
+ * @description          :Microseconds between two time stamps
+ * @return               :uint64_t
+ */
+static uint64_t aio_perf_usec(FAR const struct timespec *from, FAR const struct timespec *to)
+{
+	return (uint64_t)(to->tv_sec - from->tv_sec) * 1000000 + (to->tv_nsec - from->tv_nsec) / 1000;
+}
+
+/*
+ * @fn                   :aio_perf_prepare
+ * @description          :Set up the request of one slot
+ * @return               :void
+ */
+static void aio_perf_prepare(int fd, int slot, int seq, int opcode)
+{
+	FAR struct aio_perf_slot_s *s = &g_slots[slot];
+
+	memset(&s->cb, 0, sizeof(struct aiocb));
+	s->cb.aio_fildes = fd;
+	s->cb.aio_buf = s->buf;
+	s->cb.aio_nbytes = BLOCKSIZE;
+	s->cb.aio_offset = (off_t)(seq % NREQUESTS) * BLOCKSIZE;
+	s->cb.aio_lio_opcode = opcode;
+	s->cb.aio_sigevent.sigev_notify = SIGEV_NONE;
+	clock_gettime(CLOCK_REALTIME, &s->start);
+}
+
+/*
+ * @fn                   :aio_perf_report
+ * @description          :Print IOPS and average latency of one run
+ * @return               :void
+ */
+static void aio_perf_report(FAR const char *name, FAR const struct timespec *start, uint64_t latency, int nerrors)
+{
+	struct timespec end;
+	uint64_t elapsed;
+
+	clock_gettime(CLOCK_REALTIME, &end);
+	elapsed = aio_perf_usec(start, &end);
+	if (elapsed == 0) {
+		elapsed = 1;
+	}
+
+	printf("%-12s %5d requests in %8llu usec : %6llu IOPS, avg latency %6llu usec, %d errors\n", name, NREQUESTS, (unsigned long long)elapsed, (unsigned long long)NREQUESTS * 1000000 / elapsed, (unsigned long long)(latency / NREQUESTS), nerrors);
+}
+
+/*
+ * @fn                   :aio_perf_legacy
+ * @description          :Run NREQUESTS requests with aio_read()/aio_write()
+ * @return               :void
+ */
+static void aio_perf_legacy(int fd, int opcode)
+{
+	FAR const struct aiocb *list[DEPTH];
+	struct timespec start;
+	struct timespec now;
+	uint64_t latency = 0;
+	int submitted = 0;
+	int completed = 0;
+	int nerrors = 0;
+	int i;
+
+	clock_gettime(CLOCK_REALTIME, &start);
+
+	for (i = 0; i < DEPTH && submitted < NREQUESTS; i++) {
+		aio_perf_prepare(fd, i, submitted++, opcode);
+		if ((opcode == LIO_READ ? aio_read(&g_slots[i].cb) : aio_write(&g_slots[i].cb)) < 0) {
+			nerrors++;
+		}
+
+		list[i] = &g_slots[i].cb;
+	}
+
+	while (completed < submitted) {
+		(void)aio_suspend(list, DEPTH, NULL);
+
+		for (i = 0; i < DEPTH; i++) {
+			if (list[i] == NULL || aio_error(list[i]) == EINPROGRESS) {
+				continue;
+			}
+
+			clock_gettime(CLOCK_REALTIME, &now);
+			latency += aio_perf_usec(&g_slots[i].start, &now);
+			if (aio_return(&g_slots[i].cb) != BLOCKSIZE) {
+				nerrors++;
+			}
+
+			completed++;
+			list[i] = NULL;
+
+			if (submitted < NREQUESTS) {
+				aio_perf_prepare(fd, i, submitted++, opcode);
+				if ((opcode == LIO_READ ? aio_read(&g_slots[i].cb) : aio_write(&g_slots[i].cb)) < 0) {
+					nerrors++;
+				}
+
+				list[i] = &g_slots[i].cb;
+			}
+		}
+	}
+
+	aio_perf_report(opcode == LIO_READ ? "aio_read" : "aio_write", &start, latency, nerrors);
+}
+
+/*
+ * @fn                   :aio_perf_cq
+ * @description          :Run NREQUESTS requests through a completion queue
+ * @return               :void
+ */
+static void aio_perf_cq(int fd, int opcode)
+{
+	FAR struct aiocb *list[DEPTH];
+	struct aio_cqe cqes[DEPTH];
+	struct timespec start;
+	struct timespec now;
+	uint64_t latency = 0;
+	aio_cq_t cq;
+	int submitted = 0;
+	int completed = 0;
+	int nerrors = 0;
+	int nfree;
+	int n;
+	int i;
+
+	if (aio_cq_create(DEPTH, 0, &cq) < 0) {
+		printf("aio_cq_create failed: %d\n", errno);
+		return;
+	}
+
+	clock_gettime(CLOCK_REALTIME, &start);
+
+	/* Slots 0..nfree-1 of list[] hold the free control blocks */
+
+	for (i = 0; i < DEPTH; i++) {
+		list[i] = &g_slots[i].cb;
+	}
+
+	nfree = DEPTH;
+
+	while (completed < NREQUESTS) {
+		/* Submit every free slot in one batch */
+
+		for (n = 0; n < nfree && submitted + n < NREQUESTS; n++) {
+			aio_perf_prepare(fd, (FAR struct aio_perf_slot_s *)list[n] - g_slots, submitted + n, opcode);
+		}
+
+		if (n > 0) {
+			n = aio_cq_submit(cq, list, n);
+			if (n < 0) {
+				nerrors++;
+				break;
+			}
+
+			submitted += n;
+			nfree -= n;
+			memmove(list, &list[n], nfree * sizeof(FAR struct aiocb *));
+		}
+
+		n = aio_cq_reap(cq, cqes, 1, DEPTH, NULL);
+		clock_gettime(CLOCK_REALTIME, &now);
+
+		for (i = 0; i < n; i++) {
+			latency += aio_perf_usec(&((FAR struct aio_perf_slot_s *)cqes[i].aiocbp)->start, &now);
+			if (cqes[i].result != BLOCKSIZE) {
+				nerrors++;
+			}
+
+			list[nfree++] = cqes[i].aiocbp;
+		}
+
+		completed += n;
+	}
+
+	aio_perf_report(opcode == LIO_READ ? "aio_cq read" : "aio_cq write", &start, latency, nerrors);
+	(void)aio_cq_destroy(cq);
+}
+
+/****************************************************************************
+ * Name: AIO Performance
+ ****************************************************************************/
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int aio_performance_main(int argc, char *argv[])
+#endif
+{
+	int fd;
+
+	fd = open(CONFIG_EXAMPLES_AIO_PERFORMANCE_PATH, O_RDWR | O_CREAT | O_TRUNC, 0666);
+	if (fd < 0) {
+		printf("Failed to open %s: %d\n", CONFIG_EXAMPLES_AIO_PERFORMANCE_PATH, errno);
+		return ERROR;
+	}
+
+	printf("AIO performance: %d requests of %d bytes, %d in flight\n", NREQUESTS, BLOCKSIZE, DEPTH);
+
+	/* Write first so that the reads find data */
+
+	aio_perf_legacy(fd, LIO_WRITE);
+	aio_perf_cq(fd, LIO_WRITE);
+	aio_perf_legacy(fd, LIO_READ);
+	aio_perf_cq(fd, LIO_READ);
+
+	close(fd);
+	unlink(CONFIG_EXAMPLES_AIO_PERFORMANCE_PATH);
+	return OK;
+}
@@ -0,0 +1,169 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file chksum_performance_main.c
+
+#include <tinyara/config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <lwip/def.h>
+#include <lwip/inet_chksum.h>
+
+#define NLOOPS		CONFIG_EXAMPLES_CHKSUM_PERFORMANCE_NLOOPS
+#define MAXSIZE		1500
+
+static const int g_sizes[] = { 64, 128, 256, 512, 1024, 1500 };
+
+static uint8_t g_src[MAXSIZE + 4];
+static uint8_t g_dst[MAXSIZE + 4];
+
+/*
+ * @fn                   :chksum_usec
+ * @description          :Microseconds between two time stamps
+ * @return               :uint64_t
+ */
+static uint64_t chksum_usec(FAR const struct timespec *from, FAR const struct timespec *to)
+{
+	return (uint64_t)(to->tv_sec - from->tv_sec) * 1000000 + (to->tv_nsec - from->tv_nsec) / 1000;
+}
+
+/*
+ * @fn                   :chksum_reference
+ * @description          :RFC 1071 checksum one network order word at a time
+ * @return               :uint16_t, in network order like inet_chksum()
+ */
+static uint16_t chksum_reference(FAR const uint8_t *data, int len)
+{
+	uint32_t acc = 0;
+
+	while (len > 1) {
+		acc += ((uint32_t)data[0] << 8) | data[1];
+		data += 2;
+		len -= 2;
+	}
+
+	if (len > 0) {
+		acc += (uint32_t)data[0] << 8;
+	}
+
+	while (acc >> 16) {
+		acc = (acc >> 16) + (acc & 0xffff);
+	}
+
+	return lwip_htons((uint16_t)~acc);
+}
+
+/*
+ * @fn                   :chksum_report
+ * @description          :Print the throughput of one run
+ * @return               :void
+ */
+static void chksum_report(FAR const char *name, int size, FAR const struct timespec *start, int nerrors)
+{
+	struct timespec end;
+	uint64_t elapsed;
+
+	clock_gettime(CLOCK_REALTIME, &end);
+	elapsed = chksum_usec(start, &end);
+	if (elapsed == 0) {
+		elapsed = 1;
+	}
+
+	printf("%-10s %4d bytes : %8llu usec, %6llu KB/s, %d errors\n", name, size, (unsigned long long)elapsed, (unsigned long long)size * NLOOPS * 1000000 / 1024 / elapsed, nerrors);
+}
+
+/*
+ * @fn                   :chksum_run
+ * @description          :Checksum NLOOPS packets of one size with each method
+ * @return               :void
+ */
+static void chksum_run(int size)
+{
+	struct timespec start;
+	uint16_t expected;
+	int nerrors;
+	int i;
+
+	expected = chksum_reference(g_src, size);
+
+	nerrors = 0;
+	clock_gettime(CLOCK_REALTIME, &start);
+	for (i = 0; i < NLOOPS; i++) {
+		if (chksum_reference(g_src, size) != expected) {
+			nerrors++;
+		}
+	}
+	chksum_report("reference", size, &start, nerrors);
+
+	nerrors = 0;
+	clock_gettime(CLOCK_REALTIME, &start);
+	for (i = 0; i < NLOOPS; i++) {
+		if (inet_chksum(g_src, size) != expected) {
+			nerrors++;
+		}
+	}
+	chksum_report("chksum", size, &start, nerrors);
+
+	nerrors = 0;
+	clock_gettime(CLOCK_REALTIME, &start);
+	for (i = 0; i < NLOOPS; i++) {
+		memcpy(g_dst, g_src, size);
+		if (inet_chksum(g_dst, size) != expected) {
+			nerrors++;
+		}
+	}
+	chksum_report("copy+sum", size, &start, nerrors);
+
+#if LWIP_CHKSUM_COPY_ALGORITHM
+	nerrors = 0;
+	clock_gettime(CLOCK_REALTIME, &start);
+	for (i = 0; i < NLOOPS; i++) {
+		if ((uint16_t)~LWIP_CHKSUM_COPY(g_dst, g_src, size) != expected || memcmp(g_dst, g_src, size) != 0) {
+			nerrors++;
+		}
+	}
+	chksum_report("chksum_cp", size, &start, nerrors);
+#endif
+}
+
+/****************************************************************************
+ * Name: Checksum Performance
+ ****************************************************************************/
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int chksum_performance_main(int argc, char *argv[])
+#endif
+{
+	int i;
+
+	for (i = 0; i < sizeof(g_src); i++) {
+		g_src[i] = (uint8_t)rand();
+	}
+
+	printf("Checksum performance: %d packets per size\n", NLOOPS);
+
+	for (i = 0; i < sizeof(g_sizes) / sizeof(g_sizes[0]); i++) {
+		chksum_run(g_sizes[i]);
+	}
+
+	return OK;
+}
@@ -0,0 +1,294 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file gran_performance_main.c
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <tinyara/mm/gran.h>
+
+#define NGRANULES	CONFIG_EXAMPLES_GRAN_PERFORMANCE_NGRANULES
+#define LOG2GRAN	CONFIG_EXAMPLES_GRAN_PERFORMANCE_LOG2GRAN
+#define NOPS		CONFIG_EXAMPLES_GRAN_PERFORMANCE_NOPS
+#define MAXRUN		32			/* Largest allocation of the granule allocator */
+
+struct gran_block_s {
+	FAR void *mem;
+	int ngranules;
+};
+
+struct gran_perf_s {
+	GRAN_HANDLE handle;
+	FAR char *heap;
+	FAR uint8_t *shadow;		/* 1 for each allocated granule */
+	FAR struct gran_block_s *live;
+	int nlive;
+	int nused;					/* Number of allocated granules */
+	int nerrors;
+};
+
+static const int g_levels[] = { 25, 50, 75, 90, 98 };
+
+/*
+ * @fn                   :gran_usec
+ * @description          :Microseconds between two time stamps
+ * @return               :uint64_t
+ */
+static uint64_t gran_usec(FAR const struct timespec *from, FAR const struct timespec *to)
+{
+	return (uint64_t)(to->tv_sec - from->tv_sec) * 1000000 + (to->tv_nsec - from->tv_nsec) / 1000;
+}
+
+/*
+ * @fn                   :gran_random_run
+ * @description          :Number of granules of an allocation, mostly small
+ * @return               :int, 1 to MAXRUN
+ */
+static int gran_random_run(void)
+{
+	if (rand() % 4 != 0) {
+		return 1 + rand() % 4;
+	}
+
+	return 1 + rand() % MAXRUN;
+}
+
+/*
+ * @fn                   :gran_first_fit
+ * @description          :Lowest run of n free granules in the shadow map
+ * @return               :int, granule index or -1
+ */
+static int gran_first_fit(FAR struct gran_perf_s *perf, int n)
+{
+	int run = 0;
+	int i;
+
+	for (i = 0; i < NGRANULES; i++) {
+		run = perf->shadow[i] ? 0 : run + 1;
+		if (run == n) {
+			return i - n + 1;
+		}
+	}
+
+	return -1;
+}
+
+/*
+ * @fn                   :gran_record_alloc
+ * @description          :Record an allocation, checking it against the shadow map first if check is set
+ * @return               :void
+ */
+static void gran_record_alloc(FAR struct gran_perf_s *perf, FAR void *mem, int n, bool check)
+{
+	int expected;
+	int granno;
+
+	if (!check) {
+		if (mem != NULL) {
+			granno = ((FAR char *)mem - perf->heap) >> LOG2GRAN;
+			memset(&perf->shadow[granno], 1, n);
+			perf->live[perf->nlive].mem = mem;
+			perf->live[perf->nlive].ngranules = n;
+			perf->nlive++;
+			perf->nused += n;
+		}
+		return;
+	}
+
+	expected = gran_first_fit(perf, n);
+	if (mem == NULL) {
+		if (expected >= 0) {
+			printf("gran_alloc %d granules failed, free run at %d\n", n, expected);
+			perf->nerrors++;
+		}
+		return;
+	}
+
+	granno = ((FAR char *)mem - perf->heap) >> LOG2GRAN;
+	if (granno != expected || ((FAR char *)mem - perf->heap) != (granno << LOG2GRAN)) {
+		printf("gran_alloc %d granules at %p (granule %d), first fit is %d\n", n, mem, granno, expected);
+		perf->nerrors++;
+		if (granno < 0 || granno + n > NGRANULES) {
+			return;
+		}
+	}
+
+	memset(&perf->shadow[granno], 1, n);
+	perf->live[perf->nlive].mem = mem;
+	perf->live[perf->nlive].ngranules = n;
+	perf->nlive++;
+	perf->nused += n;
+}
+
+/*
+ * @fn                   :gran_release_block
+ * @description          :Forget block i of the live list after it was freed
+ * @return               :void
+ */
+static void gran_release_block(FAR struct gran_perf_s *perf, int i)
+{
+	FAR struct gran_block_s *block = &perf->live[i];
+
+	memset(&perf->shadow[((FAR char *)block->mem - perf->heap) >> LOG2GRAN], 0, block->ngranules);
+	perf->nused -= block->ngranules;
+	*block = perf->live[--perf->nlive];
+}
+
+/*
+ * @fn                   :gran_free_all
+ * @description          :Free every live block
+ * @return               :void
+ */
+static void gran_free_all(FAR struct gran_perf_s *perf)
+{
+	while (perf->nlive > 0) {
+		gran_free(perf->handle, perf->live[0].mem, perf->live[0].ngranules << LOG2GRAN);
+		gran_release_block(perf, 0);
+	}
+}
+
+/*
+ * @fn                   :gran_step
+ * @description          :Free a random block if the heap is at the target, else allocate a random run
+ * @return               :bool, false if an allocation failed
+ */
+static bool gran_step(FAR struct gran_perf_s *perf, int target, bool check)
+{
+	FAR void *mem;
+	int n;
+	int i;
+
+	if (perf->nused >= target && perf->nlive > 0) {
+		i = rand() % perf->nlive;
+		gran_free(perf->handle, perf->live[i].mem, perf->live[i].ngranules << LOG2GRAN);
+		gran_release_block(perf, i);
+		return true;
+	}
+
+	n = gran_random_run();
+	mem = gran_alloc(perf->handle, n << LOG2GRAN);
+	gran_record_alloc(perf, mem, n, check);
+	return mem != NULL;
+}
+
+/*
+ * @fn                   :gran_run_level
+ * @description          :Fill the heap to level percent and run alloc/free operations there
+ * @return               :void
+ */
+static void gran_run_level(FAR struct gran_perf_s *perf, int level)
+{
+	struct timespec start;
+	struct timespec end;
+	uint64_t elapsed;
+	int target = NGRANULES * level / 100;
+	int nfailed = 0;
+	int i;
+
+	gran_free_all(perf);
+
+	/* Fill the heap up to the level, leaving holes by freeing one block in
+	 * four on the way.
+	 */
+
+	while (perf->nused < target) {
+		gran_step(perf, target, true);
+		if (perf->nlive > 1 && rand() % 4 == 0) {
+			i = rand() % perf->nlive;
+			gran_free(perf->handle, perf->live[i].mem, perf->live[i].ngranules << LOG2GRAN);
+			gran_release_block(perf, i);
+		}
+	}
+
+	/* Check every allocation of a first series of operations, then time a
+	 * second one where only the bookkeeping of the blocks is done.
+	 */
+
+	for (i = 0; i < NOPS / 4; i++) {
+		gran_step(perf, target, true);
+	}
+
+	clock_gettime(CLOCK_REALTIME, &start);
+	for (i = 0; i < NOPS; i++) {
+		if (!gran_step(perf, target, false)) {
+			nfailed++;
+		}
+	}
+	clock_gettime(CLOCK_REALTIME, &end);
+
+	elapsed = gran_usec(&start, &end);
+	printf("%3d%% : %8llu usec, %6llu nsec per operation, %5d allocations failed\n", level,
+		   (unsigned long long)elapsed, (unsigned long long)(elapsed * 1000 / NOPS), nfailed);
+}
+
+/****************************************************************************
+ * Name: Granule Allocator Performance
+ ****************************************************************************/
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int gran_performance_main(int argc, char *argv[])
+#endif
+{
+	struct gran_perf_s perf;
+	int i;
+
+	memset(&perf, 0, sizeof(perf));
+	perf.heap = (FAR char *)malloc(NGRANULES << LOG2GRAN);
+	perf.shadow = (FAR uint8_t *)zalloc(NGRANULES);
+	perf.live = (FAR struct gran_block_s *)malloc(NGRANULES * sizeof(struct gran_block_s));
+	if (perf.heap == NULL || perf.shadow == NULL || perf.live == NULL) {
+		printf("Failed to allocate the test heap\n");
+		goto errout;
+	}
+
+	perf.handle = gran_initialize(perf.heap, NGRANULES << LOG2GRAN, LOG2GRAN, 0);
+	if (perf.handle == NULL) {
+		printf("gran_initialize failed\n");
+		goto errout;
+	}
+
+	printf("Granule allocator performance: %d granules of %d bytes, %d operations per level\n", NGRANULES, 1 << LOG2GRAN, NOPS);
+
+	srand(1);
+	for (i = 0; i < sizeof(g_levels) / sizeof(g_levels[0]); i++) {
+		gran_run_level(&perf, g_levels[i]);
+	}
+
+	gran_free_all(&perf);
+	gran_release(perf.handle);
+
+	printf("Granule allocator: %d errors\n", perf.nerrors);
+
+	free(perf.live);
+	free(perf.shadow);
+	free(perf.heap);
+	return perf.nerrors == 0 ? OK : ERROR;
+
+errout:
+	free(perf.live);
+	free(perf.shadow);
+	free(perf.heap);
+	return ERROR;
+}
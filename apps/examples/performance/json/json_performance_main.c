@@ -0,0 +1,304 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file json_performance_main.c
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <json/cJSON.h>
+
+#define NLOOPS		CONFIG_EXAMPLES_JSON_PERFORMANCE_NLOOPS
+
+struct json_perf_s {
+	FAR char *text;				/* The file */
+	FAR char *work;				/* Copy of the file parsed in place */
+	size_t length;
+	FAR void *arena;
+	size_t arena_size;
+	FAR const char *path;
+};
+
+static size_t g_nallocs;
+static size_t g_nbytes;
+
+/*
+ * @fn                   :json_usec
+ * @description          :Microseconds between two time stamps
+ * @return               :uint64_t
+ */
+static uint64_t json_usec(FAR const struct timespec *from, FAR const struct timespec *to)
+{
+	return (uint64_t)(to->tv_sec - from->tv_sec) * 1000000 + (to->tv_nsec - from->tv_nsec) / 1000;
+}
+
+/*
+ * @fn                   :json_malloc
+ * @description          :Allocator hook of cJSON counting the allocations
+ * @return               :void *
+ */
+static FAR void *json_malloc(size_t size)
+{
+	g_nallocs++;
+	g_nbytes += size;
+	return malloc(size);
+}
+
+/*
+ * @fn                   :json_count_items
+ * @description          :Number of items in a tree
+ * @return               :int
+ */
+static int json_count_items(FAR const cJSON *item)
+{
+	int count = 0;
+
+	for (; item != NULL; item = item->next) {
+		count += 1 + json_count_items(item->child);
+	}
+
+	return count;
+}
+
+/*
+ * SAX callbacks counting the items
+ */
+static cJSON_bool json_sax_start(FAR void *context, FAR const char *name)
+{
+	(*(FAR int *)context)++;
+	return 1;
+}
+
+static cJSON_bool json_sax_value(FAR void *context, FAR const cJSON *item)
+{
+	(*(FAR int *)context)++;
+	return 1;
+}
+
+static const cJSON_SAX_Handler g_sax_handler = {
+	json_sax_start, NULL, json_sax_start, NULL, json_sax_value
+};
+
+/*
+ * @fn                   :json_read
+ * @description          :Read function of cJSON_ParseStream on a file descriptor
+ * @return               :int
+ */
+static int json_read(FAR void *context, FAR char *buffer, size_t length)
+{
+	return read(*(FAR int *)context, buffer, length);
+}
+
+/*
+ * @fn                   :json_load
+ * @description          :Read the file and allocate the arena for it
+ * @return               :int, OK on success
+ */
+static int json_load(FAR struct json_perf_s *perf)
+{
+	FILE *fp;
+	long size;
+
+	fp = fopen(perf->path, "r");
+	if (fp == NULL) {
+		printf("Failed to open %s\n", perf->path);
+		return ERROR;
+	}
+
+	fseek(fp, 0, SEEK_END);
+	size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+
+	perf->text = malloc(size + 1);
+	perf->work = malloc(size + 1);
+	if (size <= 0 || perf->text == NULL || perf->work == NULL) {
+		fclose(fp);
+		return ERROR;
+	}
+
+	perf->length = fread(perf->text, 1, size, fp);
+	perf->text[perf->length] = '\0';
+	fclose(fp);
+
+	perf->arena_size = cJSON_GetArenaSize(perf->text);
+	perf->arena = malloc(perf->arena_size);
+	if (perf->arena == NULL) {
+		return ERROR;
+	}
+
+	return OK;
+}
+
+/*
+ * @fn                   :json_check
+ * @description          :Check that all the parsers agree on the file
+ * @return               :int, number of errors
+ */
+static int json_check(FAR struct json_perf_s *perf)
+{
+	cJSON_Arena arena;
+	FAR cJSON *root;
+	FAR cJSON *inplace;
+	int nitems;
+	int nevents = 0;
+	int nerrors = 0;
+
+	root = cJSON_Parse(perf->text);
+	if (root == NULL) {
+		printf("%s: parse error at \"%.16s\"\n", perf->path, cJSON_GetErrorPtr());
+		return 1;
+	}
+	nitems = json_count_items(root);
+
+	memcpy(perf->work, perf->text, perf->length + 1);
+	cJSON_InitArena(&arena, perf->arena, perf->arena_size);
+	inplace = cJSON_ParseInArena(&arena, perf->work);
+	if (inplace == NULL || !cJSON_Compare(root, inplace, 1)) {
+		printf("%s: in place parse differs\n", perf->path);
+		nerrors++;
+	}
+
+	if (!cJSON_ParseSAX(perf->text, &g_sax_handler, &nevents) || nevents != nitems) {
+		printf("%s: %d SAX events for %d items\n", perf->path, nevents, nitems);
+		nerrors++;
+	}
+
+	printf("%s: %u bytes, %d items, arena %u of %u bytes\n", perf->path, perf->length, nitems, arena.used, perf->arena_size);
+
+	cJSON_Delete(root);
+	return nerrors;
+}
+
+/*
+ * @fn                   :json_report
+ * @description          :Print the time and the heap usage of one parser
+ * @return               :void
+ */
+static void json_report(FAR const char *name, FAR const struct timespec *start, size_t nallocs, size_t nbytes)
+{
+	struct timespec end;
+	uint64_t elapsed;
+
+	clock_gettime(CLOCK_REALTIME, &end);
+	elapsed = json_usec(start, &end);
+
+	printf("%-10s : %6llu usec per parse, %5u mallocs %6u bytes\n", name, (unsigned long long)(elapsed / NLOOPS), nallocs, nbytes);
+}
+
+/*
+ * @fn                   :json_bench
+ * @description          :Parse the file NLOOPS times with each parser
+ * @return               :void
+ */
+static void json_bench(FAR struct json_perf_s *perf)
+{
+	cJSON_Hooks hooks = { json_malloc, free };
+	cJSON_Arena arena;
+	struct timespec start;
+	int nevents = 0;
+	int fd;
+	int i;
+
+	/* Allocates every item and every string from the heap */
+
+	cJSON_InitHooks(&hooks);
+	g_nallocs = 0;
+	g_nbytes = 0;
+	clock_gettime(CLOCK_REALTIME, &start);
+	for (i = 0; i < NLOOPS; i++) {
+		cJSON_Delete(cJSON_Parse(perf->text));
+	}
+	json_report("Parse", &start, g_nallocs / NLOOPS, g_nbytes / NLOOPS);
+
+	/* One arena for the items, the strings stay in the copy of the file */
+
+	g_nallocs = 0;
+	g_nbytes = 0;
+	cJSON_InitArena(&arena, perf->arena, perf->arena_size);
+	clock_gettime(CLOCK_REALTIME, &start);
+	for (i = 0; i < NLOOPS; i++) {
+		memcpy(perf->work, perf->text, perf->length + 1);
+		cJSON_ParseInArena(&arena, perf->work);
+		cJSON_ResetArena(&arena);
+	}
+	json_report("InArena", &start, g_nallocs / NLOOPS, g_nbytes / NLOOPS);
+
+	/* No tree at all */
+
+	clock_gettime(CLOCK_REALTIME, &start);
+	for (i = 0; i < NLOOPS; i++) {
+		cJSON_ParseSAX(perf->text, &g_sax_handler, &nevents);
+	}
+	json_report("SAX", &start, g_nallocs / NLOOPS, g_nbytes / NLOOPS);
+
+	/* SAX while reading the file */
+
+	clock_gettime(CLOCK_REALTIME, &start);
+	for (i = 0; i < NLOOPS; i++) {
+		fd = open(perf->path, O_RDONLY);
+		if (fd < 0) {
+			break;
+		}
+		cJSON_ParseStream(json_read, &fd, &g_sax_handler, &nevents, NULL);
+		close(fd);
+	}
+	json_report("Stream", &start, g_nallocs / NLOOPS, g_nbytes / NLOOPS);
+
+	cJSON_InitHooks(NULL);
+}
+
+/****************************************************************************
+ * Name: JSON Performance
+ ****************************************************************************/
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int json_performance_main(int argc, char *argv[])
+#endif
+{
+	struct json_perf_s perf;
+	int nerrors = 0;
+	int i = 1;
+
+	printf("JSON parser performance: %d parses per file\n", NLOOPS);
+
+	do {
+		memset(&perf, 0, sizeof(perf));
+		perf.path = (argc > 1) ? argv[i] : CONFIG_EXAMPLES_JSON_PERFORMANCE_FILE;
+
+		if (json_load(&perf) != OK) {
+			nerrors++;
+		} else if (json_check(&perf) != 0) {
+			nerrors++;
+		} else {
+			json_bench(&perf);
+		}
+
+		free(perf.text);
+		free(perf.work);
+		free(perf.arena);
+	} while (++i < argc);
+
+	return nerrors == 0 ? OK : ERROR;
+}
@@ -0,0 +1,238 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file net_demux_performance_main.c
+
+#include <tinyara/config.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#define NSOCKETS	CONFIG_EXAMPLES_NET_DEMUX_PERFORMANCE_NSOCKETS
+#define NPACKETS	CONFIG_EXAMPLES_NET_DEMUX_PERFORMANCE_NPACKETS
+#define BASE_PORT	CONFIG_EXAMPLES_NET_DEMUX_PERFORMANCE_PORT
+#define PAYLOAD		32
+
+static int g_rxfds[NSOCKETS];
+static int g_txfds[NSOCKETS];
+
+/*
+ * @fn                   :net_demux_usec
+ * @description          :Microseconds between two time stamps
+ * @return               :uint64_t
+ */
+static uint64_t net_demux_usec(FAR const struct timespec *from, FAR const struct timespec *to)
+{
+	return (uint64_t)(to->tv_sec - from->tv_sec) * 1000000 + (to->tv_nsec - from->tv_nsec) / 1000;
+}
+
+/*
+ * @fn                   :net_demux_addr
+ * @description          :Loopback address with the given port
+ * @return               :void
+ */
+static void net_demux_addr(FAR struct sockaddr_in *addr, int port)
+{
+	memset(addr, 0, sizeof(struct sockaddr_in));
+	addr->sin_family = AF_INET;
+	addr->sin_port = htons(port);
+	addr->sin_addr.s_addr = inet_addr("127.0.0.1");
+}
+
+/*
+ * @fn                   :net_demux_close
+ * @description          :Close all sockets opened by a run
+ * @return               :void
+ */
+static void net_demux_close(void)
+{
+	int i;
+
+	for (i = 0; i < NSOCKETS; i++) {
+		if (g_rxfds[i] >= 0) {
+			close(g_rxfds[i]);
+		}
+
+		if (g_txfds[i] >= 0) {
+			close(g_txfds[i]);
+		}
+
+		g_rxfds[i] = -1;
+		g_txfds[i] = -1;
+	}
+}
+
+/*
+ * @fn                   :net_demux_report
+ * @description          :Print the packet rate of one run
+ * @return               :void
+ */
+static void net_demux_report(FAR const char *name, FAR const struct timespec *start, int nerrors)
+{
+	struct timespec end;
+	uint64_t elapsed;
+
+	clock_gettime(CLOCK_REALTIME, &end);
+	elapsed = net_demux_usec(start, &end);
+	if (elapsed == 0) {
+		elapsed = 1;
+	}
+
+	printf("%-4s %3d sockets, %5d packets in %8llu usec : %6llu packets/s, %d errors\n", name, NSOCKETS, NPACKETS, (unsigned long long)elapsed, (unsigned long long)NPACKETS * 1000000 / elapsed, nerrors);
+}
+
+/*
+ * @fn                   :net_demux_udp
+ * @description          :Send NPACKETS datagrams round robin to NSOCKETS bound UDP sockets
+ * @return               :void
+ */
+static void net_demux_udp(void)
+{
+	struct sockaddr_in addr;
+	struct timespec start;
+	char buf[PAYLOAD];
+	int nerrors = 0;
+	int i;
+
+	memset(buf, 'U', PAYLOAD);
+
+	for (i = 0; i < NSOCKETS; i++) {
+		g_rxfds[i] = socket(AF_INET, SOCK_DGRAM, 0);
+		net_demux_addr(&addr, BASE_PORT + i);
+		if (g_rxfds[i] < 0 || bind(g_rxfds[i], (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+			printf("udp: failed to bind port %d: %d\n", BASE_PORT + i, errno);
+			goto done;
+		}
+	}
+
+	g_txfds[0] = socket(AF_INET, SOCK_DGRAM, 0);
+	if (g_txfds[0] < 0) {
+		printf("udp: failed to open the sender: %d\n", errno);
+		goto done;
+	}
+
+	clock_gettime(CLOCK_REALTIME, &start);
+
+	for (i = 0; i < NPACKETS; i++) {
+		net_demux_addr(&addr, BASE_PORT + i % NSOCKETS);
+		if (sendto(g_txfds[0], buf, PAYLOAD, 0, (struct sockaddr *)&addr, sizeof(addr)) != PAYLOAD) {
+			nerrors++;
+			continue;
+		}
+
+		if (recv(g_rxfds[i % NSOCKETS], buf, PAYLOAD, 0) != PAYLOAD) {
+			nerrors++;
+		}
+	}
+
+	net_demux_report("udp", &start, nerrors);
+
+done:
+	net_demux_close();
+}
+
+/*
+ * @fn                   :net_demux_tcp
+ * @description          :Send NPACKETS segments round robin over NSOCKETS TCP connections
+ *                        sharing one local port
+ * @return               :void
+ */
+static void net_demux_tcp(void)
+{
+	struct sockaddr_in addr;
+	struct timespec start;
+	char buf[PAYLOAD];
+	int listenfd;
+	int nerrors = 0;
+	int i;
+
+	memset(buf, 'T', PAYLOAD);
+
+	listenfd = socket(AF_INET, SOCK_STREAM, 0);
+	net_demux_addr(&addr, BASE_PORT);
+	if (listenfd < 0 || bind(listenfd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(listenfd, NSOCKETS) < 0) {
+		printf("tcp: failed to listen on port %d: %d\n", BASE_PORT, errno);
+		goto done;
+	}
+
+	for (i = 0; i < NSOCKETS; i++) {
+		g_txfds[i] = socket(AF_INET, SOCK_STREAM, 0);
+		if (g_txfds[i] < 0 || connect(g_txfds[i], (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+			printf("tcp: failed to connect %d: %d\n", i, errno);
+			goto done;
+		}
+
+		g_rxfds[i] = accept(listenfd, NULL, NULL);
+		if (g_rxfds[i] < 0) {
+			printf("tcp: failed to accept %d: %d\n", i, errno);
+			goto done;
+		}
+	}
+
+	clock_gettime(CLOCK_REALTIME, &start);
+
+	for (i = 0; i < NPACKETS; i++) {
+		if (send(g_txfds[i % NSOCKETS], buf, PAYLOAD, 0) != PAYLOAD) {
+			nerrors++;
+			continue;
+		}
+
+		if (recv(g_rxfds[i % NSOCKETS], buf, PAYLOAD, 0) != PAYLOAD) {
+			nerrors++;
+		}
+	}
+
+	net_demux_report("tcp", &start, nerrors);
+
+done:
+	net_demux_close();
+	if (listenfd >= 0) {
+		close(listenfd);
+	}
+}
+
+/****************************************************************************
+ * Name: Network Demux Performance
+ ****************************************************************************/
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int net_demux_performance_main(int argc, char *argv[])
+#endif
+{
+	int i;
+
+	for (i = 0; i < NSOCKETS; i++) {
+		g_rxfds[i] = -1;
+		g_txfds[i] = -1;
+	}
+
+	printf("Network demux performance: %d packets of %d bytes over %d sockets\n", NPACKETS, PAYLOAD, NSOCKETS);
+
+	net_demux_udp();
+	net_demux_tcp();
+
+	return OK;
+}
@@ -0,0 +1,174 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file printf_performance_main.c
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <tinyara/streams.h>
+
+#define NLOOPS		CONFIG_EXAMPLES_PRINTF_PERFORMANCE_NLOOPS
+#define BUFLEN		256
+
+#ifdef CONFIG_LIBC_FLOATINGPOINT
+#define NFORMATS	6
+#else
+#define NFORMATS	5
+#endif
+
+static char g_bulk[BUFLEN];
+static char g_char[BUFLEN];
+
+/*
+ * @fn                   :printf_usec
+ * @description          :Microseconds between two time stamps
+ * @return               :uint64_t
+ */
+static uint64_t printf_usec(FAR const struct timespec *from, FAR const struct timespec *to)
+{
+	return (uint64_t)(to->tv_sec - from->tv_sec) * 1000000 + (to->tv_nsec - from->tv_nsec) / 1000;
+}
+
+/*
+ * @fn                   :printf_format
+ * @description          :Format line number which of the test set
+ * @return               :int, number of characters formatted
+ */
+static int printf_format(FAR struct lib_outstream_s *stream, int which, int i)
+{
+	switch (which) {
+	case 0:
+		return lib_sprintf(stream, "temperature=%d humidity=%u%% sensor=%s\n", i % 50 - 10, i % 100, "livingroom");
+	case 1:
+		return lib_sprintf(stream, "[%8lu] %-12s: connection from %s closed\n", (unsigned long)i * 997, "webserver", "192.168.0.10");
+	case 2:
+		return lib_sprintf(stream, "%02d:%02d:%02d.%03d heap free %8d largest %08x\n", i / 3600 % 24, i / 60 % 60, i % 60, i % 1000, 123456 - i, 0x2002f000 + i);
+	case 3:
+		return lib_sprintf(stream, "rx %10u tx %10u err %5d drop %-5d|\n", i * 1500, i * 64, i % 7, i % 3);
+	case 4:
+		return lib_sprintf(stream, "{\"id\":%d,\"name\":\"%s\",\"value\":%d,\"unit\":\"%.4s\"}", i, "sensor", i * 3, "celsius");
+#ifdef CONFIG_LIBC_FLOATINGPOINT
+	case 5:
+		return lib_sprintf(stream, "lat %10.6f lon %10.6f alt %7.2f\n", 37.2 + i / 1e6, 127.0 - i / 1e6, i / 100.0);
+#endif
+	default:
+		return 0;
+	}
+}
+
+/*
+ * @fn                   :printf_check
+ * @description          :Check that the bulk and the per-character paths give the same output
+ * @return               :int, number of errors
+ */
+static int printf_check(void)
+{
+	struct lib_memoutstream_s bulk;
+	struct lib_memoutstream_s single;
+	int nerrors = 0;
+	int which;
+	int i;
+
+	for (which = 0; which < NFORMATS; which++) {
+		for (i = 0; i < 100; i++) {
+			lib_memoutstream(&bulk, g_bulk, BUFLEN);
+			lib_memoutstream(&single, g_char, BUFLEN);
+			single.public.puts = NULL;
+
+			if (printf_format(&bulk.public, which, i) != printf_format(&single.public, which, i) || strcmp(g_bulk, g_char) != 0) {
+				printf("format %d, %d: \"%s\" != \"%s\"\n", which, i, g_bulk, g_char);
+				nerrors++;
+			}
+		}
+	}
+
+	return nerrors;
+}
+
+/*
+ * @fn                   :printf_bench
+ * @description          :Format every line NLOOPS times and print the throughput
+ * @return               :void
+ */
+static void printf_bench(FAR const char *name, bool usenull, bool usebulk)
+{
+	struct lib_memoutstream_s memstream;
+	struct lib_outstream_s nullstream;
+	FAR struct lib_outstream_s *stream;
+	struct timespec start;
+	struct timespec end;
+	uint64_t elapsed;
+	uint64_t nchars = 0;
+	int which;
+	int i;
+
+	clock_gettime(CLOCK_REALTIME, &start);
+	for (i = 0; i < NLOOPS; i++) {
+		for (which = 0; which < NFORMATS; which++) {
+			if (usenull) {
+				lib_nulloutstream(&nullstream);
+				stream = &nullstream;
+			} else {
+				lib_memoutstream(&memstream, g_bulk, BUFLEN);
+				stream = &memstream.public;
+			}
+
+			if (!usebulk) {
+				stream->puts = NULL;
+			}
+
+			nchars += printf_format(stream, which, i);
+		}
+	}
+	clock_gettime(CLOCK_REALTIME, &end);
+
+	elapsed = printf_usec(&start, &end);
+	if (elapsed == 0) {
+		elapsed = 1;
+	}
+
+	printf("%-6s %-9s : %8llu usec, %6llu lines/s, %6llu KB/s\n", name, usebulk ? "bulk" : "per-char", (unsigned long long)elapsed,
+		   (unsigned long long)NLOOPS * NFORMATS * 1000000 / elapsed, nchars * 1000000 / 1024 / elapsed);
+}
+
+/****************************************************************************
+ * Name: Printf Performance
+ ****************************************************************************/
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int printf_performance_main(int argc, char *argv[])
+#endif
+{
+	int nerrors;
+
+	nerrors = printf_check();
+	printf("Printf: %d errors between bulk and per-character output\n", nerrors);
+
+	printf("Printf performance: %d lines of %d formats per run\n", NLOOPS * NFORMATS, NFORMATS);
+	printf_bench("memory", false, false);
+	printf_bench("memory", false, true);
+	printf_bench("null", true, false);
+	printf_bench("null", true, true);
+
+	return nerrors == 0 ? OK : ERROR;
+}
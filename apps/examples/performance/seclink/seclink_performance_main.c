@@ -0,0 +1,349 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file seclink_performance_main.c
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <tinyara/seclink.h>
+
+#define NLOOPS		CONFIG_EXAMPLES_SECLINK_PERFORMANCE_NLOOPS
+#define NBATCH		CONFIG_EXAMPLES_SECLINK_PERFORMANCE_BATCH
+#define NOUTPUTS	(2 * NBATCH)	/* Two batches are in flight in the async run */
+#define DATALEN		64
+#define OUTLEN		128
+
+#define AES_KEY_IDX		32
+#define HMAC_KEY_IDX	33
+#define ECDSA_KEY_IDX	34
+
+enum seclink_perf_e {
+	SECLINK_PERF_AES_ECB,
+	SECLINK_PERF_AES_CBC,
+	SECLINK_PERF_HMAC,
+	SECLINK_PERF_ECDSA_SIGN,
+	SECLINK_PERF_ECDSA_VERIFY,
+	SECLINK_PERF_MAX
+};
+
+static const char *g_names[SECLINK_PERF_MAX] = {
+	"AES-ECB", "AES-CBC", "HMAC", "ECDSA-sign", "ECDSA-vrfy"
+};
+
+static sl_ctx g_hnd;
+static unsigned char g_key[32];
+static unsigned char g_data[DATALEN];
+static unsigned char g_sign_buf[OUTLEN];
+static hal_data g_input;
+static hal_data g_hash;
+static hal_data g_sign;
+
+/* One output and one set of AES parameters per request of a batch */
+
+static unsigned char g_out_buf[NOUTPUTS][OUTLEN];
+static unsigned char g_iv[NOUTPUTS][16];
+static hal_data g_output[NOUTPUTS];
+static hal_aes_param g_aes[NOUTPUTS];
+
+/*
+ * @fn                   :seclink_usec
+ * @description          :Microseconds between two time stamps
+ * @return               :uint64_t
+ */
+static uint64_t seclink_usec(FAR const struct timespec *from, FAR const struct timespec *to)
+{
+	return (uint64_t)(to->tv_sec - from->tv_sec) * 1000000 + (to->tv_nsec - from->tv_nsec) / 1000;
+}
+
+/*
+ * @fn                   :seclink_prepare
+ * @description          :Reset output i and the AES parameters of a request
+ * @return               :void
+ */
+static void seclink_prepare(int test, int i)
+{
+	g_output[i].data = g_out_buf[i];
+	g_output[i].data_len = (test == SECLINK_PERF_AES_ECB || test == SECLINK_PERF_AES_CBC) ? DATALEN : OUTLEN;
+
+	memset(&g_aes[i], 0, sizeof(hal_aes_param));
+	if (test == SECLINK_PERF_AES_CBC) {
+		memset(g_iv[i], 0, 16);
+		g_aes[i].mode = HAL_AES_CBC_NOPAD;
+		g_aes[i].iv = g_iv[i];
+		g_aes[i].iv_len = 16;
+	} else {
+		g_aes[i].mode = HAL_AES_ECB_NOPAD;
+	}
+}
+
+/*
+ * @fn                   :seclink_single
+ * @description          :Run one request with its own call
+ * @return               :int, result of the request
+ */
+static int seclink_single(int test, int i)
+{
+	hal_ecdsa_mode ecdsa = {HAL_ECDSA_SEC_P256R1, HAL_HASH_SHA256};
+
+	seclink_prepare(test, i);
+
+	switch (test) {
+	case SECLINK_PERF_AES_ECB:
+	case SECLINK_PERF_AES_CBC:
+		return sl_aes_encrypt(g_hnd, &g_input, &g_aes[i], AES_KEY_IDX, &g_output[i]);
+	case SECLINK_PERF_HMAC:
+		return sl_get_hmac(g_hnd, HAL_HMAC_SHA256, &g_input, HMAC_KEY_IDX, &g_output[i]);
+	case SECLINK_PERF_ECDSA_SIGN:
+		return sl_ecdsa_sign_md(g_hnd, ecdsa, &g_hash, ECDSA_KEY_IDX, &g_output[i]);
+	case SECLINK_PERF_ECDSA_VERIFY:
+		return sl_ecdsa_verify_md(g_hnd, ecdsa, &g_hash, &g_sign, ECDSA_KEY_IDX);
+	default:
+		return SECLINK_INVALID_ARGS;
+	}
+}
+
+/*
+ * @fn                   :seclink_add
+ * @description          :Add one request to a batch, the output i is used in place
+ * @return               :int, SECLINK_OK on success
+ */
+static int seclink_add(sl_batch batch, int test, int i)
+{
+	hal_ecdsa_mode ecdsa = {HAL_ECDSA_SEC_P256R1, HAL_HASH_SHA256};
+
+	seclink_prepare(test, i);
+
+	switch (test) {
+	case SECLINK_PERF_AES_ECB:
+	case SECLINK_PERF_AES_CBC:
+		return sl_batch_aes_encrypt(batch, &g_input, &g_aes[i], AES_KEY_IDX, &g_output[i]);
+	case SECLINK_PERF_HMAC:
+		return sl_batch_get_hmac(batch, HAL_HMAC_SHA256, &g_input, HMAC_KEY_IDX, &g_output[i]);
+	case SECLINK_PERF_ECDSA_SIGN:
+		return sl_batch_ecdsa_sign_md(batch, ecdsa, &g_hash, ECDSA_KEY_IDX, &g_output[i]);
+	case SECLINK_PERF_ECDSA_VERIFY:
+		return sl_batch_ecdsa_verify_md(batch, ecdsa, &g_hash, &g_sign, ECDSA_KEY_IDX);
+	default:
+		return SECLINK_INVALID_ARGS;
+	}
+}
+
+/*
+ * @fn                   :seclink_fill
+ * @description          :Fill a batch with NBATCH requests using the outputs from first
+ * @return               :int, number of errors
+ */
+static int seclink_fill(sl_batch batch, int test, int first)
+{
+	int nerrors = 0;
+	int i;
+
+	sl_batch_reset(batch);
+	for (i = 0; i < NBATCH; i++) {
+		if (seclink_add(batch, test, first + i) != SECLINK_OK) {
+			nerrors++;
+		}
+	}
+
+	return nerrors;
+}
+
+/*
+ * @fn                   :seclink_report
+ * @description          :Print the time per request of a run
+ * @return               :void
+ */
+static void seclink_report(int test, FAR const char *how, FAR const struct timespec *start, int nerrors)
+{
+	struct timespec end;
+	uint64_t elapsed;
+
+	clock_gettime(CLOCK_REALTIME, &end);
+	elapsed = seclink_usec(start, &end);
+
+	printf("%-10s %-6s : %6llu usec per request, %d errors\n", g_names[test], how, (unsigned long long)(elapsed / (NLOOPS * NBATCH)), nerrors);
+}
+
+/*
+ * @fn                   :seclink_bench
+ * @description          :Run NLOOPS * NBATCH requests of a test in each way
+ * @return               :int, number of errors
+ */
+static int seclink_bench(int test)
+{
+	struct timespec start;
+	sl_batch batch[2] = {NULL, NULL};
+#ifdef CONFIG_SECURITY_LINK_BATCH_ASYNC
+	sl_batch done;
+#endif
+	int nerrors;
+	int total = 0;
+	int i;
+	int j;
+
+	/* One call per request */
+
+	nerrors = 0;
+	clock_gettime(CLOCK_REALTIME, &start);
+	for (i = 0; i < NLOOPS; i++) {
+		for (j = 0; j < NBATCH; j++) {
+			if (seclink_single(test, j) != SECLINK_OK) {
+				nerrors++;
+			}
+		}
+	}
+	seclink_report(test, "single", &start, nerrors);
+	total += nerrors;
+
+	if (sl_batch_create(g_hnd, NBATCH, &batch[0]) != SECLINK_OK || sl_batch_create(g_hnd, NBATCH, &batch[1]) != SECLINK_OK) {
+		printf("Failed to create the batches\n");
+		total++;
+		goto out;
+	}
+
+	/* One call per batch */
+
+	nerrors = 0;
+	clock_gettime(CLOCK_REALTIME, &start);
+	for (i = 0; i < NLOOPS; i++) {
+		nerrors += seclink_fill(batch[0], test, 0);
+		if (sl_batch_submit(batch[0]) != SECLINK_OK) {
+			nerrors++;
+		}
+	}
+	seclink_report(test, "batch", &start, nerrors);
+	total += nerrors;
+
+#ifdef CONFIG_SECURITY_LINK_BATCH_ASYNC
+	/* Fill a batch while the other one runs */
+
+	nerrors = seclink_fill(batch[0], test, 0);
+	clock_gettime(CLOCK_REALTIME, &start);
+	if (sl_batch_submit_async(batch[0]) != SECLINK_OK) {
+		nerrors++;
+	}
+	for (i = 1; i < NLOOPS; i++) {
+		nerrors += seclink_fill(batch[i & 1], test, (i & 1) * NBATCH);
+		if (sl_batch_submit_async(batch[i & 1]) != SECLINK_OK) {
+			nerrors++;
+		}
+		if (sl_batch_wait(g_hnd, &done) != SECLINK_OK) {
+			nerrors++;
+		}
+	}
+	if (sl_batch_wait(g_hnd, &done) != SECLINK_OK) {
+		nerrors++;
+	}
+	seclink_report(test, "async", &start, nerrors);
+	total += nerrors;
+#endif
+
+out:
+	if (batch[0]) {
+		sl_batch_destroy(batch[0]);
+	}
+	if (batch[1]) {
+		sl_batch_destroy(batch[1]);
+	}
+
+	return total;
+}
+
+/*
+ * @fn                   :seclink_setup
+ * @description          :Set the keys and sign the hash for the verification
+ * @return               :int, OK on success
+ */
+static int seclink_setup(void)
+{
+	hal_data key = HAL_DATA_INITIALIZER;
+	hal_ecdsa_mode ecdsa = {HAL_ECDSA_SEC_P256R1, HAL_HASH_SHA256};
+
+	memset(g_data, 0x5a, DATALEN);
+	memset(g_key, 0xa5, sizeof(g_key));
+	g_input.data = g_data;
+	g_input.data_len = DATALEN;
+	g_hash.data = g_data;
+	g_hash.data_len = 32;
+	g_sign.data = g_sign_buf;
+	g_sign.data_len = OUTLEN;
+
+	key.data = g_key;
+	key.data_len = 16;
+	if (sl_set_key(g_hnd, HAL_KEY_AES_128, AES_KEY_IDX, &key, NULL) != SECLINK_OK) {
+		printf("Failed to set the AES key\n");
+		return ERROR;
+	}
+
+	key.data_len = 32;
+	if (sl_set_key(g_hnd, HAL_KEY_HMAC_SHA256, HMAC_KEY_IDX, &key, NULL) != SECLINK_OK) {
+		printf("Failed to set the HMAC key\n");
+		return ERROR;
+	}
+
+	if (sl_generate_key(g_hnd, HAL_KEY_ECC_SEC_P256R1, ECDSA_KEY_IDX) != SECLINK_OK) {
+		printf("Failed to generate the ECDSA key\n");
+		return ERROR;
+	}
+
+	if (sl_ecdsa_sign_md(g_hnd, ecdsa, &g_hash, ECDSA_KEY_IDX, &g_sign) != SECLINK_OK) {
+		printf("Failed to sign\n");
+		return ERROR;
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: Seclink Performance
+ ****************************************************************************/
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int seclink_performance_main(int argc, char *argv[])
+#endif
+{
+	int nerrors = 0;
+	int test;
+
+	if (sl_init(&g_hnd) != SECLINK_OK) {
+		printf("Failed to initialize the security link\n");
+		return ERROR;
+	}
+
+	printf("Security link performance: %d batches of %d requests per run\n", NLOOPS, NBATCH);
+
+	if (seclink_setup() != OK) {
+		nerrors++;
+	} else {
+		for (test = 0; test < SECLINK_PERF_MAX; test++) {
+			nerrors += seclink_bench(test);
+		}
+	}
+
+	sl_remove_key(g_hnd, HAL_KEY_AES_128, AES_KEY_IDX);
+	sl_remove_key(g_hnd, HAL_KEY_HMAC_SHA256, HMAC_KEY_IDX);
+	sl_remove_key(g_hnd, HAL_KEY_ECC_SEC_P256R1, ECDSA_KEY_IDX);
+	sl_deinit(g_hnd);
+
+	return nerrors == 0 ? OK : ERROR;
+}
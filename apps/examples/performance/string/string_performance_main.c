@@ -0,0 +1,290 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/// @file string_performance_main.c
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define NLOOPS		CONFIG_EXAMPLES_STRING_PERFORMANCE_NLOOPS
+#define MAXCHECK	256
+#define BENCHSIZE	1024
+#define GUARD		0xa5
+
+static unsigned char g_src[BENCHSIZE + 16];
+static unsigned char g_dst[BENCHSIZE + 16];
+static volatile size_t g_sink;
+
+/*
+ * @fn                   :string_usec
+ * @description          :Microseconds between two time stamps
+ * @return               :uint64_t
+ */
+static uint64_t string_usec(FAR const struct timespec *from, FAR const struct timespec *to)
+{
+	return (uint64_t)(to->tv_sec - from->tv_sec) * 1000000 + (to->tv_nsec - from->tv_nsec) / 1000;
+}
+
+/*
+ * @fn                   :string_sign
+ * @description          :Sign of a comparison result
+ * @return               :int, -1, 0 or 1
+ */
+static int string_sign(int result)
+{
+	return (result > 0) - (result < 0);
+}
+
+/*
+ * @fn                   :string_fill
+ * @description          :Fill a buffer with non-zero bytes, high bit set in some
+ * @return               :void
+ */
+static void string_fill(FAR unsigned char *buf, int len, int seed)
+{
+	int i;
+
+	for (i = 0; i < len; i++) {
+		buf[i] = (unsigned char)(seed * 31 + i * 7) | 1;
+	}
+}
+
+/*
+ * @fn                   :string_check_copy
+ * @description          :Check dst[0..n) against src and the guard bytes around it
+ * @return               :int, 0 if the copy is exact
+ */
+static int string_check_copy(FAR const unsigned char *dst, FAR const unsigned char *src, int n)
+{
+	int i;
+
+	for (i = 0; i < n; i++) {
+		if (dst[i] != src[i]) {
+			return -1;
+		}
+	}
+
+	return dst[-1] == GUARD && dst[n] == GUARD ? 0 : -1;
+}
+
+/*
+ * @fn                   :string_check
+ * @description          :Check every function for all alignments and sizes up to MAXCHECK
+ * @return               :int, number of errors
+ */
+static int string_check(void)
+{
+	FAR unsigned char *s;
+	FAR unsigned char *d;
+	int nerrors = 0;
+	int sa;
+	int da;
+	int n;
+	int k;
+	int j;
+
+	for (sa = 0; sa < 8; sa++) {
+		for (da = 0; da < 8; da++) {
+			for (n = 0; n < MAXCHECK; n++) {
+				s = g_src + sa + 1;
+				d = g_dst + da + 1;
+				string_fill(g_src, sizeof(g_src), n);
+
+				memset(g_dst, GUARD, sizeof(g_dst));
+				if (memcpy(d, s, n) != d || string_check_copy(d, s, n) != 0) {
+					printf("memcpy   src+%d dst+%d %d bytes\n", sa, da, n);
+					nerrors++;
+				}
+
+				memset(g_dst, GUARD, sizeof(g_dst));
+				memset(d, 0x1c3, n);
+				for (k = 0; k < n && d[k] == 0xc3; k++) ;
+				if (k != n || d[-1] != GUARD || d[n] != GUARD) {
+					printf("memset   dst+%d %d bytes\n", da, n);
+					nerrors++;
+				}
+
+				/* Overlapping moves in both directions */
+
+				memcpy(g_dst, g_src, sizeof(g_dst));
+				memmove(g_dst + da + 8, g_dst + sa, n);
+				for (k = 0; k < n && g_dst[da + 8 + k] == g_src[sa + k]; k++) ;
+				if (k != n) {
+					printf("memmove  up src+%d dst+%d %d bytes\n", sa, da, n);
+					nerrors++;
+				}
+
+				memcpy(g_dst, g_src, sizeof(g_dst));
+				memmove(g_dst + da, g_dst + sa + 8, n);
+				for (k = 0; k < n && g_dst[da + k] == g_src[sa + 8 + k]; k++) ;
+				if (k != n) {
+					printf("memmove  down src+%d dst+%d %d bytes\n", sa, da, n);
+					nerrors++;
+				}
+
+				/* Compare equal buffers, then with one byte changed */
+
+				memcpy(d, s, n);
+				if (memcmp(s, d, n) != 0) {
+					printf("memcmp   src+%d dst+%d %d bytes equal\n", sa, da, n);
+					nerrors++;
+				}
+				if (n > 0) {
+					k = (n * 5 / 7 + sa + da) % n;
+					d[k] = (n & 1) ? s[k] ^ 0x80 : s[k] - 1;
+					if (string_sign(memcmp(s, d, n)) != (s[k] < d[k] ? -1 : 1)) {
+						printf("memcmp   src+%d dst+%d %d bytes, differs at %d\n", sa, da, n, k);
+						nerrors++;
+					}
+				}
+
+				/* String functions on a string of n bytes */
+
+				s[n] = '\0';
+				if (strlen((FAR char *)s) != n) {
+					printf("strlen   src+%d %d bytes\n", sa, n);
+					nerrors++;
+				}
+
+				memset(g_dst, GUARD, sizeof(g_dst));
+				if (strcpy((FAR char *)d, (FAR char *)s) != (FAR char *)d || string_check_copy(d, s, n + 1) != 0) {
+					printf("strcpy   src+%d dst+%d %d bytes\n", sa, da, n);
+					nerrors++;
+				}
+
+				if (strcmp((FAR char *)s, (FAR char *)d) != 0) {
+					printf("strcmp   src+%d dst+%d %d bytes equal\n", sa, da, n);
+					nerrors++;
+				}
+				if (n > 0) {
+					k = (n * 3 / 5 + sa * 2 + da) % n;
+					d[k] = (n % 3 == 0) ? 0x00 : (n % 3 == 1) ? 0xc8 : 0x02;
+					if (string_sign(strcmp((FAR char *)s, (FAR char *)d)) != (s[k] < d[k] ? -1 : 1)) {
+						printf("strcmp   src+%d dst+%d %d bytes, differs at %d\n", sa, da, n, k);
+						nerrors++;
+					}
+				}
+
+				if (da != 0) {
+					continue;
+				}
+
+				/* Look for every byte, the first occurrence is at j */
+
+				for (k = 0; k < n; k++) {
+					for (j = 0; s[j] != s[k]; j++) ;
+					if (memchr(s, s[k], n) != s + j || strchr((FAR char *)s, s[k]) != (FAR char *)s + j) {
+						printf("memchr/strchr src+%d %d bytes at %d\n", sa, n, k);
+						nerrors++;
+					}
+				}
+				if (memchr(s, 0x80, n) != NULL || strchr((FAR char *)s, 0x80) != NULL) {
+					printf("memchr/strchr src+%d %d bytes, missing byte\n", sa, n);
+					nerrors++;
+				}
+				if (strchr((FAR char *)s, '\0') != (FAR char *)s + n) {
+					printf("strchr   src+%d %d bytes, NUL\n", sa, n);
+					nerrors++;
+				}
+			}
+		}
+	}
+
+	return nerrors;
+}
+
+/*
+ * @fn                   :string_report
+ * @description          :Print the throughput of one run
+ * @return               :void
+ */
+static void string_report(FAR const char *name, FAR const char *align, FAR const struct timespec *start)
+{
+	struct timespec end;
+	uint64_t elapsed;
+
+	clock_gettime(CLOCK_REALTIME, &end);
+	elapsed = string_usec(start, &end);
+	if (elapsed == 0) {
+		elapsed = 1;
+	}
+
+	printf("%-8s %-10s : %8llu usec, %6llu KB/s\n", name, align, (unsigned long long)elapsed, (unsigned long long)BENCHSIZE * NLOOPS * 1000000 / 1024 / elapsed);
+}
+
+#define STRING_BENCH(name, align, expr) \
+	do { \
+		clock_gettime(CLOCK_REALTIME, &start); \
+		for (i = 0; i < NLOOPS; i++) { \
+			g_sink += (size_t)(expr); \
+		} \
+		string_report(name, align, &start); \
+	} while (0)
+
+/*
+ * @fn                   :string_bench
+ * @description          :Call each function NLOOPS times on BENCHSIZE bytes
+ * @return               :void
+ */
+static void string_bench(int sa, int da, FAR const char *align)
+{
+	FAR char *s = (FAR char *)g_src + sa;
+	FAR char *d = (FAR char *)g_dst + da;
+	struct timespec start;
+	int i;
+
+	memset(g_src, 'x', sizeof(g_src));
+	s[BENCHSIZE - 1] = '\0';
+	memcpy(d, s, BENCHSIZE);
+
+	STRING_BENCH("memcpy", align, memcpy(d, s, BENCHSIZE));
+	STRING_BENCH("memmove", align, memmove(d, s, BENCHSIZE));
+	STRING_BENCH("memset", align, memset(d, 'x', BENCHSIZE));
+	STRING_BENCH("memcmp", align, memcmp(d, s, BENCHSIZE));
+	STRING_BENCH("memchr", align, memchr(s, 'y', BENCHSIZE));
+	STRING_BENCH("strlen", align, strlen(s));
+	STRING_BENCH("strchr", align, strchr(s, 'y'));
+	STRING_BENCH("strcmp", align, strcmp(d, s));
+	STRING_BENCH("strcpy", align, strcpy(d, s));
+}
+
+/****************************************************************************
+ * Name: String Performance
+ ****************************************************************************/
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int string_performance_main(int argc, char *argv[])
+#endif
+{
+	int nerrors;
+
+	nerrors = string_check();
+	printf("String functions: %d errors for all alignments up to %d bytes\n", nerrors, MAXCHECK);
+
+	printf("String performance: %d calls of %d bytes per function\n", NLOOPS, BENCHSIZE);
+	string_bench(0, 0, "aligned");
+	string_bench(1, 3, "misaligned");
+
+	return nerrors == 0 ? OK : ERROR;
+}
@@ -28,6 +28,8 @@
 #include <sys/ioctl.h>
 #include <sys/types.h>
 #include <fcntl.h>
+#include <pthread.h>
+#include <semaphore.h>
 
 #define NUM_LOOPS	1000000
 #define SEC_10	10
@@ -173,6 +175,79 @@ static void syscall_perf_timer_settime(void)
 	measure_performance(timer_settime, 4, timer_id, 0, NULL, NULL);
 }
 
+/*
+ * @fn                   :mutex_lock_unlock
+ * @description          :Lock and unlock a mutex that no other thread uses
+ * @return               :void
+ */
+static void mutex_lock_unlock(pthread_mutex_t *mutex)
+{
+	pthread_mutex_lock(mutex);
+	pthread_mutex_unlock(mutex);
+}
+
+/*
+ * @fn                   :sem_wait_post
+ * @description          :Take and give a semaphore that no other thread uses
+ * @return               :void
+ */
+static void sem_wait_post(sem_t *sem)
+{
+	sem_wait(sem);
+	sem_post(sem);
+}
+
+/*
+ * @fn                   :syscall_perf_mutex
+ * @description          :Measuring performance for uncontended pthread_mutex_lock/unlock pairs
+ *                        against sem_wait/sem_post pairs. Only unsafe (stalled) mutexes can
+ *                        use CONFIG_PTHREAD_MUTEX_FASTPATH, robust ones always enter the kernel.
+ * @return               :void
+ */
+static void syscall_perf_mutex(void)
+{
+	pthread_mutex_t mutex;
+	pthread_mutexattr_t attr;
+	sem_t sem;
+
+	sem_init(&sem, 0, 1);
+	measure_performance(sem_wait_post, 1, &sem);
+	sem_destroy(&sem);
+
+#ifndef CONFIG_PTHREAD_MUTEX_ROBUST
+	/* An unsafe mutex, which takes the fast path if it is enabled */
+
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_STALLED);
+	pthread_mutex_init(&mutex, &attr);
+	measure_performance(mutex_lock_unlock, 1, &mutex);
+	pthread_mutex_destroy(&mutex);
+
+#ifdef CONFIG_PTHREAD_MUTEX_TYPES
+	/* A recursive unsafe mutex that the caller already holds once */
+
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(&mutex, &attr);
+	pthread_mutex_lock(&mutex);
+	measure_performance(mutex_lock_unlock, 1, &mutex);
+	pthread_mutex_unlock(&mutex);
+	pthread_mutex_destroy(&mutex);
+#endif
+	pthread_mutexattr_destroy(&attr);
+#endif
+
+#ifndef CONFIG_PTHREAD_MUTEX_UNSAFE
+	/* A robust mutex, which always enters the kernel */
+
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+	pthread_mutex_init(&mutex, &attr);
+	measure_performance(mutex_lock_unlock, 1, &mutex);
+	pthread_mutex_destroy(&mutex);
+	pthread_mutexattr_destroy(&attr);
+#endif
+}
+
 /****************************************************************************
  * Name: Syscall Performance
  ****************************************************************************/
@@ -213,5 +288,10 @@ int syscall_performance_main(void)
 	syscall_perf_mq_open();
 	sched_unlock();
 
+	/* Uncontended mutex, system calls only with CONFIG_PTHREAD_MUTEX_FASTPATH disabled */
+	sched_lock();
+	syscall_perf_mutex();
+	sched_unlock();
+
 	return 0;
 }
@@ -138,7 +138,7 @@ void count_time(int seconds)
 	"arc4, des3, des, camellia, blowfish,\n"				\
 	"aes_cbc, aes_gcm, aes_ccm, aes_cmac, des3_cmac,\n"		\
 	"havege, ctr_drbg, hmac_drbg\n"							\
-	"rsa, dhm, ecdsa, ecdh.\n"
+	"rsa, dhm, ecdsa, ecdh, ecc.\n"
 
 #if defined(MBEDTLS_ERROR_C)
 #define PRINT_ERROR													\
@@ -215,6 +215,30 @@ do {																	\
 	}																	\
 } while (0)
 
+/*
+ * Like TIME_PUBLIC, but reports operations per second
+ */
+#define TIME_OPS(TITLE, TYPE, CODE)										\
+do {																	\
+	unsigned long ii;													\
+	int ret;															\
+																		\
+	mbedtls_printf(HEADER_FORMAT, TITLE);								\
+	fflush(stdout);														\
+	count_time(3);														\
+																		\
+	ret = 0;															\
+	for (ii = 0; sleep_time && ! ret; ii++) {							\
+		CODE;															\
+	}																	\
+																		\
+	if (ret != 0) {														\
+		PRINT_ERROR;													\
+	} else {															\
+		mbedtls_printf("%6lu.%02lu " TYPE "/s\n", ii / 3, (ii % 3) * 100 / 3);	\
+	}																	\
+} while (0)
+
 struct pthread_arg {
 	int argc;
 	char **argv;
@@ -250,7 +274,8 @@ static int myrand(void *rng_state, unsigned char *output, size_t len)
 #if defined(MBEDTLS_ECP_C)
 void ecp_clear_precomputed(mbedtls_ecp_group *grp)
 {
-	if (grp->T != NULL) {
+	/* T_size is 0 for the tables kept in flash, which are not freed */
+	if (grp->T != NULL && grp->T_size != 0) {
 		size_t i;
 		for (i = 0; i < grp->T_size; i++) {
 			mbedtls_ecp_point_free(&grp->T[i]);
@@ -264,6 +289,73 @@ void ecp_clear_precomputed(mbedtls_ecp_group *grp)
 #define ecp_clear_precomputed(g)
 #endif
 
+#if defined(MBEDTLS_ECDSA_C) && defined(MBEDTLS_ECDH_C) && defined(MBEDTLS_SHA256_C)
+/*
+ * ECC operations as a TLS handshake runs them: each one loads its own group,
+ * so the cost of the precomputations is counted in every operation.
+ */
+static int ecc_sign(mbedtls_ecp_group_id grp_id, const mbedtls_mpi *d, const unsigned char *hash,
+					unsigned char *sig, size_t *sig_len)
+{
+	mbedtls_ecdsa_context ecdsa;
+	int ret;
+
+	mbedtls_ecdsa_init(&ecdsa);
+	ret = mbedtls_ecp_group_load(&ecdsa.grp, grp_id);
+	if (ret == 0) {
+		ret = mbedtls_mpi_copy(&ecdsa.d, d);
+	}
+	if (ret == 0) {
+		ret = mbedtls_ecdsa_write_signature(&ecdsa, MBEDTLS_MD_SHA256, hash, 32, sig, sig_len, myrand, NULL);
+	}
+	mbedtls_ecdsa_free(&ecdsa);
+
+	return ret;
+}
+
+static int ecc_verify(mbedtls_ecp_group_id grp_id, const mbedtls_ecp_point *Q, const unsigned char *hash,
+					  const unsigned char *sig, size_t sig_len)
+{
+	mbedtls_ecdsa_context ecdsa;
+	int ret;
+
+	mbedtls_ecdsa_init(&ecdsa);
+	ret = mbedtls_ecp_group_load(&ecdsa.grp, grp_id);
+	if (ret == 0) {
+		ret = mbedtls_ecp_copy(&ecdsa.Q, Q);
+	}
+	if (ret == 0) {
+		ret = mbedtls_ecdsa_read_signature(&ecdsa, hash, 32, sig, sig_len);
+	}
+	mbedtls_ecdsa_free(&ecdsa);
+
+	return ret;
+}
+
+static int ecc_ecdhe(mbedtls_ecp_group_id grp_id, const mbedtls_ecp_point *Qp)
+{
+	mbedtls_ecdh_context ecdh;
+	unsigned char out[MBEDTLS_ECP_MAX_PT_LEN];
+	size_t olen;
+	int ret;
+
+	mbedtls_ecdh_init(&ecdh);
+	ret = mbedtls_ecp_group_load(&ecdh.grp, grp_id);
+	if (ret == 0) {
+		ret = mbedtls_ecdh_make_public(&ecdh, &olen, out, sizeof(out), myrand, NULL);
+	}
+	if (ret == 0) {
+		ret = mbedtls_ecp_copy(&ecdh.Qp, Qp);
+	}
+	if (ret == 0) {
+		ret = mbedtls_ecdh_calc_secret(&ecdh, &olen, out, sizeof(out), myrand, NULL);
+	}
+	mbedtls_ecdh_free(&ecdh);
+
+	return ret;
+}
+#endif
+
 unsigned char buf[BUFSIZE];
 
 typedef struct {
@@ -272,7 +364,7 @@ typedef struct {
 		 aes_cbc, aes_gcm, aes_ccm, aes_cmac, des3_cmac,
 		 camellia, blowfish,
 		 havege, ctr_drbg, hmac_drbg,
-		 rsa, dhm, ecdsa, ecdh;
+		 rsa, dhm, ecdsa, ecdh, ecc;
 } todo_list;
 
 pthread_addr_t tls_benchmark_cb(void *args)
@@ -342,6 +434,8 @@ pthread_addr_t tls_benchmark_cb(void *args)
 				todo.ecdsa = 1;
 			} else if (strcmp(argv[i], "ecdh") == 0) {
 				todo.ecdh = 1;
+			} else if (strcmp(argv[i], "ecc") == 0) {
+				todo.ecc = 1;
 			} else {
 				mbedtls_printf("Unrecognized option: %s\n", argv[i]);
 				mbedtls_printf("Available options: " OPTIONS);
@@ -819,6 +913,36 @@ pthread_addr_t tls_benchmark_cb(void *args)
 	}
 #endif
 
+#if defined(MBEDTLS_ECDSA_C) && defined(MBEDTLS_ECDH_C) && defined(MBEDTLS_SHA256_C)
+	if (todo.ecc) {
+		mbedtls_ecdsa_context key;
+		const mbedtls_ecp_curve_info *curve_info;
+		size_t sig_len;
+
+		memset(buf, 0x2A, sizeof(buf));
+
+		for (curve_info = mbedtls_ecp_curve_list();
+			 curve_info->grp_id != MBEDTLS_ECP_DP_NONE;
+			 curve_info++) {
+			mbedtls_ecdsa_init(&key);
+
+			if (mbedtls_ecdsa_genkey(&key, curve_info->grp_id, myrand, NULL) != 0 ||
+				ecc_sign(curve_info->grp_id, &key.d, buf, tmp, &sig_len) != 0) {
+				mbedtls_exit(1);
+			}
+
+			mbedtls_snprintf(title, sizeof(title), "ECDSA-%s", curve_info->name);
+			TIME_OPS(title, "sign", ret = ecc_sign(curve_info->grp_id, &key.d, buf, tmp, &sig_len));
+			TIME_OPS(title, "verify", ret = ecc_verify(curve_info->grp_id, &key.Q, buf, tmp, sig_len));
+
+			mbedtls_snprintf(title, sizeof(title), "ECDHE-%s", curve_info->name);
+			TIME_OPS(title, "ECDH", ret = ecc_ecdhe(curve_info->grp_id, &key.Q));
+
+			mbedtls_ecdsa_free(&key);
+		}
+	}
+#endif
+
 	mbedtls_printf("Benchmark test finished \n");
 	mbedtls_printf("\n");
 
@@ -834,8 +958,12 @@ int tls_benchmark_main(int argc, char **argv)
 	pthread_t tid;
 	pthread_attr_t attr;
 	struct sched_param sparam;
+	struct pthread_arg args;
 	int r;
 
+	args.argc = argc;
+	args.argv = argv;
+
 	/* Initialize the attribute variable */
 	if ((r = pthread_attr_init(&attr)) != 0) {
 		printf("%s: pthread_attr_init failed, status=%d\n", __func__, r);
@@ -857,7 +985,7 @@ int tls_benchmark_main(int argc, char **argv)
 	}
 
 	/* 3. create pthread with entry function */
-	if ((r = pthread_create(&tid, &attr, tls_benchmark_cb, (void *)0)) != 0) {
+	if ((r = pthread_create(&tid, &attr, tls_benchmark_cb, (void *)&args)) != 0) {
 		printf("%s: pthread_create failed, status=%d\n", __func__, r);
 	}
 
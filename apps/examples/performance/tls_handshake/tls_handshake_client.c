@@ -16,6 +16,9 @@
  *
  ****************************************************************************/
 #include <tinyara/config.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <time.h>
 
 #include "mbedtls/config.h"
@@ -26,6 +29,7 @@
 #include "mbedtls/ctr_drbg.h"
 #include "mbedtls/error.h"
 #include "mbedtls/certs.h"
+#include "mbedtls/tls_session_store.h"
 
 #include <string.h>
 
@@ -66,20 +70,137 @@ static unsigned char rootca[] =
 
 static int rootca_len = sizeof(rootca);
 
-int tls_handshake_client(char *ipaddr)
+static uint64_t tls_hs_usec(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/*
+ * Offer the session of the previous connection, through the system-wide
+ * store when it is configured
+ */
+static int tls_hs_offer(mbedtls_ssl_context *ssl, mbedtls_ssl_session *saved)
+{
+#ifdef CONFIG_TLS_SESSION_STORE
+	return tls_session_store_get(SERVER_ADDR, atoi(SERVER_PORT), ssl);
+#else
+	if (saved->ciphersuite == 0) {
+		return -1;
+	}
+	return mbedtls_ssl_set_session(ssl, saved);
+#endif
+}
+
+static void tls_hs_keep(mbedtls_ssl_context *ssl, mbedtls_ssl_session *saved)
+{
+#ifdef CONFIG_TLS_SESSION_STORE
+	tls_session_store_put(SERVER_ADDR, atoi(SERVER_PORT), ssl);
+#endif
+	mbedtls_ssl_get_session(ssl, saved);
+}
+
+/*
+ * Connect, handshake and fetch the page once.
+ * Returns the handshake time in usec, or a negative mbedtls error.
+ */
+static int64_t tls_hs_connect(mbedtls_ssl_config *conf, mbedtls_ssl_session *saved, int resume, int *resumed)
 {
 	mbedtls_net_context server_fd;
-	uint32_t flags;
+	mbedtls_ssl_context ssl;
 	unsigned char buf[1024];
+	unsigned char master[48];
+	uint64_t start;
+	int64_t elapsed = 0;
+	int offered = 0;
+	uint32_t flags;
+	int ret;
+	int len;
+
+	mbedtls_net_init(&server_fd);
+	mbedtls_ssl_init(&ssl);
+	*resumed = 0;
+
+	if ((ret = mbedtls_net_connect(&server_fd, SERVER_ADDR,
+								   SERVER_PORT, MBEDTLS_NET_PROTO_TCP)) != 0) {
+		mbedtls_printf(" failed\n	 ! mbedtls_net_connect returned %d\n\n", ret);
+		goto exit;
+	}
+
+	if ((ret = mbedtls_ssl_setup(&ssl, conf)) != 0) {
+		mbedtls_printf(" failed\n	 ! mbedtls_ssl_setup returned %d\n\n", ret);
+		goto exit;
+	}
+
+	mbedtls_ssl_set_bio(&ssl, &server_fd, mbedtls_net_send, mbedtls_net_recv, NULL);
+
+	if (resume && tls_hs_offer(&ssl, saved) == 0) {
+		offered = 1;
+		memcpy(master, saved->master, sizeof(master));
+	}
+
+	start = tls_hs_usec();
+	while ((ret = mbedtls_ssl_handshake(&ssl)) != 0) {
+		if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+			mbedtls_printf(" failed\n	 ! mbedtls_ssl_handshake returned -0x%x\n\n", (unsigned int)-ret);
+			goto exit;
+		}
+	}
+	elapsed = tls_hs_usec() - start;
+
+	if ((flags = mbedtls_ssl_get_verify_result(&ssl)) != 0) {
+		char vrfy_buf[512];
+
+		mbedtls_x509_crt_verify_info(vrfy_buf, sizeof(vrfy_buf), "	! ", flags);
+		mbedtls_printf("%s\n", vrfy_buf);
+	}
+
+	tls_hs_keep(&ssl, saved);
+
+	/* A resumed session keeps its master secret */
+	*resumed = offered && !memcmp(master, saved->master, sizeof(master));
+
+	len = sprintf((char *)buf, GET_REQUEST);
+
+	while ((ret = mbedtls_ssl_write(&ssl, buf, len)) <= 0) {
+		if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+			mbedtls_printf(" failed\n	 ! mbedtls_ssl_write returned %d\n\n", ret);
+			goto exit;
+		}
+	}
+
+	/* Drain the response, the server closes the connection after it */
+	do {
+		ret = mbedtls_ssl_read(&ssl, buf, sizeof(buf));
+	} while (ret > 0 || ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE);
+
+	mbedtls_ssl_close_notify(&ssl);
+	ret = 0;
+
+exit:
+	mbedtls_net_free(&server_fd);
+	mbedtls_ssl_free(&ssl);
+
+	return ret != 0 ? ret : elapsed;
+}
+
+int tls_handshake_client(char *ipaddr, int count)
+{
 	const char *pers = "ssl_client1";
 
 	mbedtls_entropy_context entropy;
 	mbedtls_ctr_drbg_context ctr_drbg;
-	mbedtls_ssl_context ssl;
 	mbedtls_ssl_config conf;
 	mbedtls_x509_crt cacert;
+	mbedtls_ssl_session saved;
+	uint64_t total[2] = { 0, 0 };
+	int nruns[2] = { 0, 0 };
+	int64_t elapsed;
+	int resumed;
 	int ret = 1;
-	int len = 0;
+	int i;
 	struct timespec ts;
 	SERVER_ADDR = ipaddr;
 	ts.tv_sec = 1633074152; // 2021-10-01
@@ -94,11 +215,10 @@ int tls_handshake_client(char *ipaddr)
 	/*
 	 * 0. Initialize the RNG and the session data
 	 */
-	mbedtls_net_init(&server_fd);
-	mbedtls_ssl_init(&ssl);
 	mbedtls_ssl_config_init(&conf);
 	mbedtls_x509_crt_init(&cacert);
 	mbedtls_ctr_drbg_init(&ctr_drbg);
+	mbedtls_ssl_session_init(&saved);
 
 	mbedtls_printf("\n	. Seeding the random number generator...");
 	fflush(stdout);
@@ -114,8 +234,8 @@ int tls_handshake_client(char *ipaddr)
 	mbedtls_printf(" ok\n");
 
 	/*
-		 * 0. Initialize certificates
-		 */
+	 * 1. Initialize certificates
+	 */
 	mbedtls_printf("	. Loading the CA root certificate ...");
 	fflush(stdout);
 
@@ -129,22 +249,8 @@ int tls_handshake_client(char *ipaddr)
 	mbedtls_printf(" ok (%d skipped)\n", ret);
 
 	/*
-		 * 1. Start the connection
-		 */
-	mbedtls_printf("	. Connecting to tcp/%s/%s...", SERVER_ADDR, SERVER_PORT);
-	fflush(stdout);
-
-	if ((ret = mbedtls_net_connect(&server_fd, SERVER_ADDR,
-								   SERVER_PORT, MBEDTLS_NET_PROTO_TCP)) != 0) {
-		mbedtls_printf(" failed\n	 ! mbedtls_net_connect returned %d\n\n", ret);
-		goto exit;
-	}
-
-	mbedtls_printf(" ok\n");
-
-	/*
-		 * 2. Setup stuff
-		 */
+	 * 2. Setup stuff
+	 */
 	mbedtls_printf("	. Setting up the SSL/TLS structure...");
 	fflush(stdout);
 
@@ -158,117 +264,51 @@ int tls_handshake_client(char *ipaddr)
 
 	mbedtls_printf(" ok\n");
 
-	/* OPTIONAL is not optimal for security,
-		 * but makes interop easier in this simplified example */
 	mbedtls_ssl_conf_authmode(&conf, MBEDTLS_SSL_VERIFY_REQUIRED);
 	mbedtls_ssl_conf_ca_chain(&conf, &cacert, NULL);
 	mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &ctr_drbg);
 	mbedtls_ssl_conf_dbg(&conf, my_debug, stdout);
 
-	if ((ret = mbedtls_ssl_setup(&ssl, &conf)) != 0) {
-		mbedtls_printf(" failed\n	 ! mbedtls_ssl_setup returned %d\n\n", ret);
-		goto exit;
-	}
-
-	mbedtls_ssl_set_bio(&ssl, &server_fd, mbedtls_net_send, mbedtls_net_recv, NULL);
+#ifdef CONFIG_TLS_SESSION_STORE
+	tls_session_store_remove(SERVER_ADDR, atoi(SERVER_PORT));
+#endif
 
 	/*
-		 * 4. Handshake
-		 */
-	mbedtls_printf("	. Performing the SSL/TLS handshake...");
-	fflush(stdout);
+	 * 3. Full handshakes, then handshakes resuming the previous session
+	 */
+	mbedtls_printf("	. %d full and %d resumed handshakes with tcp/%s/%s\n", count, count, SERVER_ADDR, SERVER_PORT);
 
-	while ((ret = mbedtls_ssl_handshake(&ssl)) != 0) {
-		if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
-			mbedtls_printf(" failed\n	 ! mbedtls_ssl_handshake returned -0x%x\n\n", (unsigned int)-ret);
+	for (i = 0; i < 2 * count; i++) {
+		elapsed = tls_hs_connect(&conf, &saved, i >= count, &resumed);
+		if (elapsed < 0) {
+			ret = (int)elapsed;
 			goto exit;
 		}
-	}
-
-	mbedtls_printf(" ok\n");
-
-	/*
-		 * 5. Verify the server certificate
-		 */
-	mbedtls_printf("	. Verifying peer X.509 certificate...");
 
-	/* In real life, we probably want to bail out when ret != 0 */
-	if ((flags = mbedtls_ssl_get_verify_result(&ssl)) != 0) {
-		char vrfy_buf[512];
-
-		mbedtls_printf(" failed\n");
-
-		mbedtls_x509_crt_verify_info(vrfy_buf, sizeof(vrfy_buf), "	! ", flags);
-
-		mbedtls_printf("%s\n", vrfy_buf);
-	} else
-		mbedtls_printf(" ok\n");
-
-	/*
-		 * 3. Write the GET request
-		 */
-	mbedtls_printf("	> Write to server:");
-	fflush(stdout);
-
-	len = sprintf((char *)buf, GET_REQUEST);
-
-	while ((ret = mbedtls_ssl_write(&ssl, buf, len)) <= 0) {
-		if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
-			mbedtls_printf(" failed\n	 ! mbedtls_ssl_write returned %d\n\n", ret);
-			goto exit;
-		}
+		mbedtls_printf("	  #%d %s handshake : %llu ms\n", i + 1, resumed ? "resumed" : "full", (unsigned long long)elapsed / 1000);
+		total[resumed] += elapsed;
+		nruns[resumed]++;
 	}
 
-	len = ret;
-	mbedtls_printf(" %d bytes written\n\n%s", len, (char *)buf);
-
-	/*
-		 * 7. Read the HTTP response
-		 */
-	mbedtls_printf("	< Read from server:");
-	fflush(stdout);
-
-	do {
-		len = sizeof(buf) - 1;
-		memset(buf, 0, sizeof(buf));
-		ret = mbedtls_ssl_read(&ssl, buf, len);
-
-		if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
-			continue;
-		}
-		if (ret == MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY) {
-			ret = 0;
-			break;
-		}
-		if (ret < 0) {
-			mbedtls_printf("failed\n	! mbedtls_ssl_read returned %d\n\n", ret);
-			break;
+	for (i = 0; i < 2; i++) {
+		if (nruns[i] > 0) {
+			mbedtls_printf("	. %s handshake average : %llu ms over %d\n", i ? "resumed" : "full", (unsigned long long)(total[i] / nruns[i] / 1000), nruns[i]);
 		}
-		if (ret == 0) {
-			mbedtls_printf("\n\nEOF\n\n");
-			break;
-		}
-
-		len = ret;
-		mbedtls_printf(" %d bytes read\n\n%s", len, (char *)buf);
-	} while (1);
-
-	mbedtls_ssl_close_notify(&ssl);
+	}
+	ret = 0;
 
 exit:
 
 #ifdef MBEDTLS_ERROR_C
-	if (ret != -1) {
+	if (ret != 0) {
 		char error_buf[100];
 		mbedtls_strerror(ret, error_buf, 100);
 		mbedtls_printf("Last error was: %d - %s\n\n", ret, error_buf);
 	}
 #endif
 
-	mbedtls_net_free(&server_fd);
-
+	mbedtls_ssl_session_free(&saved);
 	mbedtls_x509_crt_free(&cacert);
-	mbedtls_ssl_free(&ssl);
 	mbedtls_ssl_config_free(&conf);
 	mbedtls_ctr_drbg_free(&ctr_drbg);
 	mbedtls_entropy_free(&entropy);
@@ -25,15 +25,17 @@
 #include "tls_handshake_usage.h"
 
 extern int tls_handshake_server(void);
-extern int tls_handshake_client(char *ipaddr);
+extern int tls_handshake_client(char *ipaddr, int count);
+
+#define TLS_HANDSHAKE_DEFAULT_COUNT 3
 
 int tls_handshake_main(int argc, char **argv)
 {
 	if (argc == 2 && !strncmp("-s", argv[1], 3)) {
 		tls_handshake_server();
 		return 0;
-	} else if (argc == 3 && !strncmp("-c", argv[1], 3)) {
-		tls_handshake_client(argv[2]);
+	} else if ((argc == 3 || argc == 4) && !strncmp("-c", argv[1], 3)) {
+		tls_handshake_client(argv[2], argc == 4 ? atoi(argv[3]) : TLS_HANDSHAKE_DEFAULT_COUNT);
 		return 0;
 	}
 
@@ -90,6 +90,7 @@ int main(void)
 #if defined(MBEDTLS_SSL_CACHE_C)
 #include "mbedtls/ssl_cache.h"
 #endif
+#include "mbedtls/tls_session_store.h"
 
 #define HTTP_RESPONSE                                    \
 	"HTTP/1.0 200 OK\r\nContent-Type: text/html\r\n\r\n" \
@@ -296,6 +297,13 @@ int tls_handshake_server(void)
 								   mbedtls_ssl_cache_set);
 #endif
 
+#ifdef CONFIG_TLS_SESSION_STORE
+	if ((ret = tls_ticket_keys_conf(&conf)) != 0) {
+		mbedtls_printf(" failed\n  ! tls_ticket_keys_conf returned %d\n\n", ret);
+		goto exit;
+	}
+#endif
+
 	mbedtls_ssl_conf_ca_chain(&conf, srvcert.next, NULL);
 	if ((ret = mbedtls_ssl_conf_own_cert(&conf, &srvcert, &pkey)) != 0) {
 		mbedtls_printf(" failed\n  ! mbedtls_ssl_conf_own_cert returned %d\n\n", ret);
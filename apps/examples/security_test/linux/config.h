@@ -7,6 +7,7 @@
 #define CONFIG_EXAMPLES_TESTCASE_SECURITY_FRAMEWORK_UTC_CRYPTO 1
 #define CONFIG_EXAMPLES_TESTCASE_SECURITY_FRAMEWORK_UTC_KEYMGR 1
 #define CONFIG_EXAMPLES_TESTCASE_SECURITY_FRAMEWORK_UTC_SS 1
+#define CONFIG_SECURITY_LINK_BATCH_ASYNC 1
 
 #define FAR
 #define ERROR -1
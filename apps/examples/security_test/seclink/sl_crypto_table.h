@@ -20,3 +20,7 @@ SL_CRYPTO_TEST_POOL("aes_ecb", SL_CRYPTO_TYPE_AES_ECB, sl_handle_crypto_aes_ecb)
 SL_CRYPTO_TEST_POOL("aes_cbc", SL_CRYPTO_TYPE_AES_CBC, sl_handle_crypto_aes_cbc)
 SL_CRYPTO_TEST_POOL("aes_cfb128", SL_CRYPTO_TYPE_AES_CFB128, sl_handle_crypto_aes_cfb128)
 SL_CRYPTO_TEST_POOL("aes_ctr", SL_CRYPTO_TYPE_AES_CTR, sl_handle_crypto_aes_ctr)
+SL_CRYPTO_TEST_POOL("batch", SL_CRYPTO_TYPE_BATCH, sl_handle_crypto_batch)
+#ifdef CONFIG_SECURITY_LINK_BATCH_ASYNC
+SL_CRYPTO_TEST_POOL("batch_async", SL_CRYPTO_TYPE_BATCH_ASYNC, sl_handle_crypto_batch_async)
+#endif
@@ -209,6 +209,105 @@ START_TEST_F(aes_ctr)
 }
 END_TEST_F
 
+START_TEST_F(batch)
+{
+	hal_data aes_key = HAL_DATA_INITIALIZER;
+	hal_data enc = HAL_DATA_INITIALIZER;
+	hal_data dec = HAL_DATA_INITIALIZER;
+	hal_data out = HAL_DATA_INITIALIZER;
+	hal_data hash = HAL_DATA_INITIALIZER;
+	HAL_INIT_AES_PARAM(param);
+	unsigned char output[16] = {0,};
+	unsigned char digest[32] = {0,};
+	sl_batch batch = NULL;
+
+	aes_key.data = g_key_128;
+	aes_key.data_len = 16;
+	param.mode = HAL_AES_ECB_NOPAD;
+	enc.data = g_plaintext;
+	enc.data_len = 16;
+	dec.data = g_ciphertext;
+	dec.data_len = 16;
+	out.data = output;
+	out.data_len = 16;
+	hash.data = digest;
+	hash.data_len = 32;
+
+	ST_EXPECT_EQ(SECLINK_OK, sl_set_key(g_hnd, HAL_KEY_AES_128, ST_AES_ENC_KEY_IDX, &aes_key, NULL));
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_create(g_hnd, 3, &batch));
+
+	/*  the decryption uses the output of the encryption in the same batch */
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_aes_encrypt(batch, &enc, &param, ST_AES_ENC_KEY_IDX, &dec));
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_aes_decrypt(batch, &dec, &param, ST_AES_ENC_KEY_IDX, &out));
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_get_hash(batch, HAL_HASH_SHA256, &enc, &hash));
+	ST_EXPECT_EQ(SECLINK_NOT_ENOUGH_MEMORY, sl_batch_get_hash(batch, HAL_HASH_SHA256, &enc, &hash));
+
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_submit(batch));
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_get_result(batch, 0));
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_get_result(batch, 1));
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_get_result(batch, 2));
+	ST_EXPECT_EQ(SECLINK_INVALID_ARGS, sl_batch_get_result(batch, 3));
+	sl_test_print_buffer(dec.data, dec.data_len, "AES-ECB ciphertext");
+	ST_EXPECT_EQ(0, memcmp(g_plaintext, output, 16));
+
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_reset(batch));
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_submit(batch));
+
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_destroy(batch));
+	ST_EXPECT_EQ(SECLINK_OK, sl_remove_key(g_hnd, HAL_KEY_AES_128, ST_AES_ENC_KEY_IDX));
+}
+END_TEST_F
+
+#ifdef CONFIG_SECURITY_LINK_BATCH_ASYNC
+START_TEST_F(batch_async)
+{
+	hal_data aes_key = HAL_DATA_INITIALIZER;
+	hal_data enc = HAL_DATA_INITIALIZER;
+	hal_data dec[2] = {HAL_DATA_INITIALIZER, HAL_DATA_INITIALIZER};
+	HAL_INIT_AES_PARAM(param);
+	unsigned char output[16] = {0,};
+	sl_batch batch[2] = {NULL, NULL};
+	sl_batch done = NULL;
+
+	aes_key.data = g_key_128;
+	aes_key.data_len = 16;
+	param.mode = HAL_AES_ECB_NOPAD;
+	enc.data = g_plaintext;
+	enc.data_len = 16;
+	dec[0].data = g_ciphertext;
+	dec[0].data_len = 16;
+	dec[1].data = output;
+	dec[1].data_len = 16;
+
+	ST_EXPECT_EQ(SECLINK_OK, sl_set_key(g_hnd, HAL_KEY_AES_128, ST_AES_ENC_KEY_IDX, &aes_key, NULL));
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_create(g_hnd, 1, &batch[0]));
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_create(g_hnd, 1, &batch[1]));
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_aes_encrypt(batch[0], &enc, &param, ST_AES_ENC_KEY_IDX, &dec[0]));
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_aes_encrypt(batch[1], &enc, &param, ST_AES_ENC_KEY_IDX, &dec[1]));
+
+	ST_EXPECT_EQ(SECLINK_INVALID_REQUEST, sl_batch_wait(g_hnd, &done));
+
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_submit_async(batch[0]));
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_submit_async(batch[1]));
+	/*  a queued batch can not be changed or read, nor its handle closed */
+	ST_EXPECT_EQ(SECLINK_BUSY, sl_batch_reset(batch[1]));
+	ST_EXPECT_EQ(SECLINK_BUSY, sl_batch_get_result(batch[1], 0));
+	ST_EXPECT_EQ(SECLINK_BUSY, sl_deinit(g_hnd));
+
+	/*  the batches complete in the order they were queued */
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_wait(g_hnd, &done));
+	ST_EXPECT_EQ(1, batch[0] == done);
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_wait(g_hnd, &done));
+	ST_EXPECT_EQ(1, batch[1] == done);
+	ST_EXPECT_EQ(0, memcmp(g_ciphertext, output, 16));
+
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_destroy(batch[0]));
+	ST_EXPECT_EQ(SECLINK_OK, sl_batch_destroy(batch[1]));
+	ST_EXPECT_EQ(SECLINK_OK, sl_remove_key(g_hnd, HAL_KEY_AES_128, ST_AES_ENC_KEY_IDX));
+}
+END_TEST_F
+#endif
+
 void sl_handle_crypto_aes_ecb(sl_options *opt)
 {
 	ST_SET_SMOKE1(sl_crypto, opt->count, 0, "aes test", aes_ecb);
@@ -229,6 +328,18 @@ void sl_handle_crypto_aes_ctr(sl_options *opt)
 	ST_SET_SMOKE1(sl_crypto, opt->count, 0, "aes test", aes_ctr);
 }
 
+void sl_handle_crypto_batch(sl_options *opt)
+{
+	ST_SET_SMOKE1(sl_crypto, opt->count, 0, "batch test", batch);
+}
+
+#ifdef CONFIG_SECURITY_LINK_BATCH_ASYNC
+void sl_handle_crypto_batch_async(sl_options *opt)
+{
+	ST_SET_SMOKE1(sl_crypto, opt->count, 0, "batch async test", batch_async);
+}
+#endif
+
 void sl_handle_crypto(sl_options *opt)
 {
 	ST_TC_SET_GLOBAL(sl_crypto, sl_crypto_global);
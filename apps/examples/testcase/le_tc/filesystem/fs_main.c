@@ -45,6 +45,9 @@
 #include <sys/statfs.h>
 #include <sys/select.h>
 #include <sys/types.h>
+#ifdef CONFIG_FS_EPOLL
+#include <sys/epoll.h>
+#endif
 
 #include <tinyara/streams.h>
 #include <tinyara/fs/ioctl.h>
@@ -2724,6 +2727,73 @@ static void tc_fs_vfs_poll_p(void)
 	TC_SUCCESS_RESULT();
 }
 
+#ifdef CONFIG_FS_EPOLL
+/**
+ * @testcase         tc_fs_vfs_epoll_p
+ * @brief            Polling for I/O with a persistent interest set
+ * @scenario         Register a regular file, check that it is reported on
+ *                   every epoll_wait (level-triggered) until it is removed
+ * @apicovered       epoll_create1, epoll_ctl, epoll_wait
+ * @precondition     CONFIG_FS_EPOLL should be enabled
+ * @postcondition    NA
+ */
+static void tc_fs_vfs_epoll_p(void)
+{
+	struct epoll_event ev;
+	struct epoll_event out;
+	int epfd;
+	int ret;
+	int fd;
+	char *filename = VFS_FILE_PATH;
+
+	/* Init */
+	vfs_mount();
+
+	fd = open(filename, O_RDWR | O_CREAT | O_TRUNC);
+	TC_ASSERT_GEQ_CLEANUP("open", fd, 0, vfs_unmount());
+
+	epfd = epoll_create1(EPOLL_CLOEXEC);
+	TC_ASSERT_EQ_CLEANUP("epoll_create1", epfd, ERROR, close(epfd); close(fd); vfs_unmount());
+	TC_ASSERT_EQ_CLEANUP("epoll_create1", errno, EINVAL, close(fd); vfs_unmount());
+
+	epfd = epoll_create1(0);
+	TC_ASSERT_GEQ_CLEANUP("epoll_create1", epfd, 0, close(fd); vfs_unmount());
+
+	/* Testcase */
+	ev.events = EPOLLIN | EPOLLOUT;
+	ev.data.fd = fd;
+	ret = epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev);
+	TC_ASSERT_EQ_CLEANUP("epoll_ctl", ret, OK, close(epfd); close(fd); vfs_unmount());
+
+	ret = epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev);
+	TC_ASSERT_EQ_CLEANUP("epoll_ctl", ret, ERROR, close(epfd); close(fd); vfs_unmount());
+	TC_ASSERT_EQ_CLEANUP("epoll_ctl", errno, EEXIST, close(epfd); close(fd); vfs_unmount());
+
+	/* Regular files are always ready, and stay reported while registered */
+	ret = epoll_wait(epfd, &out, 1, -1);
+	TC_ASSERT_EQ_CLEANUP("epoll_wait", ret, 1, close(epfd); close(fd); vfs_unmount());
+	TC_ASSERT_EQ_CLEANUP("epoll_wait", out.data.fd, fd, close(epfd); close(fd); vfs_unmount());
+	TC_ASSERT_CLEANUP("epoll_wait", out.events & EPOLLIN, close(epfd); close(fd); vfs_unmount());
+	TC_ASSERT_CLEANUP("epoll_wait", out.events & EPOLLOUT, close(epfd); close(fd); vfs_unmount());
+
+	ret = epoll_wait(epfd, &out, 1, 0);
+	TC_ASSERT_EQ_CLEANUP("epoll_wait", ret, 1, close(epfd); close(fd); vfs_unmount());
+
+	ret = epoll_ctl(epfd, EPOLL_CTL_DEL, fd, NULL);
+	TC_ASSERT_EQ_CLEANUP("epoll_ctl", ret, OK, close(epfd); close(fd); vfs_unmount());
+
+	ret = epoll_wait(epfd, &out, 1, 0);
+	TC_ASSERT_EQ_CLEANUP("epoll_wait", ret, 0, close(epfd); close(fd); vfs_unmount());
+
+	/* Deinit */
+	close(epfd);
+	close(fd);
+	vfs_unmount();
+
+	TC_SUCCESS_RESULT();
+}
+#endif
+
 #ifndef CONFIG_DISABLE_MANUAL_TESTCASE
 /**
  * @testcase         tc_fs_vfs_select_p
@@ -4607,6 +4677,7 @@ static void tc_libc_stdio_memoutstream_p(void)
 {
 	char buffer[STDIO_BUFLEN];
 	char *str = STREAM_TEST_CONTENTS;
+	int i;
 
 	struct lib_memoutstream_s memoutstream;
 
@@ -4620,6 +4691,18 @@ static void tc_libc_stdio_memoutstream_p(void)
 	TC_ASSERT_EQ("memoutstream_putc", memoutstream.public.nput, 1);
 	TC_ASSERT_EQ("lib_memoutstream", memoutstream.buffer[0], str[0]);
 
+	/* Bulk write, clamped to the space left in the buffer */
+
+	memoutstream.public.puts((FAR struct lib_outstream_s *)&memoutstream.public, str + 1, strlen(str) - 1);
+	TC_ASSERT_EQ("memoutstream_puts", memoutstream.public.nput, strlen(str));
+	TC_ASSERT_EQ("memoutstream_puts", strcmp(memoutstream.buffer, str), 0);
+
+	for (i = 0; i < STDIO_BUFLEN / strlen(str) + 1; i++) {
+		memoutstream.public.puts((FAR struct lib_outstream_s *)&memoutstream.public, str, strlen(str));
+	}
+	TC_ASSERT_EQ("memoutstream_puts", memoutstream.public.nput, (STDIO_BUFLEN - 1));
+	TC_ASSERT_EQ("memoutstream_puts", memoutstream.buffer[STDIO_BUFLEN - 1], '\0');
+
 	TC_SUCCESS_RESULT();
 }
 
@@ -6229,6 +6312,9 @@ int tc_filesystem_main(int argc, char *argv[])
 	tc_fs_vfs_fdopen_invalid_fp_n();
 #ifndef CONFIG_DISABLE_POLL
 	tc_fs_vfs_poll_p();
+#ifdef CONFIG_FS_EPOLL
+	tc_fs_vfs_epoll_p();
+#endif
 #ifndef CONFIG_DISABLE_MANUAL_TESTCASE
 	tc_fs_vfs_select_p();
 #endif
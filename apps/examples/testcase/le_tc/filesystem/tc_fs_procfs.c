@@ -25,6 +25,7 @@
  ****************************************************************************/
 #include <tinyara/config.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <dirent.h>
 #include <fcntl.h>
@@ -46,6 +47,7 @@
 #define LOOP_COUNT 5
 #define PROC_UPTIME_PATH PROCFS_TEST_MOUNTPOINT"/uptime"
 #define PROC_VERSION_PATH PROCFS_TEST_MOUNTPOINT"/version"
+#define PROC_STACKHWM_PATH PROCFS_TEST_MOUNTPOINT"/stackhwm"
 #define PROC_INVALID_PATH PROCFS_TEST_MOUNTPOINT"/nofile"
 #define INVALID_PATH PROCFS_TEST_MOUNTPOINT"/fs/invalid"
 #define PROC_SMARTFS_PATH PROCFS_TEST_MOUNTPOINT"/fs/smartfs"
@@ -186,6 +188,38 @@ static int procfs_version_ops(char *dirpath)
 		return OK;
 }
 
+#if defined(CONFIG_STACK_HWM) && !defined(CONFIG_FS_PROCFS_EXCLUDE_STACKHWM)
+static int procfs_stackhwm_ops(char *dirpath)
+{
+	int fd;
+	ssize_t nread;
+	char buf[PROC_BUFFER_LEN];
+
+	fd = open(dirpath, O_RDONLY);
+	if (fd < 0) {
+		printf("Failed to open %s\n", dirpath);
+		return ERROR;
+	}
+
+	nread = read(fd, buf, PROC_BUFFER_LEN - 1);
+	close(fd);
+	if (nread <= 0) {
+		printf("Failed to read %s\n", dirpath);
+		return ERROR;
+	}
+	buf[nread] = '\0';
+
+	/* The header is followed by the line of the idle task, pid 0 */
+
+	if (strncmp(buf, "stackhwm\ntask 0 ", 16) != 0) {
+		printf("Unexpected content of %s: %s\n", dirpath, buf);
+		return ERROR;
+	}
+
+	return OK;
+}
+#endif
+
 static int procfs_rewind_tc(const char *dirpath)
 {
 	int count;
@@ -346,6 +380,10 @@ void tc_fs_procfs_main(void)
 
 	ret = procfs_version_ops(PROC_UPTIME_PATH);
 	TC_ASSERT_EQ("procfs_version_ops", ret, OK);
+#if defined(CONFIG_STACK_HWM) && !defined(CONFIG_FS_PROCFS_EXCLUDE_STACKHWM)
+	ret = procfs_stackhwm_ops(PROC_STACKHWM_PATH);
+	TC_ASSERT_EQ("procfs_stackhwm_ops", ret, OK);
+#endif
 #ifndef CONFIG_FS_PROCFS_EXCLUDE_SMARTFS
 	tc_fs_smartfs_procfs_main();
 #endif
@@ -272,6 +272,10 @@ static void tc_libc_string_strchr(void)
 	TC_ASSERT_NEQ("strchr", res_ptr, NULL);
 	TC_ASSERT_EQ("strchr", *res_ptr, 's');
 
+	dest_arr[2] = (char)0xc8;
+	res_ptr = strchr(dest_arr, 0xc8);
+	TC_ASSERT_EQ("strchr", res_ptr, dest_arr + 2);
+
 	TC_SUCCESS_RESULT();
 }
 
@@ -292,6 +296,7 @@ static void tc_libc_string_strcmp(void)
 	char buffer2[BUFF_SIZE] = "test";
 	char buffer3[BUFF_SIZE] = "tesz";
 	char buffer4[BUFF_SIZE] = "tesa";
+	char buffer5[BUFF_SIZE] = "tes\xc8";
 
 	ret_chk = strcmp(buffer1, buffer2);
 	TC_ASSERT_EQ("strcmp", ret_chk, 0);
@@ -302,6 +307,11 @@ static void tc_libc_string_strcmp(void)
 	ret_chk = strcmp(buffer1, buffer4);
 	TC_ASSERT_GT("strcmp", ret_chk, 0);
 
+	/* Characters compare as unsigned char */
+
+	ret_chk = strcmp(buffer5, buffer1);
+	TC_ASSERT_GT("strcmp", ret_chk, 0);
+
 	TC_SUCCESS_RESULT();
 }
 
@@ -58,6 +58,7 @@
 **************************************************************************/
 #include <tinyara/config.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 #include <sys/types.h>
@@ -938,6 +939,65 @@ errout:
 	mq_unlink("mqsetattr");	
 }
 
+#ifdef CONFIG_MQ_REFERENCE
+static void tc_mqueue_mq_send_receive_ref(void)
+{
+	mqd_t mqdes;
+	struct mq_attr attr;
+	char msg_buffer[TEST_MSGLEN];
+	char *ref;
+	void *rcv;
+	int prio;
+	ssize_t nbytes;
+
+	attr.mq_maxmsg  = 4;
+	attr.mq_msgsize = TEST_MSGLEN;
+	attr.mq_flags   = 0;
+
+	mqdes = mq_open("mqref", O_CREAT | O_RDWR, 0666, &attr);
+	TC_ASSERT_NEQ("mq_open", mqdes, (mqd_t)ERROR);
+
+	/* A reference is handed to mq_receive_ref() without a copy */
+
+	ref = (char *)malloc(TEST_MSGLEN);
+	TC_ASSERT_NEQ_CLEANUP("malloc", ref, NULL, goto errout);
+	memcpy(ref, TEST_MESSAGE, TEST_MSGLEN);
+	TC_ASSERT_EQ_CLEANUP("mq_send_ref", mq_send_ref(mqdes, ref, TEST_MSGLEN, 3), OK, free(ref); goto errout);
+
+	nbytes = mq_receive_ref(mqdes, &rcv, &prio);
+	TC_ASSERT_EQ_CLEANUP("mq_receive_ref", nbytes, TEST_MSGLEN, goto errout);
+	TC_ASSERT_EQ_CLEANUP("mq_receive_ref", rcv, (void *)ref, goto errout);
+	TC_ASSERT_EQ_CLEANUP("mq_receive_ref", prio, 3, free(rcv); goto errout);
+	free(rcv);
+
+	/* A copied message is returned in a new buffer */
+
+	TC_ASSERT_EQ_CLEANUP("mq_send", mq_send(mqdes, TEST_MESSAGE, TEST_MSGLEN, 1), OK, goto errout);
+	nbytes = mq_receive_ref(mqdes, &rcv, NULL);
+	TC_ASSERT_EQ_CLEANUP("mq_receive_ref", nbytes, TEST_MSGLEN, goto errout);
+	TC_ASSERT_EQ_CLEANUP("mq_receive_ref", memcmp(rcv, TEST_MESSAGE, TEST_MSGLEN), 0, free(rcv); goto errout);
+	free(rcv);
+
+	/* A reference is copied out by mq_receive() */
+
+	ref = (char *)malloc(TEST_MSGLEN);
+	TC_ASSERT_NEQ_CLEANUP("malloc", ref, NULL, goto errout);
+	memcpy(ref, TEST_MESSAGE, TEST_MSGLEN);
+	TC_ASSERT_EQ_CLEANUP("mq_send_ref", mq_send_ref(mqdes, ref, TEST_MSGLEN, 1), OK, free(ref); goto errout);
+	nbytes = mq_receive(mqdes, msg_buffer, TEST_MSGLEN, NULL);
+	TC_ASSERT_EQ_CLEANUP("mq_receive", nbytes, TEST_MSGLEN, goto errout);
+	TC_ASSERT_EQ_CLEANUP("mq_receive", memcmp(msg_buffer, TEST_MESSAGE, TEST_MSGLEN), 0, goto errout);
+
+	mq_close(mqdes);
+	mq_unlink("mqref");
+	TC_SUCCESS_RESULT();
+	return;
+
+errout:
+	mq_close(mqdes);
+	mq_unlink("mqref");
+}
+#endif
 
 /****************************************************************************
  * Name: mqueue
@@ -952,6 +1012,9 @@ int mqueue_main(void)
 
 	tc_mqueue_mq_getattr();
 	tc_mqueue_mq_setattr();
+#ifdef CONFIG_MQ_REFERENCE
+	tc_mqueue_mq_send_receive_ref();
+#endif
 
 	return 0;
 }
@@ -502,6 +502,55 @@ static void tc_umm_heap_get_largest_freenode_size(void)
 }
 #endif
 
+#ifdef CONFIG_MM_HEAPPROF
+/**
+* @fn                   :tc_umm_heap_heapprof
+* @brief                :Account allocations to their call site in the heap profiler.
+* @scenario             :Allocate memory through malloc from one call site\n
+*                        Check the profiler totals and the live bytes of the call site
+*                        Free allocated memory
+* @API's covered        :malloc, free, heapprof_get_stats, heapprof_get_callsite
+* @passcase             :When the profiler counts every allocation and free and a call site holds the allocated bytes.
+* @failcase             :When an allocation or a free is not counted or no call site holds the allocated bytes.
+* @Preconditions        :NA
+*/
+static void tc_umm_heap_heapprof(void)
+{
+	int *mem_ptr[ALLOC_FREE_TIMES] = { NULL };
+	int n_alloc;
+	int index;
+	bool found = false;
+	struct heapprof_stats_s prev;
+	struct heapprof_stats_s cur;
+	struct heapprof_callsite_s callsite;
+
+	heapprof_get_stats(&prev);
+
+	for (n_alloc = 0; n_alloc < ALLOC_FREE_TIMES; n_alloc++) {
+		mem_ptr[n_alloc] = (int *)malloc(ALLOC_SIZE_VAL * sizeof(int));
+		TC_ASSERT_NEQ_CLEANUP("malloc", mem_ptr[n_alloc], NULL, mem_deallocate_func(mem_ptr, ALLOC_FREE_TIMES));
+	}
+
+	heapprof_get_stats(&cur);
+	TC_ASSERT_EQ_CLEANUP("heapprof_get_stats", cur.nallocs - prev.nallocs, ALLOC_FREE_TIMES, mem_deallocate_func(mem_ptr, ALLOC_FREE_TIMES));
+
+	for (index = 0; heapprof_get_callsite(index, &callsite); index++) {
+		if (callsite.addr != 0 && callsite.curr_size >= MEM_REQ_SIZE(ALLOC_SIZE_VAL * sizeof(int), ALLOC_FREE_TIMES)) {
+			found = true;
+			break;
+		}
+	}
+	TC_ASSERT_EQ_CLEANUP("heapprof_get_callsite", found, true, mem_deallocate_func(mem_ptr, ALLOC_FREE_TIMES));
+
+	mem_deallocate_func(mem_ptr, ALLOC_FREE_TIMES);
+
+	heapprof_get_stats(&cur);
+	TC_ASSERT_EQ("heapprof_get_stats", cur.nfrees - prev.nfrees, ALLOC_FREE_TIMES);
+
+	TC_SUCCESS_RESULT();
+}
+#endif
+
 static int umm_test(int argc, char *argv[])
 {
 	sched_lock();  // To prevent other thread allocation mixing in mallinfo
@@ -516,6 +565,9 @@ static int umm_test(int argc, char *argv[])
 	tc_umm_heap_get_heap_free_size();
 	tc_umm_heap_get_largest_freenode_size();
 #endif
+#ifdef CONFIG_MM_HEAPPROF
+	tc_umm_heap_heapprof();
+#endif
 
 	sched_unlock();
 
@@ -80,6 +80,61 @@ static void tc_net_ioctl_fionread_p(void)
 	TC_SUCCESS_RESULT();
 }
 
+#ifdef CONFIG_NET_SOCKET_ZEROCOPY
+/**
+ * @testcase		   :tc_net_ioctl_fionsendq_p
+ * @brief		   :unacknowledged bytes of a TCP socket
+ * @scenario		   :nothing is queued on a new socket, waiting for zero returns at once
+ * @apicovered	   :ioctl()
+ * @precondition	   :
+ * @postcondition	   :
+ */
+static void tc_net_ioctl_fionsendq_p(void)
+{
+	int fd = -1;
+	fd = socket(AF_INET, SOCK_STREAM, 0);
+	if (fd < 0) {
+		printf("fail %s:%d\n", __FUNCTION__, __LINE__);
+		return;
+	}
+	int queued = -1;
+	int ret = ioctl(fd, FIONSENDQ, (unsigned long)&queued);
+	if (ret == 0) {
+		queued = 0;
+		ret = ioctl(fd, FIONSENDQWAIT, (unsigned long)&queued);
+	}
+	close(fd);
+
+	TC_ASSERT_EQ("ioctl", ret, 0);
+	TC_ASSERT_EQ("ioctl", queued, 0);
+	TC_SUCCESS_RESULT();
+}
+
+/**
+ * @testcase		   :tc_net_ioctl_fionsendq_n
+ * @brief		   :
+ * @scenario		   :negative limit
+ * @apicovered	   :ioctl()
+ * @precondition	   :
+ * @postcondition	   :
+ */
+static void tc_net_ioctl_fionsendq_n(void)
+{
+	int fd = -1;
+	fd = socket(AF_INET, SOCK_STREAM, 0);
+	if (fd < 0) {
+		printf("fail %s:%d\n", __FUNCTION__, __LINE__);
+		return;
+	}
+	int limit = -1;
+	int ret = ioctl(fd, FIONSENDQWAIT, (unsigned long)&limit);
+	close(fd);
+
+	TC_ASSERT_EQ("ioctl", ret, -1);
+	TC_SUCCESS_RESULT();
+}
+#endif
+
 /**
  * @testcase		   :tc_net_ioctl_n
  * @brief		   :
@@ -104,6 +159,10 @@ int net_ioctl_main(void)
 {
 	tc_net_ioctl_p();
 	tc_net_ioctl_fionread_p();
+#ifdef CONFIG_NET_SOCKET_ZEROCOPY
+	tc_net_ioctl_fionsendq_p();
+	tc_net_ioctl_fionsendq_n();
+#endif
 	tc_net_ioctl_n();
 
 	return 0;
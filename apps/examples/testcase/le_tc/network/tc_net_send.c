@@ -32,6 +32,7 @@
 #include <sys/types.h>
 #include <netinet/in.h>
 #include <sys/socket.h>
+#include <sys/ioctl.h>
 #include <pthread.h>
 
 #define PORTNUM 1110
@@ -87,6 +88,15 @@ void tc_net_send_p(int fd)
 		printf("connect fail %s:%d", __FUNCTION__, __LINE__);
 		return;
 	}
+#ifdef CONFIG_NET_SOCKET_ZEROCOPY
+	/* msg is referenced by the stack until the client acknowledged it */
+	int queued = 0;
+	int ret_zc = send(connect_fd, msg, strlen(msg), MSG_ZEROCOPY);
+	TC_ASSERT_EQ_CLEANUP("send", ret_zc, strlen(msg), close(connect_fd))
+	ret_zc = ioctl(connect_fd, FIONSENDQWAIT, (unsigned long)&queued);
+	TC_ASSERT_EQ_CLEANUP("ioctl", ret_zc, 0, close(connect_fd))
+	TC_ASSERT_EQ_CLEANUP("ioctl", queued, 0, close(connect_fd))
+#endif
 	int ret = send(connect_fd, msg, strlen(msg), 0);
 
 	TC_ASSERT_NEQ_CLEANUP("send", ret, -1, close(connect_fd))
@@ -181,7 +191,7 @@ void *client(void *args)
 		return 0;
 	}
 
-	len = recv(mysocket, buffer, MAXRCVLEN, 0);
+	len = recv(mysocket, buffer, MAXRCVLEN - 1, 0);
 	if (len <= 0) {
 		printf("recv fail %s:%d\n", __FUNCTION__, __LINE__);
 		close(mysocket);
@@ -0,0 +1,287 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/*
+ * Load test for the webserver: keeps many keep-alive connections open at
+ * once, pipelines GET requests on each of them from a single select() loop
+ * and reports the request rate and the heap used per open connection.
+ */
+
+#include <tinyara/config.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include "webserver_test_util.h"
+
+#define WS_LOAD_MAX_CONN       64
+#define WS_LOAD_MAX_PIPELINE   8
+#define WS_LOAD_BUF_SIZE       512
+#define WS_LOAD_TIMEOUT_SEC    5
+
+struct ws_load_conn_s {
+	int fd;
+	int sent;
+	int done;
+	int body_remain;
+	int len;
+	char buf[WS_LOAD_BUF_SIZE];
+};
+
+static uint64_t ws_load_usec(const struct timespec *from, const struct timespec *to)
+{
+	return (uint64_t)(to->tv_sec - from->tv_sec) * 1000000 + (to->tv_nsec - from->tv_nsec) / 1000;
+}
+
+static int ws_load_send(struct ws_load_conn_s *conn, const char *req, int reqlen, int nreq, int pipeline)
+{
+	while (conn->sent < nreq && conn->sent - conn->done < pipeline) {
+		if (send(conn->fd, req, reqlen, 0) != reqlen) {
+			PRNT("send fail fd %d errno %d", conn->fd, errno);
+			return WS_TEST_ERR;
+		}
+		conn->sent++;
+	}
+
+	return WS_TEST_OK;
+}
+
+/* Count the complete responses in the receive buffer, skipping their bodies */
+static int ws_load_parse(struct ws_load_conn_s *conn)
+{
+	char *hdr_end;
+	char *line;
+	int skip;
+
+	while (conn->len > 0) {
+		if (conn->body_remain > 0) {
+			skip = conn->body_remain < conn->len ? conn->body_remain : conn->len;
+			conn->body_remain -= skip;
+			conn->len -= skip;
+			memmove(conn->buf, conn->buf + skip, conn->len);
+			if (conn->body_remain == 0) {
+				conn->done++;
+			}
+			continue;
+		}
+
+		conn->buf[conn->len] = '\0';
+		hdr_end = strstr(conn->buf, "\r\n\r\n");
+		if (hdr_end == NULL) {
+			if (conn->len == WS_LOAD_BUF_SIZE - 1) {
+				PRNT("response header is too long");
+				return WS_TEST_ERR;
+			}
+			break;
+		}
+		hdr_end += 4;
+
+		if (strncmp(conn->buf, "HTTP/1.1 200", 12)) {
+			PRNT("unexpected response %.16s", conn->buf);
+			return WS_TEST_ERR;
+		}
+
+		conn->body_remain = 0;
+		for (line = strstr(conn->buf, "\r\n"); line && line < hdr_end; line = strstr(line + 2, "\r\n")) {
+			if (!strncasecmp(line + 2, "Content-Length:", 15)) {
+				conn->body_remain = atoi(line + 17);
+				break;
+			}
+		}
+
+		conn->len -= hdr_end - conn->buf;
+		memmove(conn->buf, hdr_end, conn->len);
+		if (conn->body_remain == 0) {
+			conn->done++;
+		}
+	}
+
+	return WS_TEST_OK;
+}
+
+static void ws_load_dump_usage(void)
+{
+	printf("\n  webserver_test load usage:\n");
+	printf("   $ webserver_test load <ip> <port> <connections> <requests> [uri] [pipeline]\n");
+	printf("\n");
+	printf(" <connections> : keep-alive connections opened at once (max %d)\n", WS_LOAD_MAX_CONN);
+	printf(" <requests>    : GET requests sent on each connection\n");
+	printf(" [uri]         : requested path (default is /)\n");
+	printf(" [pipeline]    : requests in flight per connection (default 1, max %d)\n", WS_LOAD_MAX_PIPELINE);
+	printf("\n  example:\n");
+	printf("   $ webserver_test load 127.0.0.1 80 16 100 / 4\n");
+}
+
+int ws_test_load(int argc, char *argv[])
+{
+	struct ws_load_conn_s *conns;
+	struct sockaddr_in addr;
+	struct timespec start;
+	struct timespec end;
+	struct timeval tv;
+	struct mallinfo before;
+	struct mallinfo after;
+	fd_set readfds;
+	char req[WS_TEST_CONF_MAX_URL_SIZE + 64];
+	const char *uri = "/";
+	uint64_t elapsed;
+	int nconn;
+	int nreq;
+	int pipeline = 1;
+	int reqlen;
+	int remaining;
+	int done;
+	int maxfd;
+	int ret = WS_TEST_ERR;
+	int len;
+	int i;
+
+	if (argc < 6) {
+		ws_load_dump_usage();
+		return WS_TEST_ERR;
+	}
+
+	nconn = atoi(argv[4]);
+	nreq = atoi(argv[5]);
+	if (argc > 6) {
+		uri = argv[6];
+	}
+	if (argc > 7) {
+		pipeline = atoi(argv[7]);
+	}
+
+	if (nconn < 1 || nconn > WS_LOAD_MAX_CONN || nreq < 1 || pipeline < 1 || pipeline > WS_LOAD_MAX_PIPELINE
+		|| strlen(uri) > WS_TEST_CONF_MAX_URL_SIZE) {
+		ws_load_dump_usage();
+		return WS_TEST_ERR;
+	}
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(atoi(argv[3]));
+	addr.sin_addr.s_addr = inet_addr(argv[2]);
+
+	reqlen = snprintf(req, sizeof(req), "GET %s HTTP/1.1\r\nHost: %s\r\nConnection: Keep-Alive\r\n\r\n", uri, argv[2]);
+
+	conns = (struct ws_load_conn_s *)calloc(nconn, sizeof(struct ws_load_conn_s));
+	if (conns == NULL) {
+		PRNT("fail to allocate %d connections", nconn);
+		return WS_TEST_ERR;
+	}
+	for (i = 0; i < nconn; i++) {
+		conns[i].fd = -1;
+	}
+
+	before = mallinfo();
+	clock_gettime(CLOCK_REALTIME, &start);
+
+	for (i = 0; i < nconn; i++) {
+		conns[i].fd = socket(AF_INET, SOCK_STREAM, 0);
+		if (conns[i].fd < 0 || connect(conns[i].fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+			PRNT("fail to connect %d errno %d", i, errno);
+			goto out;
+		}
+	}
+
+	for (i = 0; i < nconn; i++) {
+		if (ws_load_send(&conns[i], req, reqlen, nreq, pipeline) != WS_TEST_OK) {
+			goto out;
+		}
+	}
+
+	remaining = nconn * nreq;
+	while (remaining > 0) {
+		FD_ZERO(&readfds);
+		maxfd = -1;
+		for (i = 0; i < nconn; i++) {
+			if (conns[i].done < nreq) {
+				FD_SET(conns[i].fd, &readfds);
+				if (conns[i].fd > maxfd) {
+					maxfd = conns[i].fd;
+				}
+			}
+		}
+
+		tv.tv_sec = WS_LOAD_TIMEOUT_SEC;
+		tv.tv_usec = 0;
+		if (select(maxfd + 1, &readfds, NULL, NULL, &tv) <= 0) {
+			PRNT("no response for %d sec, %d requests left", WS_LOAD_TIMEOUT_SEC, remaining);
+			goto out;
+		}
+
+		for (i = 0; i < nconn; i++) {
+			if (conns[i].done >= nreq || !(FD_ISSET(conns[i].fd, &readfds))) {
+				continue;
+			}
+
+			len = recv(conns[i].fd, conns[i].buf + conns[i].len, WS_LOAD_BUF_SIZE - 1 - conns[i].len, 0);
+			if (len <= 0) {
+				PRNT("connection %d closed after %d responses", i, conns[i].done);
+				goto out;
+			}
+			conns[i].len += len;
+
+			done = conns[i].done;
+			if (ws_load_parse(&conns[i]) != WS_TEST_OK) {
+				goto out;
+			}
+			remaining -= conns[i].done - done;
+
+			if (ws_load_send(&conns[i], req, reqlen, nreq, pipeline) != WS_TEST_OK) {
+				goto out;
+			}
+		}
+	}
+
+	clock_gettime(CLOCK_REALTIME, &end);
+
+	/* Heap held by the open connections once the server went idle */
+	usleep(100000);
+	after = mallinfo();
+
+	elapsed = ws_load_usec(&start, &end);
+	if (elapsed == 0) {
+		elapsed = 1;
+	}
+
+	printf("\n%d connections x %d requests, pipeline %d : %d requests in %llu usec, %llu requests/s\n",
+		   nconn, nreq, pipeline, nconn * nreq, (unsigned long long)elapsed,
+		   (unsigned long long)nconn * nreq * 1000000 / elapsed);
+	printf("heap per open connection : %d bytes (client and server side if both run on this device)\n",
+		   (after.uordblks - before.uordblks) / nconn);
+	ret = WS_TEST_OK;
+
+out:
+	for (i = 0; i < nconn; i++) {
+		if (conns[i].fd >= 0) {
+			close(conns[i].fd);
+		}
+	}
+	free(conns);
+
+	return ret;
+}
@@ -48,6 +48,7 @@ static void ws_test_dump_usage(void)
 	FUNC_EN;
 	printf("\n  webserver_test usage:\n");
 	printf("   $ webserver_test <iterations> <method> <uri> [options...] \n");
+	printf("   $ webserver_test load <ip> <port> <connections> <requests> [uri] [pipeline]\n");
 	printf("\n");
 	printf(" <method>   : %%s (GET, PUT, POST, DELETE)\n");
 	printf(" <uri>      : %%s (Host address : should be started with http:// or https://)\n");
@@ -848,6 +849,10 @@ int webserver_test_main(int argc, char *argv[])
 	FUNC_EN;
 	int iters = 1;
 
+	if (argc > 1 && !strncmp(argv[1], "load", 5)) {
+		return ws_test_load(argc, argv);
+	}
+
 	if (argc < 4) {
 		PRNT("invalid input");
 		ws_test_dump_usage();
@@ -115,6 +115,8 @@ static const char HEADERFIELD_TINYARA[] = "TinyARA";
 #define FUNC_EN PRNT("entry")
 #define FUNC_EX PRNT("exit")
 
+int ws_test_load(int argc, char *argv[]);
+
 enum {
 	HTTP_REQUEST_HEADER, 
 	HTTP_REQUEST_PARAMETERS, 
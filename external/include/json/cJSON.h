@@ -116,6 +116,31 @@ typedef struct cJSON_Hooks
 
 typedef int cJSON_bool;
 
+/* A caller supplied block of memory that cJSON_ParseInArena allocates the items from. */
+typedef struct cJSON_Arena
+{
+    unsigned char *buffer;
+    size_t size;
+    /* bytes allocated so far, the documents parsed into the arena are dropped by setting it back */
+    size_t used;
+} cJSON_Arena;
+
+/* Callbacks of cJSON_ParseStream and cJSON_ParseSAX. name is the name of the value inside an object and NULL
+ * elsewhere, item is only valid during the call and item->string is its name. A callback can be NULL, returning
+ * 0 stops the parser. */
+typedef struct cJSON_SAX_Handler
+{
+    cJSON_bool (*start_object)(void *context, const char *name);
+    cJSON_bool (*end_object)(void *context);
+    cJSON_bool (*start_array)(void *context, const char *name);
+    cJSON_bool (*end_array)(void *context);
+    cJSON_bool (*value)(void *context, const cJSON *item);
+} cJSON_SAX_Handler;
+
+/* Reads up to length bytes of the input into buffer. Returns the number of bytes read, 0 at the end of the input
+ * or a negative value on error. */
+typedef int (*cJSON_ReadFunction)(void *context, char *buffer, size_t length);
+
 #if !defined(__WINDOWS__) && (defined(WIN32) || defined(WIN64) || defined(_MSC_VER) || defined(_WIN32))
 #define __WINDOWS__
 #endif
@@ -165,6 +190,15 @@ then using the CJSON_API_VISIBILITY flag to "export" the same symbols the way CJ
 #define CJSON_NESTING_LIMIT 1000
 #endif
 
+/* cJSON_ParseStream reads the input in chunks of this size and rejects strings (and names) longer than
+ * CJSON_STREAM_STRING_LIMIT bytes after unescaping them. Both buffers are on the stack of the caller. */
+#ifndef CJSON_STREAM_CHUNK_SIZE
+#define CJSON_STREAM_CHUNK_SIZE 64
+#endif
+#ifndef CJSON_STREAM_STRING_LIMIT
+#define CJSON_STREAM_STRING_LIMIT 256
+#endif
+
 /* returns the version of cJSON as a string */
 CJSON_PUBLIC(const char*) cJSON_Version(void);
 
@@ -178,6 +212,23 @@ CJSON_PUBLIC(cJSON *) cJSON_Parse(const char *value);
 /* If you supply a ptr in return_parse_end and parsing fails, then return_parse_end will contain a pointer to the error. If not, then cJSON_GetErrorPtr() does the job. */
 CJSON_PUBLIC(cJSON *) cJSON_ParseWithOpts(const char *value, const char **return_parse_end, cJSON_bool require_null_terminated);
 
+/* Parse value in place: all items are allocated from arena, and the strings are unescaped in value and referenced
+ * from the items, so value must be writable and outlive the result. The result must not be passed to cJSON_Delete
+ * or modified with the functions that allocate or delete items; it is freed at once with cJSON_ResetArena (or by
+ * freeing the memory of the arena). Returns NULL when the arena is too small, see cJSON_GetArenaSize. */
+CJSON_PUBLIC(void) cJSON_InitArena(cJSON_Arena *arena, void *buffer, size_t size);
+CJSON_PUBLIC(void) cJSON_ResetArena(cJSON_Arena *arena);
+/* Returns an arena size that is enough to parse value in place, found by counting its values. */
+CJSON_PUBLIC(size_t) cJSON_GetArenaSize(const char *value);
+CJSON_PUBLIC(cJSON *) cJSON_ParseInArena(cJSON_Arena *arena, char *value);
+CJSON_PUBLIC(cJSON *) cJSON_ParseInArenaWithOpts(cJSON_Arena *arena, char *value, const char **return_parse_end, cJSON_bool require_null_terminated);
+
+/* Parse one value from the input returned by read_fn and report it to handler as it goes, without allocating.
+ * If return_parse_end is given, it receives the number of bytes consumed (up to the error on failure). */
+CJSON_PUBLIC(cJSON_bool) cJSON_ParseStream(cJSON_ReadFunction read_fn, void *read_context, const cJSON_SAX_Handler *handler, void *context, size_t *return_parse_end);
+/* cJSON_ParseStream on a string. On failure, cJSON_GetErrorPtr() points at the error. */
+CJSON_PUBLIC(cJSON_bool) cJSON_ParseSAX(const char *value, const cJSON_SAX_Handler *handler, void *context);
+
 /* Render a cJSON entity to text for transfer/storage. */
 CJSON_PUBLIC(char *) cJSON_Print(const cJSON *item);
 /* Render a cJSON entity to text for transfer/storage without any formatting. */
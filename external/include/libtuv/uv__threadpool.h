@@ -41,7 +41,17 @@
 extern "C" {
 #endif
 
-void uv__work_submit(uv_loop_t *loop, struct uv__work *w, void (*work)(struct uv__work *w), void (*done)(struct uv__work *w, int status));
+/*
+ * Priority classes of the threadpool. Idle workers take I/O requests
+ * first, and CPU requests never occupy every worker at once.
+ */
+enum uv__work_kind {
+	UV__WORK_IO,	/* short blocking I/O such as filesystem requests */
+	UV__WORK_CPU,	/* computation and long blocking calls */
+	UV__WORK_KINDS
+};
+
+void uv__work_submit(uv_loop_t *loop, struct uv__work *w, enum uv__work_kind kind, void (*work)(struct uv__work *w), void (*done)(struct uv__work *w, int status));
 
 void uv__work_done(uv_async_t *handle);
 
@@ -59,6 +69,26 @@ int uv_queue_work(uv_loop_t *loop, uv_work_t *req, uv_work_cb work_cb, uv_after_
 
 int uv_cancel(uv_req_t *req);
 
+#ifdef CONFIG_LIBTUV_THREADPOOL_STATS
+/*
+ * Per-worker threadpool statistics, since the pool was started.
+ */
+typedef struct uv_threadpool_stats_s {
+	unsigned int queued;		/* requests waiting in the worker's queue */
+	unsigned int max_queued;	/* highest depth of the worker's queue */
+	unsigned int executed;		/* requests run by the worker */
+	unsigned int stolen;		/* requests taken from other workers' queues */
+	uint64_t total_latency;		/* sum of the waits from submission to start, ns */
+	uint64_t max_latency;		/* longest wait from submission to start, ns */
+} uv_threadpool_stats_t;
+
+/*
+ * Fill up to count entries, one per worker.
+ * Returns the number of entries filled, 0 if the pool is not running.
+ */
+int uv_threadpool_stats(uv_threadpool_stats_t *stats, int count);
+#endif
+
 /*
  * for embed systems that need cleanup before exit
  */
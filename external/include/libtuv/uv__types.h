@@ -142,6 +142,11 @@ struct uv__work {
 	void (*done)(struct uv__work *w, int status);
 	struct uv_loop_s *loop;
 	void *wq[2];
+	unsigned int qid;
+	int kind;
+#ifdef CONFIG_LIBTUV_THREADPOOL_STATS
+	uint64_t submitted;
+#endif
 };
 
 //-----------------------------------------------------------------------------
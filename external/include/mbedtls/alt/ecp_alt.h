@@ -0,0 +1,70 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/**
+ * \file ecp_alt.h
+ *
+ * \brief Elliptic curve point arithmetic offloaded to a board accelerator.
+ *
+ * With CONFIG_TLS_HW_ECP, the jacobian point addition, doubling and
+ * normalization of mbed TLS go through the operations a board registers
+ * here, for the groups its capable() callback accepts. Every other group,
+ * and every group before a registration, keeps the software arithmetic.
+ */
+
+#ifndef MBEDTLS_ECP_ALT_H
+#define MBEDTLS_ECP_ALT_H
+
+#include "mbedtls/ecp.h"
+
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Point operations of an accelerator. The semantics of each
+ *        callback are those of the mbedtls_internal_ecp_xxx() function of
+ *        the same name in mbedtls/ecp_internal.h. All of them are mandatory.
+ */
+struct mbedtls_ecp_hw_ops {
+	unsigned char (*grp_capable)(const mbedtls_ecp_group *grp);
+	int (*init)(const mbedtls_ecp_group *grp);
+	void (*free)(const mbedtls_ecp_group *grp);
+	int (*add_mixed)(const mbedtls_ecp_group *grp, mbedtls_ecp_point *R, const mbedtls_ecp_point *P, const mbedtls_ecp_point *Q);
+	int (*double_jac)(const mbedtls_ecp_group *grp, mbedtls_ecp_point *R, const mbedtls_ecp_point *P);
+	int (*normalize_jac)(const mbedtls_ecp_group *grp, mbedtls_ecp_point *pt);
+	int (*normalize_jac_many)(const mbedtls_ecp_group *grp, mbedtls_ecp_point *T[], size_t t_len);
+};
+
+/**
+ * \brief Register the point operations of an accelerator, or NULL to go
+ *        back to software arithmetic. Call it before any TLS or ECP user
+ *        starts; the operations are not switched under a running computation.
+ *
+ * \return 0 on success, MBEDTLS_ERR_ECP_BAD_INPUT_DATA if a callback is missing.
+ */
+int mbedtls_ecp_hw_register(const struct mbedtls_ecp_hw_ops *ops);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MBEDTLS_ECP_INTERNAL_ALT */
+
+#endif /* ecp_alt.h */
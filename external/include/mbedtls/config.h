@@ -2804,6 +2804,22 @@
 #define MBEDTLS_ECP_WINDOW_SIZE            7 /**< Maximum window size used */
 #define MBEDTLS_ECP_FIXED_POINT_OPTIM      1 /**< Enable fixed-point speed-up */
 
+/*
+ * Take the comb table of the secp256r1 generator from flash instead of
+ * computing it in every new group (requires MBEDTLS_ECP_FIXED_POINT_OPTIM).
+ */
+#if defined(CONFIG_TLS_ECP_FIXED_BASE_TABLE)
+#define MBEDTLS_ECP_FIXED_BASE_TABLE
+#endif
+
+/*
+ * Window of the wNAF method used for multiplications by public scalars
+ * (ECDSA verification), 2 to 6: 2^(w-2) precomputed points.
+ */
+#if defined(CONFIG_TLS_ECP_WNAF)
+#define MBEDTLS_ECP_WNAF_WINDOW            CONFIG_TLS_ECP_WNAF_WINDOW
+#endif
+
 /* Entropy options */
 //#define MBEDTLS_ENTROPY_MAX_SOURCES                20 /**< Maximum number of sources supported */
 //#define MBEDTLS_ENTROPY_MAX_GATHER                128 /**< Maximum amount requested from entropy sources */
@@ -2938,6 +2954,14 @@
 #define MBEDTLS_PK_ECDSA_VERIFY_ALT
 #endif
 
+#if defined(CONFIG_TLS_HW_ECP)
+#define MBEDTLS_ECP_INTERNAL_ALT
+#define MBEDTLS_ECP_ADD_MIXED_ALT
+#define MBEDTLS_ECP_DOUBLE_JAC_ALT
+#define MBEDTLS_ECP_NORMALIZE_JAC_ALT
+#define MBEDTLS_ECP_NORMALIZE_JAC_MANY_ALT
+#endif
+
 #if defined(CONFIG_TLS_HW_RSA_VERIFICATION)
 #define MBEDTLS_PK_RSA_VERIFY_ALT
 #undef MBEDTLS_PK_RSA_ALT_SUPPORT
@@ -0,0 +1,108 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __TLS_SESSION_STORE_H
+#define __TLS_SESSION_STORE_H
+
+#include <tinyara/config.h>
+
+#include "mbedtls/config.h"
+#include "mbedtls/ssl.h"
+
+#ifdef CONFIG_TLS_SESSION_STORE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief tls_session_store_get() offers the session last negotiated with host:port
+ *		for resumption. Call it after mbedtls_ssl_setup() and before the handshake.
+ *
+ * @param[in] host	host name or address the client connects to
+ * @param[in] port	server port
+ * @param[in] ssl	client ssl context
+ * @return 0 if a session was offered, -1 if the store has none for host:port,
+ *         or a negative mbedtls error code.
+ *
+ */
+int tls_session_store_get(const char *host, int port, mbedtls_ssl_context *ssl);
+
+/**
+ * @brief tls_session_store_put() keeps the session of a completed client handshake
+ *		so that the next connection to host:port can resume it. The least
+ *		recently used entry is dropped when the store is full.
+ *
+ * @param[in] host	host name or address the client connected to
+ * @param[in] port	server port
+ * @param[in] ssl	client ssl context after a successful handshake
+ * @return 0 on success, or a negative mbedtls error code.
+ *
+ */
+int tls_session_store_put(const char *host, int port, const mbedtls_ssl_context *ssl);
+
+/**
+ * @brief tls_session_store_remove() forgets the session of host:port, e.g. after
+ *		a handshake that offered it failed.
+ *
+ */
+void tls_session_store_remove(const char *host, int port);
+
+/**
+ * @brief tls_session_store_clear() forgets every client session.
+ *
+ */
+void tls_session_store_clear(void);
+
+/**
+ * @brief tls_ticket_keys_conf() makes a server configuration issue and accept
+ *		session tickets protected by the system-wide ticket keys. The keys
+ *		are generated on first use and rotated every CONFIG_TLS_TICKET_LIFETIME
+ *		seconds, so every server of the device can resume every ticket.
+ *
+ * @param[in] conf	server ssl configuration
+ * @return 0 on success, or a negative mbedtls error code.
+ *
+ */
+int tls_ticket_keys_conf(mbedtls_ssl_config *conf);
+
+/**
+ * @brief tls_ticket_keys_free() destroys the ticket keys. Tickets issued with
+ *		them can no longer be resumed.
+ *
+ */
+void tls_ticket_keys_free(void);
+
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+/**
+ * @brief tls_session_store_save() writes the client sessions and the ticket keys
+ *		to CONFIG_TLS_SESSION_STORE_PATH. The store saves itself after every
+ *		full handshake, so this is only needed before an orderly shutdown.
+ *
+ * @return 0 on success, -1 if the file cannot be written.
+ *
+ */
+int tls_session_store_save(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif							/* CONFIG_TLS_SESSION_STORE */
+#endif							/* __TLS_SESSION_STORE_H */
@@ -75,6 +75,12 @@
 #define HTTP_CONF_MAX_CLIENT_HANDLE		1
 #endif
 
+#if defined(CONFIG_NETUTILS_WEBSERVER_EVENT_MAX_CONN)
+#define HTTP_CONF_EVENT_MAX_CONN		(CONFIG_NETUTILS_WEBSERVER_EVENT_MAX_CONN)
+#else
+#define HTTP_CONF_EVENT_MAX_CONN		8
+#endif
+
 #define HTTP_METHOD_UNKNOWN -1
 #define HTTP_METHOD_GET     0
 #define HTTP_METHOD_PUT     1
@@ -110,6 +116,9 @@
 #define HTTP_CONF_MAX_SLASH_COUNT               32
 #define HTTP_CONF_MAX_QUERY_HANDLER_COUNT       64
 #define HTTP_CONF_MAX_ENTITY_LENGTH             2048
+#define HTTP_CONF_EVENT_RXBUF_LENGTH            512
+#define HTTP_CONF_EVENT_TIMEOUT_MSEC            100
+#define HTTP_CONF_EVENT_FILE_CHUNK              1460
 
 #define HTTP_ERROR_400            "Bad Request"
 #define HTTP_ERROR_404            "Not Found"
@@ -331,6 +340,20 @@ int http_send_response_with_status_msg(struct http_client_t *client, int status,
 int http_send_response_chunk(struct http_client_t *client, int status, const char* status_message,
                         const char *body, struct http_keyvalue_list_t *headers, data_type_e data_type);
 
+/**
+ * @brief http_send_file() sends a file as the 200 response.
+ *        If the server runs in event-driven mode, the file is sent by the
+ *        event loop after the callback returns.
+ *
+ * @param[in] client a pointer of HTTP client.
+ * @param[in] path path of the file to send.
+ * @param[in] content_type value of the Content-Type header.
+ * @return On success, HTTP_OK(0) is returned.
+ *         On failure, HTTP_ERROR(-1) is returned. If the file cannot be
+ *         opened, a 404 response has been sent.
+ */
+int http_send_file(struct http_client_t *client, const char *path, const char *content_type);
+
 #ifdef CONFIG_NET_SECURITY_TLS
 /**
  * @brief http_tls_init() initializes the TLS configuere for webserver.
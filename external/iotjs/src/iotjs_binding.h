@@ -193,9 +193,11 @@ iotjs_jval_t iotjs_jhelper_eval(const char* name, size_t name_len,
                                 const uint8_t* data, size_t size,
                                 bool strict_mode, bool* throws);
 #ifdef ENABLE_SNAPSHOT
-// Evaluates javascript snapshot.
+// Evaluates javascript snapshot. Unless copy_bytecode is set, the bytecode
+// is executed in place and the snapshot must outlive the engine.
 iotjs_jval_t iotjs_jhelper_exec_snapshot(const void* snapshot_p,
-                                         size_t snapshot_size, bool* throws);
+                                         size_t snapshot_size,
+                                         bool copy_bytecode, bool* throws);
 #endif
 
 
@@ -57,6 +57,7 @@
 #define IOTJS_MAGIC_STRING_COMPARE "compare"
 #define IOTJS_MAGIC_STRING_COMPILE "compile"
 #define IOTJS_MAGIC_STRING_COMPILENATIVEPTR "compileNativePtr"
+#define IOTJS_MAGIC_STRING_COMPILESNAPSHOT "compileSnapshot"
 #define IOTJS_MAGIC_STRING_CONNECT "connect"
 #define IOTJS_MAGIC_STRING_COPY "copy"
 #define IOTJS_MAGIC_STRING_CREATEREQUEST "createRequest"
@@ -76,14 +76,15 @@ iotjs_module_t.resolveFilepath = function(id, directories) {
     }
 
     // 1. 'id'
-    var filepath = iotjs_module_t.tryPath(modulePath);
+    var filepath = iotjs_module_t.tryFile(modulePath);
 
     if (filepath) {
       return filepath;
     }
 
-    // 2. 'id.js'
-    filepath = iotjs_module_t.tryPath(modulePath + '.js');
+    // 2. 'id.snapshot', 'id.js'
+    filepath = iotjs_module_t.trySnapshot(modulePath) ||
+               iotjs_module_t.tryPath(modulePath + '.js');
 
     if (filepath) {
       return filepath;
@@ -95,12 +96,12 @@ iotjs_module_t.resolveFilepath = function(id, directories) {
     if (filepath) {
       var pkgSrc = process.readSource(jsonpath);
       var pkgMainFile = JSON.parse(pkgSrc).main;
-      filepath = iotjs_module_t.tryPath(modulePath + "/" + pkgMainFile);
+      filepath = iotjs_module_t.tryFile(modulePath + "/" + pkgMainFile);
       if (filepath) {
         return filepath;
       }
       // index.js
-      filepath = iotjs_module_t.tryPath(modulePath + "/" + "index.js");
+      filepath = iotjs_module_t.tryFile(modulePath + "/" + "index.js");
       if (filepath) {
         return filepath;
       }
@@ -170,6 +171,28 @@ iotjs_module_t.tryPath = function(path) {
 };
 
 
+// Snapshots are precompiled modules, see tools/js2snapshot.py.
+iotjs_module_t.trySnapshot = function(path) {
+  if (!process.compileSnapshot) {
+    return false;
+  }
+
+  return iotjs_module_t.tryPath(path + '.snapshot');
+};
+
+
+// 'path', or the snapshot that replaced it if 'path' is a missing .js file.
+iotjs_module_t.tryFile = function(path) {
+  var filepath = iotjs_module_t.tryPath(path);
+
+  if (!filepath && path.slice(-3) === '.js') {
+    filepath = iotjs_module_t.trySnapshot(path.slice(0, -3));
+  }
+
+  return filepath;
+};
+
+
 iotjs_module_t.load = function(id, parent, isMain) {
   if (process.native_sources[id]) {
     return Native.require(id);
@@ -198,8 +221,13 @@ iotjs_module_t.load = function(id, parent, isMain) {
 
 
 iotjs_module_t.prototype.compile = function() {
-  var source = process.readSource(this.filename);
-  var fn = process.compile(this.filename, source);
+  var fn;
+  if (this.filename.slice(-9) === '.snapshot') {
+    fn = process.compileSnapshot(this.filename);
+  } else {
+    var source = process.readSource(this.filename);
+    fn = process.compile(this.filename, source);
+  }
   fn.call(this.exports, this.exports, this.require.bind(this), this);
 };
 
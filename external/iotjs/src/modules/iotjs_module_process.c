@@ -18,6 +18,15 @@
 #include "jerryscript-debugger.h"
 
 #include <stdlib.h>
+#ifdef ENABLE_SNAPSHOT
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__TIZENRT__)
+#include <sys/ioctl.h>
+#include <tinyara/fs/ioctl.h>
+#endif
+#endif
 
 
 JHANDLER_FUNCTION(Binding) {
@@ -104,7 +113,8 @@ JHANDLER_FUNCTION(CompileNativePtr) {
     bool throws;
 #ifdef ENABLE_SNAPSHOT
     iotjs_jval_t jres = iotjs_jhelper_exec_snapshot(natives[i].code,
-                                                    natives[i].length, &throws);
+                                                    natives[i].length, false,
+                                                    &throws);
 #else
     iotjs_jval_t jres =
         WrapEval(name, iotjs_string_size(&id), (const char*)natives[i].code,
@@ -127,6 +137,95 @@ JHANDLER_FUNCTION(CompileNativePtr) {
 }
 
 
+#ifdef ENABLE_SNAPSHOT
+// Returns the address of a snapshot file that can be executed in place,
+// e.g. on a romfs volume in memory mapped flash, or NULL.
+static const uint32_t* MapSnapshot(int fd) {
+#if defined(__TIZENRT__)
+  void* addr = NULL;
+
+  if (ioctl(fd, FIOC_MMAP, (unsigned long)&addr) == 0 && addr != NULL &&
+      ((uintptr_t)addr % sizeof(uint32_t)) == 0) {
+    return (const uint32_t*)addr;
+  }
+#endif
+  return NULL;
+}
+
+
+// Reads a snapshot file into a new buffer, which the caller releases.
+static uint32_t* ReadSnapshot(int fd, size_t size) {
+  uint32_t* buffer = (uint32_t*)iotjs_buffer_allocate(size);
+  size_t nread = 0;
+
+  while (nread < size) {
+    ssize_t ret = read(fd, (char*)buffer + nread, size - nread);
+    if (ret <= 0) {
+      iotjs_buffer_release((char*)buffer);
+      return NULL;
+    }
+    nread += (size_t)ret;
+  }
+
+  return buffer;
+}
+
+
+// Executes a module precompiled by tools/js2snapshot.py and returns its
+// wrapper function, like Compile() does for the module source.
+JHANDLER_FUNCTION(CompileSnapshot) {
+  DJHANDLER_CHECK_ARGS(1, string);
+
+  iotjs_string_t file = JHANDLER_GET_ARG(0, string);
+  const char* filename = iotjs_string_data(&file);
+
+  const uint32_t* snapshot = NULL;
+  uint32_t* buffer = NULL;
+  size_t size = 0;
+  struct stat st;
+
+  int fd = open(filename, O_RDONLY);
+  if (fd >= 0) {
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+      size = (size_t)st.st_size;
+      snapshot = MapSnapshot(fd);
+      if (snapshot == NULL) {
+        buffer = ReadSnapshot(fd, size);
+        snapshot = buffer;
+      }
+    }
+    close(fd);
+  }
+
+  if (snapshot == NULL) {
+    iotjs_jval_t jerror = iotjs_jval_create_error("Cannot read snapshot");
+    iotjs_jhandler_throw(jhandler, &jerror);
+    iotjs_jval_destroy(&jerror);
+    iotjs_string_destroy(&file);
+    return;
+  }
+
+  // A mapped snapshot stays in flash, a buffer is copied into the heap.
+  bool throws;
+  iotjs_jval_t jres =
+      iotjs_jhelper_exec_snapshot(snapshot, size, buffer != NULL, &throws);
+
+  if (buffer != NULL) {
+    iotjs_buffer_release((char*)buffer);
+  }
+
+  if (!throws) {
+    iotjs_jhandler_return_jval(jhandler, &jres);
+  } else {
+    iotjs_jhandler_throw(jhandler, &jres);
+  }
+
+  iotjs_string_destroy(&file);
+  iotjs_jval_destroy(&jres);
+}
+#endif
+
+
 JHANDLER_FUNCTION(ReadSource) {
   DJHANDLER_CHECK_ARGS(1, string);
 
@@ -262,6 +361,10 @@ iotjs_jval_t InitProcess() {
   iotjs_jval_set_method(&process, IOTJS_MAGIC_STRING_COMPILE, Compile);
   iotjs_jval_set_method(&process, IOTJS_MAGIC_STRING_COMPILENATIVEPTR,
                         CompileNativePtr);
+#ifdef ENABLE_SNAPSHOT
+  iotjs_jval_set_method(&process, IOTJS_MAGIC_STRING_COMPILESNAPSHOT,
+                        CompileSnapshot);
+#endif
   iotjs_jval_set_method(&process, IOTJS_MAGIC_STRING_READSOURCE, ReadSource);
   iotjs_jval_set_method(&process, IOTJS_MAGIC_STRING_CWD, Cwd);
   iotjs_jval_set_method(&process, IOTJS_MAGIC_STRING_CHDIR, Chdir);
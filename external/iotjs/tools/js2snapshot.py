@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+
+# Copyright 2026-present Samsung Electronics Co., Ltd. and other contributors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+#  This file compiles the application modules (*.js) under a directory to
+# JerryScript snapshots (*.snapshot) with the host jerry that js2c.py uses
+# for the built-in modules. The module loader (src/js/module.js) runs a
+# snapshot in place of the module, so the target does not parse it, and
+# executes its bytecode directly from a memory mapped file system.
+
+import argparse
+import os
+import subprocess
+import sys
+
+
+MODULE_WRAPPER = ("(function(exports, require, module) {\n", "\n});\n")
+
+
+def compile_module(snapshot_generator, js_path, keep_source):
+    """ Compile one module to a snapshot next to it. """
+    base_path = js_path[:-len('.js')]
+    wrapped_path = base_path + '.wrapped.js'
+    snapshot_path = base_path + '.snapshot'
+
+    with open(wrapped_path, 'w') as fwrapped, open(js_path, 'r') as fmodule:
+        fwrapped.write(MODULE_WRAPPER[0])
+        fwrapped.write(fmodule.read())
+        fwrapped.write(MODULE_WRAPPER[1])
+
+    ret = subprocess.call([snapshot_generator,
+                           '--save-snapshot-for-eval',
+                           snapshot_path,
+                           wrapped_path])
+    os.remove(wrapped_path)
+    if ret != 0:
+        print('Failed to compile %s: - %d' % (js_path, ret))
+        return False
+
+    if not keep_source:
+        os.remove(js_path)
+
+    return True
+
+
+def js2snapshot(snapshot_generator, root, keep_source, verbose=False):
+    ok = True
+    for dirpath, dirnames, filenames in os.walk(root):
+        for name in sorted(filenames):
+            if not name.endswith('.js'):
+                continue
+
+            js_path = os.path.join(dirpath, name)
+            if verbose:
+                print('Compiling %s' % js_path)
+
+            ok = compile_module(snapshot_generator, js_path, keep_source) and ok
+
+    return ok
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--snapshot-generator', required=True,
+        help='Host jerry executable with snapshot saving, '
+             'e.g. build/<target>/<buildtype>/deps/jerry-host/bin/jerry')
+    parser.add_argument('--keep-source', action='store_true', default=False,
+        help='Keep the *.js files next to their snapshots')
+    parser.add_argument('-v', '--verbose', action='store_true', default=False,
+        help='Print the name of each module')
+    parser.add_argument('root',
+        help='Directory with the application modules, compiled in place')
+
+    options = parser.parse_args()
+
+    if not js2snapshot(options.snapshot_generator, options.root,
+                       options.keep_source, options.verbose):
+        sys.exit(1)
@@ -57,6 +57,7 @@
 #include <stdlib.h>
 #include <float.h>
 #include <limits.h>
+#include <stdint.h>
 #include <ctype.h>
 #include <unistd.h>
 #include <stdbool.h>
@@ -129,6 +130,9 @@ typedef struct internal_hooks
 
 static internal_hooks global_hooks = { malloc, free, realloc };
 
+/* Items are allocated from an arena at this alignment, the strictest of the members of cJSON. */
+#define CJSON_ARENA_ALIGNMENT sizeof(double)
+
 static unsigned char* cJSON_strdup(const unsigned char* string, const internal_hooks * const hooks)
 {
     size_t length = 0;
@@ -224,6 +228,8 @@ typedef struct
     size_t offset;
     size_t depth; /* How deeply nested (in arrays/objects) is the input at the current offset. */
     internal_hooks hooks;
+    cJSON_Arena *arena; /* if set, items are allocated from the arena instead of the hooks */
+    cJSON_bool in_place; /* if set, strings are unescaped in the (writable) input */
 } parse_buffer;
 
 /* check if the given size is left to read in a given parse buffer (starting with 1) */
@@ -235,6 +241,46 @@ typedef struct
 /* get a pointer to the buffer at the position */
 #define buffer_at_offset(buffer) ((buffer)->content + (buffer)->offset)
 
+/* Allocate size bytes from an arena, aligned for any member of cJSON. */
+static void *arena_allocate(cJSON_Arena * const arena, size_t size)
+{
+    size_t offset = arena->used;
+    size_t misalignment = (size_t)((uintptr_t)(arena->buffer + offset) % CJSON_ARENA_ALIGNMENT);
+
+    if (misalignment != 0)
+    {
+        offset += CJSON_ARENA_ALIGNMENT - misalignment;
+    }
+
+    if ((offset > arena->size) || ((arena->size - offset) < size))
+    {
+        return NULL;
+    }
+
+    arena->used = offset + size;
+
+    return arena->buffer + offset;
+}
+
+/* Allocate an item for the parser, from its arena if it has one. */
+static cJSON *parse_new_item(parse_buffer * const input_buffer)
+{
+    cJSON *node = NULL;
+
+    if (input_buffer->arena == NULL)
+    {
+        return cJSON_New_Item(&(input_buffer->hooks));
+    }
+
+    node = (cJSON*)arena_allocate(input_buffer->arena, sizeof(cJSON));
+    if (node)
+    {
+        memset(node, '\0', sizeof(cJSON));
+    }
+
+    return node;
+}
+
 /* Parse the input text to generate a number, and populate the result into item. */
 static cJSON_bool parse_number(cJSON * const item, parse_buffer * const input_buffer)
 {
@@ -705,12 +751,28 @@ static cJSON_bool parse_string(cJSON * const item, parse_buffer * const input_bu
             goto fail; /* string ended unexpectedly */
         }
 
-        /* This is at most how much we need for the output */
-        allocation_length = (size_t) (input_end - buffer_at_offset(input_buffer)) - skipped_bytes;
-        output = (unsigned char*)input_buffer->hooks.allocate(allocation_length + sizeof(""));
-        if (output == NULL)
+        if (input_buffer->in_place)
         {
-            goto fail; /* allocation failure */
+            /* the unescaped string is never longer than the literal, so it
+             * is written over the literal and terminated at the closing quote
+             * at the latest */
+            output = (unsigned char*)input_pointer;
+            if (skipped_bytes == 0)
+            {
+                /* nothing to unescape, reference the literal as it is */
+                output_pointer = (unsigned char*)input_end;
+                goto terminate;
+            }
+        }
+        else
+        {
+            /* This is at most how much we need for the output */
+            allocation_length = (size_t) (input_end - buffer_at_offset(input_buffer)) - skipped_bytes;
+            output = (unsigned char*)input_buffer->hooks.allocate(allocation_length + sizeof(""));
+            if (output == NULL)
+            {
+                goto fail; /* allocation failure */
+            }
         }
     }
 
@@ -771,6 +833,7 @@ static cJSON_bool parse_string(cJSON * const item, parse_buffer * const input_bu
         }
     }
 
+terminate:
     /* zero terminate the output */
     *output_pointer = '\0';
 
@@ -783,7 +846,7 @@ static cJSON_bool parse_string(cJSON * const item, parse_buffer * const input_bu
     return true;
 
 fail:
-    if (output != NULL)
+    if ((output != NULL) && !input_buffer->in_place)
     {
         input_buffer->hooks.deallocate(output);
     }
@@ -953,11 +1016,14 @@ static parse_buffer *buffer_skip_whitespace(parse_buffer * const buffer)
     return buffer;
 }
 
+#define cjson_min(a, b) ((a < b) ? a : b)
+
 /* Parse an object - create a new root, and populate. */
-CJSON_PUBLIC(cJSON *) cJSON_ParseWithOpts(const char *value, const char **return_parse_end, cJSON_bool require_null_terminated)
+static cJSON *parse(const char *value, const char **return_parse_end, cJSON_bool require_null_terminated, cJSON_Arena * const arena)
 {
-    parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0 } };
+    parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0 }, NULL, false };
     cJSON *item = NULL;
+    size_t arena_used = 0;
 
     /* reset error position */
     global_error.json = NULL;
@@ -972,8 +1038,14 @@ CJSON_PUBLIC(cJSON *) cJSON_ParseWithOpts(const char *value, const char **return
     buffer.length = strlen((const char*)value) + sizeof("");
     buffer.offset = 0;
     buffer.hooks = global_hooks;
+    if (arena != NULL)
+    {
+        arena_used = arena->used;
+        buffer.arena = arena;
+        buffer.in_place = true;
+    }
 
-    item = cJSON_New_Item(&global_hooks);
+    item = parse_new_item(&buffer);
     if (item == NULL) /* memory fail */
     {
         goto fail;
@@ -1002,7 +1074,12 @@ CJSON_PUBLIC(cJSON *) cJSON_ParseWithOpts(const char *value, const char **return
     return item;
 
 fail:
-    if (item != NULL)
+    if (arena != NULL)
+    {
+        /* drop everything allocated for this document */
+        arena->used = arena_used;
+    }
+    else if (item != NULL)
     {
         cJSON_Delete(item);
     }
@@ -1035,13 +1112,487 @@ fail:
     return NULL;
 }
 
+CJSON_PUBLIC(cJSON *) cJSON_ParseWithOpts(const char *value, const char **return_parse_end, cJSON_bool require_null_terminated)
+{
+    return parse(value, return_parse_end, require_null_terminated, NULL);
+}
+
 /* Default options for cJSON_Parse */
 CJSON_PUBLIC(cJSON *) cJSON_Parse(const char *value)
 {
     return cJSON_ParseWithOpts(value, 0, 0);
 }
 
-#define cjson_min(a, b) ((a < b) ? a : b)
+CJSON_PUBLIC(void) cJSON_InitArena(cJSON_Arena *arena, void *buffer, size_t size)
+{
+    if (arena == NULL)
+    {
+        return;
+    }
+
+    arena->buffer = (unsigned char*)buffer;
+    arena->size = (buffer != NULL) ? size : 0;
+    arena->used = 0;
+}
+
+CJSON_PUBLIC(void) cJSON_ResetArena(cJSON_Arena *arena)
+{
+    if (arena != NULL)
+    {
+        arena->used = 0;
+    }
+}
+
+/* Count the values in the text (an upper bound, as empty arrays and objects are counted as one value)
+ * without parsing it, to size the arena for cJSON_ParseInArena. */
+CJSON_PUBLIC(size_t) cJSON_GetArenaSize(const char *value)
+{
+    const unsigned char *pointer = (const unsigned char*)value;
+    size_t count = 1;
+    size_t item_size = sizeof(cJSON);
+
+    if (value == NULL)
+    {
+        return 0;
+    }
+
+    while (*pointer != '\0')
+    {
+        switch (*pointer)
+        {
+            case '\"':
+                /* skip the string, commas and brackets in it are no values */
+                for (pointer++; (*pointer != '\0') && (*pointer != '\"'); pointer++)
+                {
+                    if ((pointer[0] == '\\') && (pointer[1] != '\0'))
+                    {
+                        pointer++;
+                    }
+                }
+                if (*pointer == '\0')
+                {
+                    continue;
+                }
+                break;
+
+            case ',':
+            case '[':
+            case '{':
+                count++;
+                break;
+
+            default:
+                break;
+        }
+        pointer++;
+    }
+
+    if ((item_size % CJSON_ARENA_ALIGNMENT) != 0)
+    {
+        item_size += CJSON_ARENA_ALIGNMENT - (item_size % CJSON_ARENA_ALIGNMENT);
+    }
+
+    /* the buffer may start unaligned */
+    return (count * item_size) + CJSON_ARENA_ALIGNMENT - 1;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_ParseInArenaWithOpts(cJSON_Arena *arena, char *value, const char **return_parse_end, cJSON_bool require_null_terminated)
+{
+    if (arena == NULL)
+    {
+        return NULL;
+    }
+
+    return parse(value, return_parse_end, require_null_terminated, arena);
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_ParseInArena(cJSON_Arena *arena, char *value)
+{
+    return cJSON_ParseInArenaWithOpts(arena, value, 0, 0);
+}
+
+/* State of the streaming (SAX) parser. Strings and numbers are collected in
+ * token (and names in name) and handed to parse_string/parse_number from there. */
+typedef struct
+{
+    cJSON_ReadFunction read;
+    void *read_context;
+    const cJSON_SAX_Handler *handler;
+    void *context;
+    size_t position; /* number of bytes of the input consumed */
+    size_t depth;
+    size_t chunk_length;
+    size_t chunk_offset;
+    cJSON_bool end;
+    unsigned char chunk[CJSON_STREAM_CHUNK_SIZE];
+    unsigned char name[CJSON_STREAM_STRING_LIMIT + sizeof("\"\"")];
+    unsigned char token[CJSON_STREAM_STRING_LIMIT + sizeof("\"\"")];
+} stream_parser;
+
+/* Look at the next byte of the input, reading the next chunk if needed. Returns -1 at the end. */
+static int stream_peek(stream_parser * const parser)
+{
+    int length = 0;
+
+    if (parser->chunk_offset < parser->chunk_length)
+    {
+        return parser->chunk[parser->chunk_offset];
+    }
+
+    if (parser->end)
+    {
+        return -1;
+    }
+
+    length = parser->read(parser->read_context, (char*)parser->chunk, sizeof(parser->chunk));
+    if (length <= 0)
+    {
+        /* end of input or read error */
+        parser->end = true;
+        return -1;
+    }
+
+    parser->chunk_length = (size_t)length;
+    parser->chunk_offset = 0;
+
+    return parser->chunk[0];
+}
+
+/* Consume the next byte of the input. */
+static int stream_next(stream_parser * const parser)
+{
+    int c = stream_peek(parser);
+
+    if (c >= 0)
+    {
+        parser->chunk_offset++;
+        parser->position++;
+    }
+
+    return c;
+}
+
+static int stream_skip_whitespace(stream_parser * const parser)
+{
+    int c = stream_peek(parser);
+
+    while ((c >= 0) && (c <= 32))
+    {
+        stream_next(parser);
+        c = stream_peek(parser);
+    }
+
+    return c;
+}
+
+/* Read a string literal into output and unescape it there. */
+static cJSON_bool stream_parse_string(stream_parser * const parser, unsigned char * const output, cJSON * const item)
+{
+    parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0 }, NULL, true };
+    size_t length = 0;
+    int c = stream_next(parser);
+
+    if (c != '\"')
+    {
+        return false;
+    }
+
+    output[length++] = '\"';
+    for (;;)
+    {
+        c = stream_next(parser);
+        if (c < 0)
+        {
+            return false; /* string ended unexpectedly */
+        }
+
+        if (length >= (CJSON_STREAM_STRING_LIMIT + 2))
+        {
+            return false; /* string too long */
+        }
+        output[length++] = (unsigned char)c;
+
+        if (c == '\"')
+        {
+            break;
+        }
+
+        if (c == '\\')
+        {
+            c = stream_next(parser);
+            if ((c < 0) || (length >= (CJSON_STREAM_STRING_LIMIT + 2)))
+            {
+                return false;
+            }
+            output[length++] = (unsigned char)c;
+        }
+    }
+
+    buffer.content = output;
+    buffer.length = length;
+    buffer.hooks = global_hooks;
+
+    return parse_string(item, &buffer);
+}
+
+static cJSON_bool stream_parse_number(stream_parser * const parser, cJSON * const item)
+{
+    parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0 }, NULL, false };
+    size_t length = 0;
+    int c = stream_peek(parser);
+
+    while (((c >= '0') && (c <= '9')) || (c == '+') || (c == '-') || (c == '.') || (c == 'e') || (c == 'E'))
+    {
+        if (length >= (sizeof(parser->token) - 1))
+        {
+            return false;
+        }
+        parser->token[length++] = (unsigned char)stream_next(parser);
+        c = stream_peek(parser);
+    }
+    parser->token[length] = '\0';
+
+    buffer.content = parser->token;
+    buffer.length = length;
+    buffer.hooks = global_hooks;
+
+    return parse_number(item, &buffer) && (buffer.offset == length);
+}
+
+static cJSON_bool stream_parse_literal(stream_parser * const parser, const char *literal)
+{
+    for (; *literal != '\0'; literal++)
+    {
+        if (stream_next(parser) != (unsigned char)*literal)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static cJSON_bool stream_parse_value(stream_parser * const parser, const char * const name);
+
+/* Parse the members of an object or the elements of an array, the opening bracket is consumed. */
+static cJSON_bool stream_parse_members(stream_parser * const parser, cJSON_bool object)
+{
+    cJSON name = { 0 };
+    int c = 0;
+
+    if (parser->depth >= CJSON_NESTING_LIMIT)
+    {
+        return false; /* to deeply nested */
+    }
+    parser->depth++;
+
+    c = stream_skip_whitespace(parser);
+    if (c == (object ? '}' : ']'))
+    {
+        /* empty array or object */
+        goto success;
+    }
+
+    for (;;)
+    {
+        name.string = NULL;
+        if (object)
+        {
+            if ((c != '\"') || !stream_parse_string(parser, parser->name, &name))
+            {
+                return false; /* failed to parse name */
+            }
+            name.string = name.valuestring;
+
+            if (stream_skip_whitespace(parser) != ':')
+            {
+                return false; /* invalid object */
+            }
+            stream_next(parser);
+            stream_skip_whitespace(parser);
+        }
+
+        if (!stream_parse_value(parser, name.string))
+        {
+            return false;
+        }
+
+        c = stream_skip_whitespace(parser);
+        if (c != ',')
+        {
+            break;
+        }
+        stream_next(parser);
+        c = stream_skip_whitespace(parser);
+    }
+
+    if (c != (object ? '}' : ']'))
+    {
+        return false; /* expected end of array or object */
+    }
+
+success:
+    stream_next(parser);
+    parser->depth--;
+
+    if (object)
+    {
+        return (parser->handler->end_object == NULL) || parser->handler->end_object(parser->context);
+    }
+
+    return (parser->handler->end_array == NULL) || parser->handler->end_array(parser->context);
+}
+
+/* Parse a value and report it to the handler. name is the name of the value inside an object. */
+static cJSON_bool stream_parse_value(stream_parser * const parser, const char * const name)
+{
+    const cJSON_SAX_Handler * const handler = parser->handler;
+    cJSON item = { 0 };
+    int c = stream_peek(parser);
+
+    switch (c)
+    {
+        case '{':
+            stream_next(parser);
+            if ((handler->start_object != NULL) && !handler->start_object(parser->context, name))
+            {
+                return false;
+            }
+            return stream_parse_members(parser, true);
+
+        case '[':
+            stream_next(parser);
+            if ((handler->start_array != NULL) && !handler->start_array(parser->context, name))
+            {
+                return false;
+            }
+            return stream_parse_members(parser, false);
+
+        case '\"':
+            if (!stream_parse_string(parser, parser->token, &item))
+            {
+                return false;
+            }
+            break;
+
+        case 'n':
+            if (!stream_parse_literal(parser, "null"))
+            {
+                return false;
+            }
+            item.type = cJSON_NULL;
+            break;
+
+        case 'f':
+            if (!stream_parse_literal(parser, "false"))
+            {
+                return false;
+            }
+            item.type = cJSON_False;
+            break;
+
+        case 't':
+            if (!stream_parse_literal(parser, "true"))
+            {
+                return false;
+            }
+            item.type = cJSON_True;
+            item.valueint = 1;
+            break;
+
+        default:
+            if ((c != '-') && ((c < '0') || (c > '9')))
+            {
+                return false;
+            }
+            if (!stream_parse_number(parser, &item))
+            {
+                return false;
+            }
+            break;
+    }
+
+    item.string = (char*)name;
+
+    return (handler->value == NULL) || handler->value(parser->context, &item);
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_ParseStream(cJSON_ReadFunction read_fn, void *read_context, const cJSON_SAX_Handler *handler, void *context, size_t *return_parse_end)
+{
+    stream_parser parser;
+    cJSON_bool result = false;
+
+    if ((read_fn == NULL) || (handler == NULL))
+    {
+        return false;
+    }
+
+    parser.read = read_fn;
+    parser.read_context = read_context;
+    parser.handler = handler;
+    parser.context = context;
+    parser.position = 0;
+    parser.depth = 0;
+    parser.chunk_length = 0;
+    parser.chunk_offset = 0;
+    parser.end = false;
+
+    stream_skip_whitespace(&parser);
+    result = stream_parse_value(&parser, NULL);
+
+    if (return_parse_end != NULL)
+    {
+        *return_parse_end = parser.position;
+    }
+
+    return result;
+}
+
+typedef struct
+{
+    const char *content;
+    size_t length;
+    size_t offset;
+} stream_string;
+
+static int stream_read_string(void *context, char *buffer, size_t length)
+{
+    stream_string * const input = (stream_string*)context;
+
+    length = cjson_min(length, input->length - input->offset);
+    memcpy(buffer, input->content + input->offset, length);
+    input->offset += length;
+
+    return (int)length;
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_ParseSAX(const char *value, const cJSON_SAX_Handler *handler, void *context)
+{
+    stream_string input;
+    size_t position = 0;
+
+    /* reset error position */
+    global_error.json = NULL;
+    global_error.position = 0;
+
+    if (value == NULL)
+    {
+        return false;
+    }
+
+    input.content = value;
+    input.length = strlen(value);
+    input.offset = 0;
+
+    if (!cJSON_ParseStream(stream_read_string, &input, handler, context, &position))
+    {
+        global_error.json = (const unsigned char*)value;
+        global_error.position = (position > 0) ? (position - 1) : 0;
+        return false;
+    }
+
+    return true;
+}
 
 static unsigned char *print(const cJSON * const item, cJSON_bool format, const internal_hooks * const hooks)
 {
@@ -1338,7 +1889,7 @@ static cJSON_bool parse_array(cJSON * const item, parse_buffer * const input_buf
     do
     {
         /* allocate next item */
-        cJSON *new_item = cJSON_New_Item(&(input_buffer->hooks));
+        cJSON *new_item = parse_new_item(input_buffer);
         if (new_item == NULL)
         {
             goto fail; /* allocation failure */
@@ -1385,7 +1936,7 @@ success:
     return true;
 
 fail:
-    if (head != NULL)
+    if ((head != NULL) && (input_buffer->arena == NULL))
     {
         cJSON_Delete(head);
     }
@@ -1492,7 +2043,7 @@ static cJSON_bool parse_object(cJSON * const item, parse_buffer * const input_bu
     do
     {
         /* allocate next item */
-        cJSON *new_item = cJSON_New_Item(&(input_buffer->hooks));
+        cJSON *new_item = parse_new_item(input_buffer);
         if (new_item == NULL)
         {
             goto fail; /* allocation failure */
@@ -1556,7 +2107,7 @@ success:
     return true;
 
 fail:
-    if (head != NULL)
+    if ((head != NULL) && (input_buffer->arena == NULL))
     {
         cJSON_Delete(head);
     }
@@ -99,7 +99,7 @@
 #define POST                                                                  \
   do {                                                                        \
     if ((cb) != NULL) {                                                       \
-      uv__work_submit((loop), &(req)->work_req, uv__fs_work, uv__fs_done);    \
+      uv__work_submit((loop), &(req)->work_req, UV__WORK_IO, uv__fs_work, uv__fs_done);  \
       return 0;                                                               \
     }                                                                         \
     else {                                                                    \
@@ -56,7 +56,7 @@ void uv__poll_close(uv_poll_t *handle);
 void uv__make_close_pending(uv_handle_t *handle);
 
 // in uv_threadpool.cpp
-void uv__work_submit(uv_loop_t *loop, struct uv__work *w, void (*work)(struct uv__work *w), void (*done)(struct uv__work *w, int status));
+void uv__work_submit(uv_loop_t *loop, struct uv__work *w, enum uv__work_kind kind, void (*work)(struct uv__work *w), void (*done)(struct uv__work *w, int status));
 
 // in uv_fs.cpp
 void uv__fs_scandir_cleanup(uv_fs_t *req);
@@ -36,20 +36,62 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <uv.h>
 
 //-----------------------------------------------------------------------------
-#define MAX_THREADPOOL_SIZE 4
+#define MAX_THREADPOOL_SIZE 8
+
+#ifdef CONFIG_LIBTUV_THREADPOOL_SIZE
+#define DEFAULT_THREADPOOL_SIZE CONFIG_LIBTUV_THREADPOOL_SIZE
+#else
+#define DEFAULT_THREADPOOL_SIZE 2
+#endif
+
+#ifdef CONFIG_LIBTUV_THREADPOOL_WORK_STEALING
+#define DEFAULT_THREADPOOL_STEAL 1
+#else
+#define DEFAULT_THREADPOOL_STEAL 0
+#endif
+
+/* A work queue, owned by one worker or shared by all of them */
+struct uv__wqueue {
+	uv_mutex_t mutex;
+	QUEUE wq[UV__WORK_KINDS];
+	volatile unsigned int nqueued[UV__WORK_KINDS];
+	volatile unsigned int nsleeping;	/* Idle owners, a hint for post() */
+#ifdef CONFIG_LIBTUV_THREADPOOL_STATS
+	unsigned int max_queued;
+#endif
+};
+
+struct uv__worker {
+	uv_thread_t thread;
+	unsigned int qid;
+#ifdef CONFIG_LIBTUV_THREADPOOL_STATS
+	uv_threadpool_stats_t stats;
+#endif
+};
 
 static uv_once_t _once = UV_ONCE_INIT;
-static uv_cond_t _cond;
+
+/* _mutex protects _cpu_running, _nidle and _exiting.  Idle workers sleep on
+ * _cond, whichever queue they own, since they may take work from any queue.
+ */
 static uv_mutex_t _mutex;
+static uv_cond_t _cond;
+static unsigned int _nidle;
 static unsigned int _nthreads;
-static uv_thread_t *_threads;
-static uv_thread_t _default_threads[2];
-static QUEUE _exit_message;
-static QUEUE _wq;
+static unsigned int _nqueues;
+static unsigned int _next_queue;
+static unsigned int _cpu_limit;
+static volatile unsigned int _cpu_running;
+static volatile int _exiting;
+static struct uv__worker *_workers;
+static struct uv__wqueue *_queues;
+static struct uv__worker _default_workers[DEFAULT_THREADPOOL_SIZE];
+static struct uv__wqueue _default_queues[DEFAULT_THREADPOOL_SIZE];
 static volatile int _initialized = 0;
 
 //-----------------------------------------------------------------------------
@@ -60,42 +102,176 @@ static void uv__cancelled(struct uv__work *w)
 	ABORT();
 }
 
-/* To avoid deadlock with uv_cancel() it's crucial that the worker
- * never holds the global _mutex and the loop-local mutex at the same time.
- */
-static void worker(void *arg)
+/* Whether any queue holds requests of a class, without locking */
+static int uv__work_pending(int kind)
 {
-	struct uv__work *w;
-	QUEUE *q;
+	unsigned int i;
 
-	(void)arg;
+	for (i = 0; i < _nqueues; i++) {
+		if (_queues[i].nqueued[kind] > 0) {
+			return 1;
+		}
+	}
 
-	for (;;) {
-		uv_mutex_lock(&_mutex);
+	return 0;
+}
 
-		while (QUEUE_EMPTY(&_wq)) {
-			uv_cond_wait(&_cond, &_mutex);
-		}
+/* CPU requests may occupy all workers but one, which stays free for I/O */
+static int uv__work_cpu_acquire(void)
+{
+	int acquired;
+
+	uv_mutex_lock(&_mutex);
+	acquired = (_cpu_running < _cpu_limit);
+	if (acquired) {
+		_cpu_running++;
+	}
+	uv_mutex_unlock(&_mutex);
+
+	return acquired;
+}
 
-		q = QUEUE_HEAD(&_wq);
+static void uv__work_cpu_release(void)
+{
+	uv_mutex_lock(&_mutex);
+	_cpu_running--;
 
-		if (q == &_exit_message) {
+	/* CPU requests may have been left queued because of the limit */
+	if (_nidle > 0) {
+		if (_exiting) {
+			uv_cond_broadcast(&_cond);
+		} else if (uv__work_pending(UV__WORK_CPU)) {
 			uv_cond_signal(&_cond);
-		} else {
-			QUEUE_REMOVE(q);
-			QUEUE_INIT(q);		/* Signal uv_cancel() that the work req is
-								   executing. */
 		}
+	}
+	uv_mutex_unlock(&_mutex);
+}
+
+/* The caller holds wq->mutex */
+static QUEUE *uv__wqueue_pop(struct uv__wqueue *wq, int kind)
+{
+	QUEUE *q;
+
+	if (QUEUE_EMPTY(&wq->wq[kind])) {
+		return NULL;
+	}
+
+	q = QUEUE_HEAD(&wq->wq[kind]);
+	QUEUE_REMOVE(q);
+	QUEUE_INIT(q);				/* Signal uv_cancel() that the work req is
+								   executing. */
+	wq->nqueued[kind]--;
+
+	return q;
+}
 
-		uv_mutex_unlock(&_mutex);
+/*
+ * Whether a worker could take a request from any queue.  The caller holds
+ * _mutex: post() counts a request before it takes _mutex to wake a worker,
+ * so a worker checking this before it sleeps cannot miss the wakeup.
+ */
+static int uv__work_runnable(void)
+{
+	return uv__work_pending(UV__WORK_IO) || (uv__work_pending(UV__WORK_CPU) && _cpu_running < _cpu_limit);
+}
+
+/*
+ * Take the oldest request, I/O before CPU, from the worker's own queue or
+ * else steal it from the queue of another worker.
+ */
+static QUEUE *uv__work_take(struct uv__worker *self, int *kind)
+{
+	struct uv__wqueue *wq;
+	unsigned int i;
+	QUEUE *q;
+	int k;
 
-		if (q == &_exit_message) {
+	for (k = 0; k < UV__WORK_KINDS; k++) {
+		if (k == UV__WORK_CPU && (!uv__work_pending(k) || !uv__work_cpu_acquire())) {
 			break;
 		}
 
+		for (i = 0; i < _nqueues; i++) {
+			wq = &_queues[(self->qid + i) % _nqueues];
+			if (i > 0 && wq->nqueued[k] == 0) {
+				continue;
+			}
+
+			uv_mutex_lock(&wq->mutex);
+			q = uv__wqueue_pop(wq, k);
+			uv_mutex_unlock(&wq->mutex);
+
+			if (q != NULL) {
+#ifdef CONFIG_LIBTUV_THREADPOOL_STATS
+				if (i > 0) {
+					self->stats.stolen++;
+				}
+#endif
+				*kind = k;
+				return q;
+			}
+		}
+
+		if (k == UV__WORK_CPU) {
+			uv__work_cpu_release();
+		}
+	}
+
+	return NULL;
+}
+
+/* To avoid deadlock with uv_cancel() it's crucial that the worker
+ * never holds a queue mutex and the loop-local mutex at the same time.
+ */
+static void worker(void *arg)
+{
+	struct uv__worker *self = (struct uv__worker *)arg;
+	struct uv__wqueue *home = &_queues[self->qid];
+	struct uv__work *w;
+	QUEUE *q;
+	int kind;
+
+	for (;;) {
+		q = uv__work_take(self, &kind);
+		if (q == NULL) {
+			/* Sleep until a request can be taken from any queue.  On exit,
+			 * leave only once nothing is queued any more; CPU requests held
+			 * back by the limit are run after the running ones finish.
+			 */
+			uv_mutex_lock(&_mutex);
+			if (!uv__work_runnable()) {
+				if (_exiting && !uv__work_pending(UV__WORK_CPU)) {
+					uv_mutex_unlock(&_mutex);
+					break;
+				}
+				_nidle++;
+				home->nsleeping++;
+				uv_cond_wait(&_cond, &_mutex);
+				home->nsleeping--;
+				_nidle--;
+			}
+			uv_mutex_unlock(&_mutex);
+			continue;
+		}
+
 		w = QUEUE_DATA(q, struct uv__work, wq);
+#ifdef CONFIG_LIBTUV_THREADPOOL_STATS
+		{
+			uint64_t latency = uv__hrtime() - w->submitted;
+
+			self->stats.executed++;
+			self->stats.total_latency += latency;
+			if (latency > self->stats.max_latency) {
+				self->stats.max_latency = latency;
+			}
+		}
+#endif
 		w->work(w);
 
+		if (kind == UV__WORK_CPU) {
+			uv__work_cpu_release();
+		}
+
 		uv_mutex_lock(&w->loop->wq_mutex);
 		w->work = NULL;			/* Signal uv_cancel() that the work req is done
 								   executing. */
@@ -105,13 +281,43 @@ static void worker(void *arg)
 	}
 }
 
-static void post(QUEUE *q)
+static void post(struct uv__work *w, enum uv__work_kind kind)
 {
+	struct uv__wqueue *wq;
+	unsigned int qid;
+	unsigned int i;
+
+	/* Prefer a queue with a sleeping worker, else spread round robin */
+	qid = _next_queue++ % _nqueues;
+	for (i = 0; i < _nqueues; i++) {
+		if (_queues[(qid + i) % _nqueues].nsleeping) {
+			qid = (qid + i) % _nqueues;
+			break;
+		}
+	}
+
+	w->qid = qid;
+	w->kind = kind;
+#ifdef CONFIG_LIBTUV_THREADPOOL_STATS
+	w->submitted = uv__hrtime();
+#endif
+	wq = &_queues[qid];
+
+	uv_mutex_lock(&wq->mutex);
+	QUEUE_INSERT_TAIL(&wq->wq[kind], &w->wq);
+	wq->nqueued[kind]++;
+#ifdef CONFIG_LIBTUV_THREADPOOL_STATS
+	if (wq->nqueued[UV__WORK_IO] + wq->nqueued[UV__WORK_CPU] > wq->max_queued) {
+		wq->max_queued = wq->nqueued[UV__WORK_IO] + wq->nqueued[UV__WORK_CPU];
+	}
+#endif
+	uv_mutex_unlock(&wq->mutex);
+
 	uv_mutex_lock(&_mutex);
-	QUEUE_INSERT_TAIL(&_wq, q);
+	if (_nidle > 0) {
+		uv_cond_signal(&_cond);
+	}
 	uv_mutex_unlock(&_mutex);
-
-	uv_cond_signal(&_cond);
 }
 
 #if defined(__TINYARA__)
@@ -128,22 +334,37 @@ static void cleanup(void)
 		return;
 	}
 
-	post(&_exit_message);
+	/* Workers leave once every queued request has been run */
+	uv_mutex_lock(&_mutex);
+	_exiting = 1;
+	uv_cond_broadcast(&_cond);
+	uv_mutex_unlock(&_mutex);
 
 	for (i = 0; i < _nthreads; i++)
-		if (uv_thread_join(_threads + i)) {
+		if (uv_thread_join(&_workers[i].thread)) {
 			ABORT();
 		}
 
-	if (_threads != _default_threads) {
-		free(_threads);
+	for (i = 0; i < _nqueues; i++) {
+		uv_mutex_destroy(&_queues[i].mutex);
+	}
+
+	if (_workers != _default_workers) {
+		free(_workers);
+	}
+	if (_queues != _default_queues) {
+		free(_queues);
 	}
 
-	uv_mutex_destroy(&_mutex);
 	uv_cond_destroy(&_cond);
+	uv_mutex_destroy(&_mutex);
 
-	_threads = NULL;
+	_workers = NULL;
+	_queues = NULL;
 	_nthreads = 0;
+	_nqueues = 0;
+	_nidle = 0;
+	_exiting = 0;
 	_initialized = 0;
 	_once = UV_ONCE_INIT;
 }
@@ -151,11 +372,13 @@ static void cleanup(void)
 static void init_once(void)
 {
 	unsigned int i;
+	unsigned int k;
 	const char *val;
+	int steal;
 
 	assert(_initialized == 0);
 
-	_nthreads = ARRAY_SIZE(_default_threads);
+	_nthreads = DEFAULT_THREADPOOL_SIZE;
 	val = getenv("UV_THREADPOOL_SIZE");
 	if (val != NULL) {
 		_nthreads = atoi(val);
@@ -167,29 +390,64 @@ static void init_once(void)
 		_nthreads = MAX_THREADPOOL_SIZE;
 	}
 
-	_threads = _default_threads;
-	if (_nthreads > ARRAY_SIZE(_default_threads)) {
-		_threads = (uv_thread_t *)malloc(_nthreads * sizeof(_threads[0]));
-		if (_threads == NULL) {
-			_nthreads = ARRAY_SIZE(_default_threads);
-			_threads = _default_threads;
-		}
+	steal = DEFAULT_THREADPOOL_STEAL;
+	val = getenv("UV_THREADPOOL_STEAL");
+	if (val != NULL) {
+		steal = atoi(val);
 	}
 
-	if (uv_cond_init(&_cond)) {
-		TDLOG("init_once cond abort");
-		ABORT();
+	/* Without work stealing, all workers share a single queue */
+	_nqueues = steal ? _nthreads : 1;
+	_cpu_limit = (_nthreads > 1) ? _nthreads - 1 : 1;
+	_cpu_running = 0;
+	_next_queue = 0;
+
+	_workers = _default_workers;
+	_queues = _default_queues;
+	if (_nthreads > ARRAY_SIZE(_default_workers)) {
+		_workers = (struct uv__worker *)malloc(_nthreads * sizeof(_workers[0]));
+		_queues = (struct uv__wqueue *)malloc(_nqueues * sizeof(_queues[0]));
+		if (_workers == NULL || _queues == NULL) {
+			free(_workers);
+			free(_queues);
+			_nthreads = ARRAY_SIZE(_default_workers);
+			_nqueues = steal ? _nthreads : 1;
+			_workers = _default_workers;
+			_queues = _default_queues;
+		}
 	}
+	memset(_workers, 0, _nthreads * sizeof(_workers[0]));
 
 	if (uv_mutex_init(&_mutex)) {
 		TDLOG("init_once mutex abort");
 		ABORT();
 	}
 
-	QUEUE_INIT(&_wq);
+	if (uv_cond_init(&_cond)) {
+		TDLOG("init_once cond abort");
+		ABORT();
+	}
+	_nidle = 0;
+
+	for (i = 0; i < _nqueues; i++) {
+		if (uv_mutex_init(&_queues[i].mutex)) {
+			TDLOG("init_once mutex abort");
+			ABORT();
+		}
+
+		for (k = 0; k < UV__WORK_KINDS; k++) {
+			QUEUE_INIT(&_queues[i].wq[k]);
+			_queues[i].nqueued[k] = 0;
+		}
+		_queues[i].nsleeping = 0;
+#ifdef CONFIG_LIBTUV_THREADPOOL_STATS
+		_queues[i].max_queued = 0;
+#endif
+	}
 
 	for (i = 0; i < _nthreads; i++) {
-		if (uv_thread_create(_threads + i, worker, NULL)) {
+		_workers[i].qid = i % _nqueues;
+		if (uv_thread_create(&_workers[i].thread, worker, &_workers[i])) {
 			TDLOG("init_once thread %d abort", i);
 			ABORT();
 		}
@@ -200,7 +458,7 @@ static void init_once(void)
 
 //-----------------------------------------------------------------------------
 
-void uv__work_submit(uv_loop_t *loop, struct uv__work *w, void (*work)(struct uv__work *w), void (*done)(struct uv__work *w, int status))
+void uv__work_submit(uv_loop_t *loop, struct uv__work *w, enum uv__work_kind kind, void (*work)(struct uv__work *w), void (*done)(struct uv__work *w, int status))
 {
 
 	uv_once(&_once, init_once);
@@ -208,23 +466,25 @@ void uv__work_submit(uv_loop_t *loop, struct uv__work *w, void (*work)(struct uv
 	w->work = work;
 	w->done = done;
 	QUEUE_INIT(&w->wq);
-	post(&w->wq);
+	post(w, kind);
 }
 
 static int uv__work_cancel(uv_loop_t *loop, uv_req_t *req, struct uv__work *w)
 {
+	struct uv__wqueue *wq = &_queues[w->qid];
 	int cancelled;
 
-	uv_mutex_lock(&_mutex);
+	uv_mutex_lock(&wq->mutex);
 	uv_mutex_lock(&w->loop->wq_mutex);
 
 	cancelled = !QUEUE_EMPTY(&w->wq) && w->work != NULL;
 	if (cancelled) {
 		QUEUE_REMOVE(&w->wq);
+		wq->nqueued[w->kind]--;
 	}
 
 	uv_mutex_unlock(&w->loop->wq_mutex);
-	uv_mutex_unlock(&_mutex);
+	uv_mutex_unlock(&wq->mutex);
 
 	if (!cancelled) {
 		return UV_EBUSY;
@@ -300,7 +560,7 @@ int uv_queue_work(uv_loop_t *loop, uv_work_t *req, uv_work_cb work_cb, uv_after_
 	req->loop = loop;
 	req->work_cb = work_cb;
 	req->after_work_cb = after_work_cb;
-	uv__work_submit(loop, &req->work_req, uv__queue_work, uv__queue_done);
+	uv__work_submit(loop, &req->work_req, UV__WORK_CPU, uv__queue_work, uv__queue_done);
 	return 0;
 }
 
@@ -337,6 +597,28 @@ int uv_cancel(uv_req_t *req)
 	return uv__work_cancel(loop, req, wreq);
 }
 
+//-----------------------------------------------------------------------------
+#ifdef CONFIG_LIBTUV_THREADPOOL_STATS
+int uv_threadpool_stats(uv_threadpool_stats_t *stats, int count)
+{
+	struct uv__wqueue *wq;
+	int i;
+
+	if (_initialized == 0) {
+		return 0;
+	}
+
+	for (i = 0; i < count && i < _nthreads; i++) {
+		wq = &_queues[_workers[i].qid];
+		stats[i] = _workers[i].stats;
+		stats[i].queued = wq->nqueued[UV__WORK_IO] + wq->nqueued[UV__WORK_CPU];
+		stats[i].max_queued = wq->max_queued;
+	}
+
+	return i;
+}
+#endif
+
 //-----------------------------------------------------------------------------
 #if defined(__TINYARA__)
 void uv_cleanup(void)
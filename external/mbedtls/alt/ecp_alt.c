@@ -0,0 +1,107 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_ECP_C) && defined(MBEDTLS_ECP_INTERNAL_ALT)
+
+#include <stddef.h>
+
+#include "mbedtls/ecp.h"
+#include "mbedtls/alt/ecp_alt.h"
+
+/* ecp_internal.h only declares the jacobian hooks for these curves */
+#if defined(MBEDTLS_ECP_DP_SECP192R1_ENABLED) ||   \
+    defined(MBEDTLS_ECP_DP_SECP224R1_ENABLED) ||   \
+    defined(MBEDTLS_ECP_DP_SECP256R1_ENABLED) ||   \
+    defined(MBEDTLS_ECP_DP_SECP384R1_ENABLED) ||   \
+    defined(MBEDTLS_ECP_DP_SECP521R1_ENABLED) ||   \
+    defined(MBEDTLS_ECP_DP_BP256R1_ENABLED)   ||   \
+    defined(MBEDTLS_ECP_DP_BP384R1_ENABLED)   ||   \
+    defined(MBEDTLS_ECP_DP_BP512R1_ENABLED)   ||   \
+    defined(MBEDTLS_ECP_DP_SECP192K1_ENABLED) ||   \
+    defined(MBEDTLS_ECP_DP_SECP224K1_ENABLED) ||   \
+    defined(MBEDTLS_ECP_DP_SECP256K1_ENABLED)
+#define ECP_SHORTWEIERSTRASS
+#endif
+
+#include "mbedtls/ecp_internal.h"
+
+static const struct mbedtls_ecp_hw_ops *g_ecp_hw_ops;
+
+int mbedtls_ecp_hw_register(const struct mbedtls_ecp_hw_ops *ops)
+{
+	if (ops != NULL && (ops->grp_capable == NULL || ops->init == NULL || ops->free == NULL ||
+						ops->add_mixed == NULL || ops->double_jac == NULL ||
+						ops->normalize_jac == NULL || ops->normalize_jac_many == NULL)) {
+		return MBEDTLS_ERR_ECP_BAD_INPUT_DATA;
+	}
+
+	g_ecp_hw_ops = ops;
+
+	return 0;
+}
+
+unsigned char mbedtls_internal_ecp_grp_capable(const mbedtls_ecp_group *grp)
+{
+	if (g_ecp_hw_ops == NULL) {
+		return 0;
+	}
+
+	return g_ecp_hw_ops->grp_capable(grp);
+}
+
+int mbedtls_internal_ecp_init(const mbedtls_ecp_group *grp)
+{
+	return g_ecp_hw_ops->init(grp);
+}
+
+void mbedtls_internal_ecp_free(const mbedtls_ecp_group *grp)
+{
+	g_ecp_hw_ops->free(grp);
+}
+
+#if defined(ECP_SHORTWEIERSTRASS)
+int mbedtls_internal_ecp_add_mixed(const mbedtls_ecp_group *grp, mbedtls_ecp_point *R, const mbedtls_ecp_point *P, const mbedtls_ecp_point *Q)
+{
+	return g_ecp_hw_ops->add_mixed(grp, R, P, Q);
+}
+
+int mbedtls_internal_ecp_double_jac(const mbedtls_ecp_group *grp, mbedtls_ecp_point *R, const mbedtls_ecp_point *P)
+{
+	return g_ecp_hw_ops->double_jac(grp, R, P);
+}
+
+int mbedtls_internal_ecp_normalize_jac(const mbedtls_ecp_group *grp, mbedtls_ecp_point *pt)
+{
+	return g_ecp_hw_ops->normalize_jac(grp, pt);
+}
+
+int mbedtls_internal_ecp_normalize_jac_many(const mbedtls_ecp_group *grp, mbedtls_ecp_point *T[], size_t t_len)
+{
+	return g_ecp_hw_ops->normalize_jac_many(grp, T, t_len);
+}
+#endif /* ECP_SHORTWEIERSTRASS */
+
+#endif /* MBEDTLS_ECP_C && MBEDTLS_ECP_INTERNAL_ALT */
@@ -83,8 +83,6 @@
 #define mbedtls_free       free
 #endif
 
-#include "mbedtls/ecp_internal.h"
-
 #if defined(MBEDTLS_ENABLE_HARDWARE_ALT)
 #include "mbedtls/alt/common.h"
 #endif
@@ -125,6 +123,9 @@ static unsigned long add_count, dbl_count, mul_count;
 #define ECP_MONTGOMERY
 #endif
 
+/* After the curve types, which select the hooks it declares */
+#include "mbedtls/ecp_internal.h"
+
 /*
  * Curve types: internal for now, might be exposed later
  */
@@ -361,7 +362,8 @@ void mbedtls_ecp_group_free( mbedtls_ecp_group *grp )
         mbedtls_mpi_free( &grp->N );
     }
 
-    if( grp->T != NULL )
+    /* T_size == 0 means T is a static table from ecp_curves.c */
+    if( grp->T != NULL && grp->T_size != 0 )
     {
         for( i = 0; i < grp->T_size; i++ )
             mbedtls_ecp_point_free( &grp->T[i] );
@@ -1495,6 +1497,160 @@ cleanup:
     return( ret );
 }
 
+#if defined(MBEDTLS_ECP_WNAF_WINDOW)
+#if MBEDTLS_ECP_WNAF_WINDOW < 2 || MBEDTLS_ECP_WNAF_WINDOW > 6
+#error "MBEDTLS_ECP_WNAF_WINDOW out of bounds"
+#endif
+
+/* number of precomputed points: P, 3P, ..., ( 2^(w-1) - 1 ) P */
+#define WNAF_PRE        ( 1 << ( MBEDTLS_ECP_WNAF_WINDOW - 2 ) )
+
+/*
+ * Compute the width-w NAF of m (GECC 3.35): odd digits between -2^(w-1) and
+ * 2^(w-1), with at least w - 1 zero digits after each non-zero one.
+ * Returns the number of digits, the last one being non-zero.
+ *
+ * Calling conventions:
+ * - naf is an array of size bitlength(m) + 1
+ * - m is positive
+ */
+static size_t ecp_wnaf( signed char naf[], const mbedtls_mpi *m )
+{
+    const size_t w = MBEDTLS_ECP_WNAF_WINDOW;
+    size_t len, j;
+    int window, digit;
+
+    len = mbedtls_mpi_bitlen( m );
+
+    /* window holds the bits j .. j + w - 1 of what is left of m */
+    window = 0;
+    for( j = 0; j < w; j++ )
+        window |= mbedtls_mpi_get_bit( m, j ) << j;
+
+    for( j = 0; window != 0 || j + w < len; j++ )
+    {
+        digit = 0;
+        if( window & 1 )
+        {
+            digit = window;
+            if( digit >= ( 1 << ( w - 1 ) ) )
+                digit -= 1 << w;
+            window -= digit;
+        }
+
+        naf[j] = (signed char) digit;
+        window = ( window >> 1 ) + ( mbedtls_mpi_get_bit( m, j + w ) << ( w - 1 ) );
+    }
+
+    return( j );
+}
+
+/*
+ * Multiplication using the width-w NAF, for short Weierstrass curves.
+ * Uses fewer precomputed points than the comb method (2^(w-2) instead of
+ * 2^(w-1)) and fewer additions, but its running time depends on m.
+ *
+ * NOT constant-time - ONLY for public scalars!
+ *
+ * Cost: 1 D + (2^(w-2) - 1) A + 1 N(2^(w-2) - 1) + n D + n/(w+1) A + 1 N
+ */
+static int ecp_mul_wnaf( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+                         const mbedtls_mpi *m, const mbedtls_ecp_point *P )
+{
+    int ret;
+    signed char naf[MBEDTLS_ECP_MAX_BITS + 1];
+    mbedtls_ecp_point T[WNAF_PRE], *TT[WNAF_PRE], Q;
+    size_t i;
+    unsigned char k;
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    char is_grp_capable = 0;
+#endif
+
+    /* Same sanity checks as mbedtls_ecp_mul() */
+    if( mbedtls_mpi_cmp_int( &P->Z, 1 ) != 0 )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    if( ( ret = mbedtls_ecp_check_privkey( grp, m ) ) != 0 ||
+        ( ret = mbedtls_ecp_check_pubkey( grp, P ) ) != 0 )
+        return( ret );
+
+    mbedtls_ecp_point_init( &Q );
+    for( k = 0; k < WNAF_PRE; k++ )
+        mbedtls_ecp_point_init( &T[k] );
+
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    if( ( is_grp_capable = mbedtls_internal_ecp_grp_capable( grp ) ) != 0 )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_internal_ecp_init( grp ) );
+    }
+
+#endif /* MBEDTLS_ECP_INTERNAL_ALT */
+
+    /*
+     * T[k] = (2k + 1) P, using Q = 2P
+     */
+    MBEDTLS_MPI_CHK( mbedtls_ecp_copy( &T[0], P ) );
+    if( WNAF_PRE > 1 )
+    {
+        MBEDTLS_MPI_CHK( ecp_double_jac( grp, &Q, P ) );
+        MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, &Q ) );
+
+        for( k = 1; k < WNAF_PRE; k++ )
+        {
+            MBEDTLS_MPI_CHK( ecp_add_mixed( grp, &T[k], &T[k - 1], &Q ) );
+            TT[k - 1] = &T[k];
+        }
+
+        MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, TT, WNAF_PRE - 1 ) );
+    }
+
+    /*
+     * Left-to-right, starting from the leading (non-zero) digit
+     */
+    i = ecp_wnaf( naf, m );
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_set_zero( R ) );
+    while( i-- != 0 )
+    {
+        if( ! mbedtls_ecp_is_zero( R ) )
+            MBEDTLS_MPI_CHK( ecp_double_jac( grp, R, R ) );
+
+        if( naf[i] == 0 )
+            continue;
+
+        k = (unsigned char) ( naf[i] > 0 ? naf[i] : -naf[i] ) >> 1;
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &Q.X, &T[k].X ) );
+        if( naf[i] > 0 || mbedtls_mpi_cmp_int( &T[k].Y, 0 ) == 0 )
+            MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &Q.Y, &T[k].Y ) );
+        else
+            MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &Q.Y, &grp->P, &T[k].Y ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &Q.Z, 1 ) );
+
+        MBEDTLS_MPI_CHK( ecp_add_mixed( grp, R, R, &Q ) );
+    }
+
+    MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, R ) );
+
+cleanup:
+
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    if ( is_grp_capable )
+    {
+        mbedtls_internal_ecp_free( grp );
+    }
+
+#endif /* MBEDTLS_ECP_INTERNAL_ALT */
+    for( k = 0; k < WNAF_PRE; k++ )
+        mbedtls_ecp_point_free( &T[k] );
+    mbedtls_ecp_point_free( &Q );
+
+    if( ret != 0 )
+        mbedtls_ecp_point_free( R );
+
+    return( ret );
+}
+#endif /* MBEDTLS_ECP_WNAF_WINDOW */
+
 #endif /* ECP_SHORTWEIERSTRASS */
 
 #if defined(ECP_MONTGOMERY)
@@ -1820,6 +1976,18 @@ static int mbedtls_ecp_mul_shortcuts( mbedtls_ecp_group *grp,
         if( mbedtls_mpi_cmp_int( &R->Y, 0 ) != 0 )
             MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &R->Y, &grp->P, &R->Y ) );
     }
+#if defined(MBEDTLS_ECP_WNAF_WINDOW)
+    /*
+     * m is public here, so the comb method only pays off when its
+     * precomputed points are already there, that is for G
+     */
+    else if( grp->T == NULL ||
+             mbedtls_mpi_cmp_mpi( &P->Y, &grp->G.Y ) != 0 ||
+             mbedtls_mpi_cmp_mpi( &P->X, &grp->G.X ) != 0 )
+    {
+        MBEDTLS_MPI_CHK( ecp_mul_wnaf( grp, R, m, P ) );
+    }
+#endif
     else
     {
         MBEDTLS_MPI_CHK( mbedtls_ecp_mul( grp, R, m, P, NULL, NULL ) );
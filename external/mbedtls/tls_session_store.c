@@ -0,0 +1,718 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/*
+ * System-wide TLS session resumption.
+ *
+ * Clients keep the session of their last full handshake with each host:port
+ * and offer it (session ID and ticket) on the next connection, which turns
+ * the ECDHE and certificate work of the handshake into a single round trip
+ * of symmetric crypto. Servers share one set of session ticket keys, so a
+ * ticket issued by any server of the device is accepted by all of them.
+ * With CONFIG_TLS_SESSION_STORE_PERSIST both survive a reboot.
+ */
+
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#include <mbedtls/tls_session_store.h>
+#include <mbedtls/ssl_ticket.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/ctr_drbg.h>
+
+#if defined(MBEDTLS_PLATFORM_C)
+#include <mbedtls/platform.h>
+#else
+#include <stdlib.h>
+#include <time.h>
+#define mbedtls_calloc    calloc
+#define mbedtls_free      free
+#define mbedtls_time      time
+#endif
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define TLS_SESSION_HOST_MAX	64
+
+/* Key name and key drawn by ssl_ticket_gen_key() for each ticket key */
+#define TLS_TICKET_NAME_BYTES	4
+#define TLS_TICKET_KEY_BYTES	32
+#define TLS_TICKET_MATERIAL		(TLS_TICKET_NAME_BYTES + TLS_TICKET_KEY_BYTES)
+
+#define TLS_STORE_MAGIC			0x31535354	/* "TSS1" */
+#define TLS_STORE_MAX_BLOB		8192		/* sanity limit of a certificate or ticket */
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct tls_session_entry_s {
+	char host[TLS_SESSION_HOST_MAX];	/* empty if the entry is free */
+	uint16_t port;
+	uint32_t used;						/* LRU stamp */
+	mbedtls_ssl_session session;
+};
+
+struct tls_ticket_keys_s {
+	int ready;
+	mbedtls_ssl_ticket_context ticket;
+	mbedtls_entropy_context entropy;
+	mbedtls_ctr_drbg_context ctr_drbg;
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+	int loaded;							/* material[] and time[] came from the file */
+	int restoring;						/* replay material[] to mbedtls_ssl_ticket_setup() */
+	int dirty;							/* a key was generated since the last save */
+	int slot;							/* key being generated */
+	unsigned char active;
+	uint32_t time[2];
+	unsigned char material[2][TLS_TICKET_MATERIAL];
+#endif
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static pthread_mutex_t g_store_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct tls_session_entry_s g_sessions[CONFIG_TLS_SESSION_STORE_ENTRIES];
+static uint32_t g_used;
+static struct tls_ticket_keys_s g_keys;
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+static int g_loaded;
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void tls_store_zeroize(void *v, size_t n)
+{
+	volatile unsigned char *p = v;
+
+	while (n--) {
+		*p++ = 0;
+	}
+}
+
+static void tls_session_entry_free(struct tls_session_entry_s *entry)
+{
+	mbedtls_ssl_session_free(&entry->session);
+	memset(entry->host, 0, sizeof(entry->host));
+	entry->port = 0;
+	entry->used = 0;
+}
+
+static struct tls_session_entry_s *tls_session_find(const char *host, int port)
+{
+	int i;
+
+	for (i = 0; i < CONFIG_TLS_SESSION_STORE_ENTRIES; i++) {
+		if (g_sessions[i].host[0] != '\0' && g_sessions[i].port == port && !strcmp(g_sessions[i].host, host)) {
+			return &g_sessions[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* A free entry, else the least recently used one */
+static struct tls_session_entry_s *tls_session_victim(void)
+{
+	struct tls_session_entry_s *victim = &g_sessions[0];
+	int i;
+
+	for (i = 0; i < CONFIG_TLS_SESSION_STORE_ENTRIES; i++) {
+		if (g_sessions[i].host[0] == '\0') {
+			return &g_sessions[i];
+		}
+		if (g_sessions[i].used < victim->used) {
+			victim = &g_sessions[i];
+		}
+	}
+
+	tls_session_entry_free(victim);
+	return victim;
+}
+
+static int tls_session_expired(const mbedtls_ssl_session *session)
+{
+	mbedtls_time_t now = mbedtls_time(NULL);
+	uint32_t lifetime = CONFIG_TLS_SESSION_STORE_TIMEOUT;
+
+	if (session->ticket != NULL && session->ticket_lifetime != 0 && session->ticket_lifetime < lifetime) {
+		lifetime = session->ticket_lifetime;
+	}
+
+	/*
+	 * A clock that went backwards, typically reset by a reboot, cannot tell
+	 * the age of the session; let the server decide.
+	 */
+	if (now < session->start) {
+		return 0;
+	}
+
+	return (uint32_t)(now - session->start) > lifetime;
+}
+
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+static int tls_store_read(FILE *fp, void *buf, size_t len)
+{
+	return fread(buf, 1, len, fp) == len ? 0 : -1;
+}
+
+static int tls_store_write(FILE *fp, const void *buf, size_t len)
+{
+	return fwrite(buf, 1, len, fp) == len ? 0 : -1;
+}
+
+static int tls_store_load_session(FILE *fp, struct tls_session_entry_s *entry)
+{
+	mbedtls_ssl_session *session = &entry->session;
+	unsigned char *der;
+	uint32_t cert_len;
+	uint8_t host_len;
+	int ret;
+
+	if (tls_store_read(fp, &host_len, sizeof(host_len)) || host_len == 0 || host_len >= TLS_SESSION_HOST_MAX
+		|| tls_store_read(fp, entry->host, host_len) || tls_store_read(fp, &entry->port, sizeof(entry->port))
+		|| tls_store_read(fp, session, sizeof(*session)) || tls_store_read(fp, &cert_len, sizeof(cert_len))) {
+		return -1;
+	}
+
+	/* The pointers saved with the structure are stale */
+	session->peer_cert = NULL;
+	session->ticket = NULL;
+
+	if (cert_len > TLS_STORE_MAX_BLOB || session->ticket_len > TLS_STORE_MAX_BLOB) {
+		session->ticket_len = 0;
+		return -1;
+	}
+
+	if (cert_len > 0) {
+		der = mbedtls_calloc(1, cert_len);
+		if (der == NULL) {
+			return -1;
+		}
+		session->peer_cert = mbedtls_calloc(1, sizeof(mbedtls_x509_crt));
+		if (session->peer_cert == NULL) {
+			mbedtls_free(der);
+			return -1;
+		}
+		mbedtls_x509_crt_init(session->peer_cert);
+
+		ret = tls_store_read(fp, der, cert_len);
+		if (ret == 0) {
+			ret = mbedtls_x509_crt_parse_der(session->peer_cert, der, cert_len);
+		}
+		mbedtls_free(der);
+		if (ret != 0) {
+			return -1;
+		}
+	}
+
+	if (session->ticket_len > 0) {
+		session->ticket = mbedtls_calloc(1, session->ticket_len);
+		if (session->ticket == NULL || tls_store_read(fp, session->ticket, session->ticket_len)) {
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static int tls_store_save_session(FILE *fp, const struct tls_session_entry_s *entry)
+{
+	const mbedtls_ssl_session *session = &entry->session;
+	uint8_t host_len = strlen(entry->host);
+	uint32_t cert_len = session->peer_cert ? session->peer_cert->raw.len : 0;
+
+	if (tls_store_write(fp, &host_len, sizeof(host_len)) || tls_store_write(fp, entry->host, host_len)
+		|| tls_store_write(fp, &entry->port, sizeof(entry->port)) || tls_store_write(fp, session, sizeof(*session))
+		|| tls_store_write(fp, &cert_len, sizeof(cert_len))) {
+		return -1;
+	}
+
+	if (cert_len > 0 && tls_store_write(fp, session->peer_cert->raw.p, cert_len)) {
+		return -1;
+	}
+
+	if (session->ticket_len > 0 && tls_store_write(fp, session->ticket, session->ticket_len)) {
+		return -1;
+	}
+
+	return 0;
+}
+
+/*
+ * File layout, in the byte order of the device:
+ *   magic(4) session_size(2) nkeys(1) active(1)
+ *   nkeys x { generation_time(4) key_name(4) key(32) }
+ *   count(1)
+ *   count x { host_len(1) host port(2) mbedtls_ssl_session cert_len(4) cert ticket }
+ * A firmware with a different mbedtls_ssl_session layout ignores the file.
+ */
+static void tls_store_load_locked(void)
+{
+	struct tls_session_entry_s *entry;
+	uint32_t magic;
+	uint16_t session_size;
+	uint8_t nkeys;
+	uint8_t active;
+	uint8_t count;
+	FILE *fp;
+	int i;
+
+	if (g_loaded) {
+		return;
+	}
+	g_loaded = 1;
+
+	fp = fopen(CONFIG_TLS_SESSION_STORE_PATH, "rb");
+	if (fp == NULL) {
+		return;
+	}
+
+	if (tls_store_read(fp, &magic, sizeof(magic)) || magic != TLS_STORE_MAGIC
+		|| tls_store_read(fp, &session_size, sizeof(session_size)) || session_size != sizeof(mbedtls_ssl_session)
+		|| tls_store_read(fp, &nkeys, sizeof(nkeys)) || tls_store_read(fp, &active, sizeof(active))) {
+		goto out;
+	}
+
+	if (nkeys == 2) {
+		for (i = 0; i < 2; i++) {
+			if (tls_store_read(fp, &g_keys.time[i], sizeof(g_keys.time[i]))
+				|| tls_store_read(fp, g_keys.material[i], TLS_TICKET_MATERIAL)) {
+				goto out;
+			}
+		}
+		g_keys.active = active & 1;
+		g_keys.loaded = !g_keys.ready;
+	} else if (nkeys != 0) {
+		goto out;
+	}
+
+	if (tls_store_read(fp, &count, sizeof(count))) {
+		goto out;
+	}
+
+	for (i = 0; i < count; i++) {
+		entry = tls_session_victim();
+		if (tls_store_load_session(fp, entry)) {
+			tls_session_entry_free(entry);
+			break;
+		}
+		entry->used = ++g_used;
+	}
+
+out:
+	fclose(fp);
+}
+
+static int tls_store_save_locked(void)
+{
+	const struct tls_session_entry_s *entry;
+	uint32_t magic = TLS_STORE_MAGIC;
+	uint16_t session_size = sizeof(mbedtls_ssl_session);
+	uint8_t nkeys = (g_keys.ready || g_keys.loaded) ? 2 : 0;
+	uint8_t active = 0;
+	uint8_t count = 0;
+	uint32_t time;
+	FILE *fp;
+	int ret = -1;
+	int i;
+
+	fp = fopen(CONFIG_TLS_SESSION_STORE_PATH, "wb");
+	if (fp == NULL) {
+		return -1;
+	}
+
+	if (g_keys.ready) {
+		active = g_keys.ticket.active;
+	} else if (g_keys.loaded) {
+		active = g_keys.active;
+	}
+
+	for (i = 0; i < CONFIG_TLS_SESSION_STORE_ENTRIES; i++) {
+		if (g_sessions[i].host[0] != '\0') {
+			count++;
+		}
+	}
+
+	if (tls_store_write(fp, &magic, sizeof(magic)) || tls_store_write(fp, &session_size, sizeof(session_size))
+		|| tls_store_write(fp, &nkeys, sizeof(nkeys)) || tls_store_write(fp, &active, sizeof(active))) {
+		goto out;
+	}
+
+	for (i = 0; i < nkeys; i++) {
+		time = g_keys.ready ? g_keys.ticket.keys[i].generation_time : g_keys.time[i];
+		if (tls_store_write(fp, &time, sizeof(time)) || tls_store_write(fp, g_keys.material[i], TLS_TICKET_MATERIAL)) {
+			goto out;
+		}
+	}
+
+	if (tls_store_write(fp, &count, sizeof(count))) {
+		goto out;
+	}
+
+	for (i = 0; i < CONFIG_TLS_SESSION_STORE_ENTRIES; i++) {
+		entry = &g_sessions[i];
+		if (entry->host[0] != '\0' && tls_store_save_session(fp, entry)) {
+			goto out;
+		}
+	}
+	ret = 0;
+
+out:
+	fclose(fp);
+	return ret;
+}
+
+/*
+ * Random generator of the ticket context. ssl_ticket_gen_key() draws the key
+ * name straight into keys[i].name and then the key, so the output pointer
+ * tells which key is being made. The bytes are kept to be saved, and replayed
+ * from the file while the keys are restored.
+ */
+static int tls_ticket_rng(void *p_rng, unsigned char *output, size_t len)
+{
+	struct tls_ticket_keys_s *keys = (struct tls_ticket_keys_s *)p_rng;
+	unsigned char *material;
+	int ret;
+
+	if (output == keys->ticket.keys[0].name || output == keys->ticket.keys[1].name) {
+		keys->slot = output == keys->ticket.keys[0].name ? 0 : 1;
+		material = keys->material[keys->slot];
+		if (len != TLS_TICKET_NAME_BYTES) {
+			return mbedtls_ctr_drbg_random(&keys->ctr_drbg, output, len);
+		}
+	} else {
+		material = keys->material[keys->slot] + TLS_TICKET_NAME_BYTES;
+		if (len != TLS_TICKET_KEY_BYTES) {
+			return mbedtls_ctr_drbg_random(&keys->ctr_drbg, output, len);
+		}
+	}
+
+	if (keys->restoring) {
+		memcpy(output, material, len);
+		return 0;
+	}
+
+	ret = mbedtls_ctr_drbg_random(&keys->ctr_drbg, output, len);
+	if (ret == 0) {
+		memcpy(material, output, len);
+		keys->dirty = 1;
+	}
+
+	return ret;
+}
+#endif							/* CONFIG_TLS_SESSION_STORE_PERSIST */
+
+#if defined(MBEDTLS_SSL_TICKET_C)
+static void tls_ticket_keys_release(void)
+{
+	mbedtls_ssl_ticket_free(&g_keys.ticket);
+	mbedtls_ctr_drbg_free(&g_keys.ctr_drbg);
+	mbedtls_entropy_free(&g_keys.entropy);
+	g_keys.ready = 0;
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+	tls_store_zeroize(g_keys.material, sizeof(g_keys.material));
+	g_keys.loaded = 0;
+	g_keys.dirty = 0;
+#endif
+}
+
+static int tls_ticket_keys_setup(void)
+{
+	const char *pers = "tls_ticket_keys";
+	int ret;
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+	mbedtls_time_t now;
+	int i;
+#endif
+
+	mbedtls_ssl_ticket_init(&g_keys.ticket);
+	mbedtls_entropy_init(&g_keys.entropy);
+	mbedtls_ctr_drbg_init(&g_keys.ctr_drbg);
+
+	ret = mbedtls_ctr_drbg_seed(&g_keys.ctr_drbg, mbedtls_entropy_func, &g_keys.entropy, (const unsigned char *)pers, strlen(pers));
+	if (ret != 0) {
+		goto errout;
+	}
+
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+	tls_store_load_locked();
+
+	g_keys.restoring = g_keys.loaded;
+	ret = mbedtls_ssl_ticket_setup(&g_keys.ticket, tls_ticket_rng, &g_keys, MBEDTLS_CIPHER_AES_256_GCM, CONFIG_TLS_TICKET_LIFETIME);
+	g_keys.restoring = 0;
+	if (ret != 0) {
+		goto errout;
+	}
+
+	if (g_keys.loaded) {
+		/* A key from the future means the clock was reset; restart its lifetime */
+		now = mbedtls_time(NULL);
+		for (i = 0; i < 2; i++) {
+			g_keys.ticket.keys[i].generation_time = g_keys.time[i] <= (uint32_t)now ? g_keys.time[i] : (uint32_t)now;
+		}
+		g_keys.ticket.active = g_keys.active;
+		g_keys.loaded = 0;
+	}
+
+	g_keys.ready = 1;
+	if (g_keys.dirty) {
+		g_keys.dirty = 0;
+		tls_store_save_locked();
+	}
+#else
+	ret = mbedtls_ssl_ticket_setup(&g_keys.ticket, mbedtls_ctr_drbg_random, &g_keys.ctr_drbg, MBEDTLS_CIPHER_AES_256_GCM, CONFIG_TLS_TICKET_LIFETIME);
+	if (ret != 0) {
+		goto errout;
+	}
+
+	g_keys.ready = 1;
+#endif
+
+	return 0;
+
+errout:
+	tls_ticket_keys_release();
+	return ret;
+}
+
+/*
+ * The ticket context has no lock of its own without MBEDTLS_THREADING_C,
+ * and it is shared by every server of the device.
+ */
+static int tls_ticket_write(void *p_ticket, const mbedtls_ssl_session *session, unsigned char *start, const unsigned char *end, size_t *tlen, uint32_t *lifetime)
+{
+	int ret;
+
+	pthread_mutex_lock(&g_store_lock);
+	ret = mbedtls_ssl_ticket_write(&g_keys.ticket, session, start, end, tlen, lifetime);
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+	if (g_keys.dirty) {
+		g_keys.dirty = 0;
+		tls_store_save_locked();
+	}
+#endif
+	pthread_mutex_unlock(&g_store_lock);
+
+	return ret;
+}
+
+static int tls_ticket_parse(void *p_ticket, mbedtls_ssl_session *session, unsigned char *buf, size_t len)
+{
+	int ret;
+
+	pthread_mutex_lock(&g_store_lock);
+	ret = mbedtls_ssl_ticket_parse(&g_keys.ticket, session, buf, len);
+	pthread_mutex_unlock(&g_store_lock);
+
+	return ret;
+}
+#endif							/* MBEDTLS_SSL_TICKET_C */
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+int tls_session_store_get(const char *host, int port, mbedtls_ssl_context *ssl)
+{
+	struct tls_session_entry_s *entry;
+	int ret = -1;
+
+	if (host == NULL || ssl == NULL) {
+		return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+	}
+
+	pthread_mutex_lock(&g_store_lock);
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+	tls_store_load_locked();
+#endif
+
+	entry = tls_session_find(host, port);
+	if (entry != NULL) {
+		if (tls_session_expired(&entry->session)) {
+			tls_session_entry_free(entry);
+		} else {
+			ret = mbedtls_ssl_set_session(ssl, &entry->session);
+			entry->used = ++g_used;
+		}
+	}
+
+	pthread_mutex_unlock(&g_store_lock);
+
+	return ret;
+}
+
+int tls_session_store_put(const char *host, int port, const mbedtls_ssl_context *ssl)
+{
+	struct tls_session_entry_s *entry;
+	int resumed = 0;
+	int ret;
+
+	if (host == NULL || ssl == NULL || ssl->session == NULL) {
+		return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+	}
+
+	if (strlen(host) >= TLS_SESSION_HOST_MAX) {
+		return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+	}
+
+	pthread_mutex_lock(&g_store_lock);
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+	tls_store_load_locked();
+#endif
+
+	entry = tls_session_find(host, port);
+	if (entry == NULL) {
+		entry = tls_session_victim();
+	} else {
+		/* A resumed handshake keeps the master secret of the stored session */
+		resumed = !memcmp(entry->session.master, ssl->session->master, sizeof(entry->session.master));
+	}
+
+	ret = mbedtls_ssl_get_session(ssl, &entry->session);
+	if (ret != 0) {
+		/* A failed copy may still point at the ticket of the live session */
+		if (entry->session.ticket == ssl->session->ticket) {
+			entry->session.ticket = NULL;
+		}
+		tls_session_entry_free(entry);
+		pthread_mutex_unlock(&g_store_lock);
+		return ret;
+	}
+
+	strncpy(entry->host, host, TLS_SESSION_HOST_MAX - 1);
+	entry->port = port;
+	entry->used = ++g_used;
+
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+	/* Only a full handshake is worth a flash write */
+	if (!resumed) {
+		tls_store_save_locked();
+	}
+#else
+	(void)resumed;
+#endif
+
+	pthread_mutex_unlock(&g_store_lock);
+
+	return 0;
+}
+
+void tls_session_store_remove(const char *host, int port)
+{
+	struct tls_session_entry_s *entry;
+
+	if (host == NULL) {
+		return;
+	}
+
+	pthread_mutex_lock(&g_store_lock);
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+	tls_store_load_locked();
+#endif
+	entry = tls_session_find(host, port);
+	if (entry != NULL) {
+		tls_session_entry_free(entry);
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+		tls_store_save_locked();
+#endif
+	}
+	pthread_mutex_unlock(&g_store_lock);
+}
+
+void tls_session_store_clear(void)
+{
+	int i;
+
+	pthread_mutex_lock(&g_store_lock);
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+	tls_store_load_locked();
+#endif
+	for (i = 0; i < CONFIG_TLS_SESSION_STORE_ENTRIES; i++) {
+		if (g_sessions[i].host[0] != '\0') {
+			tls_session_entry_free(&g_sessions[i]);
+		}
+	}
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+	tls_store_save_locked();
+#endif
+	pthread_mutex_unlock(&g_store_lock);
+}
+
+int tls_ticket_keys_conf(mbedtls_ssl_config *conf)
+{
+#if defined(MBEDTLS_SSL_TICKET_C)
+	int ret = 0;
+
+	if (conf == NULL) {
+		return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+	}
+
+	pthread_mutex_lock(&g_store_lock);
+	if (!g_keys.ready) {
+		ret = tls_ticket_keys_setup();
+	}
+	pthread_mutex_unlock(&g_store_lock);
+
+	if (ret != 0) {
+		return ret;
+	}
+
+	mbedtls_ssl_conf_session_tickets_cb(conf, tls_ticket_write, tls_ticket_parse, &g_keys);
+
+	return 0;
+#else
+	return MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE;
+#endif
+}
+
+void tls_ticket_keys_free(void)
+{
+#if defined(MBEDTLS_SSL_TICKET_C)
+	pthread_mutex_lock(&g_store_lock);
+	if (g_keys.ready) {
+		tls_ticket_keys_release();
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+		tls_store_save_locked();
+#endif
+	}
+	pthread_mutex_unlock(&g_store_lock);
+#endif
+}
+
+#ifdef CONFIG_TLS_SESSION_STORE_PERSIST
+int tls_session_store_save(void)
+{
+	int ret;
+
+	pthread_mutex_lock(&g_store_lock);
+	tls_store_load_locked();
+	ret = tls_store_save_locked();
+	pthread_mutex_unlock(&g_store_lock);
+
+	return ret;
+}
+#endif
@@ -23,6 +23,42 @@
  * Compile time options have moved to config.mk.
  */
 
+/* ============================================================
+ * Packet buffer options, from menuconfig.
+ *
+ * MOSQ_READ_BUFSIZE  : size of the socket read buffer of a client, several
+ *                      small packets are parsed from one socket read.
+ * MOSQ_WRITE_BUFSIZE : largest size of the queued packets merged into one
+ *                      socket write.
+ * WITH_PACKET_POOL   : take the packets and the payloads of up to
+ *                      MOSQ_PACKET_POOL_BUFSIZE bytes from static pools.
+ *
+ * A size of 0 disables the option.
+ * ============================================================ */
+
+#if defined(__TINYARA__)
+#include <tinyara/config.h>
+
+#ifdef CONFIG_NETUTILS_MQTT_READ_BUFSIZE
+#	define MOSQ_READ_BUFSIZE CONFIG_NETUTILS_MQTT_READ_BUFSIZE
+#endif
+#ifdef CONFIG_NETUTILS_MQTT_WRITE_BUFSIZE
+#	define MOSQ_WRITE_BUFSIZE CONFIG_NETUTILS_MQTT_WRITE_BUFSIZE
+#endif
+#ifdef CONFIG_NETUTILS_MQTT_PACKET_POOL
+#	define WITH_PACKET_POOL
+#	define MOSQ_PACKET_POOL_COUNT CONFIG_NETUTILS_MQTT_PACKET_POOL_COUNT
+#	define MOSQ_PACKET_POOL_BUFSIZE CONFIG_NETUTILS_MQTT_PACKET_POOL_BUFSIZE
+#endif
+#endif
+
+#ifndef MOSQ_READ_BUFSIZE
+#	define MOSQ_READ_BUFSIZE 0
+#endif
+#ifndef MOSQ_WRITE_BUFSIZE
+#	define MOSQ_WRITE_BUFSIZE 0
+#endif
+
 /* ============================================================
  * Compatibility defines
  *
@@ -56,4 +92,5 @@
 #include "mbedtls/ctr_drbg.h"
 #include "mbedtls/ssl_cache.h"
 #include "mbedtls/entropy.h"
+#include "mbedtls/tls_session_store.h"
 #endif
@@ -54,6 +54,7 @@ typedef int ssize_t;
 #include <memory_mosq.h>
 #include <mqtt3_protocol.h>
 #include <net_mosq.h>
+#include <pool_mosq.h>
 #include <read_handle.h>
 #include <send_mosq.h>
 #include <socks_mosq.h>
@@ -482,7 +483,7 @@ void _mosquitto_destroy(struct mosquitto *mosq)
 		}
 
 		_mosquitto_packet_cleanup(packet);
-		_mosquitto_free(packet);
+		_mosquitto_packet_free(packet);
 	}
 
 	_mosquitto_packet_cleanup(&mosq->in_packet);
@@ -667,7 +668,7 @@ static int _mosquitto_reconnect(struct mosquitto *mosq, bool blocking)
 		}
 
 		_mosquitto_packet_cleanup(packet);
-		_mosquitto_free(packet);
+		_mosquitto_packet_free(packet);
 	}
 	pthread_mutex_unlock(&mosq->out_packet_mutex);
 	pthread_mutex_unlock(&mosq->current_out_packet_mutex);
@@ -786,6 +787,38 @@ int mosquitto_publish(struct mosquitto *mosq, int *mid, const char *topic, int p
 	}
 }
 
+int mosquitto_publish_batch(struct mosquitto *mosq, struct mosquitto_message *msgs, int count)
+{
+	int rc = MOSQ_ERR_SUCCESS;
+	int i;
+
+	if (!mosq || !msgs || count < 0) {
+		return MOSQ_ERR_INVAL;
+	}
+
+	/* Hold back the writes until all the messages are queued */
+	pthread_mutex_lock(&mosq->out_packet_mutex);
+	mosq->out_packet_cork++;
+	pthread_mutex_unlock(&mosq->out_packet_mutex);
+
+	for (i = 0; i < count; i++) {
+		rc = mosquitto_publish(mosq, &msgs[i].mid, msgs[i].topic, msgs[i].payloadlen, msgs[i].payload, msgs[i].qos, msgs[i].retain);
+		if (rc != MOSQ_ERR_SUCCESS) {
+			break;
+		}
+	}
+
+	pthread_mutex_lock(&mosq->out_packet_mutex);
+	mosq->out_packet_cork--;
+	pthread_mutex_unlock(&mosq->out_packet_mutex);
+
+	if (i > 0) {
+		_mosquitto_packet_kick(mosq);
+	}
+
+	return rc;
+}
+
 int mosquitto_subscribe(struct mosquitto *mosq, int *mid, const char *sub, int qos)
 {
 	if (!mosq) {
@@ -1283,7 +1316,7 @@ int mosquitto_loop(struct mosquitto *mosq, int timeout, int max_packets)
 							if (rc || mosq->sock == INVALID_SOCKET) {
 								return rc;
 							}
-						} while (SSL_DATA_PENDING(mosq));
+						} while (SSL_DATA_PENDING(mosq) || MOSQ_READ_PENDING(mosq));
 					}
 			}
 			if (mosq->sockpairR != INVALID_SOCKET && FD_ISSET(mosq->sockpairR, &readfds)) {
@@ -1512,7 +1545,9 @@ int mosquitto_loop_read(struct mosquitto *mosq, int max_packets)
 	/* Queue len here tells us how many messages are awaiting processing and
 	 * have QoS > 0. We should try to deal with that many in this loop in order
 	 * to keep up. */
-	for (i = 0; i < max_packets; i++) {
+	/* Bytes left in the socket read buffer are not reported by select(), so
+	 * the packets in it are all handled now. */
+	for (i = 0; i < max_packets || MOSQ_READ_PENDING(mosq); i++) {
 #ifdef WITH_SOCKS
 		if (mosq->socks5_host) {
 			rc = mosquitto__socks5_read(mosq);
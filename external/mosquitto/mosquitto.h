@@ -619,6 +619,29 @@ libmosq_EXPORT int mosquitto_disconnect(struct mosquitto *mosq);
  */
 libmosq_EXPORT int mosquitto_publish(struct mosquitto *mosq, int *mid, const char *topic, int payloadlen, const void *payload, int qos, bool retain);
 
+/*
+ * Function: mosquitto_publish_batch
+ *
+ * Publish several messages at once. The messages are queued like with
+ * <mosquitto_publish> and written together, so that small messages share
+ * socket writes of up to CONFIG_NETUTILS_MQTT_WRITE_BUFSIZE bytes.
+ *
+ * Parameters:
+ * 	mosq -  a valid mosquitto instance.
+ * 	msgs -  array of the messages to publish. The topic, payload, payloadlen,
+ * 	        qos and retain fields are used as with <mosquitto_publish>, and
+ * 	        the mid field is set to the message id of each message.
+ * 	count - number of messages in msgs.
+ *
+ * Returns:
+ * 	As <mosquitto_publish>, for the first message which failed. The messages
+ * 	after it are not published.
+ *
+ * See Also:
+ *	<mosquitto_publish>
+ */
+libmosq_EXPORT int mosquitto_publish_batch(struct mosquitto *mosq, struct mosquitto_message *msgs, int count);
+
 /*
  * Function: mosquitto_subscribe
  *
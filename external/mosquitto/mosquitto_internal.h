@@ -160,6 +160,7 @@ enum _mosquitto_mbedtls_state {
 struct _mosquitto_packet {
 	uint8_t *payload;
 	struct _mosquitto_packet *next;
+	struct _mosquitto_packet *batch;	/* Packets merged into this one */
 	uint32_t remaining_mult;
 	uint32_t remaining_length;
 	uint32_t packet_length;
@@ -325,6 +326,12 @@ struct mosquitto {
 	struct addrinfo *connect_ainfo;
 	struct addrinfo *connect_ainfo_bind;
 #endif
+#if MOSQ_READ_BUFSIZE > 0
+	uint8_t in_buf[MOSQ_READ_BUFSIZE];
+	uint16_t in_buf_pos;
+	uint16_t in_buf_len;
+#endif
+	int out_packet_cork;	/* Writes held back by mosquitto_publish_batch() */
 };
 
 #define STREMPTY(str) (str[0] == '\0')
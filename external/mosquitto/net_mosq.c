@@ -95,6 +95,7 @@ extern unsigned long g_pub_msgs_sent;
 #include <memory_mosq.h>
 #include <mqtt3_protocol.h>
 #include <net_mosq.h>
+#include <pool_mosq.h>
 #include <time_mosq.h>
 #include <util_mosq.h>
 
@@ -147,6 +148,8 @@ void _mosquitto_net_cleanup(void)
 
 void _mosquitto_packet_cleanup(struct _mosquitto_packet *packet)
 {
+	struct _mosquitto_packet *batch;
+
 	if (!packet) {
 		return;
 	}
@@ -157,17 +160,24 @@ void _mosquitto_packet_cleanup(struct _mosquitto_packet *packet)
 	packet->remaining_mult = 1;
 	packet->remaining_length = 0;
 	if (packet->payload) {
-		_mosquitto_free(packet->payload);
+		_mosquitto_payload_free(packet->payload);
 	}
 	packet->payload = NULL;
 	packet->to_process = 0;
 	packet->pos = 0;
+
+	while (packet->batch) {
+		batch = packet->batch;
+		packet->batch = batch->next;
+		_mosquitto_packet_cleanup(batch);
+		_mosquitto_packet_free(batch);
+	}
 }
 
 int _mosquitto_packet_queue(struct mosquitto *mosq, struct _mosquitto_packet *packet)
 {
 #ifndef WITH_BROKER
-	char sockpair_data = 0;
+	int cork;
 #endif
 	assert(mosq);
 	assert(packet);
@@ -183,6 +193,9 @@ int _mosquitto_packet_queue(struct mosquitto *mosq, struct _mosquitto_packet *pa
 		mosq->out_packet = packet;
 	}
 	mosq->out_packet_last = packet;
+#ifndef WITH_BROKER
+	cork = mosq->out_packet_cork;
+#endif
 	pthread_mutex_unlock(&mosq->out_packet_mutex);
 #ifdef WITH_BROKER
 #ifdef WITH_WEBSOCKETS
@@ -196,6 +209,21 @@ int _mosquitto_packet_queue(struct mosquitto *mosq, struct _mosquitto_packet *pa
 	return _mosquitto_packet_write(mosq);
 #endif
 #else
+	/* mosquitto_publish_batch() sends the packets once they are all queued */
+	if (cork > 0) {
+		return MOSQ_ERR_SUCCESS;
+	}
+
+	return _mosquitto_packet_kick(mosq);
+#endif
+}
+
+#ifndef WITH_BROKER
+/* Get the packets queued by _mosquitto_packet_queue() written, by the
+ * network thread or directly. */
+int _mosquitto_packet_kick(struct mosquitto *mosq)
+{
+	char sockpair_data = 0;
 
 	/* Write a single byte to sockpairW (connected to sockpairR) to break out
 	 * of select() if in threaded mode. */
@@ -219,8 +247,8 @@ int _mosquitto_packet_queue(struct mosquitto *mosq, struct _mosquitto_packet *pa
 	} else {
 		return MOSQ_ERR_SUCCESS;
 	}
-#endif
 }
+#endif
 
 /* Close a socket associated with a context and set it to -1.
  * Returns 1 on failure (context is NULL)
@@ -264,6 +292,10 @@ int _mosquitto_socket_close(struct mosquitto *mosq)
 		mosq->sock = INVALID_SOCKET;
 #endif
 	}
+#if MOSQ_READ_BUFSIZE > 0
+	mosq->in_buf_pos = 0;
+	mosq->in_buf_len = 0;
+#endif
 #ifdef WITH_BROKER
 	if (mosq->listener) {
 		mosq->listener->client_count--;
@@ -538,9 +570,21 @@ int _mosquitto_socket_connect(struct mosquitto *mosq, const char *host, uint16_t
 		((mbedtls_net_context *)mosq->net)->fd = (int)sock;
 		mbedtls_ssl_set_bio(mosq->ssl_ctx, mosq->net, mbedtls_net_send, mbedtls_net_recv, NULL);
 
+#ifdef CONFIG_TLS_SESSION_STORE
+		/* Resume the session of the previous connection to this broker */
+		tls_session_store_get(host, port, mosq->ssl_ctx);
+#endif
+
 		if (mosquitto__socket_connect_tls(mosq)) {
+#ifdef CONFIG_TLS_SESSION_STORE
+			tls_session_store_remove(host, port);
+#endif
 			return MOSQ_ERR_TLS;
 		}
+
+#ifdef CONFIG_TLS_SESSION_STORE
+		tls_session_store_put(host, port, mosq->ssl_ctx);
+#endif
 	}
 #endif
 
@@ -924,10 +968,76 @@ ssize_t _mosquitto_net_write(struct mosquitto *mosq, void *buf, size_t count)
 #endif
 }
 
+#if MOSQ_WRITE_BUFSIZE > 0
+/* Merge 'packet' and the packets queued after it into one socket write of
+ * up to MOSQ_WRITE_BUFSIZE bytes.  The merged packets are kept, without
+ * their payload, on the batch list of the new packet for the callbacks run
+ * once it is sent.  Returns 'packet' if there is nothing to merge.
+ * Called with out_packet_mutex held.
+ */
+static struct _mosquitto_packet *_mosquitto_packet_coalesce(struct mosquitto *mosq, struct _mosquitto_packet *packet)
+{
+	struct _mosquitto_packet *merged;
+	struct _mosquitto_packet *last = NULL;
+	struct _mosquitto_packet *next;
+	uint32_t length;
+
+	if (!packet || (packet->command & 0xF0) == DISCONNECT) {
+		return packet;
+	}
+
+	length = packet->packet_length;
+	for (next = mosq->out_packet; next; next = next->next) {
+		if ((next->command & 0xF0) == DISCONNECT || length + next->packet_length > MOSQ_WRITE_BUFSIZE) {
+			break;
+		}
+		length += next->packet_length;
+		last = next;
+	}
+	if (!last) {
+		return packet;
+	}
+
+	/* Without memory the packets are simply written one by one */
+	merged = _mosquitto_packet_new();
+	if (!merged) {
+		return packet;
+	}
+	merged->payload = _mosquitto_payload_alloc(length);
+	if (!merged->payload) {
+		_mosquitto_packet_free(merged);
+		return packet;
+	}
+
+	packet->next = mosq->out_packet;
+	mosq->out_packet = last->next;
+	if (!mosq->out_packet) {
+		mosq->out_packet_last = NULL;
+	}
+	last->next = NULL;
+
+	merged->batch = packet;
+	for (next = packet; next; next = next->next) {
+		memcpy(&merged->payload[merged->packet_length], next->payload, next->packet_length);
+		merged->packet_length += next->packet_length;
+		_mosquitto_payload_free(next->payload);
+		next->payload = NULL;
+	}
+	merged->to_process = merged->packet_length;
+
+	return merged;
+}
+#else
+#define _mosquitto_packet_coalesce(mosq, packet) (packet)
+#endif
+
 int _mosquitto_packet_write(struct mosquitto *mosq)
 {
 	ssize_t write_length;
 	struct _mosquitto_packet *packet;
+#if !defined(WITH_BROKER) && MOSQ_WRITE_BUFSIZE > 0
+	struct _mosquitto_packet *batch;
+#endif
 
 	if (!mosq) {
 		return MOSQ_ERR_INVAL;
@@ -944,6 +1054,7 @@ int _mosquitto_packet_write(struct mosquitto *mosq)
 		if (!mosq->out_packet) {
 			mosq->out_packet_last = NULL;
 		}
+		mosq->current_out_packet = _mosquitto_packet_coalesce(mosq, mosq->current_out_packet);
 	}
 	pthread_mutex_unlock(&mosq->out_packet_mutex);
 
@@ -990,6 +1101,20 @@ int _mosquitto_packet_write(struct mosquitto *mosq)
 		}
 #	endif
 #else
+#if MOSQ_WRITE_BUFSIZE > 0
+		for (batch = packet->batch; batch; batch = batch->next) {
+			if (((batch->command) & 0xF6) == PUBLISH) {
+				pthread_mutex_lock(&mosq->callback_mutex);
+				if (mosq->on_publish) {
+					/* A QoS=0 message merged into this write */
+					mosq->in_callback = true;
+					mosq->on_publish(mosq, mosq->userdata, batch->mid);
+					mosq->in_callback = false;
+				}
+				pthread_mutex_unlock(&mosq->callback_mutex);
+			}
+		}
+#endif
 		if (((packet->command) & 0xF6) == PUBLISH) {
 			pthread_mutex_lock(&mosq->callback_mutex);
 			if (mosq->on_publish) {
@@ -1018,7 +1143,7 @@ int _mosquitto_packet_write(struct mosquitto *mosq)
 			pthread_mutex_unlock(&mosq->out_packet_mutex);
 
 			_mosquitto_packet_cleanup(packet);
-			_mosquitto_free(packet);
+			_mosquitto_packet_free(packet);
 
 			pthread_mutex_lock(&mosq->msgtime_mutex);
 			mosq->next_msg_out = mosquitto_time() + mosq->keepalive;
@@ -1045,11 +1170,12 @@ int _mosquitto_packet_write(struct mosquitto *mosq)
 			if (!mosq->out_packet) {
 				mosq->out_packet_last = NULL;
 			}
+			mosq->current_out_packet = _mosquitto_packet_coalesce(mosq, mosq->current_out_packet);
 		}
 		pthread_mutex_unlock(&mosq->out_packet_mutex);
 
 		_mosquitto_packet_cleanup(packet);
-		_mosquitto_free(packet);
+		_mosquitto_packet_free(packet);
 
 		pthread_mutex_lock(&mosq->msgtime_mutex);
 		mosq->next_msg_out = mosquitto_time() + mosq->keepalive;
@@ -1059,6 +1185,40 @@ int _mosquitto_packet_write(struct mosquitto *mosq)
 	return MOSQ_ERR_SUCCESS;
 }
 
+#if MOSQ_READ_BUFSIZE > 0
+/* Read from the socket read buffer, which is filled from the socket when it
+ * is empty.  A read of at least the buffer size goes directly to the socket
+ * while the buffer is empty, so a large payload is not copied twice.
+ */
+static ssize_t _mosquitto_net_read_buffered(struct mosquitto *mosq, void *buf, size_t count)
+{
+	ssize_t read_length;
+
+	if (mosq->in_buf_pos == mosq->in_buf_len) {
+		if (count >= MOSQ_READ_BUFSIZE) {
+			return _mosquitto_net_read(mosq, buf, count);
+		}
+		read_length = _mosquitto_net_read(mosq, mosq->in_buf, MOSQ_READ_BUFSIZE);
+		if (read_length <= 0) {
+			return read_length;
+		}
+		mosq->in_buf_pos = 0;
+		mosq->in_buf_len = read_length;
+	}
+
+	if (count > (size_t)(mosq->in_buf_len - mosq->in_buf_pos)) {
+		count = mosq->in_buf_len - mosq->in_buf_pos;
+	}
+	memcpy(buf, &mosq->in_buf[mosq->in_buf_pos], count);
+	mosq->in_buf_pos += count;
+	set_errno(0);
+
+	return (ssize_t)count;
+}
+#else
+#define _mosquitto_net_read_buffered(mosq, buf, count) _mosquitto_net_read(mosq, buf, count)
+#endif
+
 #ifdef WITH_BROKER
 int _mosquitto_packet_read(struct mosquitto_db *db, struct mosquitto *mosq)
 #else
@@ -1094,7 +1254,7 @@ int _mosquitto_packet_read(struct mosquitto *mosq)
 	 * Finally, free the memory and reset everything to starting conditions.
 	 */
 	if (!mosq->in_packet.command) {
-		read_length = _mosquitto_net_read(mosq, &byte, 1);
+		read_length = _mosquitto_net_read_buffered(mosq, &byte, 1);
 		if (read_length == 1) {
 			mosq->in_packet.command = byte;
 #ifdef WITH_BROKER
@@ -1136,7 +1296,7 @@ int _mosquitto_packet_read(struct mosquitto *mosq)
 	 */
 	if (mosq->in_packet.remaining_count <= 0) {
 		do {
-			read_length = _mosquitto_net_read(mosq, &byte, 1);
+			read_length = _mosquitto_net_read_buffered(mosq, &byte, 1);
 			if (read_length == 1) {
 				mosq->in_packet.remaining_count--;
 				/* Max 4 bytes length for remaining length as defined by protocol.
@@ -1175,15 +1335,18 @@ int _mosquitto_packet_read(struct mosquitto *mosq)
 		mosq->in_packet.remaining_count *= -1;
 
 		if (mosq->in_packet.remaining_length > 0) {
-			mosq->in_packet.payload = _mosquitto_malloc(mosq->in_packet.remaining_length * sizeof(uint8_t));
+			/* One more byte, so a received PUBLISH payload can be handed to
+			 * on_message in place as a terminated string. */
+			mosq->in_packet.payload = _mosquitto_payload_alloc((mosq->in_packet.remaining_length + 1) * sizeof(uint8_t));
 			if (!mosq->in_packet.payload) {
 				return MOSQ_ERR_NOMEM;
 			}
+			mosq->in_packet.payload[mosq->in_packet.remaining_length] = 0;
 			mosq->in_packet.to_process = mosq->in_packet.remaining_length;
 		}
 	}
 	while (mosq->in_packet.to_process > 0) {
-		read_length = _mosquitto_net_read(mosq, &(mosq->in_packet.payload[mosq->in_packet.pos]), mosq->in_packet.to_process);
+		read_length = _mosquitto_net_read_buffered(mosq, &(mosq->in_packet.payload[mosq->in_packet.pos]), mosq->in_packet.to_process);
 		if (read_length > 0) {
 #if defined(WITH_BROKER) && defined(WITH_SYS_TREE)
 			g_bytes_received += read_length;
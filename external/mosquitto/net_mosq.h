@@ -69,8 +69,19 @@ struct mosquitto_db;
 void _mosquitto_net_init(void);
 void _mosquitto_net_cleanup(void);
 
+/* True when the socket read buffer holds data which select() will not
+ * report. */
+#if MOSQ_READ_BUFSIZE > 0
+#define MOSQ_READ_PENDING(A) ((A)->in_buf_pos < (A)->in_buf_len)
+#else
+#define MOSQ_READ_PENDING(A) 0
+#endif
+
 void _mosquitto_packet_cleanup(struct _mosquitto_packet *packet);
 int _mosquitto_packet_queue(struct mosquitto *mosq, struct _mosquitto_packet *packet);
+#ifndef WITH_BROKER
+int _mosquitto_packet_kick(struct mosquitto *mosq);
+#endif
 int _mosquitto_socket_connect(struct mosquitto *mosq, const char *host, uint16_t port, const char *bind_address, bool blocking);
 #ifdef WITH_BROKER
 int _mosquitto_socket_close(struct mosquitto_db *db, struct mosquitto *mosq);
@@ -0,0 +1,139 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#include <config.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+#include <mosquitto_internal.h>
+#include <memory_mosq.h>
+#include <pool_mosq.h>
+
+#ifdef WITH_PACKET_POOL
+
+/* A free entry of a pool holds the link to the next free entry */
+struct _mosquitto_pool_entry {
+	struct _mosquitto_pool_entry *next;
+};
+
+#define POOL_BUFWORDS ((MOSQ_PACKET_POOL_BUFSIZE + sizeof(void *) - 1) / sizeof(void *))
+
+static struct _mosquitto_packet g_packet_pool[MOSQ_PACKET_POOL_COUNT];
+static void *g_payload_pool[MOSQ_PACKET_POOL_COUNT][POOL_BUFWORDS];
+static struct _mosquitto_pool_entry *g_packet_free;
+static struct _mosquitto_pool_entry *g_payload_free;
+static bool g_pool_ready;
+static pthread_mutex_t g_pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Called with g_pool_mutex held */
+static void _mosquitto_pool_init(void)
+{
+	struct _mosquitto_pool_entry *entry;
+	int i;
+
+	for (i = 0; i < MOSQ_PACKET_POOL_COUNT; i++) {
+		entry = (struct _mosquitto_pool_entry *)&g_packet_pool[i];
+		entry->next = g_packet_free;
+		g_packet_free = entry;
+
+		entry = (struct _mosquitto_pool_entry *)g_payload_pool[i];
+		entry->next = g_payload_free;
+		g_payload_free = entry;
+	}
+	g_pool_ready = true;
+}
+
+static void *_mosquitto_pool_get(struct _mosquitto_pool_entry **list)
+{
+	struct _mosquitto_pool_entry *entry;
+
+	pthread_mutex_lock(&g_pool_mutex);
+	if (!g_pool_ready) {
+		_mosquitto_pool_init();
+	}
+	entry = *list;
+	if (entry) {
+		*list = entry->next;
+	}
+	pthread_mutex_unlock(&g_pool_mutex);
+
+	return entry;
+}
+
+static void _mosquitto_pool_put(struct _mosquitto_pool_entry **list, void *mem)
+{
+	struct _mosquitto_pool_entry *entry = (struct _mosquitto_pool_entry *)mem;
+
+	pthread_mutex_lock(&g_pool_mutex);
+	entry->next = *list;
+	*list = entry;
+	pthread_mutex_unlock(&g_pool_mutex);
+}
+#endif
+
+struct _mosquitto_packet *_mosquitto_packet_new(void)
+{
+#ifdef WITH_PACKET_POOL
+	struct _mosquitto_packet *packet;
+
+	packet = _mosquitto_pool_get(&g_packet_free);
+	if (packet) {
+		memset(packet, 0, sizeof(struct _mosquitto_packet));
+		return packet;
+	}
+#endif
+	return _mosquitto_calloc(1, sizeof(struct _mosquitto_packet));
+}
+
+void _mosquitto_packet_free(struct _mosquitto_packet *packet)
+{
+#ifdef WITH_PACKET_POOL
+	if (packet >= &g_packet_pool[0] && packet < &g_packet_pool[MOSQ_PACKET_POOL_COUNT]) {
+		_mosquitto_pool_put(&g_packet_free, packet);
+		return;
+	}
+#endif
+	_mosquitto_free(packet);
+}
+
+uint8_t *_mosquitto_payload_alloc(uint32_t size)
+{
+#ifdef WITH_PACKET_POOL
+	uint8_t *payload;
+
+	if (size <= MOSQ_PACKET_POOL_BUFSIZE) {
+		payload = _mosquitto_pool_get(&g_payload_free);
+		if (payload) {
+			return payload;
+		}
+	}
+#endif
+	return _mosquitto_malloc(size);
+}
+
+void _mosquitto_payload_free(uint8_t *payload)
+{
+#ifdef WITH_PACKET_POOL
+	if ((void *)payload >= (void *)g_payload_pool[0] && (void *)payload < (void *)g_payload_pool[MOSQ_PACKET_POOL_COUNT]) {
+		_mosquitto_pool_put(&g_payload_free, payload);
+		return;
+	}
+#endif
+	_mosquitto_free(payload);
+}
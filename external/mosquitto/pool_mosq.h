@@ -0,0 +1,32 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef _POOL_MOSQ_H_
+#define _POOL_MOSQ_H_
+
+#include <mosquitto_internal.h>
+
+/* Packets and packet payloads.  They come from the static pools when
+ * WITH_PACKET_POOL is defined and the pools are not empty, else from the
+ * heap.  The free functions accept both. */
+struct _mosquitto_packet *_mosquitto_packet_new(void);
+void _mosquitto_packet_free(struct _mosquitto_packet *packet);
+uint8_t *_mosquitto_payload_alloc(uint32_t size);
+void _mosquitto_payload_free(uint8_t *payload);
+
+#endif
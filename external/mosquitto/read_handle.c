@@ -78,6 +78,71 @@ int _mosquitto_packet_handle(struct mosquitto *mosq)
 	}
 }
 
+/* QoS 0 and 1 messages are only given to on_message, so their topic and
+ * payload are handed over in place in the packet buffer instead of being
+ * copied.  _mosquitto_packet_read() leaves a spare byte after the payload
+ * to terminate it, and the topic is moved over its length to terminate it.
+ * on_message must copy the message, e.g. with mosquitto_message_copy(), to
+ * keep it after returning.
+ */
+static int _mosquitto_handle_publish_inplace(struct mosquitto *mosq)
+{
+	struct _mosquitto_packet *packet = &mosq->in_packet;
+	struct mosquitto_message msg;
+	uint8_t dup;
+	uint16_t len;
+	uint16_t mid;
+	int rc = 0;
+
+	memset(&msg, 0, sizeof(struct mosquitto_message));
+	dup = (packet->command & 0x08) >> 3;
+	msg.qos = (packet->command & 0x06) >> 1;
+	msg.retain = (packet->command & 0x01);
+
+	rc = _mosquitto_read_uint16(packet, &len);
+	if (rc) {
+		return rc;
+	}
+	if (packet->pos + len > packet->remaining_length) {
+		return MOSQ_ERR_PROTOCOL;
+	}
+	msg.topic = (char *)&packet->payload[packet->pos - 2];
+	memmove(msg.topic, &packet->payload[packet->pos], len);
+	msg.topic[len] = '\0';
+	packet->pos += len;
+	if (!strlen(msg.topic)) {
+		return MOSQ_ERR_PROTOCOL;
+	}
+
+	if (msg.qos > 0) {
+		rc = _mosquitto_read_uint16(packet, &mid);
+		if (rc) {
+			return rc;
+		}
+		msg.mid = (int)mid;
+	}
+
+	msg.payloadlen = packet->remaining_length - packet->pos;
+	if (msg.payloadlen) {
+		msg.payload = &packet->payload[packet->pos];
+		packet->pos += msg.payloadlen;
+	}
+	_mosquitto_log_printf(mosq, MOSQ_LOG_DEBUG, "Client %s received PUBLISH (d%d, q%d, r%d, m%d, '%s', ... (%ld bytes))", mosq->id, dup, msg.qos, msg.retain, msg.mid, msg.topic, (long)msg.payloadlen);
+
+	if (msg.qos == 1) {
+		rc = _mosquitto_send_puback(mosq, msg.mid);
+	}
+	pthread_mutex_lock(&mosq->callback_mutex);
+	if (mosq->on_message) {
+		mosq->in_callback = true;
+		mosq->on_message(mosq, mosq->userdata, &msg);
+		mosq->in_callback = false;
+	}
+	pthread_mutex_unlock(&mosq->callback_mutex);
+
+	return rc;
+}
+
 int _mosquitto_handle_publish(struct mosquitto *mosq)
 {
 	uint8_t header;
@@ -87,6 +152,10 @@ int _mosquitto_handle_publish(struct mosquitto *mosq)
 
 	assert(mosq);
 
+	if (((mosq->in_packet.command & 0x06) >> 1) < 2) {
+		return _mosquitto_handle_publish_inplace(mosq);
+	}
+
 	message = _mosquitto_calloc(1, sizeof(struct mosquitto_message_all));
 	if (!message) {
 		return MOSQ_ERR_NOMEM;
@@ -39,6 +39,7 @@ Contributors:
 #include <memory_mosq.h>
 #include <mqtt3_protocol.h>
 #include <net_mosq.h>
+#include <pool_mosq.h>
 #include <send_mosq.h>
 #include <util_mosq.h>
 
@@ -86,7 +87,7 @@ int _mosquitto_send_connect(struct mosquitto *mosq, uint16_t keepalive, bool cle
 		return MOSQ_ERR_INVAL;
 	}
 
-	packet = _mosquitto_calloc(1, sizeof(struct _mosquitto_packet));
+	packet = _mosquitto_packet_new();
 	if (!packet) {
 		return MOSQ_ERR_NOMEM;
 	}
@@ -109,7 +110,7 @@ int _mosquitto_send_connect(struct mosquitto *mosq, uint16_t keepalive, bool cle
 	packet->remaining_length = headerlen + payloadlen;
 	rc = _mosquitto_packet_alloc(packet);
 	if (rc) {
-		_mosquitto_free(packet);
+		_mosquitto_packet_free(packet);
 		return rc;
 	}
 
@@ -187,7 +188,7 @@ int _mosquitto_send_subscribe(struct mosquitto *mosq, int *mid, const char *topi
 	assert(mosq);
 	assert(topic);
 
-	packet = _mosquitto_calloc(1, sizeof(struct _mosquitto_packet));
+	packet = _mosquitto_packet_new();
 	if (!packet) {
 		return MOSQ_ERR_NOMEM;
 	}
@@ -198,7 +199,7 @@ int _mosquitto_send_subscribe(struct mosquitto *mosq, int *mid, const char *topi
 	packet->remaining_length = packetlen;
 	rc = _mosquitto_packet_alloc(packet);
 	if (rc) {
-		_mosquitto_free(packet);
+		_mosquitto_packet_free(packet);
 		return rc;
 	}
 
@@ -235,7 +236,7 @@ int _mosquitto_send_unsubscribe(struct mosquitto *mosq, int *mid, const char *to
 	assert(mosq);
 	assert(topic);
 
-	packet = _mosquitto_calloc(1, sizeof(struct _mosquitto_packet));
+	packet = _mosquitto_packet_new();
 	if (!packet) {
 		return MOSQ_ERR_NOMEM;
 	}
@@ -246,7 +247,7 @@ int _mosquitto_send_unsubscribe(struct mosquitto *mosq, int *mid, const char *to
 	packet->remaining_length = packetlen;
 	rc = _mosquitto_packet_alloc(packet);
 	if (rc) {
-		_mosquitto_free(packet);
+		_mosquitto_packet_free(packet);
 		return rc;
 	}
 
@@ -48,6 +48,7 @@ extern uint64_t g_pub_bytes_sent;
 #include <mqtt3_protocol.h>
 #include <memory_mosq.h>
 #include <net_mosq.h>
+#include <pool_mosq.h>
 #include <send_mosq.h>
 #include <time_mosq.h>
 #include <util_mosq.h>
@@ -246,7 +247,7 @@ int _mosquitto_send_command_with_mid(struct mosquitto *mosq, uint8_t command, ui
 	int rc;
 
 	assert(mosq);
-	packet = _mosquitto_calloc(1, sizeof(struct _mosquitto_packet));
+	packet = _mosquitto_packet_new();
 	if (!packet) {
 		return MOSQ_ERR_NOMEM;
 	}
@@ -258,7 +259,7 @@ int _mosquitto_send_command_with_mid(struct mosquitto *mosq, uint8_t command, ui
 	packet->remaining_length = 2;
 	rc = _mosquitto_packet_alloc(packet);
 	if (rc) {
-		_mosquitto_free(packet);
+		_mosquitto_packet_free(packet);
 		return rc;
 	}
 
@@ -275,7 +276,7 @@ int _mosquitto_send_simple_command(struct mosquitto *mosq, uint8_t command)
 	int rc;
 
 	assert(mosq);
-	packet = _mosquitto_calloc(1, sizeof(struct _mosquitto_packet));
+	packet = _mosquitto_packet_new();
 	if (!packet) {
 		return MOSQ_ERR_NOMEM;
 	}
@@ -285,7 +286,7 @@ int _mosquitto_send_simple_command(struct mosquitto *mosq, uint8_t command)
 
 	rc = _mosquitto_packet_alloc(packet);
 	if (rc) {
-		_mosquitto_free(packet);
+		_mosquitto_packet_free(packet);
 		return rc;
 	}
 
@@ -305,7 +306,7 @@ int _mosquitto_send_real_publish(struct mosquitto *mosq, uint16_t mid, const cha
 	if (qos > 0) {
 		packetlen += 2;    /* For message id */
 	}
-	packet = _mosquitto_calloc(1, sizeof(struct _mosquitto_packet));
+	packet = _mosquitto_packet_new();
 	if (!packet) {
 		return MOSQ_ERR_NOMEM;
 	}
@@ -315,7 +316,7 @@ int _mosquitto_send_real_publish(struct mosquitto *mosq, uint16_t mid, const cha
 	packet->remaining_length = packetlen;
 	rc = _mosquitto_packet_alloc(packet);
 	if (rc) {
-		_mosquitto_free(packet);
+		_mosquitto_packet_free(packet);
 		return rc;
 	}
 	/* Variable header (topic string) */
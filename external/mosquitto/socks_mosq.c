@@ -37,6 +37,7 @@ Contributors:
 #include "mosquitto_internal.h"
 #include "memory_mosq.h"
 #include "net_mosq.h"
+#include "pool_mosq.h"
 #include "send_mosq.h"
 
 #define SOCKS_AUTH_NONE				0x00
@@ -118,7 +119,7 @@ int mosquitto__socks5_send(struct mosquitto *mosq)
 	int ulen, plen;
 
 	if (mosq->state == mosq_cs_socks5_new) {
-		packet = _mosquitto_calloc(1, sizeof(struct _mosquitto_packet));
+		packet = _mosquitto_packet_new();
 		if (!packet) {
 			return MOSQ_ERR_NOMEM;
 		}
@@ -150,13 +151,13 @@ int mosquitto__socks5_send(struct mosquitto *mosq)
 		mosq->in_packet.payload = _mosquitto_malloc(sizeof(uint8_t) * 2);
 		if (!mosq->in_packet.payload) {
 			_mosquitto_free(packet->payload);
-			_mosquitto_free(packet);
+			_mosquitto_packet_free(packet);
 			return MOSQ_ERR_NOMEM;
 		}
 
 		return _mosquitto_packet_queue(mosq, packet);
 	} else if (mosq->state == mosq_cs_socks5_auth_ok) {
-		packet = _mosquitto_calloc(1, sizeof(struct _mosquitto_packet));
+		packet = _mosquitto_packet_new();
 		if (!packet) {
 			return MOSQ_ERR_NOMEM;
 		}
@@ -185,13 +186,13 @@ int mosquitto__socks5_send(struct mosquitto *mosq)
 		mosq->in_packet.payload = _mosquitto_malloc(sizeof(uint8_t) * 5);
 		if (!mosq->in_packet.payload) {
 			_mosquitto_free(packet->payload);
-			_mosquitto_free(packet);
+			_mosquitto_packet_free(packet);
 			return MOSQ_ERR_NOMEM;
 		}
 
 		return _mosquitto_packet_queue(mosq, packet);
 	} else if (mosq->state == mosq_cs_socks5_send_userpass) {
-		packet = _mosquitto_calloc(1, sizeof(struct _mosquitto_packet));
+		packet = _mosquitto_packet_new();
 		if (!packet) {
 			return MOSQ_ERR_NOMEM;
 		}
@@ -217,7 +218,7 @@ int mosquitto__socks5_send(struct mosquitto *mosq)
 		mosq->in_packet.payload = _mosquitto_malloc(sizeof(uint8_t) * 2);
 		if (!mosq->in_packet.payload) {
 			_mosquitto_free(packet->payload);
-			_mosquitto_free(packet);
+			_mosquitto_packet_free(packet);
 			return MOSQ_ERR_NOMEM;
 		}
 
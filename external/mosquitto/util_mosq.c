@@ -41,6 +41,7 @@ Contributors:
 #include <mosquitto.h>
 #include <memory_mosq.h>
 #include <net_mosq.h>
+#include <pool_mosq.h>
 #include <send_mosq.h>
 #include <time_mosq.h>
 #include <tls_mosq.h>
@@ -82,7 +83,7 @@ int _mosquitto_packet_alloc(struct _mosquitto_packet *packet)
 #ifdef WITH_WEBSOCKETS
 	packet->payload = _mosquitto_malloc(sizeof(uint8_t) * packet->packet_length + LWS_SEND_BUFFER_PRE_PADDING + LWS_SEND_BUFFER_POST_PADDING);
 #else
-	packet->payload = _mosquitto_malloc(sizeof(uint8_t) * packet->packet_length);
+	packet->payload = _mosquitto_payload_alloc(sizeof(uint8_t) * packet->packet_length);
 #endif
 	if (!packet->payload) {
 		return MOSQ_ERR_NOMEM;
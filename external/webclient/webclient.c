@@ -601,7 +601,7 @@ void wget_tls_ssl_release(struct http_client_tls_t *client)
 	mbedtls_ssl_free(&(client->tls_ssl));
 }
 
-int wget_tls_handshake(struct http_client_tls_t *client, const char *hostname)
+int wget_tls_handshake(struct http_client_tls_t *client, const char *hostname, int port)
 {
 	int result = 0;
 
@@ -640,17 +640,33 @@ int wget_tls_handshake(struct http_client_tls_t *client, const char *hostname)
 	mbedtls_ssl_set_bio(&(client->tls_ssl), &(client->tls_client_fd),
 						mbedtls_net_send, mbedtls_net_recv, NULL);
 
+#ifdef CONFIG_TLS_SESSION_STORE
+	/* Offer the session of the last connection to this server */
+	tls_session_store_get(hostname, port, &(client->tls_ssl));
+#endif
+
 	/* Handshake */
 	while ((result = mbedtls_ssl_handshake(&(client->tls_ssl))) != 0) {
 		if (result != MBEDTLS_ERR_SSL_WANT_READ &&
 			result != MBEDTLS_ERR_SSL_WANT_WRITE) {
 			printf("Error: TLS Handshake fail returned -%4x\n", -result);
+#ifdef CONFIG_TLS_SESSION_STORE
+			if (result != MBEDTLS_ERR_NET_SEND_FAILED &&
+				result != MBEDTLS_ERR_NET_RECV_FAILED &&
+				result != MBEDTLS_ERR_SSL_CONN_EOF) {
+				tls_session_store_remove(hostname, port);
+			}
+#endif
 			goto HANDSHAKE_FAIL;
 		}
 	}
 
 	printf("TLS Handshake Success\n");
 
+#ifdef CONFIG_TLS_SESSION_STORE
+	tls_session_store_put(hostname, port, &(client->tls_ssl));
+#endif
+
 	return 0;
 HANDSHAKE_FAIL:
 	return result;
@@ -991,7 +1007,7 @@ retry:
 	}
 
 	client_tls->client_fd = sockfd;
-	if (param->tls && (ret = wget_tls_handshake(client_tls, ws.hostname))) {
+	if (param->tls && (ret = wget_tls_handshake(client_tls, ws.hostname, ws.port))) {
 		if (handshake_retry-- > 0) {
 			if (ret == MBEDTLS_ERR_NET_SEND_FAILED ||
 				ret == MBEDTLS_ERR_NET_RECV_FAILED ||
@@ -85,19 +85,8 @@ int http_server_mq_close(int port)
 	return mq_unlink(msg_name);
 }
 
-pthread_addr_t http_server_handler(pthread_addr_t arg)
+int http_server_listen(struct http_server_t *server)
 {
-	fd_set readfds;
-	int fdcnt = 0;
-	int fdarr[MAX_ACCEPTED_FD] = {0,};
-	mqd_t msg_q;
-	struct http_msg_t msg;
-	socklen_t addrlen;
-	int sock_fd, ret, cnt, i, maxfd = 0;
-	struct timeval tv, accept_to;
-	struct sockaddr_in client_addr;
-	struct mq_attr mqattr;
-	struct http_server_t *server = (struct http_server_t *)arg;
 	int reuse = 1;
 
 	/*
@@ -107,7 +96,7 @@ pthread_addr_t http_server_handler(pthread_addr_t arg)
 	server->listen_fd = socket(AF_INET, SOCK_STREAM, 0);
 	if (server->listen_fd < 0) {
 		HTTP_LOGE("Error: Cannot create socket!!\n");
-		return NULL;
+		return HTTP_ERROR;
 	}
 
 	if (setsockopt(server->listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse)) < 0) {
@@ -121,15 +110,35 @@ pthread_addr_t http_server_handler(pthread_addr_t arg)
 	if (bind(server->listen_fd, (struct sockaddr *)&(server->servaddr), sizeof(struct sockaddr_in)) < 0) {
 		HTTP_LOGE("Error: Cannot socket bind!!\n");
 		close(server->listen_fd);
-		return NULL;
+		return HTTP_ERROR;
 	}
 
 	if (listen(server->listen_fd, HTTP_CONF_MAX_CLIENT) < 0) {
 		HTTP_LOGE("Error: Cannot listen!!\n");
 		close(server->listen_fd);
-		return NULL;
+		return HTTP_ERROR;
 	}
 
+	return HTTP_OK;
+}
+
+pthread_addr_t http_server_handler(pthread_addr_t arg)
+{
+	fd_set readfds;
+	int fdcnt = 0;
+	int fdarr[MAX_ACCEPTED_FD] = {0,};
+	mqd_t msg_q;
+	struct http_msg_t msg;
+	socklen_t addrlen;
+	int sock_fd, ret, cnt, i, maxfd = 0;
+	struct timeval tv, accept_to;
+	struct sockaddr_in client_addr;
+	struct mq_attr mqattr;
+	struct http_server_t *server = (struct http_server_t *)arg;
+
+	if (http_server_listen(server) != HTTP_OK) {
+		return NULL;
+	}
 
 	if ((msg_q = http_server_mq_open(server->port)) == NULL) {
 		HTTP_LOGE("msg queue open fail in http_server_handler %d\n" , server->port);
@@ -281,6 +290,12 @@ int http_server_start(struct http_server_t *server)
 		return HTTP_ERROR;
 	}
 
+#ifdef CONFIG_NETUTILS_WEBSERVER_EVENT_LOOP
+	if (!server->tls_init) {
+		return http_event_start(server);
+	}
+#endif
+
 	if (pthread_attr_init(&attr) != 0) {
 		HTTP_LOGE("Error: Cannot initialize ptread attribute\n");
 		return HTTP_ERROR;
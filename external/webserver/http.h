@@ -47,4 +47,6 @@ struct http_msg_t {
 int http_server_mq_flush(mqd_t msg_q);
 mqd_t http_server_mq_open(int port);
 int http_server_mq_close(int port);
+struct http_server_t;
+int http_server_listen(struct http_server_t *server);
 #endif
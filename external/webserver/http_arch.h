@@ -30,5 +30,6 @@
 #define HTTP_MEMCPY memcpy
 #define HTTP_FREE   free
 #define HTTP_ATOI   atoi
+#define HTTP_REALLOC realloc
 
 #endif
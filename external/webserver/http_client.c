@@ -17,6 +17,9 @@
  ****************************************************************************/
 
 #include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/sendfile.h>
 #include <protocols/webserver/http_err.h>
 #include <protocols/webserver/http_keyvalue_list.h>
 #include <protocols/webclient.h>
@@ -31,7 +34,6 @@
 #include "http_arch.h"
 #include "http_log.h"
 
-#define MIN_WS_HEADER_FIELD 2
 #define MAX_CLIENT_REQUEST 999999 /* it Will be updated if max client request exceeds 999999 */
 #define MIN_CLIENT_REQUEST 100
 
@@ -159,6 +161,9 @@ struct http_client_t *http_client_init(struct http_server_t *server, int sock_fd
 	p->max_request = MAX_CLIENT_REQUEST;
 	p->remaining_request = MAX_CLIENT_REQUEST;
 	p->keep_alive_header_flag = 0;
+#ifdef CONFIG_NETUTILS_WEBSERVER_EVENT_LOOP
+	p->file_fd = -1;
+#endif
 
 	return p;
 }
@@ -595,6 +600,47 @@ int http_parse_message(char *buf, int buf_len, int *method, char *url,
 	return read_finish;
 }
 
+#ifdef CONFIG_NETUTILS_WEBSOCKET
+/* Hand the connection of an upgraded request over to a websocket thread */
+int http_open_websocket(struct http_client_t *client)
+{
+	websocket_t *ws = NULL;
+
+	ws = websocket_find_table();
+	if (ws == NULL) {
+		return HTTP_ERROR;
+	}
+	ws->fd = client->client_fd;
+	ws->cb = &client->server->ws_cb;
+#ifdef CONFIG_NET_SECURITY_TLS
+	if (client->server->tls_init) {
+		ws->tls_enabled = 1;
+		ws->tls_net.fd = client->tls_client_fd.fd;
+		ws->tls_ssl = (mbedtls_ssl_context *)malloc(sizeof(mbedtls_ssl_context));
+		memcpy(ws->tls_ssl, &client->tls_ssl, sizeof(mbedtls_ssl_context));
+		ws->tls_conf = &client->server->tls_conf;
+		mbedtls_ssl_set_bio(ws->tls_ssl, &ws->tls_net, mbedtls_net_send, mbedtls_net_recv, NULL);
+	}
+#endif
+	if (pthread_attr_init(&ws->thread_attr) != 0) {
+		HTTP_LOGE("Error: Cannot initialize thread attribute\n");
+		return HTTP_ERROR;
+	}
+	pthread_attr_setstacksize(&ws->thread_attr, WEBSOCKET_STACKSIZE);
+	pthread_attr_setschedpolicy(&ws->thread_attr, SCHED_RR);
+	if (pthread_create(&ws->thread_id, &ws->thread_attr,
+					   (pthread_startroutine_t)websocket_server_init,
+					   (pthread_addr_t)ws) != 0) {
+		HTTP_LOGE("Error: Cannot create websocket thread!!\n");
+		return HTTP_ERROR;
+	}
+	pthread_setname_np(ws->thread_id, "websocket handle server");
+	pthread_detach(ws->thread_id);
+
+	return HTTP_OK;
+}
+#endif
+
 int http_recv_and_handle_request(struct http_client_t *client, struct http_keyvalue_list_t *request_params)
 {
 	char *buf;
@@ -723,37 +769,9 @@ int http_recv_and_handle_request(struct http_client_t *client, struct http_keyva
 #ifdef CONFIG_NETUTILS_WEBSOCKET
 	/* open websocket */
 	if (client->ws_state >= MIN_WS_HEADER_FIELD) {
-		websocket_t *ws = NULL;
-		ws = websocket_find_table();
-		if (ws == NULL) {
+		if (http_open_websocket(client) != HTTP_OK) {
 			goto errout;
 		}
-		ws->fd = client->client_fd;
-		ws->cb = &client->server->ws_cb;
-#ifdef CONFIG_NET_SECURITY_TLS
-		if (client->server->tls_init) {
-			ws->tls_enabled = 1;
-			ws->tls_net.fd = client->tls_client_fd.fd;
-			ws->tls_ssl = (mbedtls_ssl_context *)malloc(sizeof(mbedtls_ssl_context));
-			memcpy(ws->tls_ssl, &client->tls_ssl, sizeof(mbedtls_ssl_context));
-			ws->tls_conf = &client->server->tls_conf;
-			mbedtls_ssl_set_bio(ws->tls_ssl, &ws->tls_net, mbedtls_net_send, mbedtls_net_recv, NULL);
-		}
-#endif
-		if (pthread_attr_init(&ws->thread_attr) != 0) {
-			HTTP_LOGE("Error: Cannot initialize thread attribute\n");
-			goto errout;
-		}
-		pthread_attr_setstacksize(&ws->thread_attr, WEBSOCKET_STACKSIZE);
-		pthread_attr_setschedpolicy(&ws->thread_attr, SCHED_RR);
-		if (pthread_create(&ws->thread_id, &ws->thread_attr,
-						   (pthread_startroutine_t)websocket_server_init,
-						   (pthread_addr_t)ws) != 0) {
-			HTTP_LOGE("Error: Cannot create websocket thread!!\n");
-			goto errout;
-		}
-		pthread_setname_np(ws->thread_id, "websocket handle server");
-		pthread_detach(ws->thread_id);
 	} else {
 		close(client->client_fd);
 	}
@@ -1252,3 +1270,100 @@ int http_send_response_with_status_msg(struct http_client_t *client, int status,
 {
 	return http_send_response_helper(client, status, status_message, body, headers);
 }
+
+int http_send_header(struct http_client_t *client, int status, const char *status_message, const char *content_type, long content_len)
+{
+	char buf[HTTP_CONF_MAX_REQUEST_LINE_LENGTH];
+	int buflen;
+
+	buflen = snprintf(buf, sizeof(buf), "HTTP/1.1 %d %s\r\n"
+					  "Content-Type: %s\r\n"
+					  "Content-Length: %ld\r\n"
+					  "Connection: %s\r\n"
+					  "Keep-Alive: timeout=%d, max=%d\r\n\r\n",
+					  status, status_message, content_type, content_len,
+					  client->keep_alive ? "Keep-Alive" : "close",
+					  client->keep_alive_timeout, client->max_request);
+	if (buflen < 0 || buflen >= sizeof(buf)) {
+		HTTP_LOGE("Error: header is too long\n");
+		return HTTP_ERROR;
+	}
+
+	if (http_send_buffer(client, buf, buflen) < 0) {
+		HTTP_LOGE("Error: failed to send header\n");
+		return HTTP_ERROR;
+	}
+
+	return HTTP_OK;
+}
+
+int http_send_file(struct http_client_t *client, const char *path, const char *content_type)
+{
+	struct stat st;
+#ifdef CONFIG_NET_SECURITY_TLS
+	char *buf;
+#endif
+	off_t offset = 0;
+	ssize_t len;
+	int ret = HTTP_OK;
+	int fd;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		HTTP_LOGE("Error: Fail to open %s\n", path);
+		http_send_response(client, 404, HTTP_ERROR_404, NULL);
+		return HTTP_ERROR;
+	}
+
+	if (fstat(fd, &st) < 0 || http_send_header(client, 200, "OK", content_type, (long)st.st_size) != HTTP_OK) {
+		close(fd);
+		return HTTP_ERROR;
+	}
+
+#ifdef CONFIG_NETUTILS_WEBSERVER_EVENT_LOOP
+	/* The event loop sends the file whenever the socket is writable */
+	if (client->event_mode) {
+		if (st.st_size == 0) {
+			close(fd);
+			return HTTP_OK;
+		}
+		client->file_fd = fd;
+		client->file_off = 0;
+		client->file_remain = st.st_size;
+		return HTTP_OK;
+	}
+#endif
+
+#ifdef CONFIG_NET_SECURITY_TLS
+	if (client->server->tls_init) {
+		buf = HTTP_MALLOC(HTTP_CONF_MAX_ENTITY_LENGTH);
+		if (buf == NULL) {
+			close(fd);
+			return HTTP_ERROR;
+		}
+
+		while ((len = read(fd, buf, HTTP_CONF_MAX_ENTITY_LENGTH)) > 0) {
+			if (http_send_buffer(client, buf, len) < 0) {
+				ret = HTTP_ERROR;
+				break;
+			}
+		}
+
+		HTTP_FREE(buf);
+		close(fd);
+		return ret;
+	}
+#endif
+
+	while (offset < st.st_size) {
+		len = sendfile(client->client_fd, fd, &offset, st.st_size - offset);
+		if (len <= 0) {
+			HTTP_LOGE("Error: Fail to send %s errno[%d]\n", path, errno);
+			ret = HTTP_ERROR;
+			break;
+		}
+	}
+
+	close(fd);
+	return ret;
+}
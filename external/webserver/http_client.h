@@ -34,8 +34,11 @@
 #include "mbedtls/error.h"
 #include "mbedtls/debug.h"
 #include "mbedtls/ssl_cache.h"
+#include "mbedtls/tls_session_store.h"
 #endif
 
+#define MIN_WS_HEADER_FIELD 2
+
 enum {
 	HTTP_REQUEST_HEADER, HTTP_REQUEST_PARAMETERS, HTTP_REQUEST_BODY
 };
@@ -56,6 +59,20 @@ struct http_client_t {
 	uint32_t max_request;
 	uint32_t remaining_request;
 	int keep_alive_header_flag;
+
+#ifdef CONFIG_NETUTILS_WEBSERVER_EVENT_LOOP
+	/* State kept by the event loop between readiness events */
+	int event_mode;
+	uint32_t client_ip;
+	char *rx_buf;
+	int rx_size;
+	int rx_len;
+	int rx_scan;
+	time_t last_active;
+	int file_fd;
+	off_t file_off;
+	size_t file_remain;
+#endif
 };
 
 struct http_message_len_t {
@@ -101,6 +118,14 @@ int http_parse_message(char *buf, int buf_len, int *method, char *url,
 					   struct http_req_message *req,
 					   int *chunk_processed);
 int   http_recv_and_handle_request(struct http_client_t *client, struct http_keyvalue_list_t *request_params);
+int   http_send_header(struct http_client_t *client, int status, const char *status_message, const char *content_type, long content_len);
+#ifdef CONFIG_NETUTILS_WEBSOCKET
+int   http_open_websocket(struct http_client_t *client);
+#endif
+
+#ifdef CONFIG_NETUTILS_WEBSERVER_EVENT_LOOP
+int   http_event_start(struct http_server_t *server);
+#endif
 
 #ifdef CONFIG_NET_SECURITY_TLS
 int   http_client_tls_init(struct http_client_t *client);
@@ -0,0 +1,572 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/*
+ * Event-driven connection handling. Every worker multiplexes the shared
+ * listening socket and up to HTTP_CONF_EVENT_MAX_CONN connections with
+ * select(). Requests are framed incrementally in a per-connection receive
+ * buffer, which only exists while a request is partially received, so an
+ * idle keep-alive connection costs a struct http_client_t. Pipelined
+ * requests are answered in order, and files queued by http_send_file()
+ * are sent in chunks whenever the socket is writable.
+ */
+
+#include <sys/types.h>
+#include <sys/sendfile.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+#include <protocols/webserver/http_err.h>
+#include <protocols/webserver/http_server.h>
+#include <protocols/webserver/http_keyvalue_list.h>
+
+#include "http.h"
+#include "http_client.h"
+#include "http_query.h"
+#include "http_arch.h"
+#include "http_log.h"
+
+#define HTTP_EVENT_HANDLER_STACKSIZE (1024 * 4)
+
+/* Result of handling a readiness event on a connection */
+#define HTTP_EVENT_KEEP   0
+#define HTTP_EVENT_CLOSE  1
+#define HTTP_EVENT_DETACH 2
+
+static int http_event_find(const char *buf, int len, int start, const char *pattern, int plen)
+{
+	int i;
+
+	for (i = start; i + plen <= len; i++) {
+		if (buf[i] == pattern[0] && !memcmp(buf + i, pattern, plen)) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+/* Find the value of a header field between the request line and hdr_end */
+static const char *http_event_header(const char *buf, int hdr_end, const char *key)
+{
+	int klen = strlen(key);
+	int line = http_event_find(buf, hdr_end, 0, "\r\n", 2);
+	int next;
+
+	while (line >= 0) {
+		line += 2;
+		next = http_event_find(buf, hdr_end, line, "\r\n", 2);
+		if (next < 0) {
+			break;
+		}
+		if (next - line > klen && buf[line + klen] == ':' && !strncasecmp(buf + line, key, klen)) {
+			line += klen + 1;
+			while (buf[line] == ' ') {
+				line++;
+			}
+			return buf + line;
+		}
+		line = next;
+	}
+
+	return NULL;
+}
+
+/*
+ * Return the length of the first complete request in the receive buffer,
+ * 0 if more data is needed or HTTP_ERROR if the request cannot fit.
+ */
+static int http_event_frame(struct http_client_t *client)
+{
+	const char *buf = client->rx_buf;
+	const char *value;
+	int hdr_end;
+	int pos;
+	int eol;
+	long size;
+
+	hdr_end = http_event_find(buf, client->rx_len, client->rx_scan > 3 ? client->rx_scan - 3 : 0, "\r\n\r\n", 4);
+	if (hdr_end < 0) {
+		client->rx_scan = client->rx_len;
+		goto need_more;
+	}
+	hdr_end += 4;
+
+	value = http_event_header(buf, hdr_end, "Transfer-Encoding");
+	if (value && !strncasecmp(value, "chunked", 7)) {
+		/* Walk the chunks up to the last one and the end of the trailer */
+		pos = hdr_end;
+		while (1) {
+			eol = http_event_find(buf, client->rx_len, pos, "\r\n", 2);
+			if (eol < 0) {
+				goto need_more;
+			}
+			size = strtol(buf + pos, NULL, 16);
+			if (size < 0 || size > HTTP_CONF_MAX_REQUEST_LENGTH) {
+				return HTTP_ERROR;
+			}
+			pos = eol + 2;
+			if (size == 0) {
+				break;
+			}
+			pos += size + 2;
+			if (pos > client->rx_len) {
+				goto need_more;
+			}
+		}
+
+		while ((eol = http_event_find(buf, client->rx_len, pos, "\r\n", 2)) != pos) {
+			if (eol < 0) {
+				goto need_more;
+			}
+			pos = eol + 2;
+		}
+		return pos + 2;
+	}
+
+	value = http_event_header(buf, hdr_end, "Content-Length");
+	if (value) {
+		size = strtol(value, NULL, 10);
+		if (size < 0 || hdr_end + size > HTTP_CONF_MAX_REQUEST_LENGTH) {
+			return HTTP_ERROR;
+		}
+		return (client->rx_len >= hdr_end + size) ? hdr_end + size : 0;
+	}
+
+	return hdr_end;
+
+need_more:
+	return (client->rx_len >= HTTP_CONF_MAX_REQUEST_LENGTH) ? HTTP_ERROR : 0;
+}
+
+/* Parse and dispatch one complete request of req_len bytes */
+static int http_event_dispatch(struct http_client_t *client, int req_len)
+{
+	struct http_keyvalue_list_t params;
+	struct http_req_message req = {0, };
+	struct http_message_len_t mlen = {0, };
+	char url[HTTP_CONF_MAX_REQUEST_HEADER_URL_LENGTH] = { 0, };
+	char *buf = client->rx_buf;
+	char *body = NULL;
+	const char *conn_type;
+	char saved;
+	int method = HTTP_METHOD_UNKNOWN;
+	int enc = HTTP_CONTENT_LENGTH;
+	int state = HTTP_REQUEST_HEADER;
+	int chunk_processed = 0;
+	int hdr_end;
+	int http11;
+	int eol;
+	int ret = HTTP_EVENT_KEEP;
+
+	/*
+	 * Decide on keep-alive before the parser dispatches chunked requests,
+	 * HTTP/1.1 connections are persistent unless the client asks otherwise.
+	 */
+	eol = http_event_find(buf, req_len, 0, "\r\n", 2);
+	hdr_end = http_event_find(buf, req_len, 0, "\r\n\r\n", 4) + 4;
+	http11 = (eol >= 8 && !strncmp(buf + eol - 8, "HTTP/1.1", 8));
+	conn_type = http_event_header(buf, hdr_end, "Connection");
+	if (conn_type == NULL) {
+		client->keep_alive = http11;
+	} else if (!strncasecmp(conn_type, "Keep-Alive", strlen("Keep-Alive"))) {
+		client->keep_alive = 1;
+	} else {
+		client->keep_alive = http11 && strncasecmp(conn_type, "close", strlen("close"));
+	}
+
+	if (client->remaining_request > client->max_request) {
+		client->remaining_request = client->max_request;
+	}
+	if (--client->remaining_request == 0) {
+		client->keep_alive = 0;
+	}
+
+	client->ws_state = 0;
+	req.req_msg = buf;
+	req.url = url;
+	req.headers = &params;
+	req.client_ip = client->client_ip;
+	req.encoding = HTTP_CONTENT_LENGTH;
+
+	/* The parser terminates the body at buf[req_len], which may belong to the next request */
+	saved = buf[req_len];
+
+	http_keyvalue_list_init(&params);
+	if (http_parse_message(buf, req_len, &method, url, &body, &enc, &state, &mlen, &params, client, NULL, &req, &chunk_processed) != true
+		|| method == HTTP_METHOD_UNKNOWN) {
+		HTTP_LOGE("Error: Fail to parse request\n");
+		ret = HTTP_EVENT_CLOSE;
+		goto out;
+	}
+
+	if (enc == HTTP_CONTENT_LENGTH) {
+		req.entity = body;
+		http_dispatch_url(client, &req);
+	}
+
+#ifdef CONFIG_NETUTILS_WEBSOCKET
+	if (client->ws_state >= MIN_WS_HEADER_FIELD) {
+		ret = (http_open_websocket(client) == HTTP_OK) ? HTTP_EVENT_DETACH : HTTP_EVENT_CLOSE;
+	}
+#endif
+
+out:
+	buf[req_len] = saved;
+	http_keyvalue_list_release(&params);
+	if (enc == HTTP_CHUNKED_ENCODING) {
+		HTTP_FREE(body);
+	}
+	return ret;
+}
+
+/* Answer the complete requests in the receive buffer, in order */
+static int http_event_process(struct http_client_t *client)
+{
+	int req_len;
+	int ret;
+
+	while (client->rx_len > 0 && client->file_fd < 0) {
+		req_len = http_event_frame(client);
+		if (req_len == HTTP_ERROR) {
+			client->keep_alive = 0;
+			http_send_response(client, 413, "Payload Too Large\r\n", NULL);
+			return HTTP_EVENT_CLOSE;
+		} else if (req_len == 0) {
+			break;
+		}
+
+		ret = http_event_dispatch(client, req_len);
+		if (ret != HTTP_EVENT_KEEP) {
+			return ret;
+		}
+
+		client->rx_len -= req_len;
+		client->rx_scan = 0;
+		if (client->rx_len > 0) {
+			memmove(client->rx_buf, client->rx_buf + req_len, client->rx_len);
+		}
+
+		if (!client->keep_alive && client->file_fd < 0) {
+			return HTTP_EVENT_CLOSE;
+		}
+	}
+
+	/* Idle connections do not keep a receive buffer */
+	if (client->rx_len == 0 && client->rx_buf) {
+		HTTP_FREE(client->rx_buf);
+		client->rx_buf = NULL;
+		client->rx_size = 0;
+	}
+
+	return HTTP_EVENT_KEEP;
+}
+
+static int http_event_recv(struct http_client_t *client, time_t now)
+{
+	char *buf;
+	int size;
+	int len;
+
+	if (client->rx_len == client->rx_size) {
+		if (client->rx_size >= HTTP_CONF_MAX_REQUEST_LENGTH) {
+			client->keep_alive = 0;
+			http_send_response(client, 413, "Payload Too Large\r\n", NULL);
+			return HTTP_EVENT_CLOSE;
+		}
+
+		size = client->rx_size ? client->rx_size * 2 : HTTP_CONF_EVENT_RXBUF_LENGTH;
+		if (size > HTTP_CONF_MAX_REQUEST_LENGTH) {
+			size = HTTP_CONF_MAX_REQUEST_LENGTH;
+		}
+
+		/* One more byte for the terminator written by the parser */
+		buf = HTTP_REALLOC(client->rx_buf, size + 1);
+		if (buf == NULL) {
+			HTTP_LOGE("Error: Fail to alloc receive buffer\n");
+			return HTTP_EVENT_CLOSE;
+		}
+		client->rx_buf = buf;
+		client->rx_size = size;
+	}
+
+	len = recv(client->client_fd, client->rx_buf + client->rx_len, client->rx_size - client->rx_len, 0);
+	if (len <= 0) {
+		HTTP_LOGD("Client %d closed %d errno[%d]\n", client->client_fd, len, errno);
+		return HTTP_EVENT_CLOSE;
+	}
+
+	client->rx_len += len;
+	client->last_active = now;
+
+	return http_event_process(client);
+}
+
+static int http_event_send_file(struct http_client_t *client, time_t now)
+{
+	ssize_t len;
+
+	len = sendfile(client->client_fd, client->file_fd, &client->file_off,
+				   client->file_remain < HTTP_CONF_EVENT_FILE_CHUNK ? client->file_remain : HTTP_CONF_EVENT_FILE_CHUNK);
+	if (len <= 0) {
+		HTTP_LOGE("Error: Fail to send file errno[%d]\n", errno);
+		return HTTP_EVENT_CLOSE;
+	}
+
+	client->file_remain -= len;
+	client->last_active = now;
+	if (client->file_remain > 0) {
+		return HTTP_EVENT_KEEP;
+	}
+
+	close(client->file_fd);
+	client->file_fd = -1;
+	if (!client->keep_alive) {
+		return HTTP_EVENT_CLOSE;
+	}
+
+	/* Continue with the requests pipelined behind the file */
+	return http_event_process(client);
+}
+
+static void http_event_release(struct http_client_t *client, int close_fd)
+{
+	if (close_fd) {
+		close(client->client_fd);
+	}
+	if (client->file_fd >= 0) {
+		close(client->file_fd);
+	}
+	HTTP_FREE(client->rx_buf);
+	http_client_release(client);
+}
+
+static struct http_client_t *http_event_accept(struct http_server_t *server, time_t now)
+{
+	struct http_client_t *client;
+	struct sockaddr_in client_addr;
+	socklen_t addrlen = sizeof(struct sockaddr_in);
+	int sock_fd;
+
+	sock_fd = accept(server->listen_fd, (struct sockaddr *)&client_addr, &addrlen);
+	if (sock_fd < 0) {
+		/* Another worker won the race for this connection */
+		if (errno != EWOULDBLOCK && errno != EAGAIN) {
+			HTTP_LOGE("Error: Accept client error!!\n");
+		}
+		return NULL;
+	}
+
+	client = http_client_init(server, sock_fd);
+	if (client == NULL) {
+		HTTP_LOGE("Error: Cannot init client!!\n");
+		close(sock_fd);
+		return NULL;
+	}
+
+	client->event_mode = 1;
+	client->client_ip = client_addr.sin_addr.s_addr;
+	client->last_active = now;
+	HTTP_LOGD("Client %d is accepted\n", sock_fd);
+
+	return client;
+}
+
+static void http_event_loop(struct http_server_t *server)
+{
+	struct http_client_t *conns[HTTP_CONF_EVENT_MAX_CONN] = { NULL, };
+	struct http_client_t *client;
+	fd_set readfds;
+	fd_set writefds;
+	struct timeval tv;
+	time_t now;
+	int nconn = 0;
+	int nready;
+	int maxfd;
+	int timeout;
+	int ret;
+	int i;
+
+	while (server->state == HTTP_SERVER_RUN) {
+		FD_ZERO(&readfds);
+		FD_ZERO(&writefds);
+		maxfd = -1;
+
+		/* Stop accepting while this worker is full */
+		if (nconn < HTTP_CONF_EVENT_MAX_CONN) {
+			FD_SET(server->listen_fd, &readfds);
+			maxfd = server->listen_fd;
+		}
+
+		for (i = 0; i < HTTP_CONF_EVENT_MAX_CONN; i++) {
+			if (conns[i] == NULL) {
+				continue;
+			}
+			if (conns[i]->file_fd >= 0) {
+				FD_SET(conns[i]->client_fd, &writefds);
+			} else {
+				FD_SET(conns[i]->client_fd, &readfds);
+			}
+			if (conns[i]->client_fd > maxfd) {
+				maxfd = conns[i]->client_fd;
+			}
+		}
+
+		tv.tv_sec = HTTP_CONF_EVENT_TIMEOUT_MSEC / 1000;
+		tv.tv_usec = (HTTP_CONF_EVENT_TIMEOUT_MSEC % 1000) * 1000;
+		nready = select(maxfd + 1, &readfds, &writefds, NULL, &tv);
+		if (nready < 0) {
+			if (errno != EINTR) {
+				HTTP_LOGE("Error: select fail errno[%d]\n", errno);
+				usleep(HTTP_CONF_EVENT_TIMEOUT_MSEC * 1000);
+			}
+			continue;
+		}
+
+		now = time(NULL);
+
+		for (i = 0; i < HTTP_CONF_EVENT_MAX_CONN; i++) {
+			client = conns[i];
+			if (client == NULL) {
+				continue;
+			}
+
+			if (FD_ISSET(client->client_fd, &writefds)) {
+				ret = http_event_send_file(client, now);
+			} else if (FD_ISSET(client->client_fd, &readfds)) {
+				ret = http_event_recv(client, now);
+			} else {
+				timeout = client->keep_alive ? client->keep_alive_timeout : HTTP_CONF_SOCKET_TIMEOUT_MSEC / HTTP_CONF_SEC_TO_MSEC;
+				ret = (now - client->last_active > timeout) ? HTTP_EVENT_CLOSE : HTTP_EVENT_KEEP;
+			}
+
+			if (ret != HTTP_EVENT_KEEP) {
+				HTTP_LOGD("Release client %d\n", client->client_fd);
+				http_event_release(client, ret == HTTP_EVENT_CLOSE);
+				conns[i] = NULL;
+				nconn--;
+			}
+		}
+
+		if (nready > 0 && nconn < HTTP_CONF_EVENT_MAX_CONN && FD_ISSET(server->listen_fd, &readfds)) {
+			client = http_event_accept(server, now);
+			for (i = 0; client && i < HTTP_CONF_EVENT_MAX_CONN; i++) {
+				if (conns[i] == NULL) {
+					conns[i] = client;
+					nconn++;
+					break;
+				}
+			}
+		}
+	}
+
+	for (i = 0; i < HTTP_CONF_EVENT_MAX_CONN; i++) {
+		if (conns[i]) {
+			http_event_release(conns[i], 1);
+		}
+	}
+}
+
+static pthread_addr_t http_event_worker(pthread_addr_t arg)
+{
+	struct http_server_t *server = (struct http_server_t *)arg;
+
+	http_event_loop(server);
+	sem_post(&server->sem_thread_sync);
+
+	return NULL;
+}
+
+static pthread_addr_t http_event_handler(pthread_addr_t arg)
+{
+	struct http_server_t *server = (struct http_server_t *)arg;
+	pthread_attr_t attr;
+	int nworker = 0;
+	int flags;
+	int i;
+
+	if (http_server_listen(server) != HTTP_OK) {
+		server->state = HTTP_SERVER_STOP;
+		return NULL;
+	}
+
+	/* Workers share the listening socket, accept must not block the losers */
+	flags = fcntl(server->listen_fd, F_GETFL, 0);
+	if (flags < 0 || fcntl(server->listen_fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+		HTTP_LOGE("Error: Fail to set non-blocking listen socket\n");
+	}
+
+	sem_init(&server->sem_thread_sync, 0, 0);
+	server->state = HTTP_SERVER_RUN;
+
+	/* This thread is the first worker */
+	for (i = 1; i < HTTP_CONF_MAX_CLIENT_HANDLE; i++) {
+		if (pthread_attr_init(&attr) != 0) {
+			HTTP_LOGE("Error: Cannot initialize thread attribute\n");
+			break;
+		}
+		pthread_attr_setschedpolicy(&attr, SCHED_RR);
+		pthread_attr_setstacksize(&attr, HTTP_EVENT_HANDLER_STACKSIZE);
+		if (pthread_create(&server->c_tid[i], &attr, http_event_worker, (void *)server) != 0) {
+			HTTP_LOGE("Error: Cannot create event worker!!\n");
+			break;
+		}
+		pthread_setname_np(server->c_tid[i], "webserver event");
+		pthread_detach(server->c_tid[i]);
+		nworker++;
+	}
+
+	HTTP_LOGD("Serving port %d with %d event loops\n", server->port, nworker + 1);
+	http_event_loop(server);
+
+	while (nworker > 0) {
+		if (sem_wait(&server->sem_thread_sync) == OK) {
+			nworker--;
+		}
+	}
+	sem_destroy(&server->sem_thread_sync);
+
+	HTTP_LOGD("http_event_handler stop :%d\n", server->port);
+	server->state = HTTP_SERVER_STOP;
+	return NULL;
+}
+
+int http_event_start(struct http_server_t *server)
+{
+	pthread_attr_t attr;
+
+	if (pthread_attr_init(&attr) != 0) {
+		HTTP_LOGE("Error: Cannot initialize ptread attribute\n");
+		return HTTP_ERROR;
+	}
+	pthread_attr_setschedpolicy(&attr, SCHED_RR);
+	pthread_attr_setstacksize(&attr, HTTP_EVENT_HANDLER_STACKSIZE);
+
+	if (pthread_create(&server->tid, &attr, http_event_handler, (void *)server) != 0) {
+		HTTP_LOGE("Error: Cannot create server thread!!\n");
+		return HTTP_ERROR;
+	}
+	pthread_setname_np(server->tid, "webserver event");
+	pthread_detach(server->tid);
+
+	return HTTP_OK;
+}
@@ -127,6 +127,13 @@ int http_tls_init(struct http_server_t *server, struct ssl_config_t *ssl_config)
 
 	HTTP_LOGD("Ok\n");
 
+#ifdef CONFIG_TLS_SESSION_STORE
+	/* Let clients resume with tickets any server of the device can decrypt */
+	if ((result = tls_ticket_keys_conf(&(server->tls_conf))) != 0) {
+		HTTP_LOGE("Error: tls_ticket_keys_conf returned -%4x\n", -result);
+	}
+#endif
+
 	mbedtls_ssl_conf_authmode(&server->tls_conf, ssl_config->auth_mode);
 
 	server->tls_init = 1;
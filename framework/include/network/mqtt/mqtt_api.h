@@ -209,6 +209,19 @@ int mqtt_disconnect(mqtt_client_t *handle);
  */
 int mqtt_publish(mqtt_client_t *handle, char *topic, char *data, uint32_t data_len, uint8_t qos, uint8_t retain);
 
+/**
+ * @brief mqtt_publish_batch() publishes several messages to a MQTT broker at once
+ *
+ * @details @b #include <network/mqtt/mqtt_api.h>
+ * The messages are written together, so that small messages share socket writes.
+ * @param[in] handle the handle of MQTT client object
+ * @param[in,out] msgs the messages to publish. msg_id is set for each message published.
+ * @param[in] count the number of messages
+ * @return On success, 0 is returned. On failure, a negative value is returned.
+ * @since TizenRT v3.0
+ */
+int mqtt_publish_batch(mqtt_client_t *handle, mqtt_msg_t *msgs, int count);
+
 /**
  * @brief mqtt_subscribe() subscribes for the specified topic with MQTT broker
  *
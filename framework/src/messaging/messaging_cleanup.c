@@ -42,7 +42,7 @@ static int messaging_unlink_internalport(const char *port_name, int pid)
 		return ERROR;
 	}
 
-	ret = mq_unlink(internal_portname);
+	ret = messaging_discard_port(internal_portname);
 	MSG_FREE(internal_portname);
 	if (ret != OK && errno != ENOENT) {
 		msgdbg("[Messaging] unregister fail : unlink error, errno %d.\n", errno);
@@ -87,8 +87,13 @@ int messaging_cleanup(const char *port_name)
 	port_info_list_ptr = messaging_get_port_info_list();
 	port_info = (msg_port_info_t *)sq_peek(port_info_list_ptr);
 	if (port_info == NULL) {
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+		/* Block receivers keep their queue until cleanup as well. */
+		return messaging_unlink_internalport(port_name, getpid());
+#else
 		/* There is no registered port. So we don't need to clean anything. */
 		return OK;
+#endif
 	}
 
 	my_pid = getpid();
@@ -107,7 +112,11 @@ int messaging_cleanup(const char *port_name)
 	if (cleanup_pid != INVALID_PID) {
 		ret = messaging_unlink_internalport(port_name, cleanup_pid);
 	} else {
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+		ret = messaging_unlink_internalport(port_name, my_pid);
+#else
 		ret = ERROR;
+#endif
 	}
 
 	return ret;
@@ -26,6 +26,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <sched.h>
 #include <sys/prctl.h>
 #include <sys/types.h>
 #include <messaging/messaging.h>
@@ -48,8 +49,10 @@ int messaging_get_version(void)
  *  For MSG_INFO_SAVE : On success, 0 (OK) is returned. On failure, -1 (ERROR) is returned.
  *  FOR MSG_INFO_READ : On success, the number of receivers who waits is returned.
  *			  On failure, -1 (ERROR) is returned.
+ *			  The receiver generation, which changes whenever receivers
+ *			  register or unregister, is returned through gen.
  ****************************************************************************/
-int messaging_handle_data(msg_info_type_t type, const char *port_name, int *data_arr, int *recv_cnt)
+int messaging_handle_data(msg_info_type_t type, const char *port_name, int *data_arr, int *recv_cnt, uint32_t *gen)
 {
 	int ret;
 	pid_t pid;
@@ -68,7 +71,7 @@ int messaging_handle_data(msg_info_type_t type, const char *port_name, int *data
 		}
 		ret = prctl(PR_MSG_SAVE, port_name, pid, param.sched_priority);
 	} else if (type == MSG_INFO_READ) {
-		ret = prctl(PR_MSG_READ, port_name, data_arr, recv_cnt);
+		ret = prctl(PR_MSG_READ, port_name, data_arr, recv_cnt, gen);
 	} else if (type == MSG_INFO_REMOVE) {
 		ret = prctl(PR_MSG_REMOVE, port_name);
 	} else {
@@ -141,6 +144,18 @@ int messaging_parse_packet(char *packet, char *buf, int buflen, pid_t *sender_pi
 	case 1:
 		*sender_pid = ((messaging_packet_t *)packet)->sender_pid;
 		*msg_type = ((messaging_packet_t *)packet)->msg_type;
+#ifdef CONFIG_MESSAGING_SHARED_BUF
+		if (*msg_type & MSG_TYPE_SHARED_BUF) {
+			messaging_shared_buf_t *shared = messaging_get_shared_buf(packet);
+
+			/* Copy out of the shared message and drop the reference of this receiver. */
+			memcpy(buf, shared->data, shared->len < buflen ? shared->len : buflen);
+			messaging_unref_shared_buf(shared);
+			*msg_type &= ~MSG_TYPE_SHARED_BUF;
+			ret = OK;
+			break;
+		}
+#endif
 		memcpy(buf, packet + offset, buflen);
 		ret = OK;
 		break;
@@ -152,6 +167,94 @@ int messaging_parse_packet(char *packet, char *buf, int buflen, pid_t *sender_pi
 
 	return ret;
 }
+#ifdef CONFIG_MESSAGING_SHARED_BUF
+/****************************************************************************
+ * Name : messaging_get_shared_buf
+ *
+ * Description:
+ *  Return the shared message which the packet refers to, or NULL if the
+ *  packet carries the message itself.
+ ****************************************************************************/
+messaging_shared_buf_t *messaging_get_shared_buf(const char *packet)
+{
+	messaging_shared_buf_t *shared;
+
+	if (!(((messaging_packet_t *)packet)->msg_type & MSG_TYPE_SHARED_BUF)) {
+		return NULL;
+	}
+
+	memcpy(&shared, packet + ((messaging_packet_t *)packet)->offset, sizeof(messaging_shared_buf_t *));
+	return shared;
+}
+/****************************************************************************
+ * Name : messaging_ref_shared_buf
+ *
+ * Description:
+ *  Add a reference to a shared message. The sender and each receiver which
+ *  got the packet hold one.
+ ****************************************************************************/
+void messaging_ref_shared_buf(messaging_shared_buf_t *shared)
+{
+	sched_lock();
+	shared->refs++;
+	sched_unlock();
+}
+/****************************************************************************
+ * Name : messaging_unref_shared_buf
+ *
+ * Description:
+ *  Drop a reference to a shared message and free it with the last one.
+ ****************************************************************************/
+void messaging_unref_shared_buf(messaging_shared_buf_t *shared)
+{
+	int refs;
+
+	sched_lock();
+	refs = --shared->refs;
+	sched_unlock();
+
+	if (refs == 0) {
+		MSG_FREE(shared);
+	}
+}
+#endif
+/****************************************************************************
+ * Name : messaging_discard_port
+ *
+ * Description:
+ *  Unlink the message queue of a receiver port. Packets which were never
+ *  received are dropped first, so that the shared messages they refer to
+ *  are released.
+ *
+ * Return Value:
+ *  The result of mq_unlink().
+ ****************************************************************************/
+int messaging_discard_port(const char *port_name)
+{
+#ifdef CONFIG_MESSAGING_SHARED_BUF
+	mqd_t mqdes;
+	struct mq_attr attr;
+	char *packet;
+
+	mqdes = mq_open(port_name, O_RDONLY | O_NONBLOCK);
+	if (mqdes != (mqd_t)ERROR) {
+		if (mq_getattr(mqdes, &attr) == OK && attr.mq_curmsgs > 0) {
+			packet = (char *)MSG_ALLOC(attr.mq_msgsize);
+			if (packet != NULL) {
+				while (mq_receive(mqdes, packet, attr.mq_msgsize, 0) > 0) {
+					messaging_shared_buf_t *shared = messaging_get_shared_buf(packet);
+					if (shared != NULL) {
+						messaging_unref_shared_buf(shared);
+					}
+				}
+				MSG_FREE(packet);
+			}
+		}
+		mq_close(mqdes);
+	}
+#endif
+	return mq_unlink(port_name);
+}
 /****************************************************************************
  * Name : messaging_set_notification
  * 
@@ -188,6 +291,7 @@ void messaging_run_callback(int signo, siginfo_t *data)
 	msg_recv_info_t *recv_info;
 	struct mq_attr attr;
 	char *recv_packet;
+	int recv_size;
 	int msg_type;
 
 	if (data == NULL) {
@@ -208,15 +312,20 @@ void messaging_run_callback(int signo, siginfo_t *data)
 		goto errout_with_recv_info;
 	}
 
+	recv_size = MSG_PACKET_SIZE(recv_info->msg->buflen);
+	if (attr.mq_msgsize > recv_size) {
+		recv_size = attr.mq_msgsize;
+	}
+
 	while (1) {
 		/* recv_packet is used for receiving message including header. */
-		recv_packet = (char *)MSG_ALLOC(attr.mq_msgsize);
+		recv_packet = (char *)MSG_ALLOC(recv_size);
 		if (recv_packet == NULL) {
 			msgdbg("[Messaging] recv fail : out of memory for including header.\n");
 			goto errout_with_recv_info;
 		}
 
-		size = mq_receive(recv_info->mqdes, (char *)recv_packet, attr.mq_msgsize, 0);
+		size = mq_receive(recv_info->mqdes, (char *)recv_packet, recv_size, 0);
 		if (size < 0) {
 			msgdbg("[Messaging] recv fail : mq_receive, errno %d\n", errno);
 			goto errout_with_recv_packet;
@@ -238,7 +347,7 @@ void messaging_run_callback(int signo, siginfo_t *data)
 			if (ret != OK) {
 				msgdbg("[Messaging] Mq_close fail for async-reply.\n");
 			}
-			ret = mq_unlink(recv_info->port_name);
+			ret = messaging_discard_port(recv_info->port_name);
 			if (ret != OK) {
 				msgdbg("[Messaging] Unlink fail for async-reply, errno %d\n", errno);
 			}
@@ -15,6 +15,7 @@
  * language governing permissions and limitations under the License.
  *
  ****************************************************************************/
+#include <tinyara/config.h>
 #include <tinyara/compiler.h>
 #include <mqueue.h>
 #include <stdio.h>
@@ -46,6 +47,30 @@ struct messaging_packet_s {
 typedef struct messaging_packet_s messaging_packet_t;
 #define MSG_HEADER_SIZE (sizeof(messaging_packet_t) - sizeof(char *)) /* Messaging Version 1 */
 
+#ifdef CONFIG_MESSAGING_SHARED_BUF
+/* Set in msg_type when the message field holds a pointer to a messaging_shared_buf_t
+ * instead of the message itself.
+ */
+#define MSG_TYPE_SHARED_BUF (1 << 16)
+
+/* Reference counted copy of a large message, shared by all of its receivers. */
+struct messaging_shared_buf_s {
+	int refs;
+	int len;
+	char data[];
+};
+typedef struct messaging_shared_buf_s messaging_shared_buf_t;
+
+/* Size of buffer needed to receive a packet for buflen bytes of message. */
+#define MSG_PACKET_SIZE(len) (MSG_HEADER_SIZE + ((len) < sizeof(void *) ? sizeof(void *) : (len)))
+/* Size of messages in the message queue of a receiver with buflen bytes of buffer. */
+#define MSG_QUEUE_MSGSIZE(len) ((len) > CONFIG_MESSAGING_SHARED_BUF_THRESHOLD ? \
+	MSG_PACKET_SIZE(CONFIG_MESSAGING_SHARED_BUF_THRESHOLD) : MSG_PACKET_SIZE(len))
+#else
+#define MSG_PACKET_SIZE(len) (MSG_HEADER_SIZE + (len))
+#define MSG_QUEUE_MSGSIZE(len) MSG_PACKET_SIZE(len)
+#endif
+
 #define MAX_PORT_NAME_SIZE 64
 
 /**
@@ -62,9 +87,9 @@ enum msg_info_type_e {
 };
 typedef enum msg_info_type_e msg_info_type_t;
 
-#define SAVE_MSG_RECEIVER(port_name)  messaging_handle_data(MSG_INFO_SAVE, port_name, NULL, NULL)
-#define READ_MSG_RECEIVER(port_name, recv_arr, recv_cnt)  messaging_handle_data(MSG_INFO_READ, port_name, recv_arr, &recv_cnt)
-#define FREE_MSG_RECEIVER(port_name)  messaging_handle_data(MSG_INFO_REMOVE, port_name, NULL, NULL)
+#define SAVE_MSG_RECEIVER(port_name)  messaging_handle_data(MSG_INFO_SAVE, port_name, NULL, NULL, NULL)
+#define READ_MSG_RECEIVER(port_name, recv_arr, recv_cnt, gen)  messaging_handle_data(MSG_INFO_READ, port_name, recv_arr, &recv_cnt, &gen)
+#define FREE_MSG_RECEIVER(port_name)  messaging_handle_data(MSG_INFO_REMOVE, port_name, NULL, NULL, NULL)
 
 /**
  * @brief The type of sending message
@@ -117,15 +142,27 @@ int messaging_set_notification(int signo, msg_recv_info_t *data);
 /**
  * @brief Internal function for save/read the message information when sending and receiving the message.
  */
-int messaging_handle_data(msg_info_type_t type, const char *port_name, int *data_arr, int *recv_cnt);
+int messaging_handle_data(msg_info_type_t type, const char *port_name, int *data_arr, int *recv_cnt, uint32_t *gen);
 /**
  * @brief Internal function for unicast and multicast send APIs.
  */
 int messaging_send_internal(const char *port_name, msg_send_type_t msg_type, msg_send_data_t *send_data, msg_recv_buf_t *recv_data, msg_callback_info_t *cb_info);
 /**
- * @brief Internal function for sending message packet which has header and message.
+ * @brief Internal function for building the packet which has header and message.
+ */
+char *messaging_make_packet(msg_send_type_t msg_type, msg_send_data_t *send_data, int *packet_size);
+/**
+ * @brief Internal function for releasing a packet and the shared message it refers to.
+ */
+void messaging_free_packet(char *packet);
+/**
+ * @brief Internal function for sending a packet built by messaging_make_packet.
+ */
+int messaging_send_packet(const char *port_name, const char *packet, int packet_size, int priority);
+/**
+ * @brief Internal function for discarding the pending packets of a message port and unlinking it.
  */
-int messaging_send_packet(const char *port_name, msg_send_type_t msg_type, msg_send_data_t *send_data, msg_callback_info_t *cb_info);
+int messaging_discard_port(const char *port_name);
 /**
  * @brief Internal function for receiving APIs.
  */
@@ -138,6 +175,20 @@ void messaging_run_callback(int signo, siginfo_t *data);
  * @brief Internal function for parsing received packet
  */
 int messaging_parse_packet(char *packet, char *buf, int buflen, pid_t *sender_pid, int *msg_type);
+#ifdef CONFIG_MESSAGING_SHARED_BUF
+/**
+ * @brief Internal function for getting the shared message a packet refers to, NULL if there is none.
+ */
+messaging_shared_buf_t *messaging_get_shared_buf(const char *packet);
+/**
+ * @brief Internal function for adding a reference to a shared message.
+ */
+void messaging_ref_shared_buf(messaging_shared_buf_t *shared);
+/**
+ * @brief Internal function for dropping a reference to a shared message. The last one frees it.
+ */
+void messaging_unref_shared_buf(messaging_shared_buf_t *shared);
+#endif
 /**
  * @brief Internal function for getting g_port_info_list
  */
@@ -40,6 +40,26 @@ sq_queue_t *messaging_get_port_info_list(void)
 {
 	return &g_port_info_list;
 }
+/****************************************************************************
+ * Name : messaging_recv_size
+ *
+ * Description:
+ *  Return the size of buffer needed to receive from the queue. It can be
+ *  larger than needed for buflen if the queue was kept from an earlier
+ *  receive with a larger buffer.
+ ****************************************************************************/
+static int messaging_recv_size(mqd_t mqdes, int buflen)
+{
+	int recv_size = MSG_PACKET_SIZE(buflen);
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+	struct mq_attr attr;
+
+	if (mq_getattr(mqdes, &attr) == OK && attr.mq_msgsize > recv_size) {
+		recv_size = attr.mq_msgsize;
+	}
+#endif
+	return recv_size;
+}
 /****************************************************************************
  * Name : messaging_recv_nonblock
  * 
@@ -68,11 +88,13 @@ static int messaging_rcv_nonblock(mqd_t mqdes, const char *port_name, msg_recv_b
 	msg_recv_info_t *nonblock_data;
 	msg_port_info_t *port_info = NULL;
 	int recv_size;
+	int buflen;
 	char *recv_packet;
 	int msg_type;
 	char *internal_portname;
 
-	recv_size = recv_buf->buflen + MSG_HEADER_SIZE;
+	buflen = recv_buf->buflen;
+	recv_size = messaging_recv_size(mqdes, buflen);
 	recv_packet = (char *)MSG_ALLOC(recv_size);
 	if (recv_packet == NULL) {
 		msgdbg("[Messaging] recv fail : out of memory for packet.\n");
@@ -82,7 +104,7 @@ static int messaging_rcv_nonblock(mqd_t mqdes, const char *port_name, msg_recv_b
 	while (1) {
 		recv_size_chk = mq_receive(mqdes, (char *)recv_packet, recv_size, 0);
 		if (recv_size_chk > 0 && recv_size_chk <= recv_size) {
-			ret = messaging_parse_packet(recv_packet, recv_buf->buf, recv_buf->buflen, &recv_buf->sender_pid, &msg_type);
+			ret = messaging_parse_packet(recv_packet, recv_buf->buf, buflen, &recv_buf->sender_pid, &msg_type);
 			if (ret != OK) {
 				MSG_FREE(recv_packet);
 				goto errout_with_mq;
@@ -145,7 +167,7 @@ errout_with_msg:
 errout_with_mq:
 	mq_close(mqdes);
 	MSG_ASPRINTF(&internal_portname, "%s%d", port_name, getpid());
-	mq_unlink(internal_portname);
+	messaging_discard_port(internal_portname);
 	MSG_FREE(internal_portname);
 	return ERROR;
 }
@@ -171,9 +193,11 @@ static int messaging_rcv_block(mqd_t mqdes, const char *port_name, msg_recv_buf_
 	int recv_size;
 	char *recv_packet;
 	int msg_type = OK;
+#ifndef CONFIG_MESSAGING_PORT_CACHE
 	char *internal_portname;
+#endif
 
-	recv_size = MSG_HEADER_SIZE + recv_buf->buflen;
+	recv_size = messaging_recv_size(mqdes, recv_buf->buflen);
 	recv_packet = (char *)MSG_ALLOC(recv_size);
 	if (recv_packet == NULL) {
 		msgdbg("[Messaging] recv fail : out of memory for packet.\n");
@@ -197,9 +221,11 @@ static int messaging_rcv_block(mqd_t mqdes, const char *port_name, msg_recv_buf_
 cleanup_return:
 	MSG_FREE(recv_packet);
 	mq_close(mqdes);
+#ifndef CONFIG_MESSAGING_PORT_CACHE
 	MSG_ASPRINTF(&internal_portname, "%s%d", port_name, getpid());
-	mq_unlink(internal_portname);
+	messaging_discard_port(internal_portname);
 	MSG_FREE(internal_portname);
+#endif
 	return msg_type;
 }
 /****************************************************************************
@@ -224,14 +250,31 @@ int messaging_recv_internal(const char *port_name, msg_recv_buf_t *recv_buf, msg
 	int ret = OK;
 	mqd_t mqdes;
 	struct mq_attr internal_attr;
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+	struct mq_attr attr;
+#endif
 	char *internal_portname;
 
 	MSG_ASPRINTF(&internal_portname, "%s%d", port_name, getpid());
 
 	internal_attr.mq_maxmsg = CONFIG_MESSAGING_MAXMSG;
-	internal_attr.mq_msgsize = recv_buf->buflen + MSG_HEADER_SIZE;
+	internal_attr.mq_msgsize = MSG_QUEUE_MSGSIZE(recv_buf->buflen);
 	internal_attr.mq_flags = 0;
 
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+	/* The queue is kept between receives so that senders can keep it open.
+	 * Recreate it if an earlier receive made it too small for this buffer.
+	 */
+	mqdes = mq_open(internal_portname, O_RDONLY | O_NONBLOCK);
+	if (mqdes != (mqd_t)ERROR) {
+		ret = mq_getattr(mqdes, &attr);
+		mq_close(mqdes);
+		if (ret == OK && attr.mq_msgsize < internal_attr.mq_msgsize && attr.mq_curmsgs == 0) {
+			mq_unlink(internal_portname);
+		}
+	}
+#endif
+
 	if (cb_info == NULL) {
 		/* This is block receive case. */
 		mqdes = mq_open(internal_portname, O_RDONLY | O_CREAT, 0666, &internal_attr);
@@ -250,7 +293,7 @@ int messaging_recv_internal(const char *port_name, msg_recv_buf_t *recv_buf, msg
 	ret = SAVE_MSG_RECEIVER(port_name);
 	if (ret != OK) {
 		mq_close(mqdes);
-		mq_unlink(internal_portname);
+		messaging_discard_port(internal_portname);
 		MSG_FREE(internal_portname);
 		return ERROR;
 	}
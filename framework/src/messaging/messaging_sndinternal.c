@@ -23,16 +23,41 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <mqueue.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <semaphore.h>
 #include <sys/prctl.h>
 #include <sys/types.h>
 #include <messaging/messaging.h>
 #include "messaging_internal.h"
 
 #define MSG_RECV_NOT_INIT (-1)
+
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+/* A message queue of a receiver which is kept open by a sender. A slot
+ * belongs to the task group of the sender which claimed it until that
+ * group exits, because a message queue descriptor can only be used and
+ * closed by the task group which opened it. Groups are told apart by the
+ * serial number from PR_GET_GROUP_SERIAL, which unlike a pid is not
+ * reused by the next task.
+ */
+struct msg_port_cache_s {
+	uint32_t owner;			/* Serial of the owning task group, 0 if free */
+	pid_t recv_pid;			/* Receiver of the cached queue */
+	uint32_t gen;			/* Receiver generation the queue was opened in */
+	uint32_t stamp;			/* Time of last use, for LRU replacement */
+	mqd_t mqdes;			/* Open message queue, NULL if there is none */
+	char name[MAX_PORT_NAME_SIZE];
+};
+typedef struct msg_port_cache_s msg_port_cache_t;
+
+static msg_port_cache_t g_port_cache[CONFIG_MESSAGING_PORT_CACHE_SIZE];
+static sem_t g_port_cache_sem = SEM_INITIALIZER(1);
+static uint32_t g_port_cache_stamp;
+#endif
 /****************************************************************************
  * private functions
  ****************************************************************************/
@@ -50,7 +75,7 @@ static int messaging_set_async_callback(const char *port_name, msg_recv_buf_t *r
 		return ERROR;
 	}
 
-	recv_size = MSG_HEADER_SIZE + recv_data->buflen;
+	recv_size = MSG_QUEUE_MSGSIZE(recv_data->buflen);
 
 	internal_attr.mq_maxmsg = CONFIG_MESSAGING_MAXMSG;
 	internal_attr.mq_msgsize = recv_size;
@@ -89,54 +114,221 @@ static int messaging_set_async_callback(const char *port_name, msg_recv_buf_t *r
 	}
 	return OK;
 }
+#ifdef CONFIG_MESSAGING_PORT_CACHE
 /****************************************************************************
- * Name : messaging_send_packet
- * 
+ * Name : messaging_port_cache_exit
+ *
+ * Description:
+ *  Close the message queues cached by the exiting task group. atexit()
+ *  handlers run in the last thread of the group, so this also covers the
+ *  slots claimed by threads which exited earlier.
+ ****************************************************************************/
+static void messaging_port_cache_exit(void)
+{
+	int slot_idx;
+	msg_port_cache_t *slot;
+	uint32_t my_group;
+
+	if (prctl(PR_GET_GROUP_SERIAL, &my_group) != OK) {
+		return;
+	}
+
+	while (sem_wait(&g_port_cache_sem) != OK) {
+	}
+
+	for (slot_idx = 0; slot_idx < CONFIG_MESSAGING_PORT_CACHE_SIZE; slot_idx++) {
+		slot = &g_port_cache[slot_idx];
+		if (slot->owner == my_group) {
+			if (slot->mqdes != NULL) {
+				mq_close(slot->mqdes);
+			}
+			memset(slot, 0, sizeof(msg_port_cache_t));
+		}
+	}
+
+	sem_post(&g_port_cache_sem);
+}
+/****************************************************************************
+ * Name : messaging_port_cache_get
+ *
  * Description:
- *  This function calls receive function based on receive type.
+ *  Find the cached message queue of a receiver, opening it if it is not
+ *  cached yet or if receivers registered or unregistered since it was
+ *  opened.
+ *
+ * Return Value:
+ *  The slot of the receiver. Its mqdes is NULL if the queue could not be
+ *  opened. NULL is returned if there is no slot for this sender.
+ ****************************************************************************/
+static msg_port_cache_t *messaging_port_cache_get(const char *port_name, pid_t recv_pid, uint32_t gen)
+{
+	int slot_idx;
+	msg_port_cache_t *slot;
+	msg_port_cache_t *found = NULL;
+	msg_port_cache_t *victim = NULL;
+	msg_port_cache_t *free_slot = NULL;
+	bool owns_slot = false;
+	uint32_t my_group;
+	char *private_portname;
+
+	if (strlen(port_name) >= MAX_PORT_NAME_SIZE || prctl(PR_GET_GROUP_SERIAL, &my_group) != OK) {
+		return NULL;
+	}
+
+	while (sem_wait(&g_port_cache_sem) != OK) {
+	}
+
+	for (slot_idx = 0; slot_idx < CONFIG_MESSAGING_PORT_CACHE_SIZE; slot_idx++) {
+		slot = &g_port_cache[slot_idx];
+		if (slot->owner == 0) {
+			if (free_slot == NULL) {
+				free_slot = slot;
+			}
+			continue;
+		}
+
+		if (slot->owner != my_group) {
+			continue;
+		}
+
+		owns_slot = true;
+		if (slot->recv_pid == recv_pid && strncmp(slot->name, port_name, MAX_PORT_NAME_SIZE) == 0) {
+			found = slot;
+			break;
+		}
+
+		if (victim == NULL || (int32_t)(slot->stamp - victim->stamp) < 0) {
+			victim = slot;
+		}
+	}
+
+	if (found != NULL) {
+		if (found->mqdes != NULL && found->gen == gen) {
+			found->stamp = ++g_port_cache_stamp;
+			sem_post(&g_port_cache_sem);
+			return found;
+		}
+		slot = found;
+	} else if (free_slot != NULL) {
+		/* The slots of a group are released when the group exits. */
+		if (!owns_slot && atexit(messaging_port_cache_exit) != OK) {
+			sem_post(&g_port_cache_sem);
+			return NULL;
+		}
+		slot = free_slot;
+		slot->owner = my_group;
+	} else if (victim != NULL) {
+		slot = victim;
+	} else {
+		sem_post(&g_port_cache_sem);
+		return NULL;
+	}
+
+	if (slot->mqdes != NULL) {
+		mq_close(slot->mqdes);
+		slot->mqdes = NULL;
+	}
+
+	slot->recv_pid = recv_pid;
+	slot->gen = gen;
+	slot->stamp = ++g_port_cache_stamp;
+	strncpy(slot->name, port_name, MAX_PORT_NAME_SIZE);
+
+	MSG_ASPRINTF(&private_portname, "%s%d", port_name, recv_pid);
+	if (private_portname != NULL) {
+		slot->mqdes = mq_open(private_portname, O_WRONLY);
+		if (slot->mqdes == (mqd_t)ERROR) {
+			msgdbg("[Messaging] send fail : open fail, errno %d.\n", errno);
+			slot->mqdes = NULL;
+		}
+		MSG_FREE(private_portname);
+	}
+
+	sem_post(&g_port_cache_sem);
+	return slot;
+}
+#endif
+/****************************************************************************
+ * Name : messaging_mq_send
+ *
+ * Description:
+ *  Send a packet to an open message queue. A receiver which gets a packet
+ *  referring to a shared message holds a reference to it.
+ ****************************************************************************/
+static int messaging_mq_send(mqd_t mqdes, const char *packet, int packet_size, int priority)
+{
+	int ret;
+#ifdef CONFIG_MESSAGING_SHARED_BUF
+	messaging_shared_buf_t *shared = messaging_get_shared_buf(packet);
+
+	if (shared != NULL) {
+		messaging_ref_shared_buf(shared);
+	}
+#endif
+
+	ret = mq_send(mqdes, packet, packet_size, priority);
+
+#ifdef CONFIG_MESSAGING_SHARED_BUF
+	if (ret != OK && shared != NULL) {
+		messaging_unref_shared_buf(shared);
+	}
+#endif
+	return ret;
+}
+/****************************************************************************
+ * Name : messaging_make_packet
+ *
+ * Description:
+ *  Build the packet for a message. It is built once and sent to every
+ *  receiver.
  *
  * Input Parameters:
- *  port_name : The message port name to send
- *  msg       : The message to be sent
- *  msglen    : The length of message to be sent
- *  priority  : A non-negative integer that specifies the priority of this message
- * 
+ *  msg_type    : The internal type of sending message
+ *  send_data   : The message to be sent
+ *  packet_size : The size of the built packet
+ *
  * Return Value:
- *  On success, 0 (OK) is returned.; On failure, -1 (ERROR) is returned.
+ *  On success, the packet is returned. It should be released with
+ *  messaging_free_packet. On failure, NULL is returned.
  ****************************************************************************/
-int messaging_send_packet(const char *port_name, msg_send_type_t msg_type, msg_send_data_t *send_data, msg_callback_info_t *cb_info)
+char *messaging_make_packet(msg_send_type_t msg_type, msg_send_data_t *send_data, int *packet_size)
 {
-	int ret = OK;
-	mqd_t mqdes;
-	struct mq_attr internal_attr;
 	char *send_packet;
 	int send_size;
 	uint32_t send_type;
 	uint32_t msg_offset;
 	uint32_t msg_version;
+#ifdef CONFIG_MESSAGING_SHARED_BUF
+	messaging_shared_buf_t *shared = NULL;
 
-	send_size = MSG_HEADER_SIZE + send_data->msglen;
-
-	internal_attr.mq_maxmsg = CONFIG_MESSAGING_MAXMSG;
-	internal_attr.mq_msgsize = send_size;
-	internal_attr.mq_flags = 0;
-
-	mqdes = mq_open(port_name, O_WRONLY, 0666, &internal_attr);
-	if (mqdes == (mqd_t)ERROR) {
-		if (errno == ENOENT) {
-			msgdbg("[Messagmemcpying] send fail : no receiver.\n");
-		} else {
-			msgdbg("[Messaging] send fail : open fail, errno %d.\n", errno);
+	if (send_data->msglen > CONFIG_MESSAGING_SHARED_BUF_THRESHOLD) {
+		/* Large messages are copied once to a shared buffer and only the
+		 * reference is sent. The reference of the sender is dropped by
+		 * messaging_free_packet.
+		 */
+		shared = (messaging_shared_buf_t *)MSG_ALLOC(sizeof(messaging_shared_buf_t) + send_data->msglen);
+		if (shared == NULL) {
+			msgdbg("[Messaging] send fail : out of memory for shared message.\n");
+			return NULL;
 		}
-		return ERROR;
+		shared->refs = 1;
+		shared->len = send_data->msglen;
+		memcpy(shared->data, send_data->msg, send_data->msglen);
+
+		send_size = MSG_HEADER_SIZE + sizeof(messaging_shared_buf_t *);
+	} else
+#endif
+	{
+		send_size = MSG_HEADER_SIZE + send_data->msglen;
 	}
 
 	send_packet = (char *)MSG_ALLOC(send_size);
 	if (send_packet == NULL) {
 		msgdbg("[Messaging] send fail : out of memory for including header.\n");
-		mq_close(mqdes);
-		mq_unlink(port_name);
-		return ERROR;
+#ifdef CONFIG_MESSAGING_SHARED_BUF
+		MSG_FREE(shared);
+#endif
+		return NULL;
 	}
 
 	/* Send packet(version 1) is like below.
@@ -162,22 +354,121 @@ int messaging_send_packet(const char *port_name, msg_send_type_t msg_type, msg_s
 	} else {
 		send_type = MSG_REPLY_REQUIRED;
 	}
+
+#ifdef CONFIG_MESSAGING_SHARED_BUF
+	if (shared != NULL) {
+		/* The message field holds the reference instead of the message. */
+		((messaging_packet_t *)send_packet)->msg_type = send_type | MSG_TYPE_SHARED_BUF;
+		memcpy(send_packet + msg_offset, &shared, sizeof(messaging_shared_buf_t *));
+		*packet_size = send_size;
+		return send_packet;
+	}
+#endif
 	((messaging_packet_t *)send_packet)->msg_type = send_type;
 
 	/* Copy the real send message. */
 	memcpy(send_packet + msg_offset, send_data->msg, send_data->msglen);
 
-	ret = mq_send(mqdes, (char *)send_packet, send_size, send_data->priority);
+	*packet_size = send_size;
+	return send_packet;
+}
+/****************************************************************************
+ * Name : messaging_free_packet
+ *
+ * Description:
+ *  Release a packet built by messaging_make_packet.
+ ****************************************************************************/
+void messaging_free_packet(char *packet)
+{
+#ifdef CONFIG_MESSAGING_SHARED_BUF
+	messaging_shared_buf_t *shared = messaging_get_shared_buf(packet);
+
+	if (shared != NULL) {
+		messaging_unref_shared_buf(shared);
+	}
+#endif
+	MSG_FREE(packet);
+}
+/****************************************************************************
+ * Name : messaging_send_packet
+ * 
+ * Description:
+ *  This function opens the message port, sends the packet and closes it.
+ *
+ * Input Parameters:
+ *  port_name   : The message port name to send
+ *  packet      : The packet built by messaging_make_packet
+ *  packet_size : The size of the packet
+ *  priority    : A non-negative integer that specifies the priority of this message
+ * 
+ * Return Value:
+ *  On success, 0 (OK) is returned.; On failure, -1 (ERROR) is returned.
+ ****************************************************************************/
+int messaging_send_packet(const char *port_name, const char *packet, int packet_size, int priority)
+{
+	int ret;
+	mqd_t mqdes;
+
+	mqdes = mq_open(port_name, O_WRONLY);
+	if (mqdes == (mqd_t)ERROR) {
+		if (errno == ENOENT) {
+			msgdbg("[Messaging] send fail : no receiver.\n");
+		} else {
+			msgdbg("[Messaging] send fail : open fail, errno %d.\n", errno);
+		}
+		return ERROR;
+	}
+
+	ret = messaging_mq_send(mqdes, packet, packet_size, priority);
 	if (ret != OK) {
 		msgdbg("[Messaging] send fail : errno %d.\n", errno);
-		MSG_FREE(send_packet);
 		mq_close(mqdes);
 		mq_unlink(port_name);
 		return ERROR;
 	}
 
-	MSG_FREE(send_packet);
 	mq_close(mqdes);
+	return OK;
+}
+/****************************************************************************
+ * Name : messaging_send_receiver
+ *
+ * Description:
+ *  Send a packet to the private message port of one receiver, through the
+ *  cached message queue of the receiver if there is one.
+ ****************************************************************************/
+static int messaging_send_receiver(const char *port_name, pid_t recv_pid, uint32_t gen, const char *packet, int packet_size, int priority)
+{
+	int ret;
+	char *private_portname;
+#ifdef CONFIG_MESSAGING_PORT_CACHE
+	msg_port_cache_t *slot;
+
+	slot = messaging_port_cache_get(port_name, recv_pid, gen);
+	if (slot != NULL) {
+		if (slot->mqdes == NULL) {
+			return ERROR;
+		}
+
+		ret = messaging_mq_send(slot->mqdes, packet, packet_size, priority);
+		if (ret != OK) {
+			/* Reopen the queue on the next send. */
+			msgdbg("[Messaging] send fail : errno %d.\n", errno);
+			mq_close(slot->mqdes);
+			slot->mqdes = NULL;
+			return ERROR;
+		}
+		return OK;
+	}
+#endif
+
+	MSG_ASPRINTF(&private_portname, "%s%d", port_name, recv_pid);
+	if (private_portname == NULL) {
+		msgdbg("[Messaging] send fail : out of memory for private portname.\n");
+		return ERROR;
+	}
+	ret = messaging_send_packet(private_portname, packet, packet_size, priority);
+	MSG_FREE(private_portname);
 	return ret;
 }
 
@@ -193,6 +484,7 @@ static void messaging_init_recv_arr(int *arr)
  * 
  * Description:
  *  This function checks how many receivers are waiting and send message to them.
+ *  The packet is built once and shared by all of the receivers.
  *
  * Input Parameters:
  *  port_name : The message port name to send
@@ -210,20 +502,24 @@ int messaging_send_internal(const char *port_name, msg_send_type_t msg_type, msg
 	int ret = ERROR;
 	int read_status = MSG_READ_YET;
 	int recv_arr[CONFIG_MESSAGING_RECV_LIST_SIZE];
-	char *private_portname;
 	int recv_cnt;
+	uint32_t gen = 0;
+	char *send_packet = NULL;
+	int send_size = 0;
 
 	/* Check that how many receivers are waiting. */
 	while (read_status != MSG_READ_ALL) {
 		(void)messaging_init_recv_arr(recv_arr);
-		read_status = READ_MSG_RECEIVER(port_name, recv_arr, recv_cnt);
+		read_status = READ_MSG_RECEIVER(port_name, recv_arr, recv_cnt, gen);
 		if (read_status == ERROR) {
-			return ERROR;
+			ret = ERROR;
+			goto errout;
 		}
 
 		if (msg_type != MSG_SEND_MULTI && recv_cnt > 1) {
 			msgdbg("[Messaging] send fail : too many receivers(%d)are waiting.\n", recv_cnt);
-			return ERROR;
+			ret = ERROR;
+			goto errout;
 		}
 
 		/* Send message to each receivers. */
@@ -231,26 +527,26 @@ int messaging_send_internal(const char *port_name, msg_send_type_t msg_type, msg
 			if (recv_arr[recv_idx] == MSG_RECV_NOT_INIT) {
 				continue;
 			}
-			MSG_ASPRINTF(&private_portname, "%s%d", port_name, recv_arr[recv_idx]);
-			if (private_portname == NULL) {
-				msgdbg("[Messaging] send fail : out of memory for private portname.\n");
-				return ERROR;
+			if (send_packet == NULL) {
+				send_packet = messaging_make_packet(msg_type, send_data, &send_size);
+				if (send_packet == NULL) {
+					return ERROR;
+				}
 			}
-			if (msg_type == MSG_SEND_ASYNC) {
-				if (recv_cnt == 1) {
-					ret = messaging_set_async_callback(port_name, recv_data, cb_info);
-					if (ret != OK) {
-						MSG_FREE(private_portname);
-						return ERROR;
-					}
+			if (msg_type == MSG_SEND_ASYNC && recv_cnt == 1) {
+				ret = messaging_set_async_callback(port_name, recv_data, cb_info);
+				if (ret != OK) {
+					goto errout;
 				}
-				ret = messaging_send_packet(private_portname, msg_type, send_data, cb_info);
-			} else {
-				ret = messaging_send_packet(private_portname, msg_type, send_data, NULL);
 			}
-			MSG_FREE(private_portname);
+			ret = messaging_send_receiver(port_name, recv_arr[recv_idx], gen, send_packet, send_size, send_data->priority);
 		}
 	}
+
+errout:
+	if (send_packet != NULL) {
+		messaging_free_packet(send_packet);
+	}
 	if (ret == OK) {
 		return recv_cnt;
 	}
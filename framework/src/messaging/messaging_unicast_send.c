@@ -57,10 +57,10 @@ static int messaging_sync_recv(const char *port_name, msg_recv_buf_t *reply_buf)
 	int reply_size;
 	int msg_type;
 
-	reply_size = reply_buf->buflen + MSG_HEADER_SIZE;
+	reply_size = MSG_PACKET_SIZE(reply_buf->buflen);
 
 	internal_attr.mq_maxmsg = CONFIG_MESSAGING_MAXMSG;
-	internal_attr.mq_msgsize = reply_size;
+	internal_attr.mq_msgsize = MSG_QUEUE_MSGSIZE(reply_buf->buflen);
 	internal_attr.mq_flags = 0;
 
 	/* sender waits the reply with "port_name + sender_pid + _r". */
@@ -198,6 +198,8 @@ int messaging_reply(const char *port_name, pid_t sender_pid, msg_send_data_t *re
 	int ret = OK;
 	char *reply_portname;
 	msg_send_data_t reply;
+	char *reply_packet;
+	int reply_size;
 
 	if (port_name == NULL || sender_pid < 0 || reply_data == NULL || reply_data->msg == NULL || reply_data->msglen <= 0) {
 		msgdbg("[Messaging] unicast reply fail : invalid param.\n");
@@ -214,7 +216,13 @@ int messaging_reply(const char *port_name, pid_t sender_pid, msg_send_data_t *re
 	reply.msg = reply_data->msg;
 	reply.msglen = reply_data->msglen;
 	reply.priority = MSG_REPLY_PRIO;
-	ret = messaging_send_packet(reply_portname, MSG_SEND_REPLY, &reply, NULL);
+	reply_packet = messaging_make_packet(MSG_SEND_REPLY, &reply, &reply_size);
+	if (reply_packet == NULL) {
+		MSG_FREE(reply_portname);
+		return ERROR;
+	}
+	ret = messaging_send_packet(reply_portname, reply_packet, reply_size, reply.priority);
+	messaging_free_packet(reply_packet);
 	MSG_FREE(reply_portname);
 	return ret;
 }
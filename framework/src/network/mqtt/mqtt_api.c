@@ -108,26 +108,19 @@ static void on_disconnect_callback(struct mosquitto *client, void *data, int res
 static void on_message_callback(struct mosquitto *client, void *data, const struct mosquitto_message *msg)
 {
 	mqtt_client_t *mqtt_client = (mqtt_client_t *)data;
-	mqtt_msg_t *received_msg;
+	mqtt_msg_t received_msg;
 
-	received_msg = (mqtt_msg_t *)_mosquitto_malloc(sizeof(mqtt_msg_t));
-	if (!received_msg) {
-		ndbg("ERROR: received_msg is null.");
-		return;
-	}
-
-	received_msg->msg_id = msg->mid;
-	received_msg->topic = msg->topic;
-	received_msg->payload = msg->payload;
-	received_msg->payload_len = msg->payloadlen;
-	received_msg->qos = msg->qos;
-	received_msg->retain = msg->retain;
+	/* The message is only valid during the callback, it needs no copy */
+	received_msg.msg_id = msg->mid;
+	received_msg.topic = msg->topic;
+	received_msg.payload = msg->payload;
+	received_msg.payload_len = msg->payloadlen;
+	received_msg.qos = msg->qos;
+	received_msg.retain = msg->retain;
 
 	if (mqtt_client && mqtt_client->config && mqtt_client->config->on_message) {
-		mqtt_client->config->on_message(mqtt_client, received_msg);
+		mqtt_client->config->on_message(mqtt_client, &received_msg);
 	}
-
-	_mosquitto_free(received_msg);
 }
 
 static void on_publish_callback(struct mosquitto *client, void *data, int msg_id)
@@ -556,6 +549,97 @@ done:
 	return result;
 }
 
+/****************************************************************************
+ * Name: mqtt_publish_batch
+ *
+ * Description:
+ *	 Publish several messages to MQTT Broker at once.  The messages are
+ *	 written together, so that small messages share socket writes.
+ *
+ * Parameters:
+ *     handle : the handle of MQTT client object
+ *     msgs : the messages to publish. msg_id is set for each message published.
+ *     count : the number of messages
+ *
+ * Returned Value:
+ *	 On success, 0 is returned. On failure, a negative value is returned.
+ *
+ ****************************************************************************/
+int mqtt_publish_batch(mqtt_client_t *handle, mqtt_msg_t *msgs, int count)
+{
+	int result = -1;
+	int ret = 0;
+	int i;
+	struct mosquitto *mosq = NULL;
+	struct mosquitto_message *batch = NULL;
+
+	if (handle == NULL) {
+		ndbg("ERROR: mqtt_client handle is null.\n");
+		goto done;
+	}
+
+	mosq = (struct mosquitto *)handle->mosq;
+	if (mosq == NULL) {
+		ndbg("ERROR: mosquitto handle is null.\n");
+		goto done;
+	}
+
+	if (handle->state == MQTT_CLIENT_STATE_NOT_CONNECTED) {
+		ndbg("ERROR: mqtt_client is disconnected.\n");
+		goto done;
+	}
+
+	if (handle->state > MQTT_CLIENT_STATE_CONNECTED) {
+		char state_str[20];
+		get_mqtt_client_state_string(handle->state, state_str);
+		ndbg("ERROR: mqtt_client is busy. (current state: %s)\n", state_str);
+		goto done;
+	}
+
+	if (msgs == NULL || count <= 0) {
+		ndbg("ERROR: no message to publish.\n");
+		goto done;
+	}
+
+	batch = (struct mosquitto_message *)_mosquitto_malloc(sizeof(struct mosquitto_message) * count);
+	if (batch == NULL) {
+		ndbg("ERROR: out of memory.\n");
+		goto done;
+	}
+
+	for (i = 0; i < count; i++) {
+		if (msgs[i].topic == NULL || msgs[i].qos < 0 || msgs[i].qos > 2) {
+			ndbg("ERROR: invalid message %d.\n", i);
+			goto done;
+		}
+		batch[i].mid = 0;
+		batch[i].topic = msgs[i].topic;
+		batch[i].payload = msgs[i].payload;
+		batch[i].payloadlen = msgs[i].payload_len;
+		batch[i].qos = msgs[i].qos;
+		batch[i].retain = msgs[i].retain != 0 ? true : false;
+	}
+
+	ret = mosquitto_publish_batch(mosq, batch, count);
+	for (i = 0; i < count; i++) {
+		msgs[i].msg_id = batch[i].mid;
+	}
+	if (ret != 0) {
+		ndbg("ERROR: mosquitto_publish_batch() failed. (ret: %d)\n", ret);
+		handle->state = MQTT_CLIENT_STATE_CONNECTED;
+		goto done;
+	}
+
+	/* result is success */
+	result = 0;
+
+done:
+	if (batch) {
+		_mosquitto_free(batch);
+	}
+	return result;
+}
+
 /****************************************************************************
  * Name: mqtt_subscribe
  *
@@ -23,6 +23,10 @@
 #include <stdlib.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <stdbool.h>
+#ifdef CONFIG_SECURITY_LINK_BATCH_ASYNC
+#include <pthread.h>
+#endif
 #ifndef LINUX
 #include <debug.h>
 #endif
@@ -116,6 +120,34 @@ static const hal_result_e g_hal_res_table[] = {
  */
 struct _seclink_s_ {
 	int fd;
+#ifdef CONFIG_SECURITY_LINK_BATCH_ASYNC
+	/*  completion queue of sl_batch_submit_async() */
+	pthread_t worker;
+	bool worker_running;
+	bool worker_stop;
+	pthread_mutex_t lock;
+	pthread_cond_t pending_cond;
+	pthread_cond_t done_cond;
+	struct _seclink_batch_s_ *pending;
+	struct _seclink_batch_s_ *done;
+	uint32_t inflight;
+#endif
+};
+
+union _seclink_batch_info_ {
+	struct seclink_crypto_info crypto;
+	struct seclink_auth_info auth;
+	struct seclink_ss_info ss;
+};
+
+struct _seclink_batch_s_ {
+	struct _seclink_s_ *sl;
+	struct seclink_batch_req breq;
+	union _seclink_batch_info_ *info;
+	uint32_t max_ops;
+	int res;
+	bool queued;
+	struct _seclink_batch_s_ *next;
 };
 
 static inline int _sl_convert_res(hal_result_e res)
@@ -148,6 +180,16 @@ int sl_init(sl_ctx *hnd)
 		return SECLINK_ERROR;
 	}
 	handle->fd = fd;
+#ifdef CONFIG_SECURITY_LINK_BATCH_ASYNC
+	handle->worker_running = false;
+	handle->worker_stop = false;
+	handle->pending = NULL;
+	handle->done = NULL;
+	handle->inflight = 0;
+	pthread_mutex_init(&handle->lock, NULL);
+	pthread_cond_init(&handle->pending_cond, NULL);
+	pthread_cond_init(&handle->done_cond, NULL);
+#endif
 
 	struct seclink_req req = {.req_type.comm = NULL, 0};
 	SL_CALL2(handle, SECLINKIOC_INIT, req, SL_FREE_HANDLE(handle));
@@ -171,6 +213,27 @@ int sl_deinit(sl_ctx hnd)
 	}
 	struct _seclink_s_ *sl = (struct _seclink_s_ *)hnd;
 
+#ifdef CONFIG_SECURITY_LINK_BATCH_ASYNC
+	/*  queued batches refer to the handle until sl_batch_wait() returns them */
+	pthread_mutex_lock(&sl->lock);
+	if (sl->inflight != 0) {
+		pthread_mutex_unlock(&sl->lock);
+		return SECLINK_BUSY;
+	}
+	pthread_mutex_unlock(&sl->lock);
+
+	if (sl->worker_running) {
+		pthread_mutex_lock(&sl->lock);
+		sl->worker_stop = true;
+		pthread_cond_signal(&sl->pending_cond);
+		pthread_mutex_unlock(&sl->lock);
+		pthread_join(sl->worker, NULL);
+	}
+	pthread_cond_destroy(&sl->done_cond);
+	pthread_cond_destroy(&sl->pending_cond);
+	pthread_mutex_destroy(&sl->lock);
+#endif
+
 	struct seclink_req req = {.req_type.comm = NULL, 0};
 	SL_CALL_NORET(sl, SECLINKIOC_DEINIT, req);
 	if (req.res != HAL_SUCCESS) {
@@ -610,6 +673,360 @@ int sl_delete_storage(sl_ctx hnd, uint32_t ss_idx)
 	return _sl_convert_res(req.res);
 }
 
+/*  Batch */
+#define SL_CHECK_BATCH(batch)                                            \
+	do {                                                                 \
+		if (!batch || !((struct _seclink_batch_s_ *)batch)->sl) {        \
+			return SECLINK_INVALID_ARGS;                                 \
+		}                                                                \
+		if (_sl_batch_queued((struct _seclink_batch_s_ *)batch)) {       \
+			return SECLINK_BUSY;                                         \
+		}                                                                \
+	} while (0)
+
+/*  The worker of sl_batch_submit_async() updates queued under sl->lock */
+static bool _sl_batch_queued(struct _seclink_batch_s_ *batch)
+{
+#ifdef CONFIG_SECURITY_LINK_BATCH_ASYNC
+	bool queued;
+
+	pthread_mutex_lock(&batch->sl->lock);
+	queued = batch->queued;
+	pthread_mutex_unlock(&batch->sl->lock);
+	return queued;
+#else
+	return batch->queued;
+#endif
+}
+
+/*  Append a request to the batch and return the information of it */
+static union _seclink_batch_info_ *_sl_batch_add(struct _seclink_batch_s_ *batch, int cmd)
+{
+	if (batch->breq.nops >= batch->max_ops) {
+		return NULL;
+	}
+
+	struct seclink_batch_op *op = &batch->breq.ops[batch->breq.nops];
+	union _seclink_batch_info_ *info = &batch->info[batch->breq.nops];
+
+	memset(op, 0, sizeof(struct seclink_batch_op));
+	memset(info, 0, sizeof(union _seclink_batch_info_));
+	op->cmd = cmd;
+	batch->breq.nops++;
+
+	return info;
+}
+
+#define SL_BATCH_ADD(batch, cmd, type, info)                             \
+	do {                                                                 \
+		SL_CHECK_BATCH(batch);                                           \
+		info = _sl_batch_add(batch, cmd);                                \
+		if (!info) {                                                     \
+			return SECLINK_NOT_ENOUGH_MEMORY;                            \
+		}                                                                \
+		batch->breq.ops[batch->breq.nops - 1].req.req_type.type =        \
+			&info->type;                                                 \
+	} while (0)
+
+static int _sl_batch_result(struct _seclink_batch_s_ *batch, uint32_t op)
+{
+	if (op >= batch->breq.ndone) {
+		/*  the driver did not run the request */
+		return SECLINK_INVALID_REQUEST;
+	}
+
+	return _sl_convert_res(batch->breq.ops[op].req.res);
+}
+
+static int _sl_batch_run(struct _seclink_batch_s_ *batch)
+{
+	struct _seclink_s_ *sl = batch->sl;
+
+	batch->breq.ndone = 0;
+	int i_res = ioctl(sl->fd, SECLINKIOC_BATCH, (unsigned long)((uintptr_t)&batch->breq));
+	if (i_res < 0) {
+		SL_ERR(i_res);
+	}
+
+	for (uint32_t i = 0; i < batch->breq.nops; i++) {
+		int res = _sl_batch_result(batch, i);
+		if (res != SECLINK_OK) {
+			return res;
+		}
+	}
+
+	return SECLINK_OK;
+}
+
+int sl_batch_create(sl_ctx hnd, uint32_t max_ops, _OUT_ sl_batch *batch)
+{
+	SL_CHECK_VALID(hnd);
+	SLC_LOGI(TAG, "--> hnd(%p) max ops(%d)\n", hnd, max_ops);
+
+	if (!batch || max_ops == 0) {
+		return SECLINK_INVALID_ARGS;
+	}
+
+	struct _seclink_batch_s_ *b = (struct _seclink_batch_s_ *)malloc(sizeof(struct _seclink_batch_s_)
+			+ max_ops * (sizeof(union _seclink_batch_info_) + sizeof(struct seclink_batch_op)));
+	if (!b) {
+		return SECLINK_NOT_ENOUGH_MEMORY;
+	}
+
+	/*  the requests and their information follow the batch */
+	b->info = (union _seclink_batch_info_ *)(b + 1);
+	b->breq.ops = (struct seclink_batch_op *)(b->info + max_ops);
+	b->breq.nops = 0;
+	b->breq.ndone = 0;
+	b->sl = (struct _seclink_s_ *)hnd;
+	b->max_ops = max_ops;
+	b->res = SECLINK_OK;
+	b->queued = false;
+	b->next = NULL;
+
+	*batch = b;
+	return SECLINK_OK;
+}
+
+int sl_batch_destroy(sl_batch batch)
+{
+	SL_CHECK_BATCH(batch);
+
+	free(batch);
+	return SECLINK_OK;
+}
+
+int sl_batch_reset(sl_batch batch)
+{
+	SL_CHECK_BATCH(batch);
+
+	batch->breq.nops = 0;
+	batch->breq.ndone = 0;
+	return SECLINK_OK;
+}
+
+int sl_batch_aes_encrypt(sl_batch batch, hal_data *dec_data, hal_aes_param *aes_param, uint32_t key_idx, _OUT_ hal_data *enc_data)
+{
+	union _seclink_batch_info_ *info;
+
+	SL_BATCH_ADD(batch, SECLINKIOC_AESENCRYPT, crypto, info);
+	info->crypto.key_idx = key_idx;
+	info->crypto.input = dec_data;
+	info->crypto.output = enc_data;
+	info->crypto.aes_param = aes_param;
+	return SECLINK_OK;
+}
+
+int sl_batch_aes_decrypt(sl_batch batch, hal_data *enc_data, hal_aes_param *aes_param, uint32_t key_idx, _OUT_ hal_data *dec_data)
+{
+	union _seclink_batch_info_ *info;
+
+	SL_BATCH_ADD(batch, SECLINKIOC_AESDECRYPT, crypto, info);
+	info->crypto.key_idx = key_idx;
+	info->crypto.input = enc_data;
+	info->crypto.output = dec_data;
+	info->crypto.aes_param = aes_param;
+	return SECLINK_OK;
+}
+
+int sl_batch_get_hash(sl_batch batch, hal_hash_type mode, hal_data *input, _OUT_ hal_data *hash)
+{
+	union _seclink_batch_info_ *info;
+
+	SL_BATCH_ADD(batch, SECLINKIOC_GETHASH, auth, info);
+	info->auth.auth_type.hash_type = mode;
+	info->auth.key_idx = -1;
+	info->auth.data = input;
+	info->auth.auth_data.data = hash;
+	return SECLINK_OK;
+}
+
+int sl_batch_get_hmac(sl_batch batch, hal_hmac_type mode, hal_data *input, uint32_t key_idx, _OUT_ hal_data *hmac)
+{
+	union _seclink_batch_info_ *info;
+
+	SL_BATCH_ADD(batch, SECLINKIOC_GETHMAC, auth, info);
+	info->auth.auth_type.hmac_type = mode;
+	info->auth.key_idx = key_idx;
+	info->auth.data = input;
+	info->auth.auth_data.data = hmac;
+	return SECLINK_OK;
+}
+
+int sl_batch_ecdsa_sign_md(sl_batch batch, hal_ecdsa_mode mode, hal_data *hash, uint32_t key_idx, _OUT_ hal_data *sign)
+{
+	union _seclink_batch_info_ *info;
+
+	SL_BATCH_ADD(batch, SECLINKIOC_ECDSASIGNMD, auth, info);
+	info->auth.auth_type.ecdsa_type = mode;
+	info->auth.key_idx = key_idx;
+	info->auth.data = hash;
+	info->auth.auth_data.data = sign;
+	return SECLINK_OK;
+}
+
+int sl_batch_ecdsa_verify_md(sl_batch batch, hal_ecdsa_mode mode, hal_data *hash, hal_data *sign, uint32_t key_idx)
+{
+	union _seclink_batch_info_ *info;
+
+	SL_BATCH_ADD(batch, SECLINKIOC_ECDSAVERIFYMD, auth, info);
+	info->auth.auth_type.ecdsa_type = mode;
+	info->auth.key_idx = key_idx;
+	info->auth.data = hash;
+	info->auth.auth_data.data = sign;
+	return SECLINK_OK;
+}
+
+int sl_batch_write_storage(sl_batch batch, uint32_t ss_idx, hal_data *data)
+{
+	union _seclink_batch_info_ *info;
+
+	SL_BATCH_ADD(batch, SECLINKIOC_WRITESTORAGE, ss, info);
+	info->ss.key_idx = ss_idx;
+	info->ss.data = data;
+	return SECLINK_OK;
+}
+
+int sl_batch_read_storage(sl_batch batch, uint32_t ss_idx, _OUT_ hal_data *data)
+{
+	union _seclink_batch_info_ *info;
+
+	SL_BATCH_ADD(batch, SECLINKIOC_READSTORAGE, ss, info);
+	info->ss.key_idx = ss_idx;
+	info->ss.data = data;
+	return SECLINK_OK;
+}
+
+int sl_batch_submit(sl_batch batch)
+{
+	SL_CHECK_BATCH(batch);
+	SL_CHECK_VALID(batch->sl);
+	SLC_LOGI(TAG, "--> hnd(%p) ops(%d)\n", batch->sl, batch->breq.nops);
+
+	batch->res = _sl_batch_run(batch);
+	return batch->res;
+}
+
+int sl_batch_get_result(sl_batch batch, uint32_t op)
+{
+	if (!batch || !batch->sl || op >= batch->breq.nops) {
+		return SECLINK_INVALID_ARGS;
+	}
+
+	if (_sl_batch_queued(batch)) {
+		/*  the worker may still be running it */
+		return SECLINK_BUSY;
+	}
+
+	return _sl_batch_result(batch, op);
+}
+
+#ifdef CONFIG_SECURITY_LINK_BATCH_ASYNC
+static void *_sl_batch_worker(void *arg)
+{
+	struct _seclink_s_ *sl = (struct _seclink_s_ *)arg;
+	struct _seclink_batch_s_ *batch;
+	struct _seclink_batch_s_ **tail;
+
+	pthread_mutex_lock(&sl->lock);
+	for (;;) {
+		while (!sl->pending && !sl->worker_stop) {
+			pthread_cond_wait(&sl->pending_cond, &sl->lock);
+		}
+		if (!sl->pending) {
+			break;
+		}
+
+		batch = sl->pending;
+		sl->pending = batch->next;
+		pthread_mutex_unlock(&sl->lock);
+
+		batch->res = _sl_batch_run(batch);
+
+		pthread_mutex_lock(&sl->lock);
+		batch->next = NULL;
+		for (tail = &sl->done; *tail; tail = &(*tail)->next) {
+		}
+		*tail = batch;
+		pthread_cond_signal(&sl->done_cond);
+	}
+	pthread_mutex_unlock(&sl->lock);
+
+	return NULL;
+}
+
+int sl_batch_submit_async(sl_batch batch)
+{
+	SL_CHECK_BATCH(batch);
+	SL_CHECK_VALID(batch->sl);
+	SLC_LOGI(TAG, "--> hnd(%p) ops(%d)\n", batch->sl, batch->breq.nops);
+
+	struct _seclink_s_ *sl = batch->sl;
+	struct _seclink_batch_s_ **tail;
+	pthread_attr_t attr;
+	int res = SECLINK_OK;
+
+	pthread_mutex_lock(&sl->lock);
+	if (!sl->worker_running) {
+		pthread_attr_init(&attr);
+#ifndef LINUX
+		pthread_attr_setstacksize(&attr, CONFIG_SECURITY_LINK_BATCH_ASYNC_STACKSIZE);
+#endif
+		if (pthread_create(&sl->worker, &attr, _sl_batch_worker, sl) != 0) {
+			res = SECLINK_ERROR;
+		} else {
+			sl->worker_running = true;
+		}
+		pthread_attr_destroy(&attr);
+	}
+
+	if (res == SECLINK_OK) {
+		batch->queued = true;
+		batch->next = NULL;
+		for (tail = &sl->pending; *tail; tail = &(*tail)->next) {
+		}
+		*tail = batch;
+		sl->inflight++;
+		pthread_cond_signal(&sl->pending_cond);
+	}
+	pthread_mutex_unlock(&sl->lock);
+
+	return res;
+}
+
+int sl_batch_wait(sl_ctx hnd, _OUT_ sl_batch *batch)
+{
+	SL_CHECK_VALID(hnd);
+
+	struct _seclink_s_ *sl = (struct _seclink_s_ *)hnd;
+	struct _seclink_batch_s_ *b;
+
+	if (!batch) {
+		return SECLINK_INVALID_ARGS;
+	}
+
+	pthread_mutex_lock(&sl->lock);
+	if (sl->inflight == 0) {
+		/*  nothing to wait for */
+		pthread_mutex_unlock(&sl->lock);
+		return SECLINK_INVALID_REQUEST;
+	}
+
+	while (!sl->done) {
+		pthread_cond_wait(&sl->done_cond, &sl->lock);
+	}
+	b = sl->done;
+	sl->done = b->next;
+	sl->inflight--;
+	b->next = NULL;
+	b->queued = false;
+	pthread_mutex_unlock(&sl->lock);
+
+	*batch = b;
+	return b->res;
+}
+#endif
+
 char *sl_strerror(int error)
 {
 	switch (error) {
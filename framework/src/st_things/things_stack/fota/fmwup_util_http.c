@@ -265,18 +265,31 @@ int fmwup_http_download_file(const char *download_url)
 	download_state = FOTA_DOWNLOAD_STATE_BINARY;
 
 
-	cJSON *root = cJSON_Parse((const char *)json_str);
+	/* The URL is only read, so parse in place into one block */
+	size_t arena_size = cJSON_GetArenaSize(json_str);
+	char *arena_buf = (char *)things_malloc(arena_size);
+	cJSON_Arena arena;
+
+	cJSON_InitArena(&arena, arena_buf, arena_size);
+	cJSON *root = cJSON_ParseInArena(&arena, json_str);
 	cJSON *url = cJSON_GetObjectItem(root, KEY_URL);
 	recv_size = 0;
 
 	is_link_fail = false;
 
+	if (url == NULL || url->valuestring == NULL) {
+		THINGS_LOG_E(TAG, "no %s in the json", KEY_URL);
+		things_free(arena_buf);
+		fotahal_close(fotahal_handle);
+		things_free(json_str);
+		download_state = FOTA_DOWNLOAD_STATE_NONE;
+		return -1;
+	}
+
 	if (wget_from_url(url->valuestring) < 0) {
 		THINGS_LOG_E(TAG, "wget_from_url error");
 
-		if (root != NULL) {
-			cJSON_Delete(root);
-		}
+		things_free(arena_buf);
 		fotahal_erase(fotahal_handle);
 		fotahal_close(fotahal_handle);
 		things_free(json_str);
@@ -285,6 +298,7 @@ int fmwup_http_download_file(const char *download_url)
 	}
 
 	if (is_link_fail) {
+		things_free(arena_buf);
 		things_free(json_str);
 		fotahal_erase(fotahal_handle);
 		fotahal_close(fotahal_handle);
@@ -296,6 +310,7 @@ int fmwup_http_download_file(const char *download_url)
 
 	if (recv_size != total_size) {
 		THINGS_LOG_E(TAG, "[recv:BINARY] file size error");
+		things_free(arena_buf);
 		fotahal_erase(fotahal_handle);
 		fotahal_close(fotahal_handle);
 		things_free(json_str);
@@ -303,9 +318,7 @@ int fmwup_http_download_file(const char *download_url)
 		return -1;
 	}
 
-	if (root != NULL) {
-		cJSON_Delete(root);
-	}
+	things_free(arena_buf);
 	things_free(json_str);
 
 	download_state = FOTA_DOWNLOAD_STATE_DONE;
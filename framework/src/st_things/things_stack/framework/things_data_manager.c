@@ -1760,10 +1760,17 @@ static int parse_things_info_json(const char *filename)
 	int ret = 0;
 	char *json_str = get_json_string_from_file(filename);
 	cJSON *json_user_root = NULL;
+	cJSON_Arena arena = { NULL, 0, 0 };
 
 	if (json_str != NULL && strlen(json_str) > 0) {
-		// 3. Parse the Json string
-		json_user_root = cJSON_Parse((const char *)json_str);
+		// 3. Parse the Json string in place, the values are copied out of the tree
+		arena.size = cJSON_GetArenaSize(json_str);
+		arena.buffer = things_malloc(arena.size);
+		if (arena.buffer == NULL) {
+			THINGS_LOG_E(TAG, THINGS_MEMORY_ERROR);
+			goto JSON_ERROR;
+		}
+		json_user_root = cJSON_ParseInArena(&arena, json_str);
 		assert(json_user_root != NULL);
 
 		// Device Items
@@ -1806,8 +1813,8 @@ static int parse_things_info_json(const char *filename)
 
 	ret = 1;
 JSON_ERROR:
-	if (json_user_root != NULL) {
-		cJSON_Delete(json_user_root);
+	if (arena.buffer != NULL) {
+		things_free(arena.buffer);
 	}
 
 	if (json_str != NULL) {
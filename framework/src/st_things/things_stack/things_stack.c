@@ -162,6 +162,47 @@ static char *things_make_abs_device_def_path(const char *json_path)
 	return abs_json_path;
 }
 
+#ifdef CONFIG_ST_THINGS_FOTA
+/* Compare the device definition file with deviceDef.  Both are parsed in
+ * place from one buffer holding a writable copy of deviceDef and the arenas
+ * of the two documents, and freed at once.
+ */
+static bool things_device_def_changed(char *json_str)
+{
+	size_t size_d = sizeof(deviceDef);
+	size_t size_h = cJSON_GetArenaSize(deviceDef);
+	size_t size_f = (json_str != NULL) ? cJSON_GetArenaSize(json_str) : 0;
+	cJSON_Arena h_arena;
+	cJSON_Arena f_arena;
+	cJSON *h_root;
+	cJSON *root = NULL;
+	char *buffer;
+	bool changed;
+
+	buffer = (char *)things_malloc(size_d + 1 + size_h + size_f);
+	if (buffer == NULL) {
+		THINGS_LOG_E(TAG, THINGS_MEMORY_ERROR);
+		return true;
+	}
+	memcpy(buffer, deviceDef, size_d);
+	buffer[size_d] = '\0';
+
+	cJSON_InitArena(&h_arena, buffer + size_d + 1, size_h);
+	cJSON_InitArena(&f_arena, buffer + size_d + 1 + size_h, size_f);
+	h_root = cJSON_ParseInArena(&h_arena, buffer);
+	if (json_str != NULL && strlen(json_str) > 0) {
+		root = cJSON_ParseInArena(&f_arena, json_str);
+		if (root == NULL) {
+			THINGS_LOG_D(TAG, "Failed to parse a device resource file");
+		}
+	}
+
+	changed = !cJSON_Compare(h_root, root, 1);
+	things_free(buffer);
+	return changed;
+}
+#endif
+
 int things_initialize_stack(const char *json_path, bool *easysetup_completed)
 {
 	THINGS_LOG_D(TAG, THINGS_FUNC_ENTRY);
@@ -183,16 +224,12 @@ int things_initialize_stack(const char *json_path, bool *easysetup_completed)
 	if (fp != NULL) {
 		THINGS_LOG_V(TAG, "File is exist...");
 		fclose(fp);
-		cJSON *root = NULL;
 		char *json_str = get_json_string_from_file(abs_json_path);
-		cJSON *h_root = cJSON_Parse(deviceDef);
-		if (json_str != NULL && strlen(json_str) > 0) {
-			root = cJSON_Parse((const char *)json_str);
-			if (root == NULL) {
-				THINGS_LOG_D(TAG, "Failed to parse a device resource file");
-			}
+		bool changed = things_device_def_changed(json_str);
+		if (json_str != NULL) {
+			things_free(json_str);
 		}
-		if (!cJSON_Compare(h_root, root, 1)) {
+		if (changed) {
 			THINGS_LOG_D(TAG, "Modify the device resource file");
 			fp = fopen(abs_json_path, "w+");
 			if (!fp) {
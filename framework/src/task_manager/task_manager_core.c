@@ -681,6 +681,32 @@ int taskmgr_calc_time(struct timespec *result_time, int offset)
 	return OK;
 }
 
+/* Receive the reply of a sync unicast, without a timeout if 'time' is NULL.
+ * With CONFIG_MQ_REFERENCE, task_manager_reply_unicast() hands its buffer
+ * over through the queue and it is returned in 'reply' without a copy.
+ */
+static int taskmgr_receive_reply(mqd_t mqfd, FAR struct timespec *time, tm_msg_t *reply)
+{
+#ifdef CONFIG_MQ_REFERENCE
+	ssize_t ret;
+
+	if (time != NULL) {
+		ret = mq_timedreceive_ref(mqfd, &reply->msg, NULL, time);
+	} else {
+		ret = mq_receive_ref(mqfd, &reply->msg, NULL);
+	}
+	if (ret > 0) {
+		reply->msg_size = ret;
+	}
+	return ret;
+#else
+	if (time != NULL) {
+		return mq_timedreceive(mqfd, (char *)reply, sizeof(tm_msg_t), 0, time);
+	}
+	return mq_receive(mqfd, (char *)reply, sizeof(tm_msg_t), 0);
+#endif
+}
+
 static int taskmgr_unicast_sync(int handle, int caller_pid, tm_internal_msg_t *data, tm_response_t *response_msg, int timeout)
 {
 	int ret;
@@ -722,16 +748,16 @@ static int taskmgr_unicast_sync(int handle, int caller_pid, tm_internal_msg_t *d
 		if (ret != OK) {
 			return TM_OPERATION_FAIL;
 		}
-		ret = mq_timedreceive(unicast_mqfd, (char *)&recv_msg, sizeof(tm_msg_t), 0, &time);
+		ret = taskmgr_receive_reply(unicast_mqfd, &time, &recv_msg);
 	} else {
 #if CONFIG_TASK_MANAGER_UNICAST_REPLY_TIMEOUT > 0
 		ret = taskmgr_calc_time(&time, CONFIG_TASK_MANAGER_UNICAST_REPLY_TIMEOUT);
 		if (ret != OK) {
 			return TM_OPERATION_FAIL;
 		}
-		ret = mq_timedreceive(unicast_mqfd, (char *)&recv_msg, sizeof(tm_msg_t), 0, &time);
+		ret = taskmgr_receive_reply(unicast_mqfd, &time, &recv_msg);
 #else
-		ret = mq_receive(unicast_mqfd, (char *)&recv_msg, sizeof(tm_msg_t), 0);
+		ret = taskmgr_receive_reply(unicast_mqfd, NULL, &recv_msg);
 #endif
 	}
 	if (ret <= 0) {
@@ -747,6 +773,11 @@ static int taskmgr_unicast_sync(int handle, int caller_pid, tm_internal_msg_t *d
 	mq_close(unicast_mqfd);
 	mq_unlink(TM_UNICAST_MQ);
 
+#ifdef CONFIG_MQ_REFERENCE
+	/* The reply buffer was handed over by task_manager_reply_unicast() */
+	((tm_msg_t *)response_msg->data)->msg_size = recv_msg.msg_size;
+	((tm_msg_t *)response_msg->data)->msg = recv_msg.msg;
+#else
 	((tm_msg_t *)response_msg->data)->msg_size = recv_msg.msg_size;
 	((tm_msg_t *)response_msg->data)->msg = (char *)TM_ALLOC(recv_msg.msg_size);
 	if (((tm_msg_t *)response_msg->data)->msg == NULL) {
@@ -754,6 +785,7 @@ static int taskmgr_unicast_sync(int handle, int caller_pid, tm_internal_msg_t *d
 	}
 	memcpy(((tm_msg_t *)response_msg->data)->msg, recv_msg.msg, recv_msg.msg_size);
 	TM_FREE(recv_msg.msg);
+#endif
 
 	return OK;
 }
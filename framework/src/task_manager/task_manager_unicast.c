@@ -87,14 +87,9 @@ int task_manager_unicast(int handle, tm_msg_t *send_msg, tm_msg_t *reply_msg, in
 		status = taskmgr_receive_response(request_msg.q_name, &response_msg, timeout);
 		TM_FREE(request_msg.q_name);
 		if (reply_msg != NULL) {
+			/* The reply buffer is allocated for the caller, take it over */
 			reply_msg->msg_size = ((tm_msg_t *)response_msg.data)->msg_size;
-			reply_msg->msg = TM_ALLOC(reply_msg->msg_size);
-			if (reply_msg->msg == NULL) {
-				status = TM_OUT_OF_MEMORY;
-				goto errout_with_free1;
-			}
-			memcpy(reply_msg->msg, ((tm_msg_t *)response_msg.data)->msg, reply_msg->msg_size);
-			TM_FREE(((tm_msg_t *)response_msg.data)->msg);
+			reply_msg->msg = ((tm_msg_t *)response_msg.data)->msg;
 			TM_FREE(response_msg.data);
 		}
 	}
@@ -115,22 +110,25 @@ int task_manager_reply_unicast(tm_msg_t *reply_msg)
 	int ret = ERROR;
 	mqd_t reply_mqfd;
 	struct mq_attr attr;
-	tm_msg_t *data;
+	tm_msg_t data;
 
 	if (reply_msg == NULL) {
 		return TM_INVALID_PARAM;
 	}
-	data = (tm_msg_t *)TM_ALLOC(sizeof(tm_msg_t));
-	if (data == NULL) {
-		return TM_OUT_OF_MEMORY;
+#ifdef CONFIG_MQ_REFERENCE
+	if (reply_msg->msg_size <= 0) {
+		/* A message passed by reference needs a buffer */
+		return TM_INVALID_PARAM;
 	}
-	data->msg = TM_ALLOC(reply_msg->msg_size);
-	if (data->msg == NULL) {
-		TM_FREE(data);
+#endif
+
+	/* The copy of the reply is freed by the task manager */
+	data.msg = TM_ALLOC(reply_msg->msg_size);
+	if (data.msg == NULL) {
 		return TM_OUT_OF_MEMORY;
 	}
-	data->msg_size = reply_msg->msg_size;
-	memcpy(data->msg, reply_msg->msg, reply_msg->msg_size);
+	data.msg_size = reply_msg->msg_size;
+	memcpy(data.msg, reply_msg->msg, reply_msg->msg_size);
 
 	attr.mq_maxmsg = CONFIG_TASK_MANAGER_MAX_MSG;
 	attr.mq_msgsize = sizeof(tm_msg_t);
@@ -138,17 +136,20 @@ int task_manager_reply_unicast(tm_msg_t *reply_msg)
 
 	reply_mqfd = mq_open(TM_UNICAST_MQ, O_WRONLY | O_CREAT, 0666, &attr);
 	if (reply_mqfd == (mqd_t)ERROR) {
-		TM_FREE(data->msg);
-		TM_FREE(data);
+		TM_FREE(data.msg);
 		tmdbg("mq_open failed!\n");
 		return TM_COMMUCATION_FAIL;
 	}
 
-	ret = mq_send(reply_mqfd, (char *)data, sizeof(tm_msg_t), TM_MQ_PRIO);
+#ifdef CONFIG_MQ_REFERENCE
+	/* Hand the copy over through the queue instead of copying it again */
+	ret = mq_send_ref(reply_mqfd, data.msg, data.msg_size, TM_MQ_PRIO);
+#else
+	ret = mq_send(reply_mqfd, (char *)&data, sizeof(tm_msg_t), TM_MQ_PRIO);
+#endif
 	if (ret != 0) {
 		mq_close(reply_mqfd);
-		TM_FREE(data->msg);
-		TM_FREE(data);
+		TM_FREE(data.msg);
 		tmdbg("mq_send failed! %d\n", errno);
 		return TM_COMMUCATION_FAIL;
 	}
@@ -158,7 +159,5 @@ int task_manager_reply_unicast(tm_msg_t *reply_msg)
 		tmdbg("mq_close failed! ret %d, errno %d\n", ret, errno);
 	}
 
-	TM_FREE(data);
-
 	return ret;
 }
@@ -0,0 +1,430 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * libc/aio/aio_cq.c
+ *
+ * Completion queue based asynchronous I/O.
+ *
+ * A queue owns two rings sized for 'depth' requests: the submission ring
+ * holds requests not yet taken by a worker, the completion ring holds
+ * finished requests not yet reaped.  A request counts against 'depth' from
+ * submission until it is reaped, so the completion ring can never
+ * overflow.  One mutex protects both rings: a batch of submissions or a
+ * batch of completions costs one lock round trip, and no signal is sent
+ * per completion.
+ *
+ * The workers are pthreads of the task that created the queue.  They share
+ * its file and socket descriptors and so can serve both.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+#include <aio.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/clock.h>
+
+#ifdef CONFIG_FS_AIO_CQ
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_FS_AIO_CQ_NWORKERS
+#define CONFIG_FS_AIO_CQ_NWORKERS 2
+#endif
+
+#ifndef CONFIG_FS_AIO_CQ_STACKSIZE
+#define CONFIG_FS_AIO_CQ_STACKSIZE 2048
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct aio_cq_s {
+	pthread_mutex_t lock;		/* Protects everything below */
+	pthread_cond_t subcond;		/* Signalled on submission and shutdown */
+	pthread_cond_t compcond;	/* Signalled on completion */
+	unsigned int depth;			/* Size of both rings */
+	unsigned int inflight;		/* Submitted and not yet reaped */
+	unsigned int sqhead;		/* Next request for the workers */
+	unsigned int sqcount;		/* Requests waiting for a worker */
+	unsigned int cqhead;		/* Next completion to reap */
+	unsigned int cqcount;		/* Completions waiting to be reaped */
+	unsigned int waitfor;		/* Completions the reaper waits for, or 0 */
+	bool shutdown;				/* The workers should exit */
+	FAR struct aiocb **sq;		/* Submission ring */
+	FAR struct aio_cqe *cq;		/* Completion ring */
+	unsigned int nworkers;		/* Number of entries in workers[] */
+	pthread_t workers[1];		/* Worker threads (variable) */
+};
+
+#define SIZEOF_AIO_CQ_S(n) (sizeof(struct aio_cq_s) + ((n) - 1) * sizeof(pthread_t))
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: aio_cq_perform
+ *
+ * Description:
+ *   Perform one request synchronously and return its result.
+ *
+ ****************************************************************************/
+
+static ssize_t aio_cq_perform(FAR struct aiocb *aiocbp)
+{
+	FAR void *buf = (FAR void *)aiocbp->aio_buf;
+	bool isfile = (unsigned int)aiocbp->aio_fildes < CONFIG_NFILE_DESCRIPTORS;
+	ssize_t ret;
+
+	switch (aiocbp->aio_lio_opcode) {
+	case LIO_READ:
+		if (isfile) {
+			ret = pread(aiocbp->aio_fildes, buf, aiocbp->aio_nbytes, aiocbp->aio_offset);
+		} else {
+			ret = read(aiocbp->aio_fildes, buf, aiocbp->aio_nbytes);
+		}
+		break;
+
+	case LIO_WRITE:
+		if (isfile) {
+			ret = pwrite(aiocbp->aio_fildes, buf, aiocbp->aio_nbytes, aiocbp->aio_offset);
+		} else {
+			ret = write(aiocbp->aio_fildes, buf, aiocbp->aio_nbytes);
+		}
+		break;
+
+#ifndef CONFIG_DISABLE_MOUNTPOINT
+	case LIO_FSYNC:
+		ret = fsync(aiocbp->aio_fildes);
+		break;
+#endif
+
+	case LIO_NOP:
+		return OK;
+
+	default:
+		return -EINVAL;
+	}
+
+	return ret < 0 ? -get_errno() : ret;
+}
+
+/****************************************************************************
+ * Name: aio_cq_worker
+ ****************************************************************************/
+
+static FAR void *aio_cq_worker(FAR void *arg)
+{
+	FAR struct aio_cq_s *cq = (FAR struct aio_cq_s *)arg;
+	FAR struct aiocb *aiocbp;
+	FAR struct aio_cqe *cqe;
+	ssize_t result;
+
+	pthread_mutex_lock(&cq->lock);
+	for (;;) {
+		while (cq->sqcount == 0 && !cq->shutdown) {
+			pthread_cond_wait(&cq->subcond, &cq->lock);
+		}
+
+		/* Drain the submissions before honouring a shutdown */
+
+		if (cq->sqcount == 0) {
+			break;
+		}
+
+		aiocbp = cq->sq[cq->sqhead];
+		cq->sqhead = (cq->sqhead + 1) % cq->depth;
+		cq->sqcount--;
+		pthread_mutex_unlock(&cq->lock);
+
+		result = aio_cq_perform(aiocbp);
+
+		pthread_mutex_lock(&cq->lock);
+		aiocbp->aio_result = result;
+		cqe = &cq->cq[(cq->cqhead + cq->cqcount) % cq->depth];
+		cqe->aiocbp = aiocbp;
+		cqe->result = result;
+		cq->cqcount++;
+
+		/* Wake the reaper only once it has what it waits for */
+
+		if (cq->waitfor != 0 && cq->cqcount >= cq->waitfor) {
+			cq->waitfor = 0;
+			pthread_cond_signal(&cq->compcond);
+		}
+	}
+
+	pthread_mutex_unlock(&cq->lock);
+	return NULL;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: aio_cq_create
+ *
+ * Returned Value:
+ *   Zero on success; -1 with errno set on failure:
+ *
+ *   EINVAL - depth is zero.
+ *   ENOMEM - Out of memory.
+ *   Any error of pthread_create().
+ *
+ ****************************************************************************/
+
+int aio_cq_create(unsigned int depth, unsigned int nworkers, FAR aio_cq_t *cqp)
+{
+	FAR struct aio_cq_s *cq;
+	pthread_attr_t attr;
+	unsigned int i;
+	int ret;
+
+	if (depth == 0 || cqp == NULL) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	if (nworkers == 0) {
+		nworkers = CONFIG_FS_AIO_CQ_NWORKERS;
+	}
+
+	cq = (FAR struct aio_cq_s *)zalloc(SIZEOF_AIO_CQ_S(nworkers));
+	if (cq == NULL) {
+		set_errno(ENOMEM);
+		return ERROR;
+	}
+
+	cq->sq = (FAR struct aiocb **)malloc(depth * sizeof(FAR struct aiocb *));
+	cq->cq = (FAR struct aio_cqe *)malloc(depth * sizeof(struct aio_cqe));
+	if (cq->sq == NULL || cq->cq == NULL) {
+		ret = ENOMEM;
+		goto errout_with_rings;
+	}
+
+	cq->depth = depth;
+	pthread_mutex_init(&cq->lock, NULL);
+	pthread_cond_init(&cq->subcond, NULL);
+	pthread_cond_init(&cq->compcond, NULL);
+
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, CONFIG_FS_AIO_CQ_STACKSIZE);
+
+	for (i = 0; i < nworkers; i++) {
+		ret = pthread_create(&cq->workers[i], &attr, aio_cq_worker, cq);
+		if (ret != 0) {
+			fdbg("ERROR: pthread_create failed: %d\n", ret);
+			break;
+		}
+
+		cq->nworkers++;
+	}
+
+	pthread_attr_destroy(&attr);
+
+	if (cq->nworkers < nworkers) {
+		(void)aio_cq_destroy(cq);
+		set_errno(ret);
+		return ERROR;
+	}
+
+	*cqp = cq;
+	return OK;
+
+errout_with_rings:
+	free(cq->sq);
+	free(cq->cq);
+	free(cq);
+	set_errno(ret);
+	return ERROR;
+}
+
+/****************************************************************************
+ * Name: aio_cq_destroy
+ *
+ * Description:
+ *   Let the workers finish the submitted requests, stop them and free the
+ *   queue.  Completions that were not reaped are discarded; their results
+ *   remain available through aio_return().
+ *
+ ****************************************************************************/
+
+int aio_cq_destroy(aio_cq_t cq)
+{
+	unsigned int i;
+
+	if (cq == NULL) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	pthread_mutex_lock(&cq->lock);
+	cq->shutdown = true;
+	pthread_cond_broadcast(&cq->subcond);
+	pthread_mutex_unlock(&cq->lock);
+
+	for (i = 0; i < cq->nworkers; i++) {
+		(void)pthread_join(cq->workers[i], NULL);
+	}
+
+	pthread_cond_destroy(&cq->compcond);
+	pthread_cond_destroy(&cq->subcond);
+	pthread_mutex_destroy(&cq->lock);
+	free(cq->sq);
+	free(cq->cq);
+	free(cq);
+	return OK;
+}
+
+/****************************************************************************
+ * Name: aio_cq_submit
+ *
+ * Returned Value:
+ *   The number of requests queued from the head of 'list'; -1 with errno
+ *   set if none could be queued:
+ *
+ *   EINVAL - Invalid parameters or the queue is shutting down.
+ *   EAGAIN - 'depth' requests are already in flight.
+ *
+ ****************************************************************************/
+
+int aio_cq_submit(aio_cq_t cq, FAR struct aiocb *const list[], int nent)
+{
+	unsigned int tail;
+	int nsubmitted = 0;
+
+	if (cq == NULL || list == NULL || nent <= 0) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	pthread_mutex_lock(&cq->lock);
+	if (cq->shutdown) {
+		pthread_mutex_unlock(&cq->lock);
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	tail = (cq->sqhead + cq->sqcount) % cq->depth;
+	while (nsubmitted < nent && cq->inflight < cq->depth) {
+		list[nsubmitted]->aio_result = -EINPROGRESS;
+		list[nsubmitted]->aio_priv = NULL;
+		cq->sq[tail] = list[nsubmitted];
+		tail = (tail + 1) % cq->depth;
+		cq->sqcount++;
+		cq->inflight++;
+		nsubmitted++;
+	}
+
+	if (nsubmitted > 1) {
+		pthread_cond_broadcast(&cq->subcond);
+	} else if (nsubmitted == 1) {
+		pthread_cond_signal(&cq->subcond);
+	}
+
+	pthread_mutex_unlock(&cq->lock);
+
+	if (nsubmitted == 0) {
+		set_errno(EAGAIN);
+		return ERROR;
+	}
+
+	return nsubmitted;
+}
+
+/****************************************************************************
+ * Name: aio_cq_reap
+ *
+ * Returned Value:
+ *   The number of completions stored in 'cqes'.  This is less than
+ *   'minevents' only when 'timeout' expired.  -1 with errno set on failure:
+ *
+ *   EINVAL - Invalid parameters.
+ *
+ ****************************************************************************/
+
+int aio_cq_reap(aio_cq_t cq, FAR struct aio_cqe *cqes, int minevents, int maxevents, FAR const struct timespec *timeout)
+{
+	struct timespec abstime;
+	int nreaped = 0;
+	int ret = OK;
+
+	if (cq == NULL || cqes == NULL || maxevents <= 0 || minevents < 0 || minevents > maxevents) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	if (timeout != NULL) {
+		(void)clock_gettime(CLOCK_REALTIME, &abstime);
+		abstime.tv_sec += timeout->tv_sec;
+		abstime.tv_nsec += timeout->tv_nsec;
+		if (abstime.tv_nsec >= NSEC_PER_SEC) {
+			abstime.tv_sec++;
+			abstime.tv_nsec -= NSEC_PER_SEC;
+		}
+	}
+
+	pthread_mutex_lock(&cq->lock);
+
+	/* Never wait for more completions than there are requests in flight */
+
+	if ((unsigned int)minevents > cq->inflight) {
+		minevents = cq->inflight;
+	}
+
+	while (cq->cqcount < (unsigned int)minevents && ret == OK) {
+		cq->waitfor = minevents;
+		if (timeout != NULL) {
+			ret = pthread_cond_timedwait(&cq->compcond, &cq->lock, &abstime);
+		} else {
+			ret = pthread_cond_wait(&cq->compcond, &cq->lock);
+		}
+	}
+
+	cq->waitfor = 0;
+
+	while (nreaped < maxevents && cq->cqcount > 0) {
+		cqes[nreaped++] = cq->cq[cq->cqhead];
+		cq->cqhead = (cq->cqhead + 1) % cq->depth;
+		cq->cqcount--;
+		cq->inflight--;
+	}
+
+	pthread_mutex_unlock(&cq->lock);
+	return nreaped;
+}
+
+#endif							/* CONFIG_FS_AIO_CQ */
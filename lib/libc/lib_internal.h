@@ -60,6 +60,7 @@
 #include <tinyara/config.h>
 
 #include <sys/types.h>
+#include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <limits.h>
@@ -139,10 +140,37 @@
 
 #define LIB_BUFLEN_UNKNOWN INT_MAX
 
+/* Word-at-a-time helpers of the string functions (CONFIG_LIBC_STRING_OPTSPEED).
+ * LIB_HAS_ZERO(w) is non-zero if any byte of the word w is zero.  Only the
+ * marker of the lowest zero byte is exact, so the callers locate the byte
+ * with a byte loop once a word has matched.
+ */
+
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+#define LIB_WORDSIZE       sizeof(lib_word_t)
+#define LIB_WORDMASK       (LIB_WORDSIZE - 1)
+#define LIB_ALIGNED(p)     (((uintptr_t)(p) & LIB_WORDMASK) == 0)
+#define LIB_ONES           ((lib_word_t)-1 / 0xff)
+#define LIB_HIGHS          (LIB_ONES * 0x80)
+#define LIB_HAS_ZERO(w)    (((w) - LIB_ONES) & ~(w) & LIB_HIGHS)
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
 
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+/* Word type of the string functions.  It may alias the bytes it is loaded
+ * from.
+ */
+
+#ifdef __GNUC__
+typedef uintptr_t __attribute__((__may_alias__)) lib_word_t;
+#else
+typedef uintptr_t lib_word_t;
+#endif
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
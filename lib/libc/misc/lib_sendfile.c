@@ -62,19 +62,58 @@
 #include <unistd.h>
 #include <errno.h>
 #include <limits.h>
+#ifdef CONFIG_LIB_SENDFILE_ZEROCOPY
+#include <string.h>
+#include <assert.h>
+#include <semaphore.h>
+#include <sys/ioctl.h>
+#include <sys/prctl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <tinyara/fs/ioctl.h>
+#endif
 
 #include "lib_internal.h"
 
 #if CONFIG_NSOCKET_DESCRIPTORS > 0 || CONFIG_NFILE_DESCRIPTORS > 0
 
+/************************************************************************
+ * Pre-processor Definitions
+ ************************************************************************/
+
+#if defined(CONFIG_LIB_SENDFILE_ZEROCOPY_NRINGS) && CONFIG_LIB_SENDFILE_ZEROCOPY_NRINGS > 0
+#define SENDFILE_RING_CACHE
+#endif
+
 /************************************************************************
  * Private types
  ************************************************************************/
 
+#ifdef SENDFILE_RING_CACHE
+/* A ring buffer which stays with the socket it was last used for when
+ * sendfile() returns, because the stack still references the data which
+ * the peer has not acknowledged yet.  The next sendfile() to the socket
+ * continues in the ring and only waits for the space it needs.
+ */
+
+struct sendfile_ring_s {
+	uint32_t group;				/* Task group of the socket, 0 if free */
+	int fd;						/* The socket */
+	bool busy;					/* In use by a sendfile() call */
+	size_t head;				/* Where the next chunk goes */
+	FAR uint8_t *buf;			/* The ring, kept when the slot is freed */
+};
+#endif
+
 /************************************************************************
  * Private Variables
  ************************************************************************/
 
+#ifdef SENDFILE_RING_CACHE
+static struct sendfile_ring_s g_sendfile_rings[CONFIG_LIB_SENDFILE_ZEROCOPY_NRINGS];
+static sem_t g_sendfile_ringsem = SEM_INITIALIZER(1);
+#endif
+
 /************************************************************************
  * Public Variables
  ************************************************************************/
@@ -83,6 +122,335 @@
  * Private Functions
  ************************************************************************/
 
+#ifdef CONFIG_LIB_SENDFILE_ZEROCOPY
+/************************************************************************
+ * Name: sendfile_send
+ *
+ * Description:
+ *   Send a buffer to the socket with MSG_ZEROCOPY, so that the stack
+ *   references the buffer instead of copying it.  The buffer must not be
+ *   changed until FIONSENDQ reports that the peer acknowledged it.
+ *   Returns less than 'len' if a signal interrupted the send after some
+ *   of the data was sent.
+ *
+ ************************************************************************/
+
+static ssize_t sendfile_send(int outfd, FAR const uint8_t *buf, size_t len)
+{
+	ssize_t nsent = 0;
+	ssize_t ret;
+
+	while ((size_t)nsent < len) {
+		ret = send(outfd, buf + nsent, len - nsent, MSG_ZEROCOPY);
+		if (ret < 0) {
+#ifndef CONFIG_DISABLE_SIGNALS
+			if (errno == EINTR && nsent > 0) {
+				break;
+			}
+#endif
+			return ERROR;
+		}
+
+		nsent += ret;
+	}
+
+	return nsent;
+}
+
+#ifdef SENDFILE_RING_CACHE
+static void sendfile_ring_lock(void)
+{
+	while (sem_wait(&g_sendfile_ringsem) != 0) {
+		ASSERT(get_errno() == EINTR);
+	}
+}
+
+static void sendfile_ring_unlock(void)
+{
+	sem_post(&g_sendfile_ringsem);
+}
+
+/************************************************************************
+ * Name: sendfile_ring_exit
+ *
+ * Description:
+ *   Release the rings of the exiting task group once the peers have
+ *   acknowledged the data sent from them.  The buffers are kept for
+ *   other task groups.
+ *
+ ************************************************************************/
+
+static void sendfile_ring_exit(void)
+{
+	FAR struct sendfile_ring_s *ring;
+	uint32_t group;
+	int limit;
+	int i;
+
+	if (prctl(PR_GET_GROUP_SERIAL, &group) != OK) {
+		return;
+	}
+
+	/* Only this task group can give a slot its serial number */
+
+	for (i = 0; i < CONFIG_LIB_SENDFILE_ZEROCOPY_NRINGS; i++) {
+		ring = &g_sendfile_rings[i];
+		if (ring->group == group) {
+			limit = 0;
+			(void)ioctl(ring->fd, FIONSENDQWAIT, (unsigned long)((uintptr_t)&limit));
+
+			sendfile_ring_lock();
+			ring->group = 0;
+			ring->busy = false;
+			sendfile_ring_unlock();
+		}
+	}
+}
+
+/************************************************************************
+ * Name: sendfile_ring_get
+ *
+ * Description:
+ *   Get the ring of the socket 'outfd' of the calling task group, or a
+ *   ring which no socket references any more.  A socket that reports no
+ *   unacknowledged data, or a descriptor that is not a socket any more,
+ *   does not reference its ring: close() of a socket that sent with
+ *   MSG_ZEROCOPY waits for the acknowledgements.  Returns NULL if there
+ *   is no ring available, the caller then uses a private one.
+ *
+ ************************************************************************/
+
+static FAR struct sendfile_ring_s *sendfile_ring_get(int outfd)
+{
+	FAR struct sendfile_ring_s *ring = NULL;
+	FAR struct sendfile_ring_s *slot;
+	bool registered = false;
+	uint32_t group;
+	int queued;
+	int i;
+
+	if (prctl(PR_GET_GROUP_SERIAL, &group) != OK) {
+		return NULL;
+	}
+
+	sendfile_ring_lock();
+
+	for (i = 0; i < CONFIG_LIB_SENDFILE_ZEROCOPY_NRINGS; i++) {
+		slot = &g_sendfile_rings[i];
+		if (slot->group == group) {
+			registered = true;
+			if (slot->fd == outfd) {
+				ring = slot;
+				break;
+			}
+		}
+	}
+
+	if (!ring) {
+		for (i = 0; i < CONFIG_LIB_SENDFILE_ZEROCOPY_NRINGS && !ring; i++) {
+			slot = &g_sendfile_rings[i];
+			if (slot->group == 0) {
+				ring = slot;
+			} else if (slot->group == group && !slot->busy && (ioctl(slot->fd, FIONSENDQ, (unsigned long)((uintptr_t)&queued)) != OK || queued == 0)) {
+				ring = slot;
+			}
+		}
+
+		/* The first ring of a task group is released when it exits */
+
+		if (!ring || (!registered && atexit(sendfile_ring_exit) != OK)) {
+			sendfile_ring_unlock();
+			return NULL;
+		}
+
+		ring->group = group;
+		ring->fd = outfd;
+		ring->head = 0;
+	}
+
+	if (ring->busy) {
+		ring = NULL;
+	} else {
+		if (!ring->buf) {
+			ring->buf = (FAR uint8_t *)lib_malloc(CONFIG_LIB_SENDFILE_ZEROCOPY_BUFSIZE);
+		}
+
+		if (ring->buf) {
+			ring->busy = true;
+		} else {
+			ring = NULL;
+		}
+	}
+
+	sendfile_ring_unlock();
+	return ring;
+}
+
+/************************************************************************
+ * Name: sendfile_ring_put
+ *
+ * Description:
+ *   Leave the ring with its socket, 'head' is where the next chunk goes.
+ *
+ ************************************************************************/
+
+static void sendfile_ring_put(FAR struct sendfile_ring_s *ring, size_t head)
+{
+	sendfile_ring_lock();
+	ring->head = head;
+	ring->busy = false;
+	sendfile_ring_unlock();
+}
+#endif							/* SENDFILE_RING_CACHE */
+
+/************************************************************************
+ * Name: sendfile_zerocopy
+ *
+ * Description:
+ *   Transfer 'count' bytes from the current position of 'infd' to the
+ *   socket 'outfd' without the copy into the socket send buffer.  If the
+ *   file system can map the file, the data is sent straight from the
+ *   mapping.  Otherwise the file is read into a ring buffer and a part of
+ *   the ring is reused only once the peer has acknowledged it.  With
+ *   CONFIG_LIB_SENDFILE_ZEROCOPY_NRINGS, the ring stays with the socket
+ *   and the call returns without waiting for the last acknowledgements.
+ *
+ ************************************************************************/
+
+static ssize_t sendfile_zerocopy(int outfd, int infd, size_t count)
+{
+#ifdef SENDFILE_RING_CACHE
+	FAR struct sendfile_ring_s *cached;
+#endif
+	FAR uint8_t *ring;
+	FAR void *map;
+	struct stat st;
+	ssize_t ntransferred = 0;
+	ssize_t nbytes;
+	ssize_t nsent;
+	size_t head = 0;
+	size_t chunk;
+	off_t pos;
+	int limit;
+
+	if (count > SSIZE_MAX) {
+		count = SSIZE_MAX;
+	}
+
+	/* Files in XIP file systems are sent from where they are stored */
+
+	if (ioctl(infd, FIOC_MMAP, (unsigned long)((uintptr_t)&map)) == OK && fstat(infd, &st) == OK) {
+		pos = lseek(infd, 0, SEEK_CUR);
+		if (pos == (off_t)-1) {
+			return ERROR;
+		}
+
+		if (pos < st.st_size && count > (size_t)(st.st_size - pos)) {
+			count = st.st_size - pos;
+		} else if (pos >= st.st_size) {
+			count = 0;
+		}
+
+		if (count > 0) {
+			ntransferred = sendfile_send(outfd, (FAR const uint8_t *)map + pos, count);
+			if (ntransferred > 0 && lseek(infd, pos + ntransferred, SEEK_SET) == (off_t)-1) {
+				return ERROR;
+			}
+		}
+
+		return ntransferred;
+	}
+
+#ifdef SENDFILE_RING_CACHE
+	cached = sendfile_ring_get(outfd);
+	if (cached) {
+		ring = cached->buf;
+		head = cached->head;
+	} else
+#endif
+	{
+		ring = (FAR uint8_t *)lib_malloc(CONFIG_LIB_SENDFILE_ZEROCOPY_BUFSIZE);
+		if (!ring) {
+			set_errno(ENOMEM);
+			return ERROR;
+		}
+	}
+
+	while ((size_t)ntransferred < count) {
+		/* Read in quarters of the ring so that reading overlaps with the
+		 * transmission of the previous chunks.
+		 */
+
+		chunk = CONFIG_LIB_SENDFILE_ZEROCOPY_BUFSIZE / 4;
+		if (chunk > CONFIG_LIB_SENDFILE_ZEROCOPY_BUFSIZE - head) {
+			chunk = CONFIG_LIB_SENDFILE_ZEROCOPY_BUFSIZE - head;
+		}
+
+		if (chunk > count - ntransferred) {
+			chunk = count - ntransferred;
+		}
+
+		/* Wait until the bytes about to be overwritten were acknowledged */
+
+		limit = CONFIG_LIB_SENDFILE_ZEROCOPY_BUFSIZE - chunk;
+		if (ioctl(outfd, FIONSENDQWAIT, (unsigned long)((uintptr_t)&limit)) < 0) {
+			ntransferred = ERROR;
+			break;
+		}
+
+		nbytes = read(infd, ring + head, chunk);
+		if (nbytes <= 0) {
+#ifndef CONFIG_DISABLE_SIGNALS
+			if (nbytes < 0 && (errno != EINTR || ntransferred == 0))
+#else
+			if (nbytes < 0)
+#endif
+			{
+				ntransferred = ERROR;
+			}
+
+			break;
+		}
+
+		nsent = sendfile_send(outfd, ring + head, nbytes);
+		if (nsent < 0) {
+			ntransferred = ERROR;
+			break;
+		}
+
+		ntransferred += nsent;
+		head = (head + nsent) % CONFIG_LIB_SENDFILE_ZEROCOPY_BUFSIZE;
+
+		/* A signal interrupted the send.  Return the partial count and
+		 * leave the input at the first byte that was not sent.
+		 */
+
+		if (nsent < nbytes) {
+			if (lseek(infd, nsent - nbytes, SEEK_CUR) == (off_t)-1) {
+				ntransferred = ERROR;
+			}
+
+			break;
+		}
+	}
+
+#ifdef SENDFILE_RING_CACHE
+	if (cached) {
+		sendfile_ring_put(cached, head);
+		return ntransferred;
+	}
+#endif
+
+	/* The stack references the ring until the peer has acknowledged all */
+
+	limit = 0;
+	(void)ioctl(outfd, FIONSENDQWAIT, (unsigned long)((uintptr_t)&limit));
+	lib_free(ring);
+
+	return ntransferred;
+}
+#endif							/* CONFIG_LIB_SENDFILE_ZEROCOPY */
+
 /************************************************************************
  * Public Functions
  ************************************************************************/
@@ -159,6 +527,19 @@ ssize_t sendfile(int outfd, int infd, off_t *offset, size_t count)
 		}
 	}
 
+#ifdef CONFIG_LIB_SENDFILE_ZEROCOPY
+	/* Sockets which report their unacknowledged bytes support MSG_ZEROCOPY */
+
+	{
+		int queued;
+
+		if (ioctl(outfd, FIONSENDQ, (unsigned long)((uintptr_t)&queued)) == OK) {
+			ntransferred = sendfile_zerocopy(outfd, infd, count);
+			goto return_offset;
+		}
+	}
+#endif
+
 	/* Allocate an I/O buffer */
 
 	iobuffer = (FAR void *)lib_malloc(CONFIG_LIB_SENDFILE_BUFSIZE);
@@ -283,6 +664,9 @@ ssize_t sendfile(int outfd, int infd, off_t *offset, size_t count)
 
 	lib_free(iobuffer);
 
+#ifdef CONFIG_LIB_SENDFILE_ZEROCOPY
+return_offset:
+#endif
 	/* Return the current file position */
 
 	if (offset) {
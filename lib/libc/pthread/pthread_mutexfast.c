@@ -0,0 +1,144 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <errno.h>
+
+#include <tinyara/pthread.h>
+
+#if defined(CONFIG_BUILD_PROTECTED) && !defined(__KERNEL__)
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+/* PID of the running thread, written by up_restoretask() through
+ * userspace_s.curr_pid.
+ */
+
+volatile pid_t g_pthread_curr_pid;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pthread_mutex_mypid
+ *
+ * Description:
+ *   Return the PID of the calling thread without a system call once the
+ *   kernel has switched to it.
+ *
+ ****************************************************************************/
+
+static inline pid_t pthread_mutex_mypid(void)
+{
+	pid_t mypid = g_pthread_curr_pid;
+
+	return mypid > 0 ? mypid : getpid();
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pthread_mutex_lock
+ *
+ * Description:
+ *   Lock the mutex in user space if it is free, otherwise ask the kernel to
+ *   lock it.  See os/kernel/pthread/pthread_mutexlock.c.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_lock(FAR pthread_mutex_t *mutex)
+{
+	int ret;
+
+	if (mutex == NULL) {
+		return EINVAL;
+	}
+
+	ret = pthread_mutex_fastlock(mutex, pthread_mutex_mypid());
+	if (ret == PTHREAD_MUTEX_SLOWPATH) {
+		ret = pthread_mutex_lock_slow(mutex);
+	}
+
+	return ret;
+}
+
+/****************************************************************************
+ * Name: pthread_mutex_trylock
+ *
+ * Description:
+ *   Try to lock the mutex in user space, otherwise ask the kernel.  See
+ *   os/kernel/pthread/pthread_mutextrylock.c.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_trylock(FAR pthread_mutex_t *mutex)
+{
+	int ret;
+
+	if (mutex == NULL) {
+		return EINVAL;
+	}
+
+	ret = pthread_mutex_fasttrylock(mutex, pthread_mutex_mypid());
+	if (ret == PTHREAD_MUTEX_SLOWPATH) {
+		ret = pthread_mutex_trylock_slow(mutex);
+	}
+
+	return ret;
+}
+
+/****************************************************************************
+ * Name: pthread_mutex_unlock
+ *
+ * Description:
+ *   Unlock a mutex that was locked in user space, otherwise ask the kernel
+ *   to unlock it and wake up a waiter.  See
+ *   os/kernel/pthread/pthread_mutexunlock.c.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_unlock(FAR pthread_mutex_t *mutex)
+{
+	int ret;
+
+	if (mutex == NULL) {
+		return EINVAL;
+	}
+
+	ret = pthread_mutex_fastunlock(mutex, pthread_mutex_mypid());
+	if (ret == PTHREAD_MUTEX_SLOWPATH) {
+		ret = pthread_mutex_unlock_slow(mutex);
+	}
+
+	return ret;
+}
+
+#endif							/* CONFIG_BUILD_PROTECTED && !__KERNEL__ */
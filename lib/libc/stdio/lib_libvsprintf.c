@@ -92,6 +92,13 @@
 
 #define putc(c, stream)	(total_len++, (stream)->put(stream, c))
 
+/* Put n characters from s, or n padding characters from pad, as one run */
+
+#define putstr(s, n, stream)	(total_len += (n), vsprintf_puts(stream, s, n))
+#define putpad(pad, n, stream)	(total_len += (n), vsprintf_pad(stream, pad, n))
+
+#define PAD_LEN            16
+
 /* Order is relevant here and matches order in format string */
 
 #define FL_ZFILL           0x0001
@@ -157,6 +164,52 @@ struct arg {
  ****************************************************************************/
 
 static const char g_nullstring[] = "(null)";
+static const char g_spaces[PAD_LEN + 1] = "                ";
+static const char g_zeros[PAD_LEN + 1] = "0000000000000000";
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: vsprintf_puts
+ *
+ * Description:
+ *   Put len characters to the stream with one call to its puts method, or
+ *   one by one if it has none.
+ *
+ ****************************************************************************/
+
+static void vsprintf_puts(FAR struct lib_outstream_s *stream, FAR const char *buf, int len)
+{
+	if (stream->puts != NULL) {
+		stream->puts(stream, buf, len);
+	} else {
+		while (len-- > 0) {
+			stream->put(stream, *buf++);
+		}
+	}
+}
+
+/****************************************************************************
+ * Name: vsprintf_pad
+ *
+ * Description:
+ *   Put len copies of the padding character of pad (g_spaces or g_zeros).
+ *
+ ****************************************************************************/
+
+static void vsprintf_pad(FAR struct lib_outstream_s *stream, FAR const char *pad, int len)
+{
+	while (len > PAD_LEN) {
+		vsprintf_puts(stream, pad, PAD_LEN);
+		len -= PAD_LEN;
+	}
+
+	if (len > 0) {
+		vsprintf_puts(stream, pad, len);
+	}
+}
 
 /****************************************************************************
  * Public Functions
@@ -195,6 +248,25 @@ static int vsprintf_internal(FAR struct lib_outstream_s *stream, FAR struct arg
 
 	for (;;) {
 		for (;;) {
+#ifndef CONFIG_ARCH_ROMGETC
+			/* Put the literal text up to the next conversion as one run */
+
+#ifdef CONFIG_LIBC_NUMBERED_ARGS
+			if (stream != NULL && stream->puts != NULL) {
+#else
+			if (stream->puts != NULL) {
+#endif
+				pnt = fmt;
+				while (*fmt != '\0' && *fmt != '%') {
+					fmt++;
+				}
+
+				if (fmt != pnt) {
+					putstr(pnt, fmt - pnt, stream);
+				}
+			}
+#endif
+
 			c = fmt_char(fmt);
 			if (c == '\0') {
 				goto ret;
@@ -602,22 +674,18 @@ flt_oper:
 
 			/* Output before first digit */
 
-			if ((flags & (FL_LPAD | FL_ZFILL)) == 0) {
-				while (width) {
-					putc(' ', stream);
-					width--;
-				}
+			if ((flags & (FL_LPAD | FL_ZFILL)) == 0 && width > 0) {
+				putpad(g_spaces, width, stream);
+				width = 0;
 			}
 
 			if (sign != 0) {
 				putc(sign, stream);
 			}
 
-			if ((flags & FL_LPAD) == 0) {
-				while (width) {
-					putc('0', stream);
-					width--;
-				}
+			if ((flags & FL_LPAD) == 0 && width > 0) {
+				putpad(g_zeros, width, stream);
+				width = 0;
 			}
 
 			if ((flags & FL_FLTFIX) != 0) {
@@ -749,20 +817,14 @@ flt_oper:
 			size = strnlen(pnt, (flags & FL_PREC) ? prec : ~0);
 
 str_lpad:
-			if ((flags & FL_LPAD) == 0) {
-				while (size < width) {
-					putc(' ', stream);
-					width--;
-				}
+			if ((flags & FL_LPAD) == 0 && size < width) {
+				putpad(g_spaces, width - size, stream);
+				width = size;
 			}
 
-			while (size) {
-				putc(*pnt++, stream);
-				if (width != 0) {
-					width -= 1;
-				}
-
-				size -= 1;
+			if (size > 0) {
+				putstr(pnt, size, stream);
+				width = size < width ? width - size : 0;
 			}
 
 			goto tail;
@@ -956,9 +1018,9 @@ str_lpad:
 				}
 			}
 
-			while (len < width) {
-				putc(' ', stream);
-				len++;
+			if (len < width) {
+				putpad(g_spaces, width - len, stream);
+				len = width;
 			}
 		}
 
@@ -982,22 +1044,36 @@ str_lpad:
 			putc(z, stream);
 		}
 
-		while (prec > c) {
-			putc('0', stream);
-			prec--;
+		if (prec > c) {
+			putpad(g_zeros, prec - c, stream);
 		}
 
-		while (c) {
-			putc(buf[--c], stream);
+		/* The digits were converted in reverse order */
+
+		if (stream->puts == NULL) {
+			while (c) {
+				putc(buf[--c], stream);
+			}
+		} else if (c > 0) {
+			unsigned char i;
+			unsigned char tmp;
+
+			for (i = 0; i < c / 2; i++) {
+				tmp = buf[i];
+				buf[i] = buf[c - 1 - i];
+				buf[c - 1 - i] = tmp;
+			}
+
+			putstr((FAR const char *)buf, c, stream);
 		}
 
 tail:
 
 		/* Tail is possible.  */
 
-		while (width) {
-			putc(' ', stream);
-			width--;
+		if (width > 0) {
+			putpad(g_spaces, width, stream);
+			width = 0;
 		}
 	}
 
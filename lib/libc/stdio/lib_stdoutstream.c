@@ -55,6 +55,7 @@
  ****************************************************************************/
 
 #include <fcntl.h>
+#include <string.h>
 #include <assert.h>
 #include <errno.h>
 
@@ -92,6 +93,44 @@ static void stdoutstream_putc(FAR struct lib_outstream_s *this, int ch)
 	} while (get_errno() == EINTR);
 }
 
+/****************************************************************************
+ * Name: stdoutstream_puts
+ ****************************************************************************/
+
+static void stdoutstream_puts(FAR struct lib_outstream_s *this, FAR const char *buf, int len)
+{
+	FAR struct lib_stdoutstream_s *sthis = (FAR struct lib_stdoutstream_s *)this;
+#ifdef CONFIG_STDIO_LINEBUFFER
+	bool newline = memchr(buf, '\n', len) != NULL;
+#endif
+	ssize_t result;
+
+	DEBUGASSERT(this && sthis->stream);
+
+	/* Buffer the whole run at once.  Loop until all characters are
+	 * transferred or an irrecoverable error occurs.
+	 */
+
+	while (len > 0) {
+		result = lib_fwrite(buf, len, sthis->stream);
+		if (result > 0) {
+			this->nput += result;
+			buf += result;
+			len -= result;
+		} else if (result == 0 || get_errno() != EINTR) {
+			return;
+		}
+	}
+
+	/* Flush the buffer if a newline is output, as fputc() does */
+
+#ifdef CONFIG_STDIO_LINEBUFFER
+	if (newline) {
+		(void)lib_fflush(sthis->stream, true);
+	}
+#endif
+}
+
 /****************************************************************************
  * Name: stdoutstream_flush
  ****************************************************************************/
@@ -130,6 +169,7 @@ void lib_stdoutstream(FAR struct lib_stdoutstream_s *outstream, FAR FILE *stream
 	/* Select the put operation */
 
 	outstream->public.put = stdoutstream_putc;
+	outstream->public.puts = stdoutstream_puts;
 
 	/* Select the correct flush operation.  This flush is only called when
 	 * a newline is encountered in the output stream.  However, we do not
@@ -58,6 +58,8 @@
 
 #include <string.h>
 
+#include "lib_internal.h"
+
 /****************************************************************************
  * Global Functions
  ****************************************************************************/
@@ -81,6 +83,33 @@ FAR void *memchr(FAR const void *s, int c, size_t n)
 	FAR const unsigned char *p = (FAR const unsigned char *)s;
 
 	if (s) {
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+		if (n >= 2 * LIB_WORDSIZE) {
+			lib_word_t mask = LIB_ONES * (unsigned char)c;
+			lib_word_t w;
+
+			while (!LIB_ALIGNED(p)) {
+				if (*p == (unsigned char)c) {
+					return (FAR void *)p;
+				}
+
+				p++;
+				n--;
+			}
+
+			/* Skip the words that do not hold 'c' */
+
+			while (n >= LIB_WORDSIZE) {
+				w = *(FAR const lib_word_t *)p ^ mask;
+				if (LIB_HAS_ZERO(w)) {
+					break;
+				}
+
+				p += LIB_WORDSIZE;
+				n -= LIB_WORDSIZE;
+			}
+		}
+#endif
 		while (n--) {
 			if (*p == (unsigned char)c) {
 				return (FAR void *)p;
@@ -62,6 +62,8 @@
 #include <sys/types.h>
 #include <string.h>
 
+#include "lib_internal.h"
+
 /************************************************************
  * Global Functions
  ************************************************************/
@@ -72,6 +74,30 @@ int memcmp(FAR const void *s1, FAR const void *s2, size_t n)
 	unsigned char *p1 = (unsigned char *)s1;
 	unsigned char *p2 = (unsigned char *)s2;
 
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+	/* Skip the equal words when both pointers share the same alignment.  The
+	 * bytes of the first word that differs are compared below.
+	 */
+
+	if (n >= 2 * LIB_WORDSIZE && (((uintptr_t)p1 ^ (uintptr_t)p2) & LIB_WORDMASK) == 0) {
+		while (!LIB_ALIGNED(p1)) {
+			if (*p1 != *p2) {
+				return *p1 < *p2 ? -1 : 1;
+			}
+
+			p1++;
+			p2++;
+			n--;
+		}
+
+		while (n >= LIB_WORDSIZE && *(lib_word_t *)p1 == *(lib_word_t *)p2) {
+			p1 += LIB_WORDSIZE;
+			p2 += LIB_WORDSIZE;
+			n -= LIB_WORDSIZE;
+		}
+	}
+#endif
+
 	while (n-- > 0) {
 		if (*p1 < *p2) {
 			return -1;
@@ -62,6 +62,8 @@
 #include <sys/types.h>
 #include <string.h>
 
+#include "lib_internal.h"
+
 /****************************************************************************
  * Global Functions
  ****************************************************************************/
@@ -75,6 +77,67 @@ FAR void *memcpy(FAR void *dest, FAR const void *src, size_t n)
 {
 	FAR unsigned char *pout = (FAR unsigned char *)dest;
 	FAR unsigned char *pin = (FAR unsigned char *)src;
+
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+	if (n >= 2 * LIB_WORDSIZE) {
+		FAR lib_word_t *wout;
+		FAR const lib_word_t *win;
+
+		/* Align the destination */
+
+		while (!LIB_ALIGNED(pout)) {
+			*pout++ = *pin++;
+			n--;
+		}
+
+		wout = (FAR lib_word_t *)pout;
+		if (LIB_ALIGNED(pin)) {
+			win = (FAR const lib_word_t *)pin;
+			while (n >= 4 * LIB_WORDSIZE) {
+				wout[0] = win[0];
+				wout[1] = win[1];
+				wout[2] = win[2];
+				wout[3] = win[3];
+				wout += 4;
+				win += 4;
+				n -= 4 * LIB_WORDSIZE;
+			}
+
+			while (n >= LIB_WORDSIZE) {
+				*wout++ = *win++;
+				n -= LIB_WORDSIZE;
+			}
+
+			pin = (FAR unsigned char *)win;
+		} else {
+			/* The source is not aligned: load aligned words and merge each
+			 * two of them into one destination word.  The aligned loads never
+			 * cross the word holding the last byte copied.
+			 */
+
+			unsigned int shift = ((uintptr_t)pin & LIB_WORDMASK) * 8;
+			lib_word_t w0;
+			lib_word_t w1;
+
+			win = (FAR const lib_word_t *)(pin - ((uintptr_t)pin & LIB_WORDMASK));
+			w0 = *win++;
+			while (n >= LIB_WORDSIZE) {
+				w1 = *win++;
+#ifdef CONFIG_ENDIAN_BIG
+				*wout++ = (w0 << shift) | (w1 >> (8 * LIB_WORDSIZE - shift));
+#else
+				*wout++ = (w0 >> shift) | (w1 << (8 * LIB_WORDSIZE - shift));
+#endif
+				w0 = w1;
+				pin += LIB_WORDSIZE;
+				n -= LIB_WORDSIZE;
+			}
+		}
+
+		pout = (FAR unsigned char *)wout;
+	}
+#endif
+
 	while (n-- > 0) {
 		*pout++ = *pin++;
 	}
@@ -62,6 +62,8 @@
 #include <sys/types.h>
 #include <string.h>
 
+#include "lib_internal.h"
+
 /************************************************************
  * Global Functions
  ************************************************************/
@@ -73,12 +75,44 @@ FAR void *memmove(FAR void *dest, FAR const void *src, size_t count)
 	if (dest <= src) {
 		tmp = (char *)dest;
 		s = (char *)src;
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+		/* Words can be moved when both pointers share the same alignment */
+
+		if (count >= 2 * LIB_WORDSIZE && (((uintptr_t)tmp ^ (uintptr_t)s) & LIB_WORDMASK) == 0) {
+			while (!LIB_ALIGNED(tmp)) {
+				*tmp++ = *s++;
+				count--;
+			}
+
+			while (count >= LIB_WORDSIZE) {
+				*(lib_word_t *)tmp = *(lib_word_t *)s;
+				tmp += LIB_WORDSIZE;
+				s += LIB_WORDSIZE;
+				count -= LIB_WORDSIZE;
+			}
+		}
+#endif
 		while (count--) {
 			*tmp++ = *s++;
 		}
 	} else {
 		tmp = (char *)dest + count;
 		s = (char *)src + count;
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+		if (count >= 2 * LIB_WORDSIZE && (((uintptr_t)tmp ^ (uintptr_t)s) & LIB_WORDMASK) == 0) {
+			while (!LIB_ALIGNED(tmp)) {
+				*--tmp = *--s;
+				count--;
+			}
+
+			while (count >= LIB_WORDSIZE) {
+				tmp -= LIB_WORDSIZE;
+				s -= LIB_WORDSIZE;
+				*(lib_word_t *)tmp = *(lib_word_t *)s;
+				count -= LIB_WORDSIZE;
+			}
+		}
+#endif
 		while (count--) {
 			*--tmp = *--s;
 		}
@@ -82,7 +82,7 @@
 #ifndef CONFIG_ARCH_MEMSET
 void *memset(void *s, int c, size_t n)
 {
-#ifdef CONFIG_MEMSET_OPTSPEED
+#if defined(CONFIG_MEMSET_OPTSPEED) || defined(CONFIG_LIBC_STRING_OPTSPEED)
 	/* This version is optimized for speed (you could do better
 	 * still by exploiting processor caching or memory burst
 	 * knowledge.)
@@ -58,6 +58,8 @@
 
 #include <string.h>
 
+#include "lib_internal.h"
+
 /****************************************************************************
  * Global Functions
  ****************************************************************************/
@@ -80,8 +82,31 @@
 FAR char *strchr(FAR const char *s, int c)
 {
 	if (s) {
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+		lib_word_t mask = LIB_ONES * (unsigned char)c;
+		lib_word_t w;
+
+		for (; !LIB_ALIGNED(s); s++) {
+			if (*s == (char)c) {
+				return (FAR char *)s;
+			}
+
+			if (!*s) {
+				return NULL;
+			}
+		}
+
+		/* Skip the words that hold neither 'c' nor the NUL */
+
+		for (;; s += LIB_WORDSIZE) {
+			w = *(FAR const lib_word_t *)s;
+			if (LIB_HAS_ZERO(w) || LIB_HAS_ZERO(w ^ mask)) {
+				break;
+			}
+		}
+#endif
 		for (;; s++) {
-			if (*s == c) {
+			if (*s == (char)c) {
 				return (FAR char *)s;
 			}
 
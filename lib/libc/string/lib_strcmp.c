@@ -58,6 +58,8 @@
 
 #include <string.h>
 
+#include "lib_internal.h"
+
 /****************************************************************************
  * Public Functions
  *****************************************************************************/
@@ -65,9 +67,29 @@
 #ifndef CONFIG_ARCH_STRCMP
 int strcmp(const char *cs, const char *ct)
 {
-	register signed char result;
+	register int result;
+
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+	/* Skip the equal words without a NUL when both strings share the same
+	 * alignment
+	 */
+
+	if ((((uintptr_t)cs ^ (uintptr_t)ct) & LIB_WORDMASK) == 0) {
+		for (; !LIB_ALIGNED(cs); cs++, ct++) {
+			if (*cs != *ct || !*cs) {
+				return (unsigned char)*cs - (unsigned char)*ct;
+			}
+		}
+
+		while (*(const lib_word_t *)cs == *(const lib_word_t *)ct && !LIB_HAS_ZERO(*(const lib_word_t *)cs)) {
+			cs += LIB_WORDSIZE;
+			ct += LIB_WORDSIZE;
+		}
+	}
+#endif
+
 	for (;;) {
-		if ((result = *cs - *ct++) != 0 || !*cs++) {
+		if ((result = (unsigned char)*cs - (unsigned char)*ct++) != 0 || !*cs++) {
 			break;
 		}
 	}
@@ -58,6 +58,8 @@
 
 #include <string.h>
 
+#include "lib_internal.h"
+
 /************************************************************************
  * Public Functions
  ************************************************************************/
@@ -78,6 +80,27 @@
 FAR char *strcpy(FAR char *dest, FAR const char *src)
 {
 	char *tmp = dest;
+
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+	/* Copy the words without a NUL when both pointers share the same
+	 * alignment
+	 */
+
+	if ((((uintptr_t)dest ^ (uintptr_t)src) & LIB_WORDMASK) == 0) {
+		for (; !LIB_ALIGNED(src); src++) {
+			if ((*dest++ = *src) == '\0') {
+				return tmp;
+			}
+		}
+
+		while (!LIB_HAS_ZERO(*(FAR const lib_word_t *)src)) {
+			*(FAR lib_word_t *)dest = *(FAR const lib_word_t *)src;
+			dest += LIB_WORDSIZE;
+			src += LIB_WORDSIZE;
+		}
+	}
+#endif
+
 	while ((*dest++ = *src++) != '\0');
 	return tmp;
 }
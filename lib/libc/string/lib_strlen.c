@@ -58,6 +58,8 @@
 #include <sys/types.h>
 #include <string.h>
 
+#include "lib_internal.h"
+
 /****************************************************************************
  * Global Functions
  ****************************************************************************/
@@ -69,7 +71,24 @@ size_t strlen(const char *s)
 	if (s == NULL) {
 		return 0;
 	}
-	for (sc = s; *sc != '\0'; ++sc);
+#ifdef CONFIG_LIBC_STRING_OPTSPEED
+	/* Align, then skip the words without a NUL.  The aligned loads never
+	 * read past the word holding the NUL.
+	 */
+
+	for (sc = s; !LIB_ALIGNED(sc); ++sc) {
+		if (*sc == '\0') {
+			return sc - s;
+		}
+	}
+
+	while (!LIB_HAS_ZERO(*(const lib_word_t *)sc)) {
+		sc += LIB_WORDSIZE;
+	}
+#else
+	sc = s;
+#endif
+	for (; *sc != '\0'; ++sc);
 	return sc - s;
 }
 #endif
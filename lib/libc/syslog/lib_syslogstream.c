@@ -106,6 +106,21 @@ static void syslogstream_putc(FAR struct lib_outstream_s *this, int ch)
 	} while (errno == -EINTR);
 }
 
+/****************************************************************************
+ * Name: syslogstream_puts
+ ****************************************************************************/
+
+static void syslogstream_puts(FAR struct lib_outstream_s *this, FAR const char *buf, int len)
+{
+	/* The logging device takes one character at a time, but this saves the
+	 * call through the stream for each of them.
+	 */
+
+	while (len-- > 0) {
+		syslogstream_putc(this, *buf++);
+	}
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -128,6 +143,7 @@ static void syslogstream_putc(FAR struct lib_outstream_s *this, int ch)
 void lib_syslogstream(FAR struct lib_outstream_s *stream)
 {
 	stream->put = syslogstream_putc;
+	stream->puts = syslogstream_puts;
 #ifdef CONFIG_STDIO_LINEBUFFER
 	stream->flush = lib_noflush;
 #endif
@@ -37,6 +37,9 @@
 #include "mpu.h"
 #endif
 #include <tinyara/arch.h>
+#if defined(CONFIG_PTHREAD_MUTEX_FASTPATH) && defined(CONFIG_APP_BINARY_SEPARATION)
+#include <tinyara/userspace.h>
+#endif
 
 #include "up_internal.h"
 #include "sched/sched.h"
@@ -92,6 +95,14 @@ void up_restoretask(struct tcb_s *tcb)
 #endif
 #endif
 
+#if defined(CONFIG_PTHREAD_MUTEX_FASTPATH) && defined(CONFIG_APP_BINARY_SEPARATION)
+		/* Tell the user space mutex fast path which thread is running */
+
+		if (tcb->uspace && ((struct userspace_s *)tcb->uspace)->curr_pid) {
+			*((struct userspace_s *)tcb->uspace)->curr_pid = tcb->pid;
+		}
+#endif
+
 #ifdef CONFIG_TASK_MONITOR
 		/* Update tcb active flag for monitoring. */
 		tcb->is_active = true;
@@ -78,6 +78,9 @@
  ****************************************************************************/
 
 static size_t do_stackcheck(uintptr_t alloc, size_t size);
+#ifdef CONFIG_STACK_HWM
+static ssize_t do_stackcheck_range(uintptr_t alloc, size_t size, size_t offset, size_t nbytes);
+#endif
 
 /****************************************************************************
  * Name: do_stackcheck
@@ -146,6 +149,62 @@ static size_t do_stackcheck(uintptr_t alloc, size_t size)
 	return mark << 2;
 }
 
+#ifdef CONFIG_STACK_HWM
+/****************************************************************************
+ * Name: do_stackcheck_range
+ *
+ * Description:
+ *   Search a part of the stack memory for the high water mark, so that the
+ *   search of a large stack can be spread over several calls.
+ *
+ * Input Parameters:
+ *   alloc - Allocation base address of the stack
+ *   size - The size of the stack in bytes
+ *   offset - Offset of the part from the lowest address of the stack
+ *   nbytes - The size of the part in bytes
+ *
+ * Returned Value:
+ *   The estimated amount of stack space used if the high water mark is in
+ *   the part, or -1 if the whole part still holds the marker.
+ *
+ ****************************************************************************/
+
+static ssize_t do_stackcheck_range(uintptr_t alloc, size_t size, size_t offset, size_t nbytes)
+{
+	FAR uintptr_t start;
+	FAR uintptr_t end;
+	FAR uint32_t *ptr;
+	FAR uint32_t *last;
+
+	/* Get aligned addresses of the top and bottom of the stack */
+
+#ifdef CONFIG_TLS
+	start = alloc + sizeof(struct tls_info_s);
+#else
+	start = alloc & ~3;
+#endif
+	end = (alloc + size + 3) & ~3;
+
+	/* Search up from the lowest address of the part, as do_stackcheck() does
+	 * from the lowest address of the stack.
+	 */
+
+	ptr = (FAR uint32_t *)(start + (offset & ~3));
+	last = (FAR uint32_t *)(start + ((offset + nbytes) & ~3));
+	if ((uintptr_t)last > end) {
+		last = (FAR uint32_t *)end;
+	}
+
+	for (; ptr < last; ptr++) {
+		if (*ptr != STACK_COLOR) {
+			return end - (uintptr_t)ptr;
+		}
+	}
+
+	return -1;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -186,6 +245,13 @@ ssize_t up_check_stack_remain(void)
 	return up_check_tcbstack_remain(this_task());
 }
 
+#ifdef CONFIG_STACK_HWM
+ssize_t up_check_tcbstack_range(FAR struct tcb_s *tcb, size_t offset, size_t nbytes)
+{
+	return do_stackcheck_range((uintptr_t)tcb->stack_alloc_ptr, tcb->adj_stack_size, offset, nbytes);
+}
+#endif
+
 #if CONFIG_ARCH_INTERRUPTSTACK > 3
 size_t up_check_intstack(void)
 {
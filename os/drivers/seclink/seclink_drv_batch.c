@@ -0,0 +1,73 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+#include <tinyara/config.h>
+
+#include <stdio.h>
+#include <errno.h>
+#include <tinyara/seclink.h>
+#include <tinyara/seclink_drv.h>
+
+#include "seclink_drv_req.h"
+#include "seclink_drv_utils.h"
+
+/*  Debugging */
+#ifdef SLDRV_TAG
+#undef SLDRV_TAG
+#endif
+#define SLDRV_TAG "[SECLINK_DRV_BATCH]"
+
+/*  Run the requests of a batch in one call. A request that the HAL fails
+ *  does not stop the batch, its result is returned in its own request.
+ */
+int hd_handle_batch_request(int cmd, unsigned long arg, void *lower)
+{
+	SLDRV_ENTER;
+	int res = 0;
+	struct seclink_batch_req *breq = (struct seclink_batch_req *)arg;
+	if (!breq || (breq->nops && !breq->ops)) {
+		return -EINVAL;
+	}
+
+	breq->ndone = 0;
+	for (uint32_t i = 0; i < breq->nops; i++) {
+		struct seclink_batch_op *op = &breq->ops[i];
+		unsigned long op_arg = (unsigned long)&op->req;
+
+		/*  common requests and nested batches are not allowed */
+		if (SL_IS_COMMON_REQ(op->cmd)) {
+			res = -EINVAL;
+		} else if (SL_IS_AUTH_REQ(op->cmd)) {
+			res = hd_handle_auth_request(op->cmd, op_arg, lower);
+		} else if (SL_IS_KEYMGR_REQ(op->cmd)) {
+			res = hd_handle_key_request(op->cmd, op_arg, lower);
+		} else if (SL_IS_SS_REQ(op->cmd)) {
+			res = hd_handle_ss_request(op->cmd, op_arg, lower);
+		} else if (SL_IS_CRYPTO_REQ(op->cmd)) {
+			res = hd_handle_crypto_request(op->cmd, op_arg, lower);
+		} else {
+			res = -ENOSYS;
+		}
+
+		if (res < 0) {
+			break;
+		}
+		breq->ndone++;
+	}
+
+	return res;
+}
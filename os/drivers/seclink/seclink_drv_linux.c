@@ -9,12 +9,6 @@
 #include "seclink_drv_req.h"
 #include "seclink_drv_utils.h"
 
-#define SL_IS_COMMON_REQ(cmd)  ((cmd & 0xf0) == 0)
-#define SL_IS_CRYPTO_REQ(cmd)  ((cmd & 0xf0) & (SECLINKIOC_CRYPTO & 0xf0))
-#define SL_IS_AUTH_REQ(cmd)    ((cmd & 0xf0) & (SECLINKIOC_AUTH & 0xf0))
-#define SL_IS_SS_REQ(cmd)      ((cmd & 0xf0) & (SECLINKIOC_SS & 0xf0))
-#define SL_IS_KEYMGR_REQ(cmd)  ((cmd & 0xf0) & (SECLINKIOC_KEYMGR & 0xf0))
-
 extern struct sec_lowerhalf_s *se_get_device(void);
 
 static struct sec_upperhalf_s *g_upper = NULL;
@@ -29,7 +23,9 @@ sl_post_msg(int fd, int cmd, unsigned long arg)
 	}
 
 	int res = 0;
-	if (SL_IS_COMMON_REQ(cmd)) {
+	if (SL_IS_BATCH_REQ(cmd)) {
+		res = hd_handle_batch_request(cmd, arg, (void *)upper->lower);
+	} else if (SL_IS_COMMON_REQ(cmd)) {
 		res = hd_handle_common_request(cmd, arg, (void *)upper->lower);
 	} else if (SL_IS_AUTH_REQ(cmd)) {
 		res = hd_handle_auth_request(cmd, arg, (void *)upper->lower);
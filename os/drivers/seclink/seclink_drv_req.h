@@ -18,11 +18,19 @@
 #ifndef __SECLINK_DRV_REQ_H__
 #define __SECLINK_DRV_REQ_H__
 
+#define SL_IS_COMMON_REQ(cmd)  ((cmd & 0xf0) == 0)
+#define SL_IS_BATCH_REQ(cmd)   (cmd == SECLINKIOC_BATCH)
+#define SL_IS_CRYPTO_REQ(cmd)  ((cmd & 0xf0) & (SECLINKIOC_CRYPTO & 0xf0))
+#define SL_IS_AUTH_REQ(cmd)    ((cmd & 0xf0) & (SECLINKIOC_AUTH & 0xf0))
+#define SL_IS_SS_REQ(cmd)      ((cmd & 0xf0) & (SECLINKIOC_SS & 0xf0))
+#define SL_IS_KEYMGR_REQ(cmd)  ((cmd & 0xf0) & (SECLINKIOC_KEYMGR & 0xf0))
+
 int hd_handle_common_request(int cmd, unsigned long arg, void *lower);
 int hd_handle_auth_request(int cmd, unsigned long arg, void *lower);
 int hd_handle_key_request(int cmd, unsigned long arg, void *lower);
 int hd_handle_ss_request(int cmd, unsigned long arg, void *lower);
 int hd_handle_crypto_request(int cmd, unsigned long arg, void *lower);
+int hd_handle_batch_request(int cmd, unsigned long arg, void *lower);
 
 #endif // __SECLINK_DRV_REQ_H__
 
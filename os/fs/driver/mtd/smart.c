@@ -459,7 +459,9 @@ static uint16_t smart_findfreephyssector(FAR struct smart_struct_s *dev, uint8_t
 static int smart_writesector(FAR struct smart_struct_s *dev, unsigned long arg);
 #endif
 static int smart_readsector(FAR struct smart_struct_s *dev, unsigned long arg);
+static int smart_readsectors(FAR struct smart_struct_s *dev, unsigned long arg);
 #ifdef CONFIG_FS_WRITABLE
+static int smart_writesectors(FAR struct smart_struct_s *dev, unsigned long arg);
 static int smart_allocsector(FAR struct smart_struct_s *dev, unsigned long requested);
 #endif
 #ifdef CONFIG_MTD_SMART_WEAR_LEVEL
@@ -4352,6 +4354,31 @@ static int smart_writesector(FAR struct smart_struct_s *dev, unsigned long arg)
 
 	return OK;
 }
+
+/****************************************************************************
+ * Name: smart_writesectors
+ *
+ * Description:  Perform a batch of logical sector writes described by a
+ *               struct smart_multi_rw_s.  Stops at the first failing write.
+ *
+ ****************************************************************************/
+
+static int smart_writesectors(FAR struct smart_struct_s *dev, unsigned long arg)
+{
+	FAR struct smart_multi_rw_s *multi;
+	uint16_t x;
+	int ret;
+
+	multi = (FAR struct smart_multi_rw_s *)arg;
+	for (x = 0; x < multi->nreqs; x++) {
+		ret = smart_writesector(dev, (unsigned long)&multi->reqs[x]);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return OK;
+}
 #endif							/* CONFIG_FS_WRITABLE */
 
 /****************************************************************************
@@ -4471,6 +4498,37 @@ static int smart_readsector(FAR struct smart_struct_s *dev, unsigned long arg)
 	return ret;
 }
 
+/****************************************************************************
+ * Name: smart_readsectors
+ *
+ * Description:  Perform a batch of logical sector reads described by a
+ *               struct smart_multi_rw_s, each one straight into its own
+ *               destination buffer.  Returns the total number of bytes
+ *               read or the error of the first failing read.
+ *
+ ****************************************************************************/
+
+static int smart_readsectors(FAR struct smart_struct_s *dev, unsigned long arg)
+{
+	FAR struct smart_multi_rw_s *multi;
+	uint16_t x;
+	int total;
+	int ret;
+
+	multi = (FAR struct smart_multi_rw_s *)arg;
+	total = 0;
+	for (x = 0; x < multi->nreqs; x++) {
+		ret = smart_readsector(dev, (unsigned long)&multi->reqs[x]);
+		if (ret < 0) {
+			return ret;
+		}
+
+		total += ret;
+	}
+
+	return total;
+}
+
 /****************************************************************************
  * Name: smart_allocsector
  *
@@ -4848,6 +4906,13 @@ static int smart_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
 		ret = smart_readsector(dev, arg);
 		goto ok_out;
 
+	case BIOC_READSECTS:
+
+		/* Read a batch of logical sectors. */
+
+		ret = smart_readsectors(dev, arg);
+		goto ok_out;
+
 #ifdef CONFIG_FS_WRITABLE
 	case BIOC_LLFORMAT:
 
@@ -4881,6 +4946,22 @@ static int smart_ioctl(FAR struct inode *inode, int cmd, unsigned long arg)
 
 		ret = smart_writesector(dev, arg);
 
+#ifdef CONFIG_MTD_SMART_WEAR_LEVEL
+		if (dev->wearflags & SMART_WEARFLAGS_WRITE_NEEDED) {
+			/* Write new wear status bits to the device. */
+
+			smart_write_wearstatus(dev);
+		}
+#endif
+
+		goto ok_out;
+
+	case BIOC_WRITESECTS:
+
+		/* Write a batch of logical sectors. */
+
+		ret = smart_writesectors(dev, arg);
+
 #ifdef CONFIG_MTD_SMART_WEAR_LEVEL
 		if (dev->wearflags & SMART_WEARFLAGS_WRITE_NEEDED) {
 			/* Write new wear status bits to the device. */
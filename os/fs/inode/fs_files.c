@@ -130,6 +130,12 @@ static int _files_close(FAR struct file *filep)
 	/* Check if the struct file is open (i.e., assigned an inode) */
 
 	if (inode) {
+#if defined(CONFIG_FS_EPOLL) && !defined(CONFIG_DISABLE_POLL)
+		/* Drop the epoll registrations before the driver goes away */
+
+		epoll_fileclose(filep);
+#endif
+
 		/* Close the file, driver, or mountpoint. */
 
 		if (inode->u.i_ops && inode->u.i_ops->close) {
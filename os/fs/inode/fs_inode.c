@@ -61,6 +61,7 @@
 #include <errno.h>
 
 #include <tinyara/kmalloc.h>
+#include <tinyara/irq.h>
 #include <tinyara/fs/fs.h>
 
 #include "inode/inode.h"
@@ -69,7 +70,7 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
-#define NO_HOLDER (pid_t)-1;
+#define NO_HOLDER ((pid_t)-1)
 
 /****************************************************************************
  * Private Types
@@ -86,6 +87,11 @@ struct inode_sem_s {
 	sem_t sem;					/* The semaphore */
 	pid_t holder;				/* The current holder of the semaphore */
 	int16_t count;				/* Number of counts held */
+#ifdef CONFIG_FS_INODE_CACHE
+	int16_t readers;			/* Number of tasks holding the read lock */
+	bool drainwait;				/* The holder waits for readers to leave */
+	sem_t drain;				/* Posted when the last reader leaves */
+#endif
 };
 
 /****************************************************************************
@@ -190,6 +196,11 @@ void inode_initialize(void)
 	(void)sem_init(&g_inode_sem.sem, 0, 1);
 	g_inode_sem.holder = NO_HOLDER;
 	g_inode_sem.count = 0;
+#ifdef CONFIG_FS_INODE_CACHE
+	(void)sem_init(&g_inode_sem.drain, 0, 0);
+	g_inode_sem.readers = 0;
+	g_inode_sem.drainwait = false;
+#endif
 
 	/* Initialize files array (if it is used) */
 
@@ -212,6 +223,9 @@ void inode_initialize(void)
 void inode_semtake(void)
 {
 	pid_t me;
+#ifdef CONFIG_FS_INODE_CACHE
+	irqstate_t flags;
+#endif
 
 	/* Do we already hold the semaphore? */
 
@@ -236,8 +250,27 @@ void inode_semtake(void)
 
 		/* No we hold the semaphore */
 
+#ifdef CONFIG_FS_INODE_CACHE
+		/* Readers may still be looking at the tree.  New readers will see
+		 * the holder and queue up behind us; wait for the current ones to
+		 * leave.
+		 */
+
+		flags = irqsave();
+		g_inode_sem.holder = me;
+		g_inode_sem.count = 1;
+		g_inode_sem.drainwait = (g_inode_sem.readers > 0);
+		irqrestore(flags);
+
+		if (g_inode_sem.drainwait) {
+			while (sem_wait(&g_inode_sem.drain) != 0) {
+				ASSERT(get_errno() == EINTR);
+			}
+		}
+#else
 		g_inode_sem.holder = me;
 		g_inode_sem.count = 1;
+#endif
 	}
 }
 
@@ -264,12 +297,78 @@ void inode_semgive(void)
 	/* Yes.. then we can really release the semaphore */
 
 	else {
+#ifdef CONFIG_FS_INODE_CACHE
+		/* Nobody else can see the tree now; bring the lookup hash up to
+		 * date with whatever we changed.
+		 */
+
+		inode_cache_rebuild();
+#endif
 		g_inode_sem.holder = NO_HOLDER;
 		g_inode_sem.count = 0;
 		sem_post(&g_inode_sem.sem);
 	}
 }
 
+#ifdef CONFIG_FS_INODE_CACHE
+/****************************************************************************
+ * Name: inode_rdtake
+ *
+ * Description:
+ *   Get shared, read-only access to the in-memory inode tree.  Any number
+ *   of readers may hold the lock together; they only exclude holders of
+ *   inode_semtake().  Returns true if the lock was taken exclusively
+ *   instead, which must be passed back to inode_rdgive().
+ *
+ ****************************************************************************/
+
+bool inode_rdtake(void)
+{
+	irqstate_t flags;
+
+	flags = irqsave();
+	if (g_inode_sem.holder == NO_HOLDER) {
+		g_inode_sem.readers++;
+		irqrestore(flags);
+		return false;
+	}
+
+	irqrestore(flags);
+
+	/* Someone (maybe us) holds the tree exclusively, wait our turn */
+
+	inode_semtake();
+	return true;
+}
+
+/****************************************************************************
+ * Name: inode_rdgive
+ *
+ * Description:
+ *   Release access taken with inode_rdtake().
+ *
+ ****************************************************************************/
+
+void inode_rdgive(bool exclusive)
+{
+	irqstate_t flags;
+
+	if (exclusive) {
+		inode_semgive();
+		return;
+	}
+
+	flags = irqsave();
+	DEBUGASSERT(g_inode_sem.readers > 0);
+	if (--g_inode_sem.readers == 0 && g_inode_sem.drainwait) {
+		g_inode_sem.drainwait = false;
+		sem_post(&g_inode_sem.drain);
+	}
+
+	irqrestore(flags);
+}
+#endif
+
 /****************************************************************************
  * Name: inode_search
  *
@@ -289,6 +388,16 @@ FAR struct inode *inode_search(FAR const char **path, FAR struct inode **peer, F
 	FAR struct inode *left = NULL;
 	FAR struct inode *above = NULL;
 
+#ifdef CONFIG_FS_INODE_CACHE
+	/* Plain lookups can use the hashed caches.  Callers that need the
+	 * neighbours of the node in order to modify the tree walk the lists.
+	 */
+
+	if (!peer && !parent && inode_cache_search(path, relpath, &node)) {
+		return node;
+	}
+#endif
+
 	while (node) {
 		int result = _inode_compare(name, node);
 
@@ -0,0 +1,351 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * fs/inode/fs_inodecache.c
+ *
+ * Lookup acceleration for the pseudo-filesystem inode tree:
+ *
+ * - A hash table indexed by (parent inode, child name) replaces the walk
+ *   along each sibling list in inode_search().  It is rebuilt by the last
+ *   writer leaving the inode semaphore after the tree has changed.
+ * - A small table of recently resolved full paths maps a path string
+ *   directly to its inode.
+ *
+ * Both are only used while they match the current shape of the tree, so a
+ * lookup made while the tree is being modified falls back to the plain
+ * sibling list walk.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <debug.h>
+
+#include <tinyara/irq.h>
+#include <tinyara/fs/fs.h>
+
+#include "inode/inode.h"
+
+#ifdef CONFIG_FS_INODE_CACHE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define INODE_HASH_MASK           (CONFIG_FS_INODE_HASH_SIZE - 1)
+
+#if (CONFIG_FS_INODE_HASH_SIZE & INODE_HASH_MASK) != 0
+#error "CONFIG_FS_INODE_HASH_SIZE must be a power of two"
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One slot of the open-addressed child hash table */
+
+struct inode_hslot_s {
+	FAR struct inode *parent;	/* Parent inode (NULL for top level) */
+	FAR struct inode *node;		/* Child inode, NULL if the slot is free */
+};
+
+/* One recently resolved path */
+
+struct inode_pslot_s {
+	uint32_t gen;				/* Tree generation the entry is valid for */
+	FAR struct inode *node;		/* Inode the path resolved to */
+	char path[CONFIG_FS_INODE_PATHCACHE_NAMELEN];
+};
+
+/****************************************************************************
+ * Private Variables
+ ****************************************************************************/
+
+/* Incremented on every change of the tree shape.  Starts at one so that a
+ * zeroed path cache entry is never valid.
+ */
+
+static uint32_t g_inode_gen = 1;
+
+/* Generation the hash table was built for, or zero if it is unusable */
+
+static uint32_t g_inode_hashgen;
+
+static struct inode_hslot_s g_inode_hash[CONFIG_FS_INODE_HASH_SIZE];
+
+#if CONFIG_FS_INODE_PATHCACHE_SIZE > 0
+static struct inode_pslot_s g_inode_paths[CONFIG_FS_INODE_PATHCACHE_SIZE];
+static uint8_t g_inode_nextpath;
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: inode_hash
+ *
+ * Description:
+ *   Hash one path segment (terminated by '/' or NUL) together with the
+ *   parent inode it is looked up in.  The segment length is returned in
+ *   'len'.
+ *
+ ****************************************************************************/
+
+static uint32_t inode_hash(FAR struct inode *parent, FAR const char *name, FAR size_t *len)
+{
+	uint32_t hash = 2166136261u ^ (uint32_t)(uintptr_t)parent;
+	FAR const char *ptr = name;
+
+	while (*ptr && *ptr != '/') {
+		hash ^= (uint8_t)*ptr++;
+		hash *= 16777619u;
+	}
+
+	*len = ptr - name;
+	return hash;
+}
+
+/****************************************************************************
+ * Name: inode_hash_insert
+ ****************************************************************************/
+
+static bool inode_hash_insert(FAR struct inode *parent, FAR struct inode *node, FAR int *count)
+{
+	uint32_t index;
+	size_t len;
+
+	for (; node; node = node->i_peer) {
+		/* Keep the table at most 3/4 full so probe sequences stay short */
+
+		if (++(*count) > (CONFIG_FS_INODE_HASH_SIZE * 3) / 4) {
+			return false;
+		}
+
+		index = inode_hash(parent, node->i_name, &len) & INODE_HASH_MASK;
+		while (g_inode_hash[index].node != NULL) {
+			index = (index + 1) & INODE_HASH_MASK;
+		}
+
+		g_inode_hash[index].parent = parent;
+		g_inode_hash[index].node = node;
+
+		/* Mountpoints absorb everything below them, so their children are
+		 * never looked up by name.
+		 */
+
+		if (!INODE_IS_MOUNTPT(node) && !inode_hash_insert(node, node->i_child, count)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/****************************************************************************
+ * Name: inode_hash_find
+ ****************************************************************************/
+
+static FAR struct inode *inode_hash_find(FAR struct inode *parent, FAR const char *name)
+{
+	FAR struct inode *node;
+	uint32_t index;
+	size_t len;
+
+	index = inode_hash(parent, name, &len) & INODE_HASH_MASK;
+	while ((node = g_inode_hash[index].node) != NULL) {
+		if (g_inode_hash[index].parent == parent && strncmp(node->i_name, name, len) == 0 && node->i_name[len] == '\0') {
+			return node;
+		}
+
+		index = (index + 1) & INODE_HASH_MASK;
+	}
+
+	return NULL;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: inode_cache_invalidate
+ *
+ * Description:
+ *   Record that the shape of the inode tree changed.  Must be called with
+ *   the inode semaphore held whenever a node is linked into or out of the
+ *   tree.
+ *
+ ****************************************************************************/
+
+void inode_cache_invalidate(void)
+{
+	g_inode_gen++;
+	if (g_inode_gen == 0) {
+		g_inode_gen = 1;
+	}
+}
+
+/****************************************************************************
+ * Name: inode_cache_rebuild
+ *
+ * Description:
+ *   Rebuild the child hash table if the tree changed since it was built.
+ *   Called by the last holder releasing the inode semaphore, when nobody
+ *   else can be looking at the tree.
+ *
+ ****************************************************************************/
+
+void inode_cache_rebuild(void)
+{
+	int count = 0;
+
+	if (g_inode_hashgen == g_inode_gen) {
+		return;
+	}
+
+	memset(g_inode_hash, 0, sizeof(g_inode_hash));
+	if (inode_hash_insert(NULL, root_inode, &count)) {
+		g_inode_hashgen = g_inode_gen;
+	} else {
+		/* Too many nodes; stay with the sibling list walk */
+
+		fvdbg("Inode hash too small for %d nodes\n", count);
+		g_inode_hashgen = 0;
+	}
+}
+
+/****************************************************************************
+ * Name: inode_cache_search
+ *
+ * Description:
+ *   Resolve 'path' with the lookup caches, with the same results as
+ *   inode_search() called without peer and parent.
+ *
+ * Returned Value:
+ *   true if the caches could answer (*node is then the found inode or NULL
+ *   if there is none), false if the caller has to walk the tree.
+ *
+ * Assumptions:
+ *   The caller holds the inode semaphore or the inode read lock.
+ *
+ ****************************************************************************/
+
+bool inode_cache_search(FAR const char **path, FAR const char **relpath, FAR struct inode **result)
+{
+	FAR const char *name = *path + 1;	/* Skip over leading '/' */
+	FAR struct inode *above = NULL;
+	FAR struct inode *node;
+#if CONFIG_FS_INODE_PATHCACHE_SIZE > 0
+	FAR struct inode_pslot_s *slot;
+	irqstate_t flags;
+	size_t pathlen;
+	int i;
+#endif
+	size_t len;
+
+	if (g_inode_hashgen != g_inode_gen) {
+		return false;
+	}
+
+#if CONFIG_FS_INODE_PATHCACHE_SIZE > 0
+	/* Look for the full path among the recently resolved ones.  Several
+	 * readers may be here at once, so the table is only touched with
+	 * interrupts disabled.
+	 */
+
+	pathlen = strlen(*path);
+	if (pathlen < CONFIG_FS_INODE_PATHCACHE_NAMELEN) {
+		flags = irqsave();
+		for (i = 0; i < CONFIG_FS_INODE_PATHCACHE_SIZE; i++) {
+			slot = &g_inode_paths[i];
+			if (slot->gen == g_inode_gen && strcmp(slot->path, *path) == 0) {
+				node = slot->node;
+				irqrestore(flags);
+
+				if (relpath) {
+					*relpath = *path + pathlen;
+				}
+
+				*path += pathlen;
+				*result = node;
+				return true;
+			}
+		}
+
+		irqrestore(flags);
+	}
+#endif
+
+	/* Resolve the path one segment at a time */
+
+	for (;;) {
+		(void)inode_hash(above, name, &len);
+		if (len == 0) {
+			/* Empty segment ("//" or trailing '/'), let the tree walk
+			 * decide what that means.
+			 */
+
+			return false;
+		}
+
+		node = inode_hash_find(above, name);
+		if (node == NULL) {
+			break;
+		}
+
+		name = inode_nextname(name);
+		if (!*name || INODE_IS_MOUNTPT(node)) {
+			if (relpath) {
+				*relpath = name;
+			}
+
+#if CONFIG_FS_INODE_PATHCACHE_SIZE > 0
+			/* Remember complete paths to pseudo-filesystem nodes.  Paths
+			 * below mountpoints are not cached, there are too many of them.
+			 */
+
+			if (!*name && pathlen < CONFIG_FS_INODE_PATHCACHE_NAMELEN) {
+				flags = irqsave();
+				slot = &g_inode_paths[g_inode_nextpath];
+				g_inode_nextpath = (g_inode_nextpath + 1) % CONFIG_FS_INODE_PATHCACHE_SIZE;
+				strncpy(slot->path, *path, CONFIG_FS_INODE_PATHCACHE_NAMELEN);
+				slot->node = node;
+				slot->gen = g_inode_gen;
+				irqrestore(flags);
+			}
+#endif
+			break;
+		}
+
+		above = node;
+	}
+
+	*path = name;
+	*result = node;
+	return true;
+}
+
+#endif							/* CONFIG_FS_INODE_CACHE */
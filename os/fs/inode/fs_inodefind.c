@@ -57,6 +57,7 @@
 #include <tinyara/config.h>
 
 #include <errno.h>
+#include <tinyara/irq.h>
 #include <tinyara/fs/fs.h>
 
 #include "inode/inode.h"
@@ -93,6 +94,10 @@
 FAR struct inode *inode_find(FAR const char *path, FAR const char **relpath)
 {
 	FAR struct inode *node;
+#ifdef CONFIG_FS_INODE_CACHE
+	irqstate_t flags;
+	bool exclusive;
+#endif
 
 	if (!path || !*path || path[0] != '/') {
 		return NULL;
@@ -102,6 +107,21 @@ FAR struct inode *inode_find(FAR const char *path, FAR const char **relpath)
 	 * references on the node.
 	 */
 
+#ifdef CONFIG_FS_INODE_CACHE
+	/* Lookups only need shared access to the tree.  Other readers may be
+	 * bumping the same reference count, so do that with interrupts off.
+	 */
+
+	exclusive = inode_rdtake();
+	node = inode_search(&path, (FAR struct inode **)NULL, (FAR struct inode **)NULL, relpath);
+	if (node) {
+		flags = irqsave();
+		node->i_crefs++;
+		irqrestore(flags);
+	}
+
+	inode_rdgive(exclusive);
+#else
 	inode_semtake();
 	node = inode_search(&path, (FAR struct inode **)NULL, (FAR struct inode **)NULL, relpath);
 	if (node) {
@@ -109,5 +129,6 @@ FAR struct inode *inode_find(FAR const char *path, FAR const char **relpath)
 	}
 
 	inode_semgive();
+#endif
 	return node;
 }
@@ -136,6 +136,9 @@ FAR struct inode *inode_unlink(FAR const char *path)
 		}
 
 		node->i_peer = NULL;
+#ifdef CONFIG_FS_INODE_CACHE
+		inode_cache_invalidate();
+#endif
 	}
 
 	return node;
@@ -172,6 +172,34 @@ void inode_semtake(void);
 
 void inode_semgive(void);
 
+#ifdef CONFIG_FS_INODE_CACHE
+/****************************************************************************
+ * Name: inode_rdtake / inode_rdgive
+ *
+ * Description:
+ *   Get and relinquish shared access to the in-memory inode tree for
+ *   lookups that do not modify it.  inode_rdtake() returns true if
+ *   exclusive access had to be taken; pass that to inode_rdgive().
+ *
+ ****************************************************************************/
+
+bool inode_rdtake(void);
+void inode_rdgive(bool exclusive);
+
+/****************************************************************************
+ * Name: inode_cache_invalidate / inode_cache_rebuild / inode_cache_search
+ *
+ * Description:
+ *   Maintenance and use of the hashed inode lookup caches
+ *   (see fs_inodecache.c).
+ *
+ ****************************************************************************/
+
+void inode_cache_invalidate(void);
+void inode_cache_rebuild(void);
+bool inode_cache_search(FAR const char **path, FAR const char **relpath, FAR struct inode **result);
+#endif
+
 /****************************************************************************
  * Name: inode_search
  *
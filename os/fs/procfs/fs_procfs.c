@@ -94,6 +94,8 @@
 
 extern const struct procfs_operations proc_operations;
 extern const struct procfs_operations cpuload_operations;
+extern const struct procfs_operations heapprof_operations;
+extern const struct procfs_operations stackhwm_operations;
 extern const struct procfs_operations uptime_operations;
 extern const struct procfs_operations version_operations;
 #if defined(CONFIG_LOG_DUMP)
@@ -132,6 +134,14 @@ static const struct procfs_entry_s g_procfsentries[] = {
 	{"cpuload", &cpuload_operations},
 #endif
 
+#if defined(CONFIG_MM_HEAPPROF) && !defined(CONFIG_FS_PROCFS_EXCLUDE_HEAPPROF)
+	{"heapprof", &heapprof_operations},
+#endif
+
+#if defined(CONFIG_STACK_HWM) && !defined(CONFIG_FS_PROCFS_EXCLUDE_STACKHWM)
+	{"stackhwm", &stackhwm_operations},
+#endif
+
 #if defined(CONFIG_LOG_DUMP)
 	{"logsave", &logsave_operations},
 #endif
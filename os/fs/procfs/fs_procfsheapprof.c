@@ -0,0 +1,349 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/statfs.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/clock.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/procfs.h>
+#include <tinyara/mm/mm.h>
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_MM_HEAPPROF) && !defined(CONFIG_FS_PROCFS_EXCLUDE_HEAPPROF)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+/* Determines the size of an intermediate buffer that must be large enough
+ * to handle the longest line generated by this logic.
+ */
+
+#define HEAPPROF_LINELEN 96
+
+/* The file is made of the header line, one line per call site, one line
+ * per histogram bucket, one line per sample and the trailer line.  Each
+ * line is generated again from the statistics when it is read.
+ */
+
+#define HEAPPROF_LINE_CALLSITE  1
+#define HEAPPROF_LINE_HIST      (HEAPPROF_LINE_CALLSITE + CONFIG_MM_HEAPPROF_NCALLSITES)
+#define HEAPPROF_LINE_SAMPLE    (HEAPPROF_LINE_HIST + HEAPPROF_NBUCKETS)
+#define HEAPPROF_LINE_TRAILER   (HEAPPROF_LINE_SAMPLE + CONFIG_MM_HEAPPROF_NSAMPLES)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* This structure describes one open "file" */
+
+struct heapprof_file_s {
+	struct procfs_file_s base;	/* Base open file structure */
+	char line[HEAPPROF_LINELEN];	/* Pre-allocated buffer for formatted lines */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int heapprof_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int heapprof_close(FAR struct file *filep);
+static ssize_t heapprof_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+static ssize_t heapprof_write(FAR struct file *filep, FAR const char *buffer, size_t buflen);
+
+static int heapprof_dup(FAR const struct file *oldp, FAR struct file *newp);
+
+static int heapprof_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+/* See fs_mount.c -- this structure is explicitly externed there.
+ * We use the old-fashioned kind of initializers so that this will compile
+ * with any compiler.
+ */
+
+const struct procfs_operations heapprof_operations = {
+	heapprof_open,				/* open */
+	heapprof_close,				/* close */
+	heapprof_read,				/* read */
+	heapprof_write,				/* write */
+
+	heapprof_dup,				/* dup */
+
+	NULL,						/* opendir */
+	NULL,						/* closedir */
+	NULL,						/* readdir */
+	NULL,						/* rewinddir */
+
+	heapprof_stat				/* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: heapprof_line
+ *
+ * Description:
+ *   Format line number 'index' of the file.  Returns the length of the
+ *   line, 0 for the unused entries of the tables and -1 past the end.
+ *
+ ****************************************************************************/
+
+static int heapprof_line(FAR char *line, int index)
+{
+	struct heapprof_stats_s stats;
+	struct heapprof_callsite_s callsite;
+	struct heapprof_sample_s sample;
+
+	if (index == 0) {
+		return snprintf(line, HEAPPROF_LINELEN, "heapprof %lu %d\n", (unsigned long)clock_systimer(), CLOCKS_PER_SEC);
+	}
+
+	if (index < HEAPPROF_LINE_HIST) {
+		heapprof_get_callsite(index - HEAPPROF_LINE_CALLSITE, &callsite);
+		if (callsite.addr == 0) {
+			return 0;
+		}
+
+		return snprintf(line, HEAPPROF_LINELEN, "callsite %08x %u %u %u %u %u %u %lu\n", callsite.addr, callsite.nallocs, callsite.nfrees, callsite.curr_size, callsite.peak_size, callsite.total_size, callsite.nlifetimes, (unsigned long)callsite.lifetime);
+	}
+
+	if (index < HEAPPROF_LINE_SAMPLE) {
+		index -= HEAPPROF_LINE_HIST;
+		heapprof_get_stats(&stats);
+		return snprintf(line, HEAPPROF_LINELEN, "hist %u %u\n", 1 << (index + HEAPPROF_BUCKET_SHIFT), stats.hist[index]);
+	}
+
+	if (index < HEAPPROF_LINE_TRAILER) {
+		heapprof_get_sample(index - HEAPPROF_LINE_SAMPLE, &sample);
+		if (sample.mem == NULL) {
+			return 0;
+		}
+
+		if (!sample.freed) {
+			return snprintf(line, HEAPPROF_LINELEN, "sample %08x %08x %u %d %lu -\n", (size_t)sample.mem, sample.addr, sample.size, sample.pid, (unsigned long)sample.alloc_time);
+		}
+
+		return snprintf(line, HEAPPROF_LINELEN, "sample %08x %08x %u %d %lu %lu\n", (size_t)sample.mem, sample.addr, sample.size, sample.pid, (unsigned long)sample.alloc_time, (unsigned long)sample.free_time);
+	}
+
+	if (index == HEAPPROF_LINE_TRAILER) {
+		heapprof_get_stats(&stats);
+		return snprintf(line, HEAPPROF_LINELEN, "total %u %u %u %u\n", stats.nallocs, stats.nfrees, stats.nlost_allocs, stats.nlost_frees);
+	}
+
+	return -1;
+}
+
+/****************************************************************************
+ * Name: heapprof_open
+ ****************************************************************************/
+
+static int heapprof_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct heapprof_file_s *attr;
+
+	fvdbg("Open '%s'\n", relpath);
+
+	/* "heapprof" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "heapprof") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* Allocate a container to hold the file attributes */
+
+	attr = (FAR struct heapprof_file_s *)kmm_zalloc(sizeof(struct heapprof_file_s));
+	if (!attr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* Save the attributes as the open-specific state in filep->f_priv */
+
+	filep->f_priv = (FAR void *)attr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: heapprof_close
+ ****************************************************************************/
+
+static int heapprof_close(FAR struct file *filep)
+{
+	FAR struct heapprof_file_s *attr;
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct heapprof_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	/* Release the file attributes structure */
+
+	kmm_free(attr);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: heapprof_read
+ ****************************************************************************/
+
+static ssize_t heapprof_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct heapprof_file_s *attr;
+	size_t copysize = 0;
+	off_t offset;
+	int linesize;
+	int index;
+
+	fvdbg("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct heapprof_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	/* Skip the lines before the file position and transfer the others until
+	 * the user buffer is full.
+	 */
+
+	offset = filep->f_pos;
+	for (index = 0; copysize < buflen; index++) {
+		linesize = heapprof_line(attr->line, index);
+		if (linesize < 0) {
+			break;
+		}
+
+		copysize += procfs_memcpy(attr->line, linesize, buffer + copysize, buflen - copysize, &offset);
+	}
+
+	/* Update the file offset */
+
+	filep->f_pos += copysize;
+	return copysize;
+}
+
+/****************************************************************************
+ * Name: heapprof_write
+ *
+ * Description:
+ *   Writing "reset" clears the statistics.
+ *
+ ****************************************************************************/
+
+static ssize_t heapprof_write(FAR struct file *filep, FAR const char *buffer, size_t buflen)
+{
+	if (buflen >= 5 && strncmp(buffer, "reset", 5) == 0) {
+		heapprof_reset();
+		return buflen;
+	}
+
+	return -EINVAL;
+}
+
+/****************************************************************************
+ * Name: heapprof_dup
+ *
+ * Description:
+ *   Duplicate open file data in the new file structure.
+ *
+ ****************************************************************************/
+
+static int heapprof_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+	FAR struct heapprof_file_s *oldattr;
+	FAR struct heapprof_file_s *newattr;
+
+	fvdbg("Dup %p->%p\n", oldp, newp);
+
+	/* Recover our private data from the old struct file instance */
+
+	oldattr = (FAR struct heapprof_file_s *)oldp->f_priv;
+	DEBUGASSERT(oldattr);
+
+	/* Allocate a new container to hold the task and attribute selection */
+
+	newattr = (FAR struct heapprof_file_s *)kmm_malloc(sizeof(struct heapprof_file_s));
+	if (!newattr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* The copy the file attributes from the old attributes to the new */
+
+	memcpy(newattr, oldattr, sizeof(struct heapprof_file_s));
+
+	/* Save the new attributes in the new file structure */
+
+	newp->f_priv = (FAR void *)newattr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: heapprof_stat
+ *
+ * Description: Return information about a file or directory
+ *
+ ****************************************************************************/
+
+static int heapprof_stat(const char *relpath, struct stat *buf)
+{
+	/* "heapprof" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "heapprof") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* "heapprof" is the name for a file that is read, or written to reset it */
+
+	buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR | S_IWUSR;
+	buf->st_size = 0;
+	buf->st_blksize = 0;
+	buf->st_blocks = 0;
+	return OK;
+}
+
+#endif							/* CONFIG_MM_HEAPPROF && !CONFIG_FS_PROCFS_EXCLUDE_HEAPPROF */
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
@@ -743,6 +743,21 @@ static ssize_t proc_entry_stack(FAR struct proc_file_s *procfile, FAR struct tcb
 	remaining -= copysize;
 #endif
 
+#ifdef CONFIG_STACK_HWM
+	if (totalsize >= buflen) {
+		return totalsize;
+	}
+
+	/* Show the high water mark found by the idle task so far */
+
+	linesize = snprintf(procfile->line, STATUS_LINELEN, "\n%-12s%ld", "StackPeak:", (long)tcb->stack_hwm);
+	copysize = procfs_memcpy(procfile->line, linesize, buffer, remaining, &offset);
+
+	totalsize += copysize;
+	buffer += copysize;
+	remaining -= copysize;
+#endif
+
 	return totalsize;
 }
 
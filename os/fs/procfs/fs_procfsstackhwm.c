@@ -0,0 +1,374 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/statfs.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/procfs.h>
+#include <tinyara/sched.h>
+#include <tinyara/debug/stackhwm.h>
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_STACK_HWM) && !defined(CONFIG_FS_PROCFS_EXCLUDE_STACKHWM)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+/* Determines the size of an intermediate buffer that must be large enough
+ * to handle the longest line generated by this logic.
+ */
+
+#define STACKHWM_LINELEN (48 + CONFIG_TASK_NAME_SIZE)
+
+/* The file is made of the header line, one line per task which was alive
+ * when the file was opened and one line per record of terminated tasks.
+ */
+
+#define STACKHWM_LINE_TASK      1
+#define STACKHWM_LINE_RECORD    (STACKHWM_LINE_TASK + CONFIG_MAX_TASKS)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Stack of a task alive when the file was opened */
+
+struct stackhwm_task_s {
+	pid_t pid;
+	size_t stack_size;
+	size_t peak;
+#if CONFIG_TASK_NAME_SIZE > 0
+	char name[CONFIG_TASK_NAME_SIZE + 1];
+#endif
+};
+
+/* This structure describes one open "file" */
+
+struct stackhwm_file_s {
+	struct procfs_file_s base;	/* Base open file structure */
+	int ntasks;					/* Number of entries of tasks[] */
+	struct stackhwm_task_s tasks[CONFIG_MAX_TASKS];	/* Tasks alive at open */
+	char line[STACKHWM_LINELEN];	/* Pre-allocated buffer for formatted lines */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int stackhwm_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int stackhwm_close(FAR struct file *filep);
+static ssize_t stackhwm_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+
+static int stackhwm_dup(FAR const struct file *oldp, FAR struct file *newp);
+
+static int stackhwm_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+/* See fs_mount.c -- this structure is explicitly externed there.
+ * We use the old-fashioned kind of initializers so that this will compile
+ * with any compiler.
+ */
+
+const struct procfs_operations stackhwm_operations = {
+	stackhwm_open,				/* open */
+	stackhwm_close,				/* close */
+	stackhwm_read,				/* read */
+	NULL,						/* write */
+
+	stackhwm_dup,				/* dup */
+
+	NULL,						/* opendir */
+	NULL,						/* closedir */
+	NULL,						/* readdir */
+	NULL,						/* rewinddir */
+
+	stackhwm_stat				/* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: stackhwm_enum
+ *
+ * Description:
+ *   sched_foreach() callback which saves the stack of a task.
+ *
+ ****************************************************************************/
+
+static void stackhwm_enum(FAR struct tcb_s *tcb, FAR void *arg)
+{
+	FAR struct stackhwm_file_s *attr = (FAR struct stackhwm_file_s *)arg;
+	FAR struct stackhwm_task_s *task;
+
+	if (attr->ntasks >= CONFIG_MAX_TASKS) {
+		return;
+	}
+
+	task = &attr->tasks[attr->ntasks++];
+	task->pid = tcb->pid;
+	task->stack_size = tcb->adj_stack_size;
+	task->peak = tcb->stack_hwm;
+#if CONFIG_TASK_NAME_SIZE > 0
+	strncpy(task->name, tcb->name, CONFIG_TASK_NAME_SIZE);
+	task->name[CONFIG_TASK_NAME_SIZE] = '\0';
+#endif
+}
+
+/****************************************************************************
+ * Name: stackhwm_line
+ *
+ * Description:
+ *   Format line number 'index' of the file.  Returns the length of the
+ *   line, 0 for the unused entries of the tables and -1 past the end.
+ *
+ ****************************************************************************/
+
+static int stackhwm_line(FAR struct stackhwm_file_s *attr, int index)
+{
+	FAR struct stackhwm_task_s *task;
+	struct stack_hwm_record_s record;
+
+	if (index == 0) {
+		return snprintf(attr->line, STACKHWM_LINELEN, "stackhwm\n");
+	}
+
+	if (index < STACKHWM_LINE_RECORD) {
+		index -= STACKHWM_LINE_TASK;
+		if (index >= attr->ntasks) {
+			return 0;
+		}
+
+		task = &attr->tasks[index];
+#if CONFIG_TASK_NAME_SIZE > 0
+		return snprintf(attr->line, STACKHWM_LINELEN, "task %d %u %u %s\n", task->pid, task->stack_size, task->peak, task->name);
+#else
+		return snprintf(attr->line, STACKHWM_LINELEN, "task %d %u %u -\n", task->pid, task->stack_size, task->peak);
+#endif
+	}
+
+	if (!stack_hwm_get_record(index - STACKHWM_LINE_RECORD, &record)) {
+		return -1;
+	}
+
+	if (record.nexits == 0) {
+		return 0;
+	}
+
+#if CONFIG_TASK_NAME_SIZE > 0
+	return snprintf(attr->line, STACKHWM_LINELEN, "exited %u %u %u %s\n", record.nexits, record.stack_size, record.peak, record.name);
+#else
+	return 0;
+#endif
+}
+
+/****************************************************************************
+ * Name: stackhwm_open
+ ****************************************************************************/
+
+static int stackhwm_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct stackhwm_file_s *attr;
+
+	fvdbg("Open '%s'\n", relpath);
+
+	/* PROCFS is read-only.  Any attempt to open with any kind of write
+	 * access is not permitted.
+	 */
+
+	if ((oflags & O_WRONLY) != 0 || (oflags & O_RDONLY) == 0) {
+		fdbg("ERROR: Only O_RDONLY supported\n");
+		return -EACCES;
+	}
+
+	/* "stackhwm" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "stackhwm") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* Allocate a container to hold the file attributes */
+
+	attr = (FAR struct stackhwm_file_s *)kmm_zalloc(sizeof(struct stackhwm_file_s));
+	if (!attr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* Take a snapshot of the tasks, they are listed in the order of the
+	 * pid hash table.
+	 */
+
+	sched_foreach(stackhwm_enum, attr);
+
+	/* Save the attributes as the open-specific state in filep->f_priv */
+
+	filep->f_priv = (FAR void *)attr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: stackhwm_close
+ ****************************************************************************/
+
+static int stackhwm_close(FAR struct file *filep)
+{
+	FAR struct stackhwm_file_s *attr;
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct stackhwm_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	/* Release the file attributes structure */
+
+	kmm_free(attr);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: stackhwm_read
+ ****************************************************************************/
+
+static ssize_t stackhwm_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct stackhwm_file_s *attr;
+	size_t copysize = 0;
+	off_t offset;
+	int linesize;
+	int index;
+
+	fvdbg("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+	/* Recover our private data from the struct file instance */
+
+	attr = (FAR struct stackhwm_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	/* Skip the lines before the file position and transfer the others until
+	 * the user buffer is full.
+	 */
+
+	offset = filep->f_pos;
+	for (index = 0; copysize < buflen; index++) {
+		linesize = stackhwm_line(attr, index);
+		if (linesize < 0) {
+			break;
+		}
+
+		copysize += procfs_memcpy(attr->line, linesize, buffer + copysize, buflen - copysize, &offset);
+	}
+
+	/* Update the file offset */
+
+	filep->f_pos += copysize;
+	return copysize;
+}
+
+/****************************************************************************
+ * Name: stackhwm_dup
+ *
+ * Description:
+ *   Duplicate open file data in the new file structure.
+ *
+ ****************************************************************************/
+
+static int stackhwm_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+	FAR struct stackhwm_file_s *oldattr;
+	FAR struct stackhwm_file_s *newattr;
+
+	fvdbg("Dup %p->%p\n", oldp, newp);
+
+	/* Recover our private data from the old struct file instance */
+
+	oldattr = (FAR struct stackhwm_file_s *)oldp->f_priv;
+	DEBUGASSERT(oldattr);
+
+	/* Allocate a new container to hold the task and attribute selection */
+
+	newattr = (FAR struct stackhwm_file_s *)kmm_malloc(sizeof(struct stackhwm_file_s));
+	if (!newattr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	/* The copy the file attributes from the old attributes to the new */
+
+	memcpy(newattr, oldattr, sizeof(struct stackhwm_file_s));
+
+	/* Save the new attributes in the new file structure */
+
+	newp->f_priv = (FAR void *)newattr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: stackhwm_stat
+ *
+ * Description: Return information about a file or directory
+ *
+ ****************************************************************************/
+
+static int stackhwm_stat(const char *relpath, struct stat *buf)
+{
+	/* "stackhwm" is the only acceptable value for the relpath */
+
+	if (strcmp(relpath, "stackhwm") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	/* "stackhwm" is the name for a read-only file */
+
+	buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR;
+	buf->st_size = 0;
+	buf->st_blksize = 0;
+	buf->st_blocks = 0;
+	return OK;
+}
+
+#endif							/* CONFIG_STACK_HWM && !CONFIG_FS_PROCFS_EXCLUDE_STACKHWM */
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
@@ -239,10 +239,21 @@
 #define UINT8_TO_UINT16(UINT8_ARRAY)                    ((uint16_t)(((uint16_t)UINT8_ARRAY[1] << 8) & 0xFF00) | UINT8_ARRAY[0])
 #define SMARTFS_NEXTSECTOR(h)   (UINT8_TO_UINT16(h->nextsector))
 #define SMARTFS_USED(h)                 (UINT8_TO_UINT16(h->used))
-#ifdef CONFIG_MTD_SMART_ENABLE_CRC
+#if defined(CONFIG_MTD_SMART_ENABLE_CRC) || defined(CONFIG_SMARTFS_SECTOR_BUFFER)
 #define CONFIG_SMARTFS_USE_SECTOR_BUFFER
 #endif
 
+/* Drop the last sector cached and the chain read ahead by every open file
+ * of a volume.  This must be done whenever sector contents of the volume
+ * may change.
+ */
+
+#if defined(CONFIG_SMARTFS_SECTCACHE) || defined(CONFIG_SMARTFS_READAHEAD)
+#define SMARTFS_SECTCACHE_INVALIDATE(f) ((f)->fs_rdgen++)
+#else
+#define SMARTFS_SECTCACHE_INVALIDATE(f)
+#endif
+
 #define USED_ARRAY_SIZE                 2
 
 #if !defined(CONFIG_SMARTFS_DYNAMIC_HEADER) || !defined(CONFIG_MTD_SMART_SECTOR_SIZE)
@@ -309,6 +320,15 @@ struct smartfs_chain_header_s {
  * is protected by the volume semaphore.
  */
 
+#ifdef CONFIG_SMARTFS_READAHEAD
+/* One chain sector found ahead of the reader of an open file */
+
+struct smartfs_rahead_s {
+	uint16_t sector;			/* Logical sector number */
+	uint16_t used;				/* Data bytes held by the sector */
+};
+#endif
+
 struct smartfs_ofile_s {
 	struct smartfs_ofile_s *fnext;	/* Supports a singly linked list */
 #ifdef CONFIG_SMARTFS_USE_SECTOR_BUFFER
@@ -327,8 +347,64 @@ struct smartfs_ofile_s {
 								 * used field until the file is closed,
 								 * a seek, or more data is written that
 								 * causes the sector to change. */
+#ifdef CONFIG_SMARTFS_SECTCACHE
+	uint8_t *cachebuf;			/* Copy of the last sector read */
+	uint16_t cachesector;			/* Logical sector held in cachebuf */
+	uint32_t cachegen;				/* fs_rdgen when cachebuf was filled */
+#endif
+#ifdef CONFIG_SMARTFS_READAHEAD
+	struct smartfs_rahead_s ra[CONFIG_SMARTFS_READAHEAD_SECTORS];	/* Chain from currsector on */
+	uint16_t ranext;			/* Sector chained after the last ra[] entry */
+	uint8_t rastart;			/* First ra[] entry not consumed yet */
+	uint8_t racount;			/* Number of valid ra[] entries */
+	uint32_t ragen;				/* fs_rdgen when ra[] was filled */
+#endif
 };
 
+#ifdef CONFIG_SMARTFS_DCACHE
+/* One cached directory entry location, see smartfs_dcache.c */
+
+struct smartfs_dcache_entry_s {
+	uint32_t hash;				/* Hash of the entry name */
+	uint16_t hnext;				/* Next entry in hash chain or free list */
+	uint16_t parent;			/* First sector of the parent directory */
+	uint16_t dsector;			/* Sector holding the entry header */
+	uint16_t doffset;			/* Offset of the entry header in dsector */
+};
+
+/* Per-volume hashed directory entry cache */
+
+struct smartfs_dcache_s {
+	uint16_t buckets[CONFIG_SMARTFS_DCACHE_BUCKETS];
+	struct smartfs_dcache_entry_s entries[CONFIG_SMARTFS_DCACHE_ENTRIES];
+	uint16_t freelist;			/* First free entry */
+	uint16_t indexed[CONFIG_SMARTFS_DCACHE_DIRS];	/* Completely cached dirs */
+	uint16_t nextindexed;		/* Next indexed[] slot to replace */
+	uint32_t flushes;			/* Number of times the cache was flushed */
+	uint32_t lookups;			/* Lookups made */
+	uint32_t hits;				/* Lookups resolved by a cached location */
+	uint32_t negatives;			/* Lookups resolved as -ENOENT from RAM */
+	uint32_t stale;				/* Cached locations that did not verify */
+};
+#endif
+
+#ifdef CONFIG_SMARTFS_IOSTAT
+/* Read/write throughput counters of one mounted volume */
+
+struct smartfs_iostat_s {
+	uint32_t rdbytes;			/* Bytes returned by read() */
+	uint32_t rdsectors;			/* Sectors read from the MTD layer */
+	uint32_t rdcached;			/* Sectors served from the last sector cache */
+	uint32_t rdheaders;			/* Chain headers read ahead of the reader */
+	uint32_t rdmulti;			/* Multi-sector reads into the user buffer */
+	clock_t rdticks;			/* Ticks spent in read() */
+	uint32_t wrbytes;			/* Bytes accepted by write() */
+	uint32_t wrsectors;			/* Sectors filled by multi-sector writes */
+	uint32_t wrmulti;			/* Multi-sector writes */
+	clock_t wrticks;			/* Ticks spent in write() */
+};
+#endif
+
 /* This structure represents the overall mountpoint state.  An instance of this
  * structure is retained as inode private data on each mountpoint that is
  * mounted with a smartfs filesystem.
@@ -353,6 +429,15 @@ struct smartfs_mountpt_s {
 #ifdef CONFIG_SMARTFS_ENTRY_TIMESTAMP
 	uint32_t entry_seq;
 #endif
+#if defined(CONFIG_SMARTFS_SECTCACHE) || defined(CONFIG_SMARTFS_READAHEAD)
+	uint32_t fs_rdgen;			/* Bumped when cached sectors become stale */
+#endif
+#ifdef CONFIG_SMARTFS_DCACHE
+	struct smartfs_dcache_s *fs_dcache;	/* Directory entry cache (lazily allocated) */
+#endif
+#ifdef CONFIG_SMARTFS_IOSTAT
+	struct smartfs_iostat_s fs_iostat;	/* Throughput statistics */
+#endif
 };
 
 
@@ -431,6 +516,16 @@ uint16_t get_used_byte_count(uint8_t *used);
 #endif
 int smartfs_sector_recovery(struct smartfs_mountpt_s *fs);
 
+#ifdef CONFIG_SMARTFS_DCACHE
+void smartfs_dcache_flush(struct smartfs_dcache_s *dc);
+int smartfs_dcache_lookup(struct smartfs_mountpt_s *fs, uint16_t parent, const char *name, uint16_t *dsector, uint16_t *doffset);
+void smartfs_dcache_add(struct smartfs_mountpt_s *fs, uint16_t parent, const char *name, uint16_t dsector, uint16_t doffset);
+void smartfs_dcache_remove(struct smartfs_mountpt_s *fs, uint16_t dsector, uint16_t doffset);
+void smartfs_dcache_purgedir(struct smartfs_mountpt_s *fs, uint16_t parent);
+void smartfs_dcache_setindexed(struct smartfs_mountpt_s *fs, uint16_t parent, uint32_t flushes);
+void smartfs_dcache_release(struct smartfs_mountpt_s *fs);
+#endif
+
 struct file;					/* Forward references */
 struct inode;
 struct fs_dirent_s;
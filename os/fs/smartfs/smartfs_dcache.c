@@ -0,0 +1,375 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * fs/smartfs/smartfs_dcache.c
+ *
+ * In-RAM hashed index of SMARTFS directory entries.
+ *
+ * Every cached entry maps (parent directory first sector, name hash) to the
+ * location of the on-flash entry header.  Cached locations are only hints:
+ * smartfs_finddirentry() always re-reads the sector and compares the name
+ * before using them.  When a directory has been scanned completely it is
+ * marked as indexed, and a lookup that finds no candidate in an indexed
+ * directory is answered with -ENOENT without touching the flash.
+ *
+ * The number of entries is fixed at CONFIG_SMARTFS_DCACHE_ENTRIES.  When
+ * it is exhausted the whole cache is flushed and refilled by later scans.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/kmalloc.h>
+
+#include "smartfs.h"
+
+#ifdef CONFIG_SMARTFS_DCACHE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define DCACHE_NONE               0xFFFF
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: smartfs_dcache_hash
+ *
+ * Description: FNV-1a hash of at most 'len' characters of 'name'.
+ *
+ ****************************************************************************/
+
+static uint32_t smartfs_dcache_hash(FAR const char *name, uint16_t len)
+{
+	uint32_t hash = 2166136261u;
+
+	while (len-- > 0 && *name != '\0') {
+		hash ^= (uint8_t)*name++;
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+/****************************************************************************
+ * Name: smartfs_dcache_get
+ *
+ * Description: Return the cache of a volume, allocating it on first use.
+ *
+ ****************************************************************************/
+
+static FAR struct smartfs_dcache_s *smartfs_dcache_get(FAR struct smartfs_mountpt_s *fs)
+{
+	FAR struct smartfs_dcache_s *dc;
+
+	if (fs->fs_dcache != NULL) {
+		return fs->fs_dcache;
+	}
+
+	dc = (FAR struct smartfs_dcache_s *)kmm_zalloc(sizeof(struct smartfs_dcache_s));
+	if (dc == NULL) {
+		fdbg("Unable to allocate directory cache\n");
+		return NULL;
+	}
+
+	smartfs_dcache_flush(dc);
+	fs->fs_dcache = dc;
+	return dc;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: smartfs_dcache_flush
+ *
+ * Description: Drop every cached entry and every indexed directory.
+ *
+ ****************************************************************************/
+
+void smartfs_dcache_flush(FAR struct smartfs_dcache_s *dc)
+{
+	uint16_t x;
+
+	for (x = 0; x < CONFIG_SMARTFS_DCACHE_BUCKETS; x++) {
+		dc->buckets[x] = DCACHE_NONE;
+	}
+
+	/* Chain all entries into the free list */
+
+	for (x = 0; x < CONFIG_SMARTFS_DCACHE_ENTRIES; x++) {
+		dc->entries[x].hnext = x + 1;
+	}
+
+	dc->entries[CONFIG_SMARTFS_DCACHE_ENTRIES - 1].hnext = DCACHE_NONE;
+	dc->freelist = 0;
+
+	for (x = 0; x < CONFIG_SMARTFS_DCACHE_DIRS; x++) {
+		dc->indexed[x] = SMARTFS_ERASEDSTATE_16BIT;
+	}
+
+	dc->nextindexed = 0;
+	dc->flushes++;
+}
+
+/****************************************************************************
+ * Name: smartfs_dcache_lookup
+ *
+ * Description: Find the cached location of 'name' in directory 'parent'.
+ *
+ * Returned Values:
+ *   OK      - A candidate was found in *dsector / *doffset.  The caller
+ *             must verify it against the flash.
+ *   -ENOENT - The directory is completely indexed and has no such entry.
+ *   -EAGAIN - Nothing is known; the directory must be scanned.
+ *
+ ****************************************************************************/
+
+int smartfs_dcache_lookup(FAR struct smartfs_mountpt_s *fs, uint16_t parent, FAR const char *name, FAR uint16_t *dsector, FAR uint16_t *doffset)
+{
+	FAR struct smartfs_dcache_s *dc;
+	FAR struct smartfs_dcache_entry_s *entry;
+	uint32_t hash;
+	uint16_t index;
+	uint16_t x;
+
+	dc = smartfs_dcache_get(fs);
+	if (dc == NULL) {
+		return -EAGAIN;
+	}
+
+	dc->lookups++;
+
+	hash = smartfs_dcache_hash(name, fs->fs_llformat.namesize);
+	index = dc->buckets[hash % CONFIG_SMARTFS_DCACHE_BUCKETS];
+	while (index != DCACHE_NONE) {
+		entry = &dc->entries[index];
+		if (entry->hash == hash && entry->parent == parent) {
+			*dsector = entry->dsector;
+			*doffset = entry->doffset;
+			return OK;
+		}
+
+		index = entry->hnext;
+	}
+
+	for (x = 0; x < CONFIG_SMARTFS_DCACHE_DIRS; x++) {
+		if (dc->indexed[x] == parent) {
+			dc->negatives++;
+			return -ENOENT;
+		}
+	}
+
+	return -EAGAIN;
+}
+
+/****************************************************************************
+ * Name: smartfs_dcache_add
+ *
+ * Description: Record that 'name' in directory 'parent' lives at
+ *   dsector/doffset.  A record of the same name or of the same location in
+ *   the bucket of 'name' is updated.  Callers that reuse a location for a
+ *   different name remove the record of the old name first.
+ *
+ ****************************************************************************/
+
+void smartfs_dcache_add(FAR struct smartfs_mountpt_s *fs, uint16_t parent, FAR const char *name, uint16_t dsector, uint16_t doffset)
+{
+	FAR struct smartfs_dcache_s *dc;
+	FAR struct smartfs_dcache_entry_s *entry;
+	uint32_t hash;
+	uint16_t bucket;
+	uint16_t index;
+
+	dc = smartfs_dcache_get(fs);
+	if (dc == NULL) {
+		return;
+	}
+
+	hash = smartfs_dcache_hash(name, fs->fs_llformat.namesize);
+	bucket = hash % CONFIG_SMARTFS_DCACHE_BUCKETS;
+
+	for (index = dc->buckets[bucket]; index != DCACHE_NONE; index = entry->hnext) {
+		entry = &dc->entries[index];
+		if ((entry->hash == hash && entry->parent == parent) || (entry->dsector == dsector && entry->doffset == doffset)) {
+			entry->hash = hash;
+			entry->parent = parent;
+			entry->dsector = dsector;
+			entry->doffset = doffset;
+			return;
+		}
+	}
+
+	if (dc->freelist == DCACHE_NONE) {
+		/* Out of entries.  Start over rather than evicting one by one,
+		 * which would silently invalidate the indexed directories.
+		 */
+
+		fvdbg("Directory cache full, flushing\n");
+		smartfs_dcache_flush(dc);
+	}
+
+	index = dc->freelist;
+	entry = &dc->entries[index];
+	dc->freelist = entry->hnext;
+
+	entry->hash = hash;
+	entry->parent = parent;
+	entry->dsector = dsector;
+	entry->doffset = doffset;
+	entry->hnext = dc->buckets[bucket];
+	dc->buckets[bucket] = index;
+}
+
+/****************************************************************************
+ * Name: smartfs_dcache_remove
+ *
+ * Description: Forget the entry stored at dsector/doffset, if cached.
+ *
+ ****************************************************************************/
+
+void smartfs_dcache_remove(FAR struct smartfs_mountpt_s *fs, uint16_t dsector, uint16_t doffset)
+{
+	FAR struct smartfs_dcache_s *dc = fs->fs_dcache;
+	FAR uint16_t *link;
+	uint16_t bucket;
+	uint16_t index;
+
+	if (dc == NULL) {
+		return;
+	}
+
+	for (bucket = 0; bucket < CONFIG_SMARTFS_DCACHE_BUCKETS; bucket++) {
+		link = &dc->buckets[bucket];
+		while (*link != DCACHE_NONE) {
+			index = *link;
+			if (dc->entries[index].dsector == dsector && dc->entries[index].doffset == doffset) {
+				*link = dc->entries[index].hnext;
+				dc->entries[index].hnext = dc->freelist;
+				dc->freelist = index;
+				return;
+			}
+
+			link = &dc->entries[index].hnext;
+		}
+	}
+}
+
+/****************************************************************************
+ * Name: smartfs_dcache_purgedir
+ *
+ * Description: Forget everything known about directory 'parent'.  Used when
+ *   the directory is deleted and its first sector may be reused.
+ *
+ ****************************************************************************/
+
+void smartfs_dcache_purgedir(FAR struct smartfs_mountpt_s *fs, uint16_t parent)
+{
+	FAR struct smartfs_dcache_s *dc = fs->fs_dcache;
+	FAR uint16_t *link;
+	uint16_t bucket;
+	uint16_t index;
+	uint16_t x;
+
+	if (dc == NULL) {
+		return;
+	}
+
+	for (x = 0; x < CONFIG_SMARTFS_DCACHE_DIRS; x++) {
+		if (dc->indexed[x] == parent) {
+			dc->indexed[x] = SMARTFS_ERASEDSTATE_16BIT;
+		}
+	}
+
+	for (bucket = 0; bucket < CONFIG_SMARTFS_DCACHE_BUCKETS; bucket++) {
+		link = &dc->buckets[bucket];
+		while (*link != DCACHE_NONE) {
+			index = *link;
+			if (dc->entries[index].parent == parent) {
+				*link = dc->entries[index].hnext;
+				dc->entries[index].hnext = dc->freelist;
+				dc->freelist = index;
+			} else {
+				link = &dc->entries[index].hnext;
+			}
+		}
+	}
+}
+
+/****************************************************************************
+ * Name: smartfs_dcache_setindexed
+ *
+ * Description: Mark directory 'parent' as completely present in the cache.
+ *   'flushes' is the flush count sampled before the directory scan started;
+ *   if the cache was flushed meanwhile some entries were lost and the
+ *   directory is not marked.
+ *
+ ****************************************************************************/
+
+void smartfs_dcache_setindexed(FAR struct smartfs_mountpt_s *fs, uint16_t parent, uint32_t flushes)
+{
+	FAR struct smartfs_dcache_s *dc = fs->fs_dcache;
+	uint16_t x;
+
+	if (dc == NULL || dc->flushes != flushes) {
+		return;
+	}
+
+	for (x = 0; x < CONFIG_SMARTFS_DCACHE_DIRS; x++) {
+		if (dc->indexed[x] == parent) {
+			return;
+		}
+	}
+
+	/* Replace the oldest indexed directory */
+
+	dc->indexed[dc->nextindexed] = parent;
+	dc->nextindexed = (dc->nextindexed + 1) % CONFIG_SMARTFS_DCACHE_DIRS;
+}
+
+/****************************************************************************
+ * Name: smartfs_dcache_release
+ *
+ * Description: Free the cache of a volume being unmounted.
+ *
+ ****************************************************************************/
+
+void smartfs_dcache_release(FAR struct smartfs_mountpt_s *fs)
+{
+	if (fs->fs_dcache != NULL) {
+		kmm_free(fs->fs_dcache);
+		fs->fs_dcache = NULL;
+	}
+}
+
+#endif							/* CONFIG_SMARTFS_DCACHE */
@@ -72,6 +72,7 @@
 
 #include <tinyara/arch.h>
 #include <tinyara/sched.h>
+#include <tinyara/clock.h>
 #include <tinyara/kmalloc.h>
 #include <tinyara/fs/fs.h>
 #include <tinyara/fs/procfs.h>
@@ -147,6 +148,12 @@ static int smartfs_stat(FAR const char *relpath, FAR struct stat *buf);
 
 static ssize_t smartfs_debug_write(FAR struct file *filep, FAR const char *buffer, size_t buflen);
 static size_t smartfs_status_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+#ifdef CONFIG_SMARTFS_IOSTAT
+static size_t smartfs_iostat_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+#endif
+#ifdef CONFIG_SMARTFS_DCACHE
+static size_t smartfs_dcache_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+#endif
 #ifdef CONFIG_MTD_SMART_ALLOC_DEBUG
 static size_t smartfs_mem_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
 #endif
@@ -174,6 +181,12 @@ static const struct smartfs_procfs_entry_s g_direntry[] = {
 #ifdef CONFIG_MTD_SMART_ALLOC_DEBUG
 	{"mem", smartfs_mem_read, NULL, DTYPE_FILE},
 #endif
+#ifdef CONFIG_SMARTFS_IOSTAT
+	{"iostat", smartfs_iostat_read, NULL, DTYPE_FILE},
+#endif
+#ifdef CONFIG_SMARTFS_DCACHE
+	{"dcache", smartfs_dcache_read, NULL, DTYPE_FILE},
+#endif
 #ifdef CONFIG_DEBUG_FS
 	{"dump_lsector", NULL, smartfs_dump_lsector, DTYPE_FILE},
 	{"dump_psector", NULL, smartfs_dump_psector, DTYPE_FILE},
@@ -790,6 +803,110 @@ static size_t smartfs_status_read(FAR struct file *filep, FAR char *buffer, size
 	return len;
 }
 
+/****************************************************************************
+ * Name: smartfs_iostat_read
+ *
+ * Description: Performs the read operation for the "iostat" dir entry.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SMARTFS_IOSTAT
+static uint32_t smartfs_iostat_kbps(uint32_t bytes, clock_t ticks)
+{
+	uint32_t msec = TICK2MSEC(ticks);
+
+	if (msec == 0) {
+		return 0;
+	}
+
+	/* Bytes per millisecond is (roughly) kilobytes per second */
+
+	return (uint32_t)(((uint64_t)bytes * 1000) / ((uint64_t)msec * 1024));
+}
+
+static size_t smartfs_iostat_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct smartfs_file_s *priv;
+	struct smartfs_iostat_s stat;
+	size_t len;
+
+	priv = (FAR struct smartfs_file_s *)filep->f_priv;
+
+	len = 0;
+	if (priv->offset == 0) {
+		/* Take a consistent snapshot of the counters */
+
+		smartfs_semtake(priv->level1.mount);
+		stat = priv->level1.mount->fs_iostat;
+		smartfs_semgive(priv->level1.mount);
+
+		len = snprintf(buffer, buflen, "Read Bytes       %u\nRead Sectors     %u\n" "Cached Sectors   %u\nHeaders Ahead    %u\n" "Multi Reads      %u\nRead Time (ms)   %u\n" "Read KB/s        %u\nWrite Bytes      %u\n" "Multi Wr Sectors %u\nMulti Writes     %u\n" "Write Time (ms)  %u\nWrite KB/s       %u\n",
+					   stat.rdbytes, stat.rdsectors, stat.rdcached, stat.rdheaders, stat.rdmulti, (uint32_t)TICK2MSEC(stat.rdticks), smartfs_iostat_kbps(stat.rdbytes, stat.rdticks),
+					   stat.wrbytes, stat.wrsectors, stat.wrmulti, (uint32_t)TICK2MSEC(stat.wrticks), smartfs_iostat_kbps(stat.wrbytes, stat.wrticks));
+
+		/* Indicate we have already provided all the data */
+
+		priv->offset = 0xFF;
+	}
+
+	return len;
+}
+#endif
+
+/****************************************************************************
+ * Name: smartfs_dcache_read
+ *
+ * Description: Performs the read operation for the "dcache" dir entry.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SMARTFS_DCACHE
+static size_t smartfs_dcache_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct smartfs_file_s *priv;
+	FAR struct smartfs_dcache_s *dc;
+	uint32_t lookups = 0;
+	uint32_t hits = 0;
+	uint32_t negatives = 0;
+	uint32_t stale = 0;
+	uint32_t flushes = 0;
+	uint32_t hitrate = 0;
+	size_t len;
+
+	priv = (FAR struct smartfs_file_s *)filep->f_priv;
+
+	len = 0;
+	if (priv->offset == 0) {
+		smartfs_semtake(priv->level1.mount);
+		dc = priv->level1.mount->fs_dcache;
+		if (dc != NULL) {
+			lookups = dc->lookups;
+			hits = dc->hits;
+			negatives = dc->negatives;
+			stale = dc->stale;
+
+			/* The first flush happens when the cache is created */
+
+			flushes = dc->flushes - 1;
+		}
+		smartfs_semgive(priv->level1.mount);
+
+		if (lookups > 0) {
+			hitrate = 100 * (hits + negatives) / lookups;
+		}
+
+		len = snprintf(buffer, buflen, "Capacity         %d\nLookups          %u\n" "Hits             %u\nNegative Hits    %u\n" "Stale            %u\nFlushes          %u\n" "Hit Rate         %u%%\n",
+					   CONFIG_SMARTFS_DCACHE_ENTRIES, lookups, hits, negatives, stale, flushes, hitrate);
+
+		/* Indicate we have already provided all the data */
+
+		priv->offset = 0xFF;
+	}
+
+	return len;
+}
+#endif
+
 /****************************************************************************
  * Name: smartfs_mem_read
  *
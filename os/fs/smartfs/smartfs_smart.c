@@ -70,6 +70,7 @@
 #include <debug.h>
 
 #include <tinyara/kmalloc.h>
+#include <tinyara/clock.h>
 #include <tinyara/fs/fs.h>
 #include <tinyara/fs/dirent.h>
 #include <tinyara/fs/ioctl.h>
@@ -92,6 +93,10 @@
 
 static int smartfs_open(FAR struct file *filep, const char *relpath, int oflags, mode_t mode);
 static int smartfs_close(FAR struct file *filep);
+#ifdef CONFIG_SMARTFS_READAHEAD
+static int smartfs_readahead(FAR struct smartfs_mountpt_s *fs, FAR struct smartfs_ofile_s *sf);
+static int smartfs_read_chain(FAR struct smartfs_mountpt_s *fs, FAR struct smartfs_ofile_s *sf, char *buffer, size_t buflen);
+#endif
 static ssize_t smartfs_read(FAR struct file *filep, char *buffer, size_t buflen);
 static ssize_t smartfs_write(FAR struct file *filep, const char *buffer, size_t buflen);
 static off_t smartfs_seek(FAR struct file *filep, off_t offset, int whence);
@@ -481,6 +486,11 @@ static int smartfs_close(FAR struct file *filep)
 		kmm_free(sf->buffer);
 	}
 #endif
+#ifdef CONFIG_SMARTFS_SECTCACHE
+	if (sf->cachebuf) {
+		kmm_free(sf->cachebuf);
+	}
+#endif
 
 	kmm_free(sf);
 	filep->f_priv = NULL;
@@ -490,6 +500,150 @@ okout:
 	return OK;
 }
 
+/****************************************************************************
+ * Name: smartfs_readahead
+ *
+ * Description:
+ *   Follow the sector chain of an open file from its current sector and
+ *   record the location and used byte count of the next sectors.  Only
+ *   the chain headers are read.  A failure past the first sector just
+ *   ends the list; the reader reports it if it gets that far.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SMARTFS_READAHEAD
+static int smartfs_readahead(FAR struct smartfs_mountpt_s *fs, FAR struct smartfs_ofile_s *sf)
+{
+	struct smart_read_write_s readwrite;
+	struct smartfs_chain_header_s header;
+	struct smartfs_chain_header_s *hp = &header;
+	uint16_t sector;
+	uint16_t used;
+	uint8_t count;
+	int ret;
+
+	sector = sf->currsector;
+	count = 0;
+	while (count < CONFIG_SMARTFS_READAHEAD_SECTORS && sector != SMARTFS_ERASEDSTATE_16BIT) {
+		smartfs_setbuffer(&readwrite, sector, 0, sizeof(struct smartfs_chain_header_s), (uint8_t *)hp);
+		ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long)&readwrite);
+		if (ret < 0) {
+			if (count == 0) {
+				fdbg("Error reading sector %d header, ret : %d\n", sector, ret);
+				sf->racount = 0;
+				return ret;
+			}
+
+			break;
+		}
+#ifdef CONFIG_SMARTFS_IOSTAT
+		fs->fs_iostat.rdheaders++;
+#endif
+
+		used = SMARTFS_USED(hp);
+		if (used == SMARTFS_ERASEDSTATE_16BIT) {
+			used = 0;
+		} else if (used > SMARTFS_AVAIL_DATABYTES(fs)) {
+			used = SMARTFS_AVAIL_DATABYTES(fs);
+		}
+
+		sf->ra[count].sector = sector;
+		sf->ra[count].used = used;
+		count++;
+		sector = SMARTFS_NEXTSECTOR(hp);
+	}
+
+	sf->ranext = sector;
+	sf->rastart = 0;
+	sf->racount = count;
+	sf->ragen = fs->fs_rdgen;
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: smartfs_read_chain
+ *
+ * Description:
+ *   Read the data of the consecutive chain sectors that start at the file
+ *   position and fit whole in the user buffer with one BIOC_READSECTS,
+ *   each sector straight to its place in the buffer.  Returns the number
+ *   of sectors consumed, zero if the first one does not fit or a negated
+ *   errno.
+ *
+ ****************************************************************************/
+
+static int smartfs_read_chain(FAR struct smartfs_mountpt_s *fs, FAR struct smartfs_ofile_s *sf, char *buffer, size_t buflen)
+{
+	struct smart_read_write_s reqs[CONFIG_SMARTFS_READAHEAD_SECTORS];
+	struct smart_multi_rw_s multi;
+	size_t nbytes;
+	uint16_t nreqs;
+	uint8_t x;
+	int ret;
+
+	/* Find the current sector in what was read ahead, or read ahead again */
+
+	x = sf->rastart;
+	if (sf->ragen == fs->fs_rdgen) {
+		while (x < sf->racount && sf->ra[x].sector != sf->currsector) {
+			x++;
+		}
+	}
+
+	if (sf->ragen != fs->fs_rdgen || x >= sf->racount) {
+		ret = smartfs_readahead(fs, sf);
+		if (ret < 0) {
+			return ret;
+		}
+
+		x = 0;
+	}
+
+	sf->rastart = x;
+
+	/* Collect the sectors whose data fits in the buffer */
+
+	nbytes = 0;
+	nreqs = 0;
+	while (x < sf->racount && nbytes + sf->ra[x].used <= buflen) {
+		if (sf->ra[x].used > 0) {
+			smartfs_setbuffer(&reqs[nreqs], sf->ra[x].sector, sizeof(struct smartfs_chain_header_s), sf->ra[x].used, (uint8_t *)&buffer[nbytes]);
+			nbytes += sf->ra[x].used;
+			nreqs++;
+		}
+
+		x++;
+	}
+
+	if (x == sf->rastart) {
+		return 0;
+	}
+
+	if (nreqs > 0) {
+		multi.nreqs = nreqs;
+		multi.reqs = reqs;
+		ret = FS_IOCTL(fs, BIOC_READSECTS, (unsigned long)&multi);
+		if (ret < 0) {
+			fdbg("Error reading %d sectors from sector %d, ret : %d\n", nreqs, sf->currsector, ret);
+			return ret;
+		}
+#ifdef CONFIG_SMARTFS_IOSTAT
+		fs->fs_iostat.rdsectors += nreqs;
+		fs->fs_iostat.rdmulti++;
+#endif
+	}
+
+	sf->filepos += nbytes;
+	sf->currsector = (x < sf->racount) ? sf->ra[x].sector : sf->ranext;
+	sf->curroffset = sizeof(struct smartfs_chain_header_s);
+
+	ret = x - sf->rastart;
+	sf->rastart = x;
+	return ret;
+}
+#endif
+
 /****************************************************************************
  * Name: smartfs_read
  ****************************************************************************/
@@ -501,10 +655,17 @@ static ssize_t smartfs_read(FAR struct file *filep, char *buffer, size_t buflen)
 	struct smartfs_ofile_s *sf;
 	struct smart_read_write_s readwrite;
 	struct smartfs_chain_header_s *header;
+	char *sectbuf;
 	int ret = OK;
 	uint32_t bytesread;
 	uint16_t bytestoread;
 	uint16_t bytesinsector;
+#ifdef CONFIG_SMARTFS_READAHEAD
+	size_t filepos;
+#endif
+#ifdef CONFIG_SMARTFS_IOSTAT
+	clock_t start;
+#endif
 
 	/* Sanity checks */
 
@@ -522,6 +683,28 @@ static ssize_t smartfs_read(FAR struct file *filep, char *buffer, size_t buflen)
 
 	smartfs_semtake(fs);
 
+#ifdef CONFIG_SMARTFS_IOSTAT
+	start = clock_systimer();
+#endif
+
+	/* Read partial sectors into the per-file sector cache if we have (or
+	 * can get) one.  Otherwise fall back to the volume's shared buffer.
+	 * This only keeps the sector read last; whole sectors are read ahead
+	 * along the chain by smartfs_read_chain() instead.
+	 */
+
+	sectbuf = fs->fs_rwbuffer;
+#ifdef CONFIG_SMARTFS_SECTCACHE
+	if (sf->cachebuf == NULL) {
+		sf->cachebuf = (uint8_t *)kmm_malloc(fs->fs_llformat.availbytes);
+		sf->cachesector = SMARTFS_ERASEDSTATE_16BIT;
+	}
+
+	if (sf->cachebuf != NULL) {
+		sectbuf = (char *)sf->cachebuf;
+	}
+#endif
+
 	/* Loop until all byte read or error */
 
 	bytesread = 0;
@@ -534,22 +717,65 @@ static ssize_t smartfs_read(FAR struct file *filep, char *buffer, size_t buflen)
 			break;
 		}
 
-		/* Read the curent sector into our buffer */
+#ifdef CONFIG_SMARTFS_READAHEAD
+		/* At the start of a sector with room for at least a whole sector,
+		 * read the chain ahead straight into the user buffer.
+		 */
 
-		smartfs_setbuffer(&readwrite, sf->currsector, 0, fs->fs_llformat.availbytes, (uint8_t *)fs->fs_rwbuffer);
-		ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long)&readwrite);
-		if (ret < 0) {
-			fdbg("Error reading sector %d data, ret : %d\n", readwrite.logsector, ret);
-			goto errout_with_semaphore;
+		if (sf->curroffset == sizeof(struct smartfs_chain_header_s) && buflen - bytesread >= SMARTFS_AVAIL_DATABYTES(fs)) {
+			filepos = sf->filepos;
+			ret = smartfs_read_chain(fs, sf, &buffer[bytesread], buflen - bytesread);
+			if (ret < 0) {
+				goto errout_with_semaphore;
+			}
+
+			if (ret > 0) {
+				bytesread += sf->filepos - filepos;
+				continue;
+			}
+		}
+#endif
+
+
+#ifdef CONFIG_SMARTFS_SECTCACHE
+		/* Reuse the cached copy if nothing was written since it was read */
+
+		if (sectbuf == (char *)sf->cachebuf && sf->cachesector == sf->currsector && sf->cachegen == fs->fs_rdgen) {
+#ifdef CONFIG_SMARTFS_IOSTAT
+			fs->fs_iostat.rdcached++;
+#endif
+		} else
+#endif
+		{
+			/* Read the curent sector into our buffer */
+
+			smartfs_setbuffer(&readwrite, sf->currsector, 0, fs->fs_llformat.availbytes, (uint8_t *)sectbuf);
+			ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long)&readwrite);
+			if (ret < 0) {
+				fdbg("Error reading sector %d data, ret : %d\n", readwrite.logsector, ret);
+#ifdef CONFIG_SMARTFS_SECTCACHE
+				sf->cachesector = SMARTFS_ERASEDSTATE_16BIT;
+#endif
+				goto errout_with_semaphore;
+			}
+#ifdef CONFIG_SMARTFS_IOSTAT
+			fs->fs_iostat.rdsectors++;
+#endif
+#ifdef CONFIG_SMARTFS_SECTCACHE
+			if (sectbuf == (char *)sf->cachebuf) {
+				sf->cachesector = sf->currsector;
+				sf->cachegen = fs->fs_rdgen;
+			}
+#endif
 		}
 
 		/* Point header to the read data to get used byte count */
 
-		header = (struct smartfs_chain_header_s *)fs->fs_rwbuffer;
+		header = (struct smartfs_chain_header_s *)sectbuf;
 
 		/* Get number of used bytes in this sector */
 #ifdef CONFIG_SMARTFS_DYNAMIC_HEADER
-		bytesinsector = get_leftover_used_byte_count((uint8_t *)readwrite.buffer, get_used_byte_count((uint8_t *)header->used));
+		bytesinsector = get_leftover_used_byte_count((uint8_t *)sectbuf, get_used_byte_count((uint8_t *)header->used));
 #else
 		bytesinsector = SMARTFS_USED(header);
 
@@ -573,7 +799,7 @@ static ssize_t smartfs_read(FAR struct file *filep, char *buffer, size_t buflen)
 		if (bytestoread > 0) {
 			/* Do incremental copy from this sector */
 
-			memcpy(&buffer[bytesread], &fs->fs_rwbuffer[sf->curroffset], bytestoread);
+			memcpy(&buffer[bytesread], &sectbuf[sf->curroffset], bytestoread);
 			bytesread += bytestoread;
 			sf->filepos += bytestoread;
 			sf->curroffset += bytestoread;
@@ -593,6 +819,11 @@ static ssize_t smartfs_read(FAR struct file *filep, char *buffer, size_t buflen)
 
 	ret = bytesread;
 
+#ifdef CONFIG_SMARTFS_IOSTAT
+	fs->fs_iostat.rdbytes += bytesread;
+	fs->fs_iostat.rdticks += clock_systimer() - start;
+#endif
+
 errout_with_semaphore:
 	smartfs_semgive(fs);
 	return ret;
@@ -613,6 +844,9 @@ static ssize_t smartfs_write(FAR struct file *filep, const char *buffer, size_t
 	uint16_t bytes;
 	size_t size = sizeof(struct smartfs_chain_header_s);
 	int ret;
+#ifdef CONFIG_SMARTFS_IOSTAT
+	clock_t start;
+#endif
 
 	/* Sanity checks.  I have seen the following assertion misfire if
 	 * CONFIG_DEBUG_MM is enabled while re-directing output to a
@@ -648,6 +882,11 @@ static ssize_t smartfs_write(FAR struct file *filep, const char *buffer, size_t
 		goto errout_with_semaphore;
 	}
 
+#ifdef CONFIG_SMARTFS_IOSTAT
+	start = clock_systimer();
+#endif
+	SMARTFS_SECTCACHE_INVALIDATE(fs);
+
 	header = (struct smartfs_chain_header_s *)fs->fs_rwbuffer;
 	byteswritten = 0;
 
@@ -777,6 +1016,13 @@ static ssize_t smartfs_write(FAR struct file *filep, const char *buffer, size_t
 	}
 	ret = byteswritten;
 
+#ifdef CONFIG_SMARTFS_IOSTAT
+	if (ret > 0) {
+		fs->fs_iostat.wrbytes += ret;
+	}
+	fs->fs_iostat.wrticks += clock_systimer() - start;
+#endif
+
 errout_with_semaphore:
 	smartfs_semgive(fs);
 	return ret;
@@ -1642,6 +1888,12 @@ int smartfs_rename(struct inode *mountpt, const char *oldrelpath, const char *ne
 			if (ret != OK) {
 				fdbg("Error writing new entry to sector %d, ret : %d\n", readwrite.logsector, ret);
 			}
+#ifdef CONFIG_SMARTFS_DCACHE
+			else {
+				smartfs_dcache_remove(fs, oldentry.dsector, oldentry.doffset);
+				smartfs_dcache_add(fs, oldentry.dfirst, newentry.name, oldentry.dsector, oldentry.doffset);
+			}
+#endif
 			/* Old entry doesn't have to be invalidated, directly go to end */
 			goto errout_with_semaphore;
 		}
@@ -186,6 +186,108 @@ struct sector_recover_info_s {
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: smartfs_append_sectors
+ *
+ * Description:
+ *   Append whole sectors of data with a single BIOC_WRITESECTS.  The
+ *   chained sectors are allocated first, so the data and the complete
+ *   chain header (type, next sector and used count) of every sector can
+ *   each be written once.  Only done when the file position is at the
+ *   start of an empty current sector and more than one sector of data
+ *   remains.  Returns the number of bytes appended, zero if the caller
+ *   should fall back to appending sector by sector, or a negated errno.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_SMARTFS_READAHEAD) && !defined(CONFIG_SMARTFS_USE_SECTOR_BUFFER)
+static ssize_t smartfs_append_sectors(FAR struct smartfs_mountpt_s *fs, FAR struct smartfs_ofile_s *sf, const char *buffer, size_t buflen)
+{
+	struct smart_read_write_s reqs[2 * CONFIG_SMARTFS_READAHEAD_SECTORS];
+	struct smartfs_chain_header_s headers[CONFIG_SMARTFS_READAHEAD_SECTORS];
+	uint16_t sectors[CONFIG_SMARTFS_READAHEAD_SECTORS + 1];
+	struct smart_multi_rw_s multi;
+	uint16_t avail;
+	uint16_t nsectors;
+	uint16_t nalloc;
+	uint16_t x;
+	int ret;
+
+	avail = SMARTFS_AVAIL_DATABYTES(fs);
+	if (sf->curroffset != sizeof(struct smartfs_chain_header_s) || sf->byteswritten != 0 || buflen / avail < 2) {
+		return 0;
+	}
+
+	nsectors = MIN(buflen / avail, CONFIG_SMARTFS_READAHEAD_SECTORS);
+
+	/* Allocate the sectors to chain after the current one, including the
+	 * sector the remaining data will go to.
+	 */
+
+	nalloc = (buflen > (size_t)nsectors * avail) ? nsectors : nsectors - 1;
+	sectors[0] = sf->currsector;
+	sectors[nsectors] = SMARTFS_ERASEDSTATE_16BIT;
+	for (x = 1; x <= nalloc; x++) {
+		ret = FS_IOCTL(fs, BIOC_ALLOCSECT, 0xFFFF);
+		if (ret < 0) {
+			/* Give the sectors back and let the caller fill the volume
+			 * sector by sector and report where it runs out of space.
+			 */
+
+			while (--x > 0) {
+				FS_IOCTL(fs, BIOC_FREESECT, sectors[x]);
+			}
+
+			return 0;
+		}
+
+		sectors[x] = (uint16_t)ret;
+	}
+
+	/* The data of each sector is written before its header, just like
+	 * the used count is recorded only after the data when appending
+	 * sector by sector.
+	 */
+
+	for (x = 0; x < nsectors; x++) {
+		headers[x].type = SMARTFS_SECTOR_TYPE_FILE;
+		smartfs_wrle16(headers[x].nextsector, sectors[x + 1]);
+		smartfs_wrle16(headers[x].used, avail);
+
+		smartfs_setbuffer(&reqs[2 * x], sectors[x], sizeof(struct smartfs_chain_header_s), avail, (uint8_t *)&buffer[x * avail]);
+		smartfs_setbuffer(&reqs[2 * x + 1], sectors[x], 0, sizeof(struct smartfs_chain_header_s), (uint8_t *)&headers[x]);
+	}
+
+	multi.nreqs = 2 * nsectors;
+	multi.reqs = reqs;
+	ret = FS_IOCTL(fs, BIOC_WRITESECTS, (unsigned long)&multi);
+	if (ret < 0) {
+		fdbg("Error writing %d sectors from sector %d, ret : %d\n", nsectors, sf->currsector, ret);
+		return ret;
+	}
+
+	/* Leave the file where appending sector by sector would have left it */
+
+	if (nalloc == nsectors) {
+		sf->currsector = sectors[nsectors];
+		sf->curroffset = sizeof(struct smartfs_chain_header_s);
+	} else {
+		sf->currsector = sectors[nsectors - 1];
+		sf->curroffset = fs->fs_llformat.availbytes;
+	}
+
+	sf->entry.datalen += (size_t)nsectors * avail;
+	sf->filepos += (size_t)nsectors * avail;
+
+#ifdef CONFIG_SMARTFS_IOSTAT
+	fs->fs_iostat.wrsectors += nsectors;
+	fs->fs_iostat.wrmulti++;
+#endif
+
+	return (ssize_t)nsectors * avail;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -687,6 +789,8 @@ int smartfs_sync_internal(struct smartfs_mountpt_s *fs, struct smartfs_ofile_s *
 
 #ifdef CONFIG_SMARTFS_USE_SECTOR_BUFFER
 	if (sf->bflags & SMARTFS_BFLAG_DIRTY) {
+		SMARTFS_SECTCACHE_INVALIDATE(fs);
+
 		/* Update the header with the number of bytes written */
 
 		header = (struct smartfs_chain_header_s *)sf->buffer;
@@ -730,6 +834,7 @@ int smartfs_sync_internal(struct smartfs_mountpt_s *fs, struct smartfs_ofile_s *
 
 	if (sf->byteswritten > 0) {
 		fvdbg("Syncing sector %d\n", sf->currsector);
+		SMARTFS_SECTCACHE_INVALIDATE(fs);
 
 		/* Read the existing sector used bytes value */
 
@@ -1043,6 +1148,10 @@ int smartfs_unmount(struct smartfs_mountpt_s *fs)
 	kmm_free(fs->fs_workbuffer);
 #endif
 
+#ifdef CONFIG_SMARTFS_DCACHE
+	smartfs_dcache_release(fs);
+#endif
+
 	return ret;
 }
 
@@ -1137,6 +1246,11 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs, struct smartfs_entry_s *d
 #ifdef CONFIG_SMARTFS_DYNAMIC_HEADER
 	int used_value;
 #endif
+#ifdef CONFIG_SMARTFS_DCACHE
+	uint16_t hintoffset;
+	uint32_t flushes;
+	bool fullscan;
+#endif
 
 	/* Initialize directory level zero as the root sector */
 	direntry->dsector = 0xFFFF;
@@ -1224,6 +1338,26 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs, struct smartfs_entry_s *d
 
 			offset = 0xFFFF;
 
+#ifdef CONFIG_SMARTFS_DCACHE
+			/* Ask the directory cache first.  A cached location only tells
+			 * us where to start looking; if the name is not found there we
+			 * fall back to scanning the whole directory.
+			 */
+
+			fullscan = false;
+			flushes = fs->fs_dcache ? fs->fs_dcache->flushes : 0;
+			ret = smartfs_dcache_lookup(fs, dirstack[depth], fs->fs_workbuffer, &dirsector, &hintoffset);
+			if (ret == -ENOENT) {
+				/* The directory is fully cached and has no such name */
+
+				dirsector = SMARTFS_ERASEDSTATE_16BIT;
+				readwrite.count = 0;
+			} else if (ret != OK) {
+				fullscan = true;
+				flushes = fs->fs_dcache ? fs->fs_dcache->flushes : 0;
+			}
+#endif
+
 #if CONFIG_SMARTFS_ERASEDSTATE == 0xFF
 			while (dirsector != 0xFFFF)
 #else
@@ -1246,6 +1380,18 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs, struct smartfs_entry_s *d
 				/* Search for the entry */
 
 				offset = sizeof(struct smartfs_chain_header_s);
+#ifdef CONFIG_SMARTFS_DCACHE
+				if (!fullscan) {
+					/* Start at the cached location, but only if this still
+					 * is a directory sector.
+					 */
+
+					offset = hintoffset;
+					if (header->type != SMARTFS_SECTOR_TYPE_DIR) {
+						offset = readwrite.count;
+					}
+				}
+#endif
 				entry = (struct smartfs_entry_header_s *)&fs->fs_rwbuffer[offset];
 				while (offset < readwrite.count) {
 					/* Test if this entry is valid and active */
@@ -1260,9 +1406,22 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs, struct smartfs_entry_s *d
 						continue;
 					}
 
+#ifdef CONFIG_SMARTFS_DCACHE
+					/* Index every entry we come across while scanning */
+
+					if (fullscan) {
+						smartfs_dcache_add(fs, dirstack[depth], entry->name, readwrite.logsector, offset);
+					}
+#endif
+
 					/* Test if the name matches */
 
 					if (strncmp(entry->name, fs->fs_workbuffer, fs->fs_llformat.namesize) == 0) {
+#ifdef CONFIG_SMARTFS_DCACHE
+						if (fs->fs_dcache != NULL && !fullscan) {
+							fs->fs_dcache->hits++;
+						}
+#endif
 						/* We found it!  If this is the last segment entry,
 						 * then report the entry.  If it isn't the last
 						 * entry, then validate it is a directory entry and
@@ -1352,8 +1511,29 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs, struct smartfs_entry_s *d
 				if (offset < readwrite.count) {
 					break;
 				}
+#ifdef CONFIG_SMARTFS_DCACHE
+				if (!fullscan) {
+					/* The cached location was stale, scan the whole directory */
+
+					if (fs->fs_dcache != NULL) {
+						fs->fs_dcache->stale++;
+					}
+
+					fullscan = true;
+					flushes = fs->fs_dcache ? fs->fs_dcache->flushes : 0;
+					dirsector = dirstack[depth];
+				}
+#endif
 			}
 
+#ifdef CONFIG_SMARTFS_DCACHE
+			if (fullscan && offset >= readwrite.count) {
+				/* We have seen every entry of this directory */
+
+				smartfs_dcache_setindexed(fs, dirstack[depth], flushes);
+			}
+#endif
+
 			/* If we found a dir entry, then continue searching */
 
 			if (offset < readwrite.count) {
@@ -1373,6 +1553,7 @@ int smartfs_finddirentry(struct smartfs_mountpt_s *fs, struct smartfs_entry_s *d
 
 			if (*ptr == '\0') {
 				direntry->dsector = dirstack[depth];
+				direntry->dfirst = dirstack[depth];
 				strncpy(direntry->name, segment, seglen);
 			} else {
 				direntry->dsector = 0xFFFF;
@@ -1620,6 +1801,9 @@ int smartfs_writeentry(struct smartfs_mountpt_s *fs, struct smartfs_entry_s new_
 		}
 	}
 
+#ifdef CONFIG_SMARTFS_DCACHE
+	smartfs_dcache_add(fs, new_entry.dfirst, new_entry.name, new_entry.dsector, new_entry.doffset);
+#endif
 	ret = OK;
 
 errout:
@@ -1719,6 +1903,10 @@ int smartfs_invalidateentry(struct smartfs_mountpt_s *fs, uint16_t parentdirsect
 	struct smart_read_write_s readwrite;
 	uint8_t *entry_flags;
 
+#ifdef CONFIG_SMARTFS_DCACHE
+	smartfs_dcache_remove(fs, parentdirsector, offset);
+#endif
+
 	smartfs_setbuffer(&readwrite, parentdirsector, offset, sizeof(uint16_t), (uint8_t *)fs->fs_rwbuffer);
 	ret = FS_IOCTL(fs, BIOC_READSECT, (unsigned long)&readwrite);
 	if (ret < 0) {
@@ -1780,6 +1968,15 @@ int smartfs_deleteentry(struct smartfs_mountpt_s *fs, struct smartfs_entry_s *en
 	 * So We will always process regarding entry & chain first when delete entry.
 	 */
 
+	SMARTFS_SECTCACHE_INVALIDATE(fs);
+
+#ifdef CONFIG_SMARTFS_DCACHE
+	smartfs_dcache_remove(fs, entry->dsector, entry->doffset);
+	if ((entry->flags & SMARTFS_DIRENT_TYPE) == SMARTFS_DIRENT_TYPE_DIR) {
+		smartfs_dcache_purgedir(fs, entry->firstsector);
+	}
+#endif
+
 	/* First Find current directory has only one item which is target entry */
 	ret = OK;
 	header = (struct smartfs_chain_header_s *)fs->fs_rwbuffer;
@@ -2011,6 +2208,8 @@ int smartfs_shrinkfile(FAR struct smartfs_mountpt_s *fs, FAR struct smartfs_ofil
 	struct smartfs_chain_header_s *chainheader;
 	uint16_t nextsector;
 
+	SMARTFS_SECTCACHE_INVALIDATE(fs);
+
 	/* Seek till point 'length' of the file, file pointer lies at position of requested 'length' now */
 	smartfs_seek_internal(fs, sf, length, SEEK_SET);
 	sf->byteswritten = sf->curroffset - sizeof(struct smartfs_chain_header_s);
@@ -2132,7 +2331,24 @@ ssize_t smartfs_append_data(FAR struct smartfs_mountpt_s *fs, FAR struct smartfs
 	struct smart_read_write_s readwrite;
 	struct smartfs_chain_header_s *chainheader;
 
+	SMARTFS_SECTCACHE_INVALIDATE(fs);
+
 	while (buflen > 0) {
+#if defined(CONFIG_SMARTFS_READAHEAD) && !defined(CONFIG_SMARTFS_USE_SECTOR_BUFFER)
+		/* Write runs of whole sectors with one multi-sector request */
+
+		ret = smartfs_append_sectors(fs, sf, &buffer[byteswritten], buflen);
+		if (ret < 0) {
+			return ret;
+		}
+
+		if (ret > 0) {
+			buflen -= ret;
+			byteswritten += ret;
+			continue;
+		}
+#endif
+
 		/* We will fill up the current sector. Write data to
 		 * the current sector first.
 		 */
@@ -0,0 +1,803 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * fs/vfs/fs_epoll.c
+ *
+ * Persistent interest sets on top of the driver and socket poll() hooks.
+ *
+ * poll() sets up every descriptor before it sleeps and tears every one of
+ * them down after it wakes.  An epoll instance instead keeps one struct
+ * pollfd per registered descriptor set up with the driver for as long as
+ * the descriptor is registered.  All of them share the semaphore of the
+ * instance, and drivers record what happened in the revents of their own
+ * pollfd before posting it, so epoll_wait() only has to collect non-zero
+ * revents.  Only the descriptors that are reported are touched again:
+ *
+ *   - Level-triggered descriptors have their state re-evaluated, so that the
+ *     driver posts again if they are still ready.  Sockets stay registered
+ *     and only rescan their state.  Drivers only evaluate their state at
+ *     setup, so files are torn down and set up again; that takes a slot
+ *     of the driver and allocates nothing.
+ *   - Edge-triggered descriptors just have their revents cleared and stay
+ *     set up; the driver posts again on the next event.
+ *   - One-shot descriptors are torn down until EPOLL_CTL_MOD re-arms them.
+ *
+ * Drivers keep pointing at the pollfd of an entry for as long as it is set
+ * up, so closing a registered descriptor removes it from every instance
+ * before the driver or socket goes away (epoll_fileclose() and
+ * epoll_sockclose()).
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/epoll.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <time.h>
+#include <errno.h>
+#include <assert.h>
+#include <debug.h>
+
+#include <tinyara/kmalloc.h>
+#include <tinyara/clock.h>
+#include <tinyara/cancelpt.h>
+#include <tinyara/semaphore.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/net/net.h>
+#include <arch/irq.h>
+
+#include "inode/inode.h"
+
+#if defined(CONFIG_FS_EPOLL) && !defined(CONFIG_DISABLE_POLL) && CONFIG_NFILE_DESCRIPTORS > 0
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Events always reported, as poll() does */
+
+#define EPOLL_ALWAYS   (POLLERR | POLLHUP)
+
+/* I/O events that can be requested */
+
+#define EPOLL_IOMASK   (POLLIN | POLLOUT | POLLERR | POLLHUP)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One registered descriptor.  The entry is never moved while registered
+ * because the driver holds a pointer to its pollfd.
+ */
+
+struct epoll_entry_s {
+	FAR struct epoll_entry_s *flink;
+	FAR struct file *filep;		/* Registered file, NULL for a socket */
+	struct pollfd pfd;			/* Set up with the driver while armed */
+	uint32_t events;			/* Events and mode flags from epoll_ctl() */
+	epoll_data_t data;			/* Returned with the events */
+	bool armed;					/* pfd is set up with the driver */
+};
+
+/* One epoll instance, the private data of its file descriptor */
+
+struct epoll_head_s {
+	FAR struct epoll_head_s *flink;	/* Next instance in g_epoll_heads */
+	sem_t exclsem;				/* Protects the interest set */
+	sem_t waitsem;				/* Posted by the drivers */
+	FAR struct epoll_entry_s *head;	/* Registered descriptors */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static int epoll_close(FAR struct file *filep);
+
+/****************************************************************************
+ * Private Variables
+ ****************************************************************************/
+
+static const struct file_operations g_epoll_ops = {
+	NULL,						/* open */
+	epoll_close,				/* close */
+	NULL,						/* read */
+	NULL,						/* write */
+	NULL,						/* seek */
+	NULL,						/* ioctl */
+	NULL,						/* poll */
+	NULL						/* unlink */
+};
+
+/* All epoll instances, searched when a descriptor is closed.  Lock order
+ * is g_epoll_sem, then the exclsem of an instance.
+ */
+
+static sem_t g_epoll_sem = SEM_INITIALIZER(1);
+static FAR struct epoll_head_s *g_epoll_heads;
+
+/* All epoll descriptors refer to this inode.  It is not part of the inode
+ * tree.
+ */
+
+static struct inode g_epoll_inode = {
+	NULL,						/* i_peer */
+	NULL,						/* i_child */
+	0,							/* i_crefs */
+	FSNODEFLAG_TYPE_DRIVER,		/* i_flags */
+	{
+		&g_epoll_ops			/* u */
+	},
+#ifdef CONFIG_FILE_MODE
+	0,							/* i_mode */
+#endif
+	NULL,						/* i_private */
+	{'\0'}						/* i_name */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: epoll_semtake
+ ****************************************************************************/
+
+static void epoll_semtake(FAR sem_t *sem)
+{
+	while (sem_wait(sem) != 0) {
+		/* The only case that an error should occur here is if the wait was
+		 * awakened by a signal.
+		 */
+
+		ASSERT(get_errno() == EINTR);
+	}
+}
+
+#define epoll_semgive(sem) sem_post(sem)
+
+/****************************************************************************
+ * Name: epoll_fdsetup
+ *
+ * Description:
+ *   Set up or tear down the driver poll of one registered descriptor.
+ *
+ ****************************************************************************/
+
+static int epoll_fdsetup(FAR struct epoll_entry_s *entry, bool setup)
+{
+	int ret;
+
+	if (entry->filep != NULL) {
+		ret = file_poll(entry->filep, &entry->pfd, setup);
+	} else {
+#if defined(CONFIG_NET) && CONFIG_NSOCKET_DESCRIPTORS > 0
+		ret = net_poll(entry->pfd.fd, &entry->pfd, setup);
+#else
+		ret = -EBADF;
+#endif
+	}
+
+	if (ret >= 0 || !setup) {
+		entry->armed = setup;
+	}
+
+	return ret;
+}
+
+/****************************************************************************
+ * Name: epoll_arm
+ *
+ * Description:
+ *   (Re-)set up the driver poll of an entry with cleared revents.  If the
+ *   descriptor is ready already the driver sets revents and posts waitsem
+ *   right away.
+ *
+ ****************************************************************************/
+
+static int epoll_arm(FAR struct epoll_head_s *eph, FAR struct epoll_entry_s *entry)
+{
+	if (entry->armed) {
+		(void)epoll_fdsetup(entry, false);
+	}
+
+	entry->pfd.sem = &eph->waitsem;
+	entry->pfd.events = (pollevent_t)((entry->events & EPOLL_IOMASK) | EPOLL_ALWAYS | POLLPERSIST);
+	entry->pfd.revents = 0;
+	entry->pfd.priv = NULL;
+	entry->pfd.filep = NULL;
+
+	return epoll_fdsetup(entry, true);
+}
+
+/****************************************************************************
+ * Name: epoll_recheck
+ *
+ * Description:
+ *   Have the ready state of a level-triggered entry re-evaluated after its
+ *   events were reported.  The driver sets revents and posts waitsem again
+ *   if the descriptor is still ready.
+ *
+ ****************************************************************************/
+
+static void epoll_recheck(FAR struct epoll_head_s *eph, FAR struct epoll_entry_s *entry)
+{
+	if (entry->filep == NULL && entry->armed) {
+		/* A set up socket rescans and keeps its registration */
+
+		(void)epoll_fdsetup(entry, true);
+	} else {
+		(void)epoll_arm(eph, entry);
+	}
+}
+
+/****************************************************************************
+ * Name: epoll_gethead
+ ****************************************************************************/
+
+static FAR struct epoll_head_s *epoll_gethead(int epfd)
+{
+	FAR struct file *filep;
+
+	if ((unsigned int)epfd >= CONFIG_NFILE_DESCRIPTORS || fs_getfilep(epfd, &filep) < 0) {
+		return NULL;
+	}
+
+	if (filep->f_inode != &g_epoll_inode) {
+		return NULL;
+	}
+
+	return (FAR struct epoll_head_s *)filep->f_priv;
+}
+
+/****************************************************************************
+ * Name: epoll_find
+ ****************************************************************************/
+
+static FAR struct epoll_entry_s *epoll_find(FAR struct epoll_head_s *eph, int fd, FAR struct epoll_entry_s **prev)
+{
+	FAR struct epoll_entry_s *entry;
+
+	*prev = NULL;
+	for (entry = eph->head; entry; entry = entry->flink) {
+		if (entry->pfd.fd == fd) {
+			return entry;
+		}
+
+		*prev = entry;
+	}
+
+	return NULL;
+}
+
+/****************************************************************************
+ * Name: epoll_collect
+ *
+ * Description:
+ *   Return the events of up to 'maxevents' reported descriptors and re-arm
+ *   them according to their mode.
+ *
+ ****************************************************************************/
+
+static int epoll_collect(FAR struct epoll_head_s *eph, FAR struct epoll_event *evs, int maxevents)
+{
+	FAR struct epoll_entry_s *entry;
+	FAR struct epoll_entry_s *prev = NULL;
+	FAR struct epoll_entry_s *tail;
+	pollevent_t revents;
+	irqstate_t flags;
+	int nevents = 0;
+
+	for (entry = eph->head; entry && nevents < maxevents; prev = entry, entry = entry->flink) {
+		if (!entry->armed) {
+			continue;
+		}
+
+		/* Drivers update revents from interrupt handlers and other tasks */
+
+		flags = irqsave();
+		revents = entry->pfd.revents;
+		entry->pfd.revents = 0;
+		irqrestore(flags);
+
+		revents &= (pollevent_t)((entry->events & EPOLL_IOMASK) | EPOLL_ALWAYS);
+		if (revents == 0) {
+			continue;
+		}
+
+		evs[nevents].events = revents;
+		evs[nevents].data = entry->data;
+		nevents++;
+
+		if ((entry->events & EPOLLONESHOT) != 0) {
+			(void)epoll_fdsetup(entry, false);
+		} else if ((entry->events & EPOLLET) == 0) {
+			epoll_recheck(eph, entry);
+		}
+	}
+
+	/* If 'evs' filled up, start the next scan with the first entry that
+	 * was not visited so that busy descriptors cannot starve the others.
+	 */
+
+	if (entry != NULL && prev != NULL) {
+		for (tail = entry; tail->flink; tail = tail->flink) ;
+		tail->flink = eph->head;
+		prev->flink = NULL;
+		eph->head = entry;
+	}
+
+	return nevents;
+}
+
+/****************************************************************************
+ * Name: epoll_detach
+ *
+ * Description:
+ *   Tear down and remove the entries of a descriptor that is being closed
+ *   from every epoll instance.  Files are matched by their struct file,
+ *   sockets (filep == NULL) by their descriptor number.
+ *
+ ****************************************************************************/
+
+static void epoll_detach(FAR struct file *filep, int sd)
+{
+	FAR struct epoll_head_s *eph;
+	FAR struct epoll_entry_s *entry;
+	FAR struct epoll_entry_s *prev;
+	FAR struct epoll_entry_s *next;
+
+	/* Most closes happen with no epoll instance at all */
+
+	if (g_epoll_heads == NULL) {
+		return;
+	}
+
+	epoll_semtake(&g_epoll_sem);
+	for (eph = g_epoll_heads; eph; eph = eph->flink) {
+		epoll_semtake(&eph->exclsem);
+
+		prev = NULL;
+		for (entry = eph->head; entry; entry = next) {
+			next = entry->flink;
+			if (entry->filep != filep || (filep == NULL && entry->pfd.fd != sd)) {
+				prev = entry;
+				continue;
+			}
+
+			if (entry->armed) {
+				(void)epoll_fdsetup(entry, false);
+			}
+
+			if (prev) {
+				prev->flink = next;
+			} else {
+				eph->head = next;
+			}
+
+			kmm_free(entry);
+		}
+
+		epoll_semgive(&eph->exclsem);
+	}
+
+	epoll_semgive(&g_epoll_sem);
+}
+
+/****************************************************************************
+ * Name: epoll_close
+ *
+ * Description:
+ *   Close method of the epoll descriptor.  Tear down every registered
+ *   descriptor and free the instance.
+ *
+ ****************************************************************************/
+
+static int epoll_close(FAR struct file *filep)
+{
+	FAR struct epoll_head_s *eph = (FAR struct epoll_head_s *)filep->f_priv;
+	FAR struct epoll_entry_s *entry;
+
+	FAR struct epoll_head_s *curr;
+	FAR struct epoll_head_s *prev;
+
+	if (eph == NULL) {
+		return OK;
+	}
+
+	epoll_semtake(&g_epoll_sem);
+	for (prev = NULL, curr = g_epoll_heads; curr && curr != eph; prev = curr, curr = curr->flink) ;
+	if (curr != NULL) {
+		if (prev) {
+			prev->flink = eph->flink;
+		} else {
+			g_epoll_heads = eph->flink;
+		}
+	}
+
+	epoll_semgive(&g_epoll_sem);
+
+	while ((entry = eph->head) != NULL) {
+		eph->head = entry->flink;
+		if (entry->armed) {
+			(void)epoll_fdsetup(entry, false);
+		}
+
+		kmm_free(entry);
+	}
+
+	sem_destroy(&eph->waitsem);
+	sem_destroy(&eph->exclsem);
+	kmm_free(eph);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: epoll_fileclose
+ *
+ * Description:
+ *   Called when a file is closed, before its driver close method.  Removes
+ *   the file from every epoll instance it is registered with.
+ *
+ ****************************************************************************/
+
+void epoll_fileclose(FAR struct file *filep)
+{
+	if (filep->f_inode != &g_epoll_inode) {
+		epoll_detach(filep, -1);
+	}
+}
+
+/****************************************************************************
+ * Name: epoll_sockclose
+ *
+ * Description:
+ *   Called when a socket descriptor is closed, before the network stack
+ *   frees the socket.  Removes the socket from every epoll instance it is
+ *   registered with.
+ *
+ ****************************************************************************/
+
+void epoll_sockclose(int sd)
+{
+	epoll_detach(NULL, sd);
+}
+
+/****************************************************************************
+ * Name: epoll_create1
+ *
+ * Description:
+ *   Create an epoll instance and return a file descriptor for it.
+ *
+ * Returned Value:
+ *   The new descriptor on success; -1 with errno set on failure:
+ *
+ *   EINVAL - Unsupported flags, including EPOLL_CLOEXEC.
+ *   ENOMEM - Out of memory.
+ *   EMFILE - No free file descriptor.
+ *
+ ****************************************************************************/
+
+int epoll_create1(int flags)
+{
+	FAR struct epoll_head_s *eph;
+	FAR struct file *filep;
+	int err;
+	int fd;
+
+	/* There are no close-on-exec descriptors to honour EPOLL_CLOEXEC */
+
+	if (flags != 0) {
+		err = EINVAL;
+		goto errout;
+	}
+
+	eph = (FAR struct epoll_head_s *)kmm_zalloc(sizeof(struct epoll_head_s));
+	if (eph == NULL) {
+		err = ENOMEM;
+		goto errout;
+	}
+
+	sem_init(&eph->exclsem, 0, 1);
+
+	/* waitsem is used for signaling and, hence, should not have priority
+	 * inheritance enabled.
+	 */
+
+	sem_init(&eph->waitsem, 0, 0);
+	sem_setprotocol(&eph->waitsem, SEM_PRIO_NONE);
+
+	inode_addref(&g_epoll_inode);
+	fd = files_allocate(&g_epoll_inode, O_RDOK, 0, 0);
+	if (fd < 0) {
+		err = EMFILE;
+		goto errout_with_inode;
+	}
+
+	if (fs_getfilep(fd, &filep) < 0) {
+		err = EBADF;
+		goto errout_with_inode;
+	}
+
+	filep->f_priv = eph;
+
+	epoll_semtake(&g_epoll_sem);
+	eph->flink = g_epoll_heads;
+	g_epoll_heads = eph;
+	epoll_semgive(&g_epoll_sem);
+	return fd;
+
+errout_with_inode:
+	inode_release(&g_epoll_inode);
+	sem_destroy(&eph->waitsem);
+	sem_destroy(&eph->exclsem);
+	kmm_free(eph);
+
+errout:
+	set_errno(err);
+	return ERROR;
+}
+
+/****************************************************************************
+ * Name: epoll_create
+ ****************************************************************************/
+
+int epoll_create(int size)
+{
+	if (size <= 0) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	return epoll_create1(0);
+}
+
+/****************************************************************************
+ * Name: epoll_ctl
+ *
+ * Returned Value:
+ *   Zero on success; -1 with errno set on failure:
+ *
+ *   EBADF  - epfd is not an epoll descriptor or fd is not valid.
+ *   EEXIST - fd is already registered (EPOLL_CTL_ADD).
+ *   ENOENT - fd is not registered (EPOLL_CTL_MOD, EPOLL_CTL_DEL).
+ *   EINVAL - Invalid operation or epfd == fd.
+ *   ENOMEM - Out of memory.
+ *   ENOSYS - The driver of fd does not support poll.
+ *
+ ****************************************************************************/
+
+int epoll_ctl(int epfd, int op, int fd, FAR struct epoll_event *ev)
+{
+	FAR struct epoll_head_s *eph;
+	FAR struct epoll_entry_s *entry;
+	FAR struct epoll_entry_s *prev;
+	int ret = OK;
+
+	eph = epoll_gethead(epfd);
+	if (eph == NULL || fd < 0) {
+		set_errno(EBADF);
+		return ERROR;
+	}
+
+	if (fd == epfd || (op != EPOLL_CTL_DEL && ev == NULL)) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	epoll_semtake(&eph->exclsem);
+	entry = epoll_find(eph, fd, &prev);
+
+	switch (op) {
+	case EPOLL_CTL_ADD:
+		if (entry != NULL) {
+			ret = -EEXIST;
+			break;
+		}
+
+		entry = (FAR struct epoll_entry_s *)kmm_zalloc(sizeof(struct epoll_entry_s));
+		if (entry == NULL) {
+			ret = -ENOMEM;
+			break;
+		}
+
+		entry->pfd.fd = fd;
+		entry->events = ev->events;
+		entry->data = ev->data;
+
+		/* Files are polled through their struct file, which closing the
+		 * descriptor detaches again.  Anything else must be a socket.
+		 */
+
+		if ((unsigned int)fd < CONFIG_NFILE_DESCRIPTORS) {
+			ret = fs_getfilep(fd, &entry->filep);
+			if (ret >= 0 && entry->filep->f_inode == NULL) {
+				ret = -EBADF;
+			}
+		}
+#if defined(CONFIG_NET) && CONFIG_NSOCKET_DESCRIPTORS > 0
+		else if ((unsigned int)fd >= (CONFIG_NFILE_DESCRIPTORS + CONFIG_NSOCKET_DESCRIPTORS)) {
+			ret = -EBADF;
+		}
+#else
+		else {
+			ret = -EBADF;
+		}
+#endif
+
+		if (ret >= 0) {
+			ret = epoll_arm(eph, entry);
+		}
+
+		if (ret < 0) {
+			kmm_free(entry);
+			break;
+		}
+
+		entry->flink = eph->head;
+		eph->head = entry;
+		break;
+
+	case EPOLL_CTL_MOD:
+		if (entry == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		entry->events = ev->events;
+		entry->data = ev->data;
+		ret = epoll_arm(eph, entry);
+		break;
+
+	case EPOLL_CTL_DEL:
+		if (entry == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		if (entry->armed) {
+			(void)epoll_fdsetup(entry, false);
+		}
+
+		if (prev) {
+			prev->flink = entry->flink;
+		} else {
+			eph->head = entry->flink;
+		}
+
+		kmm_free(entry);
+		break;
+
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	epoll_semgive(&eph->exclsem);
+
+	if (ret < 0) {
+		set_errno(-ret);
+		return ERROR;
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: epoll_wait
+ *
+ * Returned Value:
+ *   The number of events returned in 'evs', zero on timeout; -1 with errno
+ *   set on failure:
+ *
+ *   EBADF  - epfd is not an epoll descriptor.
+ *   EINVAL - maxevents is not positive.
+ *   EINTR  - A signal occurred before any event.
+ *
+ ****************************************************************************/
+
+int epoll_wait(int epfd, FAR struct epoll_event *evs, int maxevents, int timeout)
+{
+	FAR struct epoll_head_s *eph;
+	struct timespec abstime;
+	irqstate_t flags;
+	int nevents;
+	int err = 0;
+	int ret;
+
+	/* epoll_wait() is a cancellation point */
+
+	(void)enter_cancellation_point();
+
+	eph = epoll_gethead(epfd);
+	if (eph == NULL) {
+		err = EBADF;
+		goto errout;
+	}
+
+	if (evs == NULL || maxevents <= 0) {
+		err = EINVAL;
+		goto errout;
+	}
+
+	if (timeout > 0) {
+		(void)clock_gettime(CLOCK_REALTIME, &abstime);
+		abstime.tv_sec += timeout / MSEC_PER_SEC;
+		abstime.tv_nsec += (timeout % MSEC_PER_SEC) * NSEC_PER_MSEC;
+		if (abstime.tv_nsec >= NSEC_PER_SEC) {
+			abstime.tv_sec++;
+			abstime.tv_nsec -= NSEC_PER_SEC;
+		}
+	}
+
+	for (;;) {
+		epoll_semtake(&eph->exclsem);
+		nevents = epoll_collect(eph, evs, maxevents);
+		epoll_semgive(&eph->exclsem);
+
+		if (nevents > 0 || timeout == 0) {
+			break;
+		}
+
+		/* Nothing reported yet.  waitsem may also hold counts for events
+		 * that were collected already; those just cause another pass.
+		 */
+
+		if (timeout > 0) {
+			flags = irqsave();
+			ret = sem_timedwait(&eph->waitsem, &abstime);
+			irqrestore(flags);
+		} else {
+			ret = sem_wait(&eph->waitsem);
+		}
+
+		if (ret < 0) {
+			err = get_errno();
+			if (err == ETIMEDOUT) {
+				err = 0;
+				nevents = 0;
+				break;
+			}
+
+			goto errout;
+		}
+	}
+
+	leave_cancellation_point();
+	return nevents;
+
+errout:
+	leave_cancellation_point();
+	set_errno(err);
+	return ERROR;
+}
+
+#endif							/* CONFIG_FS_EPOLL && !CONFIG_DISABLE_POLL */
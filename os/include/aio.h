@@ -117,6 +117,10 @@
 #define LIO_READ        1
 #define LIO_WRITE       2
 
+#ifdef CONFIG_FS_AIO_CQ
+#define LIO_FSYNC       3		/* Non-standard, aio_cq_submit() only */
+#endif
+
 /* lio_listio modes
  *
  * LIO_NOWAIT      - Indicates that the calling thread is to continue
@@ -157,6 +161,19 @@ struct aiocb {
 	FAR void *aio_priv;			/* Used by signal handlers */
 };
 
+#ifdef CONFIG_FS_AIO_CQ
+/* One completion reported by aio_cq_reap() */
+
+struct aio_cqe {
+	FAR struct aiocb *aiocbp;	/* The completed request */
+	ssize_t result;				/* Bytes transferred or a negated errno */
+};
+
+/* Handle of a completion queue */
+
+typedef FAR struct aio_cq_s *aio_cq_t;
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -181,6 +198,35 @@ int aio_suspend(FAR const struct aiocb *const list[], int nent, FAR const struct
 int aio_write(FAR struct aiocb *aiocbp);
 int lio_listio(int mode, FAR struct aiocb *const list[], int nent, FAR struct sigevent *sig);
 
+#ifdef CONFIG_FS_AIO_CQ
+/****************************************************************************
+ * Completion queue interface (non-standard)
+ *
+ * Requests are queued to a pool of worker threads that belong to the
+ * calling task, so any file or socket descriptor of the task can be used.
+ * Completions are collected with aio_cq_reap() instead of being signalled.
+ *
+ *   aio_cq_create  - Create a queue for up to 'depth' requests in flight,
+ *                    served by 'nworkers' threads (0 selects the default).
+ *   aio_cq_destroy - Wait for the requests in flight and free the queue.
+ *   aio_cq_submit  - Queue up to 'nent' requests (LIO_READ, LIO_WRITE,
+ *                    LIO_FSYNC or LIO_NOP) in one call.  Returns the number
+ *                    queued, which is less than 'nent' when the queue is
+ *                    full.  File requests use aio_offset; socket requests
+ *                    ignore it.
+ *   aio_cq_reap    - Return up to 'maxevents' completions, waiting until at
+ *                    least 'minevents' are available or 'timeout' (relative,
+ *                    NULL waits forever) expires.  With minevents == 0 it
+ *                    polls without waiting.
+ *
+ ****************************************************************************/
+
+int aio_cq_create(unsigned int depth, unsigned int nworkers, FAR aio_cq_t *cqp);
+int aio_cq_destroy(aio_cq_t cq);
+int aio_cq_submit(aio_cq_t cq, FAR struct aiocb *const list[], int nent);
+int aio_cq_reap(aio_cq_t cq, FAR struct aio_cqe *cqes, int minevents, int maxevents, FAR const struct timespec *timeout);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
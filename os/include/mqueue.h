@@ -67,6 +67,8 @@
  * Included Files
  ********************************************************************************/
 
+#include <tinyara/config.h>
+
 #include <sys/types.h>
 #include <signal.h>
 #include "queue.h"
@@ -189,6 +191,30 @@ int mq_setattr(mqd_t mqdes, FAR const struct mq_attr *mq_stat, FAR struct mq_att
  */
 int mq_getattr(mqd_t mqdes, FAR struct mq_attr *mq_stat);
 
+#ifdef CONFIG_MQ_REFERENCE
+/**
+ * @brief send a message to a message queue by reference
+ * @details @b #include <mqueue.h> \n
+ * The ownership of buf, allocated with malloc(), moves to the receiver.
+ * @since TizenRT v3.0
+ */
+int mq_send_ref(mqd_t mqdes, FAR void *buf, size_t buflen, int prio);
+/**
+ * @brief receive a message from a message queue by reference
+ * @details @b #include <mqueue.h> \n
+ * The caller owns the returned buffer and releases it with free().
+ * @since TizenRT v3.0
+ */
+ssize_t mq_receive_ref(mqd_t mqdes, FAR void **buf, FAR int *prio);
+/**
+ * @brief receive a message from a message queue by reference with a timeout
+ * @details @b #include <mqueue.h> \n
+ * The caller owns the returned buffer and releases it with free().
+ * @since TizenRT v3.0
+ */
+ssize_t mq_timedreceive_ref(mqd_t mqdes, FAR void **buf, FAR int *prio, FAR const struct timespec *abstime);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
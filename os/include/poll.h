@@ -115,6 +115,14 @@
 #define POLLHUP      (0x08)
 #define POLLNVAL     (0x10)
 
+/* Kernel internal: the pollfd stays set up across events (epoll), so the
+ * driver must keep reporting to it instead of signalling only once.
+ * Sockets also accept a setup of a pollfd that is set up already; it only
+ * re-evaluates the ready state.
+ */
+
+#define POLLPERSIST  (0x80)
+
 /****************************************************************************
  * Public Type Definitions
  ****************************************************************************/
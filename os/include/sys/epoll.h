@@ -0,0 +1,140 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * include/sys/epoll.h
+ ****************************************************************************/
+
+#ifndef __INCLUDE_SYS_EPOLL_H
+#define __INCLUDE_SYS_EPOLL_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <poll.h>
+
+#ifdef CONFIG_FS_EPOLL
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/* Operations for epoll_ctl() */
+
+#define EPOLL_CTL_ADD  1		/* Add a descriptor to the interest set */
+#define EPOLL_CTL_DEL  2		/* Remove a descriptor from the interest set */
+#define EPOLL_CTL_MOD  3		/* Change the events of a registered descriptor */
+
+/* Event flags.  The I/O events are the poll() events; the remaining bits
+ * select the notification mode.  EPOLLERR and EPOLLHUP are always reported
+ * whether requested or not.
+ */
+
+#define EPOLLIN        POLLIN
+#define EPOLLPRI       POLLPRI
+#define EPOLLOUT       POLLOUT
+#define EPOLLRDNORM    POLLRDNORM
+#define EPOLLRDBAND    POLLRDBAND
+#define EPOLLWRNORM    POLLWRNORM
+#define EPOLLWRBAND    POLLWRBAND
+#define EPOLLERR       POLLERR
+#define EPOLLHUP       POLLHUP
+
+#define EPOLLONESHOT   (1u << 30)	/* Disable after one event until EPOLL_CTL_MOD */
+#define EPOLLET        (1u << 31)	/* Edge-triggered notification */
+
+/* Flags for epoll_create1().  Descriptors have no close-on-exec flag
+ * (F_SETFD fails with ENOSYS), so epoll_create1() rejects it with EINVAL.
+ */
+
+#define EPOLL_CLOEXEC  (1 << 19)
+
+/****************************************************************************
+ * Public Type Definitions
+ ****************************************************************************/
+
+typedef union epoll_data {
+	FAR void *ptr;
+	int fd;
+	uint32_t u32;
+} epoll_data_t;
+
+struct epoll_event {
+	uint32_t events;			/* Epoll events and mode flags */
+	epoll_data_t data;			/* User data returned with the events */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Name: epoll_create, epoll_create1
+ *
+ * Description:
+ *   Create a new, empty interest set and return a file descriptor
+ *   referring to it.  'size' is only a hint and must be positive.  The set
+ *   is destroyed when the descriptor is closed.
+ *
+ ****************************************************************************/
+
+int epoll_create(int size);
+int epoll_create1(int flags);
+
+/****************************************************************************
+ * Name: epoll_ctl
+ *
+ * Description:
+ *   Add, modify or remove descriptor 'fd' in the interest set 'epfd'.
+ *   Descriptors stay registered with their drivers until removed, so a
+ *   descriptor must be removed with EPOLL_CTL_DEL before it is closed.
+ *
+ ****************************************************************************/
+
+int epoll_ctl(int epfd, int op, int fd, FAR struct epoll_event *ev);
+
+/****************************************************************************
+ * Name: epoll_wait
+ *
+ * Description:
+ *   Wait up to 'timeout' milliseconds (forever if negative) for events on
+ *   the interest set and return up to 'maxevents' of them.  Returns the
+ *   number of events, zero on timeout or -1 with errno set on failure.
+ *
+ ****************************************************************************/
+
+int epoll_wait(int epfd, FAR struct epoll_event *evs, int maxevents, int timeout);
+
+#undef EXTERN
+#if defined(__cplusplus)
+}
+#endif
+
+#endif							/* CONFIG_FS_EPOLL */
+#endif							/* __INCLUDE_SYS_EPOLL_H */
@@ -96,6 +96,16 @@
  *
  *      char myname[CONFIG_TASK_NAME_SIZE];
  *      prctl(PR_GET_NAME_BYPID, myname, 0);
+ *
+ *  PR_GET_GROUP_SERIAL
+ *    Return the serial number of the task group of the calling task (or
+ *    thread) in the location pointed to by required arg1 (uint32_t *).
+ *    All threads of a task group get the same number.  It is never 0 and
+ *    only given to another task group after 2^32 task groups were created.
+ *    As an example:
+ *
+ *      uint32_t serial;
+ *      prctl(PR_GET_GROUP_SERIAL, &serial);
  */
 
 /**
@@ -123,6 +133,7 @@ enum prctl_type_e {
 	PR_REBOOT_REASON_READ,
 	PR_REBOOT_REASON_WRITE,
 	PR_REBOOT_REASON_CLEAR,
+	PR_GET_GROUP_SERIAL,
 };
 
 /****************************************************************************
@@ -289,7 +289,15 @@
 #ifndef CONFIG_DISABLE_POLL
 #define SYS_poll                       __SYS_poll
 #define SYS_select                     (__SYS_poll + 1)
+#ifdef CONFIG_FS_EPOLL
+#define SYS_epoll_create               (__SYS_poll + 2)
+#define SYS_epoll_create1              (__SYS_poll + 3)
+#define SYS_epoll_ctl                  (__SYS_poll + 4)
+#define SYS_epoll_wait                 (__SYS_poll + 5)
+#define __SYS_boardctl                 (__SYS_poll + 6)
+#else
 #define __SYS_boardctl                 (__SYS_poll + 2)
+#endif
 #else
 #define __SYS_boardctl                 __SYS_poll
 #endif
@@ -392,9 +400,15 @@
 #define SYS_pthread_key_delete         (__SYS_pthread + 12)
 #define SYS_pthread_mutex_destroy      (__SYS_pthread + 13)
 #define SYS_pthread_mutex_init         (__SYS_pthread + 14)
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+#define SYS_pthread_mutex_lock_slow    (__SYS_pthread + 15)
+#define SYS_pthread_mutex_trylock_slow (__SYS_pthread + 16)
+#define SYS_pthread_mutex_unlock_slow  (__SYS_pthread + 17)
+#else
 #define SYS_pthread_mutex_lock         (__SYS_pthread + 15)
 #define SYS_pthread_mutex_trylock      (__SYS_pthread + 16)
 #define SYS_pthread_mutex_unlock       (__SYS_pthread + 17)
+#endif
 
 #ifndef CONFIG_PTHREAD_MUTEX_UNSAFE
 #define SYS_pthread_mutex_consistent   (__SYS_pthread + 18)
@@ -394,6 +394,11 @@ struct pthread_mutex_s {
 	uint8_t type;                   /* Type of the mutex.  See PTHREAD_MUTEX_* definitions */
 	int nlocks;                     /* The number of recursive locks held */
 #endif
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+	volatile int owner;             /* Lock word of the fast path: 0 if free, PID of a holder
+	                                 * that took it without the kernel, or
+	                                 * PTHREAD_MUTEX_OWNER_KERNEL if sem holds the state */
+#endif
 };
 typedef struct pthread_mutex_s pthread_mutex_t;
 
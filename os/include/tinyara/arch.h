@@ -1868,6 +1868,9 @@ size_t up_check_tcbstack(FAR struct tcb_s *tcb);
 ssize_t up_check_tcbstack_remain(FAR struct tcb_s *tcb);
 size_t up_check_stack(void);
 ssize_t up_check_stack_remain(void);
+#ifdef CONFIG_STACK_HWM
+ssize_t up_check_tcbstack_range(FAR struct tcb_s *tcb, size_t offset, size_t nbytes);
+#endif
 #if CONFIG_ARCH_INTERRUPTSTACK > 3
 size_t up_check_intstack(void);
 size_t up_check_intstack_remain(void);
@@ -0,0 +1,82 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+#ifndef __INCLUDE_DEBUG_STACKHWM_H
+#define __INCLUDE_DEBUG_STACKHWM_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef CONFIG_STACK_HWM
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* Stack peak of the terminated tasks of one name */
+
+struct stack_hwm_record_s {
+#if CONFIG_TASK_NAME_SIZE > 0
+	char name[CONFIG_TASK_NAME_SIZE + 1];	/* Task name, empty if unused */
+#endif
+	size_t stack_size;			/* Largest stack size of the runs */
+	size_t peak;				/* Deepest stack use of the runs */
+	uint32_t nexits;			/* Number of runs, 0 if unused */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+struct tcb_s;
+
+/* Called by the idle loop to search the next few words of the stacks */
+
+void stack_hwm_scan(void);
+
+/* Called by task_exithook() to record the stack peak of a task */
+
+void stack_hwm_terminated(FAR struct tcb_s *tcb);
+
+/* Copy record 'index' of the terminated tasks.  Returns false once index
+ * is past the end of the table.
+ */
+
+bool stack_hwm_get_record(int index, FAR struct stack_hwm_record_s *record);
+
+#undef EXTERN
+#if defined(__cplusplus)
+}
+#endif
+
+#endif							/* CONFIG_STACK_HWM */
+#endif							/* __INCLUDE_DEBUG_STACKHWM_H */
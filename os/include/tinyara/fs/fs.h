@@ -1020,6 +1020,23 @@ int file_poll(FAR struct file *filep, FAR struct pollfd *fds, bool setup);
 
 int fdesc_poll(int fd, FAR struct pollfd *fds, bool setup);
 
+/* fs/vfs/fs_epoll.c ********************************************************/
+/****************************************************************************
+ * Name: epoll_fileclose and epoll_sockclose
+ *
+ * Description:
+ *   Remove a file or socket descriptor that is being closed from every
+ *   epoll instance it is registered with, so that no driver or socket keeps
+ *   a poll registration for it.  Called before the driver or network stack
+ *   close.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_FS_EPOLL) && !defined(CONFIG_DISABLE_POLL)
+void epoll_fileclose(FAR struct file *filep);
+void epoll_sockclose(int sd);
+#endif
+
 /* fs/driver/block/fs_blockproxy.c ******************************************/
 /****************************************************************************
  * Name: unique_chardev_initialize
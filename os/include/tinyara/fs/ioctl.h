@@ -164,6 +164,14 @@
 #define FIONBIO         _FIOC(0x000b)     /* IN:  Boolean option takes an int value.
 										 * OUT: Origin option.
 										 */
+#define FIONSENDQ       _FIOC(0x000c)	/* IN:  Location to return value (int *)
+										 * OUT: Bytes sent on this socket but not
+										 *      acknowledged by the peer yet
+										 */
+#define FIONSENDQWAIT   _FIOC(0x000d)	/* IN:  Pointer to an int holding the limit
+										 *      of unacknowledged bytes to wait for
+										 * OUT: Bytes still unacknowledged
+										 */
 
 /* TinyAra file system ioctl definitions **************************************/
 
@@ -256,6 +264,17 @@
 										 *		to reveal physical sector.
 										 * OUT: Physical sector number align with
 										 *		logical sector number */
+#define BIOC_READSECTS  _BIOC(0x000E)	/* Read several logical sectors from the
+										 * block device in one request.
+										 * IN:  Pointer to a struct smart_multi_rw_s
+										 *      listing the sector read requests
+										 * OUT: Total number of bytes read or error */
+#define BIOC_WRITESECTS _BIOC(0x000F)	/* Write data to several logical sectors
+										 * in one request.
+										 * IN:  Pointer to a struct smart_multi_rw_s
+										 *      listing the sector write requests
+										 * OUT: None (ioctl return value provides
+										 *      success/failure indication). */
 #define BIOC_DEBUGCMD   _BIOC(0x00FF)	/* Send driver specific debug command /
 										 * data to the block device.
 										 * IN:  Pointer to a struct defined for
@@ -102,6 +102,16 @@ struct smart_read_write_s {
 	const uint8_t *buffer;		/* Pointer to the data to write */
 };
 
+/* The following describes a batch of logical sector reads or writes
+ * passed with BIOC_READSECTS or BIOC_WRITESECTS.  The requests are
+ * processed in order and processing stops at the first failure.
+ */
+
+struct smart_multi_rw_s {
+	uint16_t nreqs;				/* Number of entries in reqs */
+	FAR struct smart_read_write_s *reqs;	/* The individual sector requests */
+};
+
 /* The following defines the procfs data exchange interface between the
  * SMART MTD and FS layers.
  */
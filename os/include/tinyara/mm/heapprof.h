@@ -0,0 +1,133 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * include/tinyara/mm/heapprof.h
+ *
+ * Heap allocation profiler.  Every allocation and free of the heaps is
+ * accounted to the call site recorded in its chunk header, the chunk sizes
+ * are counted in a power of two histogram and the lifetime of one in
+ * CONFIG_MM_HEAPPROF_SAMPLE_PERIOD allocations is recorded in a ring
+ * buffer.  The statistics are read from /proc/heapprof and reported by
+ * tools/memory/heapprof.py.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_TINYARA_MM_HEAPPROF_H
+#define __INCLUDE_TINYARA_MM_HEAPPROF_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#ifdef CONFIG_MM_HEAPPROF
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/* Bucket n of the size histogram counts the chunks of size 2^(n+4) up to
+ * 2^(n+5) - 1 bytes.  The first bucket also counts the smaller chunks and
+ * the last one the larger chunks.
+ */
+
+#define HEAPPROF_NBUCKETS        16
+#define HEAPPROF_BUCKET_SHIFT    4
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* Statistics of one call site */
+
+struct heapprof_callsite_s {
+	size_t addr;				/* Return address of the allocation call, 0 if unused */
+	uint32_t nallocs;			/* Number of allocations */
+	uint32_t nfrees;			/* Number of frees */
+	size_t curr_size;			/* Bytes allocated now */
+	size_t peak_size;			/* Maximum of curr_size */
+	size_t total_size;			/* Bytes allocated in total */
+	uint32_t nlifetimes;		/* Number of sampled allocations freed */
+	clock_t lifetime;			/* Sum of their lifetimes */
+};
+
+/* One sampled allocation */
+
+struct heapprof_sample_s {
+	FAR void *mem;				/* Address of the chunk, NULL if unused */
+	size_t addr;				/* Call site */
+	size_t size;				/* Size of the chunk */
+	pid_t pid;					/* Allocating task */
+	bool freed;					/* True once free_time is valid */
+	clock_t alloc_time;
+	clock_t free_time;
+};
+
+/* Totals of the profiler */
+
+struct heapprof_stats_s {
+	uint32_t nallocs;			/* Number of allocations */
+	uint32_t nfrees;			/* Number of frees */
+	uint32_t nlost_allocs;		/* Allocations of call sites not in the table */
+	uint32_t nlost_frees;		/* Frees of chunks not accounted to a call site */
+	uint32_t hist[HEAPPROF_NBUCKETS];	/* Chunk size histogram of the allocations */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+struct mm_allocnode_s;
+
+/* Called by the allocator with the heap semaphore held, after the chunk
+ * header is updated by heapinfo_update_node() and before the chunk is freed.
+ */
+
+void heapprof_alloc(FAR struct mm_allocnode_s *node);
+void heapprof_free(FAR struct mm_allocnode_s *node);
+
+/* Copy the statistics out of the profiler.  The get functions return false
+ * once index is past the end of the table.
+ */
+
+void heapprof_get_stats(FAR struct heapprof_stats_s *stats);
+bool heapprof_get_callsite(int index, FAR struct heapprof_callsite_s *callsite);
+bool heapprof_get_sample(int index, FAR struct heapprof_sample_s *sample);
+void heapprof_reset(void);
+
+#undef EXTERN
+#if defined(__cplusplus)
+}
+#endif
+
+#endif							/* CONFIG_MM_HEAPPROF */
+#endif							/* __INCLUDE_TINYARA_MM_HEAPPROF_H */
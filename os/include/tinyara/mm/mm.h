@@ -67,6 +67,9 @@
 #ifdef CONFIG_HEAPINFO_USER_GROUP
 #include <tinyara/mm/heapinfo_internal.h>
 #endif
+#ifdef CONFIG_MM_HEAPPROF
+#include <tinyara/mm/heapprof.h>
+#endif
 
 #include <tinyara/sched.h>
 /****************************************************************************
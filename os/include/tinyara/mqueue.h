@@ -90,6 +90,10 @@ struct mqueue_inode_s {
 	int16_t nwaitnotfull;		/* Number tasks waiting for not full */
 	int16_t nwaitnotempty;		/* Number tasks waiting for not empty */
 	size_t maxmsgsize;			/* Max size of message in message queue */
+#ifdef CONFIG_MQ_PERQUEUE_POOL
+	sq_queue_t msgfree;			/* Free messages sized for this queue */
+	FAR void *msgblock;			/* Messages pre-allocated with the queue */
+#endif
 #ifndef CONFIG_DISABLE_SIGNALS
 	FAR struct mq_des *ntmqdes;	/* Notification: Owning mqdes (NULL if none) */
 	pid_t ntpid;				/* Notification: Receiving Task's PID */
@@ -60,6 +60,10 @@
 #include <tinyara/config.h>
 #include <pthread.h>
 #include <sched.h>
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+#include <stdint.h>
+#include <errno.h>
+#endif
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -82,6 +86,18 @@
 	{ {NULL, 0, 0}, {NULL, 0, 0} } /* No MPU regions */ \
 }
 
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+/* Value of the lock word of a mutex whose state is kept by its semaphore,
+ * because threads wait for it or the kernel took it on their behalf.
+ */
+
+#define PTHREAD_MUTEX_OWNER_KERNEL (-1)
+
+/* Returned by the fast path when the kernel must complete the operation */
+
+#define PTHREAD_MUTEX_SLOWPATH     (-1)
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -99,10 +115,164 @@ extern "C" {
 
 EXTERN const pthread_attr_t g_default_pthread_attr;
 
+#if defined(CONFIG_PTHREAD_MUTEX_FASTPATH) && defined(CONFIG_BUILD_PROTECTED) && !defined(__KERNEL__)
+/* PID of the running thread.  The kernel writes it at each context switch
+ * so that the user-space mutex fast path does not need getpid().
+ */
+
+EXTERN volatile pid_t g_pthread_curr_pid;
+#endif
+
 /****************************************************************************
  * Public Function Prototypes
  ****************************************************************************/
 
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+/****************************************************************************
+ * Name: pthread_mutex_lock_slow, pthread_mutex_trylock_slow and
+ *       pthread_mutex_unlock_slow
+ *
+ * Description:
+ *   The kernel part of pthread_mutex_lock(), pthread_mutex_trylock() and
+ *   pthread_mutex_unlock(), called when the fast path below could not
+ *   complete the operation.  They hand a mutex held in user space over to
+ *   its semaphore before blocking on it, so priority inheritance and the
+ *   robust mutex checks see the real holder.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_lock_slow(FAR pthread_mutex_t *mutex);
+int pthread_mutex_trylock_slow(FAR pthread_mutex_t *mutex);
+int pthread_mutex_unlock_slow(FAR pthread_mutex_t *mutex);
+
+/****************************************************************************
+ * Name: pthread_mutex_fastlock
+ *
+ * Description:
+ *   Lock a free mutex with one compare-and-swap of its lock word (LDREX and
+ *   STREX on ARM), or relock a recursive or errorcheck mutex that the
+ *   caller already holds this way, without entering the kernel.  Robust
+ *   mutexes always take the slow path.
+ *
+ * Parameters:
+ *   mutex - The mutex to be locked
+ *   mypid - The PID of the calling thread
+ *
+ * Return Value:
+ *   0 or an errno value if the operation is complete, or
+ *   PTHREAD_MUTEX_SLOWPATH if pthread_mutex_lock_slow() must complete it.
+ *
+ ****************************************************************************/
+
+static inline int pthread_mutex_fastlock(FAR pthread_mutex_t *mutex, pid_t mypid)
+{
+#ifndef CONFIG_PTHREAD_MUTEX_UNSAFE
+	/* A robust mutex must be on the list of mutexes held by its holder, so
+	 * that the kernel releases it when the holder exits.
+	 */
+
+	if ((mutex->flags & _PTHREAD_MFLAGS_ROBUST) != 0) {
+		return PTHREAD_MUTEX_SLOWPATH;
+	}
+#endif
+
+	if (__sync_bool_compare_and_swap(&mutex->owner, 0, mypid)) {
+		mutex->pid = mypid;
+#ifdef CONFIG_PTHREAD_MUTEX_TYPES
+		mutex->nlocks = 1;
+#endif
+		return OK;
+	}
+
+#ifdef CONFIG_PTHREAD_MUTEX_TYPES
+	if (mutex->owner == mypid && mutex->type != PTHREAD_MUTEX_NORMAL) {
+		if (mutex->type != PTHREAD_MUTEX_RECURSIVE) {
+			return EDEADLK;
+		}
+
+		if (mutex->nlocks >= INT16_MAX) {
+			return EOVERFLOW;
+		}
+
+		mutex->nlocks++;
+		return OK;
+	}
+#endif
+
+	return PTHREAD_MUTEX_SLOWPATH;
+}
+
+/****************************************************************************
+ * Name: pthread_mutex_fasttrylock
+ *
+ * Description:
+ *   Like pthread_mutex_fastlock(), but an errorcheck mutex held by the
+ *   caller is busy rather than a deadlock.
+ *
+ ****************************************************************************/
+
+static inline int pthread_mutex_fasttrylock(FAR pthread_mutex_t *mutex, pid_t mypid)
+{
+	int ret = pthread_mutex_fastlock(mutex, mypid);
+
+#ifdef CONFIG_PTHREAD_MUTEX_TYPES
+	if (ret == EDEADLK) {
+		ret = EBUSY;
+	}
+#endif
+
+	return ret;
+}
+
+/****************************************************************************
+ * Name: pthread_mutex_fastunlock
+ *
+ * Description:
+ *   Unlock a mutex that the caller locked with pthread_mutex_fastlock(),
+ *   unless a waiter has handed it over to the kernel in the meantime.
+ *
+ * Parameters:
+ *   mutex - The mutex to be unlocked
+ *   mypid - The PID of the calling thread
+ *
+ * Return Value:
+ *   0 if the mutex was unlocked, or PTHREAD_MUTEX_SLOWPATH if
+ *   pthread_mutex_unlock_slow() must unlock it.
+ *
+ ****************************************************************************/
+
+static inline int pthread_mutex_fastunlock(FAR pthread_mutex_t *mutex, pid_t mypid)
+{
+	if (mutex->owner != mypid) {
+		return PTHREAD_MUTEX_SLOWPATH;
+	}
+
+#ifdef CONFIG_PTHREAD_MUTEX_TYPES
+	if (mutex->type == PTHREAD_MUTEX_RECURSIVE && mutex->nlocks > 1) {
+		mutex->nlocks--;
+		return OK;
+	}
+
+	mutex->nlocks = 0;
+#endif
+	mutex->pid = -1;
+
+	if (__sync_bool_compare_and_swap(&mutex->owner, mypid, 0)) {
+		return OK;
+	}
+
+	/* A waiter handed the mutex over to the kernel, which now needs to
+	 * wake it up.
+	 */
+
+	mutex->pid = mypid;
+#ifdef CONFIG_PTHREAD_MUTEX_TYPES
+	mutex->nlocks = 1;
+#endif
+	return PTHREAD_MUTEX_SLOWPATH;
+}
+#endif							/* CONFIG_PTHREAD_MUTEX_FASTPATH */
+
 #undef EXTERN
 #ifdef __cplusplus
 }
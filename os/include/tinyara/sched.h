@@ -370,6 +370,7 @@ struct task_group_s {
 #endif
 
 	uint8_t tg_flags;			/* See GROUP_FLAG_* definitions             */
+	uint32_t tg_serial;			/* Serial number, see PR_GET_GROUP_SERIAL   */
 
 	/* Group membership ********************************************************** */
 
@@ -575,6 +576,9 @@ struct tcb_s {
 #ifdef CONFIG_MPU_STACKGUARD
 	FAR void *stack_guard;          /* address of the stack guard */
 	size_t guard_size;              /* size of the guard region */
+#endif
+#ifdef CONFIG_STACK_HWM
+	size_t stack_hwm;			/* Stack high water mark found by idle */
 #endif
 	/* External Module Support *************************************************** */
 
@@ -52,6 +52,7 @@
 #define SECLINKIOC_COMMON _SECLINKIOC(0x00)
 #define SECLINKIOC_INIT _SECLINKIOC((SECLINKIOC_COMMON | 0x00))
 #define SECLINKIOC_DEINIT _SECLINKIOC((SECLINKIOC_COMMON | 0x01))
+#define SECLINKIOC_BATCH _SECLINKIOC((SECLINKIOC_COMMON | 0x02))
 
 /*  Crypto */
 #define SECLINKIOC_CRYPTO _SECLINKIOC(0x10)
@@ -157,6 +158,25 @@ struct seclink_req {
 	int32_t res;
 };
 
+/*  A crypto, authenticate, secure storage or key manager request of a batch */
+struct seclink_batch_op {
+	int32_t cmd;
+	struct seclink_req req;
+};
+
+/*  The driver runs the requests in order and stops at the first one it
+ *  can not run (not at the first one the HAL fails), ndone is the number
+ *  of requests that were run.
+ */
+struct seclink_batch_req {
+	struct seclink_batch_op *ops;
+	uint32_t nops;
+	uint32_t ndone;
+};
+
+struct _seclink_batch_s_;
+typedef struct _seclink_batch_s_ *sl_batch;
+
 /*  Common */
 int sl_init(sl_ctx *hnd);
 int sl_deinit(sl_ctx hnd);
@@ -199,5 +219,37 @@ int sl_write_storage(sl_ctx hnd, uint32_t ss_idx, hal_data *data);
 int sl_read_storage(sl_ctx hnd, uint32_t ss_idx, _OUT_ hal_data *data);
 int sl_delete_storage(sl_ctx hnd, uint32_t ss_idx);
 
+/*  Batch
+ *  The requests added to a batch are sent to the driver in one call by
+ *  sl_batch_submit(). The buffers and parameters given to sl_batch_xxx()
+ *  are used in place, so they have to stay valid until the batch is done.
+ *  The result of each request is read with sl_batch_get_result(), by the
+ *  order it was added in.  It returns SECLINK_BUSY while the batch is
+ *  queued by sl_batch_submit_async().
+ */
+int sl_batch_create(sl_ctx hnd, uint32_t max_ops, _OUT_ sl_batch *batch);
+int sl_batch_destroy(sl_batch batch);
+int sl_batch_reset(sl_batch batch);
+int sl_batch_aes_encrypt(sl_batch batch, hal_data *dec_data, hal_aes_param *aes_param, uint32_t key_idx, _OUT_ hal_data *enc_data);
+int sl_batch_aes_decrypt(sl_batch batch, hal_data *enc_data, hal_aes_param *aes_param, uint32_t key_idx, _OUT_ hal_data *dec_data);
+int sl_batch_get_hash(sl_batch batch, hal_hash_type mode, hal_data *input, _OUT_ hal_data *hash);
+int sl_batch_get_hmac(sl_batch batch, hal_hmac_type mode, hal_data *input, uint32_t key_idx, _OUT_ hal_data *hmac);
+int sl_batch_ecdsa_sign_md(sl_batch batch, hal_ecdsa_mode mode, hal_data *hash, uint32_t key_idx, _OUT_ hal_data *sign);
+int sl_batch_ecdsa_verify_md(sl_batch batch, hal_ecdsa_mode mode, hal_data *hash, hal_data *sign, uint32_t key_idx);
+int sl_batch_write_storage(sl_batch batch, uint32_t ss_idx, hal_data *data);
+int sl_batch_read_storage(sl_batch batch, uint32_t ss_idx, _OUT_ hal_data *data);
+/*  Returns SECLINK_OK if all requests succeeded, otherwise the first error */
+int sl_batch_submit(sl_batch batch);
+int sl_batch_get_result(sl_batch batch, uint32_t op);
+#ifdef CONFIG_SECURITY_LINK_BATCH_ASYNC
+/*  Queue the batch to the worker thread of the handle and return. The
+ *  batches complete in the order they were queued, sl_batch_wait() waits
+ *  for the next one and returns it with the result of sl_batch_submit().
+ */
+int sl_batch_submit_async(sl_batch batch);
+/*  sl_deinit() returns SECLINK_BUSY until every queued batch is waited for */
+int sl_batch_wait(sl_ctx hnd, _OUT_ sl_batch *batch);
+#endif
+
 /*  Utils */
 char *sl_strerror(int error);
@@ -90,6 +90,12 @@ struct userspace_s {
 #ifndef CONFIG_DISABLE_SIGNALS
 	void (*signal_handler)(_sa_sigaction_t sighand, int signo, FAR siginfo_t *info, FAR void *ucontext);
 #endif
+
+	/* PID of the running thread, written by the kernel at context switch */
+
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+	FAR volatile pid_t *curr_pid;
+#endif
 };
 
 /****************************************************************************
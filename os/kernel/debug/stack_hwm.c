@@ -0,0 +1,261 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/irq.h>
+#include <tinyara/sched.h>
+#include <tinyara/debug/stackhwm.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_STACK_HWM
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Position of the idle task search.  The stack of a task is searched from
+ * its lowest address up to the high water mark already found, so the
+ * search of each stack gets shorter as the task goes deeper.
+ */
+
+struct stack_hwm_cursor_s {
+	bool active;				/* pid and offset are valid */
+	pid_t pid;					/* Task being searched */
+	int hash_ndx;				/* Its entry of g_pidhash */
+	size_t offset;				/* Next offset to search in its stack */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct stack_hwm_cursor_s g_stack_hwm_cursor;
+
+#if CONFIG_TASK_NAME_SIZE > 0
+static struct stack_hwm_record_s g_stack_hwm_records[CONFIG_STACK_HWM_NRECORDS];
+#endif
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: stack_hwm_next
+ *
+ * Description:
+ *   Move the cursor to the next task of the pid hash table.  Called with
+ *   interrupts disabled.
+ *
+ ****************************************************************************/
+
+static FAR struct tcb_s *stack_hwm_next(FAR struct stack_hwm_cursor_s *cursor)
+{
+	FAR struct tcb_s *tcb;
+	int i;
+
+	for (i = 0; i < CONFIG_MAX_TASKS; i++) {
+		cursor->hash_ndx = (cursor->hash_ndx + 1) % CONFIG_MAX_TASKS;
+		tcb = g_pidhash[cursor->hash_ndx].tcb;
+		if (tcb != NULL && tcb->stack_alloc_ptr != NULL) {
+			cursor->active = true;
+			cursor->pid = tcb->pid;
+			cursor->offset = 0;
+			return tcb;
+		}
+	}
+
+	cursor->active = false;
+	return NULL;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: stack_hwm_scan
+ *
+ * Description:
+ *   Search the next CONFIG_STACK_HWM_SCAN_WORDS words of the stacks for
+ *   the high water marks.  This is called from the idle loop, so the stacks
+ *   are searched in the idle time only and interrupts are disabled for the
+ *   search of a few words at a time.
+ *
+ ****************************************************************************/
+
+void stack_hwm_scan(void)
+{
+	FAR struct stack_hwm_cursor_s *cursor = &g_stack_hwm_cursor;
+	FAR struct tcb_s *tcb = NULL;
+	irqstate_t flags;
+	size_t nbytes;
+	size_t limit;
+	ssize_t used;
+
+	flags = irqsave();
+
+	/* Go on with the task of the previous search, unless it exited since */
+
+	if (cursor->active) {
+		tcb = g_pidhash[cursor->hash_ndx].tcb;
+		if (tcb != NULL && tcb->pid != cursor->pid) {
+			tcb = NULL;
+		}
+	}
+
+	if (tcb == NULL) {
+		tcb = stack_hwm_next(cursor);
+		if (tcb == NULL) {
+			irqrestore(flags);
+			return;
+		}
+	}
+
+	/* The words above the high water mark already found are in use, the
+	 * search of this stack is over when it reaches them.
+	 */
+
+	limit = tcb->adj_stack_size - tcb->stack_hwm;
+	nbytes = CONFIG_STACK_HWM_SCAN_WORDS << 2;
+	if (cursor->offset + nbytes >= limit) {
+		nbytes = cursor->offset < limit ? limit - cursor->offset : 0;
+		cursor->active = false;
+	}
+
+	used = up_check_tcbstack_range(tcb, cursor->offset, nbytes);
+	if (used >= 0) {
+		if ((size_t)used > tcb->stack_hwm) {
+			tcb->stack_hwm = used;
+		}
+
+		cursor->active = false;
+	} else {
+		cursor->offset += nbytes;
+	}
+
+	irqrestore(flags);
+}
+
+/****************************************************************************
+ * Name: stack_hwm_terminated
+ *
+ * Description:
+ *   Record the stack peak of a terminating task in the record of its name.
+ *   The stack is searched completely here, the idle task may not have
+ *   reached the high water mark yet.
+ *
+ ****************************************************************************/
+
+void stack_hwm_terminated(FAR struct tcb_s *tcb)
+{
+#if CONFIG_TASK_NAME_SIZE > 0
+	FAR struct stack_hwm_record_s *record = NULL;
+	irqstate_t flags;
+	size_t peak;
+	int i;
+
+	if (tcb->stack_alloc_ptr == NULL) {
+		return;
+	}
+
+	peak = up_check_tcbstack(tcb);
+	if (peak < tcb->stack_hwm) {
+		peak = tcb->stack_hwm;
+	}
+
+	flags = irqsave();
+
+	/* Find the record of the name or else the first free record.  Once the
+	 * table is full, the tasks of the new names are not recorded.
+	 */
+
+	for (i = 0; i < CONFIG_STACK_HWM_NRECORDS; i++) {
+		if (g_stack_hwm_records[i].nexits == 0) {
+			if (record == NULL) {
+				record = &g_stack_hwm_records[i];
+			}
+		} else if (strncmp(g_stack_hwm_records[i].name, tcb->name, CONFIG_TASK_NAME_SIZE) == 0) {
+			record = &g_stack_hwm_records[i];
+			break;
+		}
+	}
+
+	if (record != NULL) {
+		if (record->nexits == 0) {
+			strncpy(record->name, tcb->name, CONFIG_TASK_NAME_SIZE);
+			record->name[CONFIG_TASK_NAME_SIZE] = '\0';
+			record->stack_size = 0;
+			record->peak = 0;
+		}
+
+		if (record->stack_size < tcb->adj_stack_size) {
+			record->stack_size = tcb->adj_stack_size;
+		}
+
+		if (record->peak < peak) {
+			record->peak = peak;
+		}
+
+		record->nexits++;
+	}
+
+	irqrestore(flags);
+#endif
+}
+
+/****************************************************************************
+ * Name: stack_hwm_get_record
+ *
+ * Description:
+ *   Copy record 'index' of the terminated tasks.  An unused record has
+ *   nexits set to 0.  Returns false once index is past the end of the
+ *   table.
+ *
+ ****************************************************************************/
+
+bool stack_hwm_get_record(int index, FAR struct stack_hwm_record_s *record)
+{
+#if CONFIG_TASK_NAME_SIZE > 0
+	irqstate_t flags;
+
+	if (index < 0 || index >= CONFIG_STACK_HWM_NRECORDS) {
+		return false;
+	}
+
+	flags = irqsave();
+	memcpy(record, &g_stack_hwm_records[index], sizeof(struct stack_hwm_record_s));
+	irqrestore(flags);
+	return true;
+#else
+	return false;
+#endif
+}
+
+#endif							/* CONFIG_STACK_HWM */
@@ -91,6 +91,12 @@
 static gid_t g_gidcounter;
 #endif
 
+/* Serial numbers of task groups, never 0 and only reused after wrapping
+ * around
+ */
+
+static uint32_t g_groupserial;
+
 /*****************************************************************************
  * Public Data
  *****************************************************************************/
@@ -230,6 +236,10 @@ int group_allocate(FAR struct task_tcb_s *tcb, uint8_t ttype)
 	/* Attach the group to the TCB */
 
 	tcb->cmn.group = group;
+	if (++g_groupserial == 0) {
+		g_groupserial = 1;
+	}
+	group->tg_serial = g_groupserial;
 
 #if defined(HAVE_GROUP_MEMBERS) || defined(CONFIG_ARCH_ADDRENV)
 	/* Assign the group a unique ID.  If g_gidcounter were to wrap before we
@@ -76,6 +76,9 @@
 #ifdef CONFIG_DEBUG_SYSTEM
 #include  <tinyara/debug/sysdbg.h>
 #endif
+#ifdef CONFIG_STACK_HWM
+#include  <tinyara/debug/stackhwm.h>
+#endif
 #ifdef CONFIG_DRIVERS_OS_API_TEST
 #include  <tinyara/os_api_test_drv.h>
 #endif
@@ -636,6 +639,12 @@ void os_start(void)
 		sched_garbagecollection();
 #endif
 
+#ifdef CONFIG_STACK_HWM
+		/* Search a few more words of the stacks for their high water marks */
+
+		stack_hwm_scan();
+#endif
+
 		/* Perform any processor-specific idle state operations */
 
 		up_idle();
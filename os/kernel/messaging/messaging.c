@@ -105,6 +105,11 @@ static sem_t port_list_sem;
  ****************************************************************************/
 static sq_queue_t g_port_node_list;
 static int curr_recv_cnt;;
+
+/* Bumped whenever a receiver is added to or removed from any port.  Senders
+ * compare it to decide whether their cached port handles are still valid.
+ */
+static uint32_t g_port_gen;
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -200,6 +205,7 @@ int messaging_save_receiver(char *port_name, pid_t recv_pid, int recv_prio)
 				return OK;
 			}
 			port_node->nreceiver++;
+			g_port_gen++;
 			/* There was already same port node in the list, append recv node to this list. */
 			sem_wait(&port_node->port_sem);
 			ret = messaging_append_receiver(recv_pid, recv_prio, &port_node->recv_node_list);
@@ -221,6 +227,7 @@ int messaging_save_receiver(char *port_name, pid_t recv_pid, int recv_prio)
 	port_node->port_name[MSG_MAX_PORT_NAME - 1] = '\0';
 	port_node->sender_pid = MSG_SENDER_UNDEFINED;
 	port_node->nreceiver = 1;
+	g_port_gen++;
 	sem_init(&port_node->port_sem, 0, 1);
 	sq_init(&port_node->recv_node_list);
 	sem_wait(&port_list_sem);
@@ -243,6 +250,9 @@ int messaging_save_receiver(char *port_name, pid_t recv_pid, int recv_prio)
  *
  * Parameters:
  *   port_name - A message port name
+ *   recv_arr  - Array receiving the pids of the receivers
+ *   total_cnt - Location receiving the total number of receivers
+ *   gen       - Location receiving the current receiver generation (may be NULL)
  *
  * Return Value:
  *   Return the number of receivers who wait the port on success.
@@ -251,13 +261,17 @@ int messaging_save_receiver(char *port_name, pid_t recv_pid, int recv_prio)
  * Assumptions:
  *
  ****************************************************************************/
-int messaging_read_list(char *port_name, int *recv_arr, int *total_cnt)
+int messaging_read_list(char *port_name, int *recv_arr, int *total_cnt, uint32_t *gen)
 {
 	int recv_idx;
 	msg_port_node_t *port_node;
 	msg_recv_node_t *recv_node;
 	int recv_cnt;
 
+	if (gen != NULL) {
+		*gen = g_port_gen;
+	}
+
 	port_node = (msg_port_node_t *)sq_peek(&g_port_node_list);
 	while (port_node != NULL) {
 		if (strncmp(port_node->port_name, port_name, strlen(port_name) + 1) == 0) {
@@ -356,6 +370,7 @@ int messaging_remove_list(char *port_name)
 			ret = messaging_remove_recv_node(&port_node->recv_node_list);
 			if (ret == OK) {
 				port_node->nreceiver--;
+				g_port_gen++;
 			}
 			sem_post(&port_node->port_sem);
 
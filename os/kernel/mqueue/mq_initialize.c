@@ -109,7 +109,9 @@ sq_queue_t g_desfree;
  * messages.
  */
 
+#ifndef CONFIG_MQ_PERQUEUE_POOL
 static struct mqueue_msg_s *g_msgalloc;
+#endif
 
 /* g_msgfreeirqalloc is a pointer to the start of the allocated block of
  * messages.
@@ -187,9 +189,13 @@ void mq_initialize(void)
 	sq_init(&g_msgfreeirq);
 	sq_init(&g_desalloc);
 
-	/* Allocate a block of messages for general use */
+	/* Allocate a block of messages for general use.  With per-queue pools,
+	 * each message queue allocates its own messages when it is created.
+	 */
 
+#ifndef CONFIG_MQ_PERQUEUE_POOL
 	g_msgalloc = mq_msgblockalloc(&g_msgfree, CONFIG_PREALLOC_MQ_MSGS, MQ_ALLOC_FIXED);
+#endif
 
 	/* Allocate a block of messages for use exclusively by
 	 * interrupt handlers
@@ -96,6 +96,7 @@
  *   allocated dynamically it will be deallocated.
  *
  * Inputs:
+ *   msgq  - message queue the message was allocated for
  *   mqmsg - message to free
  *
  * Return Value:
@@ -103,7 +104,7 @@
  *
  ************************************************************************/
 
-void mq_msgfree(FAR struct mqueue_msg_s *mqmsg)
+void mq_msgfree(FAR struct mqueue_inode_s *msgq, FAR struct mqueue_msg_s *mqmsg)
 {
 	irqstate_t saved_state;
 
@@ -142,7 +143,19 @@ void mq_msgfree(FAR struct mqueue_msg_s *mqmsg)
 
 	else if (mqmsg->type == MQ_ALLOC_DYN) {
 		sched_kfree(mqmsg);
-	} else {
+	}
+#ifdef CONFIG_MQ_PERQUEUE_POOL
+	/* Messages sized for the queue go back to the pool of the queue.  They
+	 * are deallocated together with the queue.
+	 */
+
+	else if (mqmsg->type == MQ_ALLOC_QFIXED || mqmsg->type == MQ_ALLOC_QDYN) {
+		saved_state = irqsave();
+		sq_addlast((FAR sq_entry_t *)mqmsg, &msgq->msgfree);
+		irqrestore(saved_state);
+	}
+#endif
+	else {
 		PANIC();
 	}
 }
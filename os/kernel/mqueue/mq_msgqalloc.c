@@ -86,6 +86,51 @@
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: mq_msgpoolalloc
+ *
+ * Description:
+ *   Allocate the block of messages pre-allocated with a message queue and
+ *   place them on the free list of the queue.  Each message holds only
+ *   maxmsgsize bytes of message data.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_MQ_PERQUEUE_POOL
+static int mq_msgpoolalloc(FAR struct mqueue_inode_s *msgq)
+{
+	FAR struct mqueue_msg_s *mqmsg;
+	FAR uint8_t *block;
+	size_t size;
+	int nmsgs;
+	int i;
+
+	nmsgs = msgq->maxmsgs;
+	if (nmsgs > CONFIG_MQ_PERQUEUE_NPREALLOC) {
+		nmsgs = CONFIG_MQ_PERQUEUE_NPREALLOC;
+	}
+
+	if (nmsgs <= 0) {
+		return OK;
+	}
+
+	size = MQ_MSG_SIZE(msgq->maxmsgsize);
+	block = (FAR uint8_t *)kmm_malloc(size * nmsgs);
+	if (!block) {
+		return ERROR;
+	}
+
+	for (i = 0; i < nmsgs; i++) {
+		mqmsg = (FAR struct mqueue_msg_s *)(block + i * size);
+		mqmsg->type = MQ_ALLOC_QFIXED;
+		sq_addlast((FAR sq_entry_t *)mqmsg, &msgq->msgfree);
+	}
+
+	msgq->msgblock = block;
+	return OK;
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -101,7 +146,9 @@
  *   mode   - mode_t value is ignored
  *   attr   - The mq_maxmsg attribute is used at the time that the message
  *            queue is created to determine the maximum number of
- *            messages that may be placed in the message queue.
+ *            messages that may be placed in the message queue.  With
+ *            CONFIG_MQ_PERQUEUE_POOL, the messages of the queue are
+ *            sized from the mq_msgsize attribute.
  *
  * Return Value:
  *   The allocated and initialized message queue structure or NULL in the
@@ -141,6 +188,16 @@ FAR struct mqueue_inode_s *mq_msgqalloc(mode_t mode, FAR struct mq_attr *attr)
 #ifndef CONFIG_DISABLE_SIGNALS
 		msgq->ntpid = INVALID_PROCESS_ID;
 #endif
+
+#ifdef CONFIG_MQ_PERQUEUE_POOL
+		/* Pre-allocate messages sized for this queue */
+
+		sq_init(&msgq->msgfree);
+		if (mq_msgpoolalloc(msgq) != OK) {
+			sched_kfree(msgq);
+			msgq = NULL;
+		}
+#endif
 	}
 
 	return msgq;
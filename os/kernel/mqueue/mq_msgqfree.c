@@ -114,10 +114,33 @@ void mq_msgqfree(FAR struct mqueue_inode_s *msgq)
 		/* Deallocate the message structure. */
 
 		next = curr->next;
-		mq_msgfree(curr);
+#ifdef CONFIG_MQ_REFERENCE
+		/* The queue owns the data of a message passed by reference */
+
+		if (curr->ref) {
+			sched_ufree(curr->ref);
+		}
+#endif
+		mq_msgfree(msgq, curr);
 		curr = next;
 	}
 
+#ifdef CONFIG_MQ_PERQUEUE_POOL
+	/* Deallocate the messages allocated for this queue.  All of them are on
+	 * the free list of the queue now.
+	 */
+
+	while ((curr = (FAR struct mqueue_msg_s *)sq_remfirst(&msgq->msgfree)) != NULL) {
+		if (curr->type == MQ_ALLOC_QDYN) {
+			sched_kfree(curr);
+		}
+	}
+
+	if (msgq->msgblock) {
+		sched_kfree(msgq->msgblock);
+	}
+#endif
+
 	/* Then deallocate the message queue itself */
 
 	sched_kfree(msgq);
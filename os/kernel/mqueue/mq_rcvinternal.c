@@ -66,6 +66,7 @@
 #include <debug.h>
 
 #include <tinyara/arch.h>
+#include <tinyara/kmalloc.h>
 #include <tinyara/cancelpt.h>
 #include <tinyara/ttrace.h>
 
@@ -92,6 +93,47 @@
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: mq_wakesender
+ *
+ * Description:
+ *   Wake up the highest priority task waiting for the message queue to
+ *   become non-full after a message was taken from the queue.
+ *
+ ****************************************************************************/
+
+static void mq_wakesender(FAR struct mqueue_inode_s *msgq)
+{
+	FAR struct tcb_s *btcb;
+	irqstate_t saved_state;
+
+	/* Check if any tasks are waiting for the MQ not full event. */
+
+	if (msgq->nwaitnotfull > 0) {
+		/* Find the highest priority task that is waiting for
+		 * this queue to be not-full in g_waitingformqnotfull list.
+		 * This must be performed in a critical section because
+		 * messages can be sent from interrupt handlers.
+		 */
+
+		saved_state = irqsave();
+		for (btcb = (FAR struct tcb_s *)g_waitingformqnotfull.head; btcb && btcb->msgwaitq != msgq; btcb = btcb->flink) ;
+
+		/* If one was found, unblock it.  NOTE:  There is a race
+		 * condition here:  the queue might be full again by the
+		 * time the task is unblocked
+		 */
+
+		ASSERT(btcb);
+
+		btcb->msgwaitq = NULL;
+		msgq->nwaitnotfull--;
+		up_unblock_task(btcb);
+
+		irqrestore(saved_state);
+	}
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -258,7 +300,10 @@ FAR struct mqueue_msg_s *mq_waitreceive(mqd_t mqdes)
  *   prio    - The user-provided location to return the message priority.
  *
  * Return Value:
- *   Returns the length of the received message.  This function does not fail.
+ *   Returns the length of the received message.  This function does not
+ *   fail unless the message was passed by reference and is larger than
+ *   the maxmsgsize of the queue.  Such a message is discarded and ERROR
+ *   is returned with errno set to EMSGSIZE.
  *
  * Assumptions:
  * - The caller has provided all validity checking of the input parameters
@@ -271,9 +316,6 @@ FAR struct mqueue_msg_s *mq_waitreceive(mqd_t mqdes)
 
 ssize_t mq_doreceive(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR char *ubuffer, int *prio)
 {
-	FAR struct tcb_s *btcb;
-	irqstate_t saved_state;
-	FAR struct mqueue_inode_s *msgq;
 	ssize_t rcvmsglen;
 
 	trace_begin(TTRACE_TAG_IPC, "mq_doreceive");
@@ -284,7 +326,23 @@ ssize_t mq_doreceive(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR char *ubuf
 
 	/* Copy the message into the caller's buffer */
 
-	memcpy(ubuffer, (const void *)mqmsg->mail, rcvmsglen);
+#ifdef CONFIG_MQ_REFERENCE
+	if (mqmsg->ref) {
+		/* The caller's buffer holds only maxmsgsize bytes */
+
+		if (rcvmsglen > mqdes->msgq->maxmsgsize) {
+			set_errno(EMSGSIZE);
+			rcvmsglen = ERROR;
+		} else {
+			memcpy(ubuffer, (const void *)mqmsg->ref, rcvmsglen);
+		}
+
+		sched_ufree(mqmsg->ref);
+	} else
+#endif
+	{
+		memcpy(ubuffer, (const void *)mqmsg->mail, rcvmsglen);
+	}
 
 	/* Copy the message priority as well (if a buffer is provided) */
 
@@ -294,38 +352,85 @@ ssize_t mq_doreceive(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR char *ubuf
 
 	/* We are done with the message.  Deallocate it now. */
 
-	mq_msgfree(mqmsg);
+	mq_msgfree(mqdes->msgq, mqmsg);
+	mq_wakesender(mqdes->msgq);
 
-	/* Check if any tasks are waiting for the MQ not full event. */
+	trace_end(TTRACE_TAG_IPC);
 
-	msgq = mqdes->msgq;
-	if (msgq->nwaitnotfull > 0) {
-		/* Find the highest priority task that is waiting for
-		 * this queue to be not-full in g_waitingformqnotfull list.
-		 * This must be performed in a critical section because
-		 * messages can be sent from interrupt handlers.
-		 */
+	/* Return the length of the message transferred to the user buffer */
 
-		saved_state = irqsave();
-		for (btcb = (FAR struct tcb_s *)g_waitingformqnotfull.head; btcb && btcb->msgwaitq != msgq; btcb = btcb->flink) ;
+	return rcvmsglen;
+}
 
-		/* If one was found, unblock it.  NOTE:  There is a race
-		 * condition here:  the queue might be full again by the
-		 * time the task is unblocked
-		 */
+/****************************************************************************
+ * Name: mq_doreceive_ref
+ *
+ * Description:
+ *   This is the counterpart of mq_doreceive for mq_receive_ref.  The
+ *   ownership of the data of a message passed by reference moves to the
+ *   caller.  The data of a copied message is copied into a new buffer
+ *   allocated from the user heap.
+ *
+ * Parameters:
+ *   mqdes - Message queue descriptor
+ *   mqmsg   - The message obtained by mq_waitmsg()
+ *   ubuffer - The location to return the message data
+ *   prio    - The user-provided location to return the message priority.
+ *
+ * Return Value:
+ *   Returns the length of the received message or ERROR with errno set
+ *   to ENOMEM if the copy of the message could not be allocated.  The
+ *   message then stays in the message queue.
+ *
+ * Assumptions:
+ * - Pre-emption should be disabled throughout this call.
+ *
+ ****************************************************************************/
 
-		ASSERT(btcb);
+#ifdef CONFIG_MQ_REFERENCE
+ssize_t mq_doreceive_ref(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR void **ubuffer, FAR int *prio)
+{
+	FAR struct mqueue_inode_s *msgq = mqdes->msgq;
+	FAR struct mqueue_msg_s *next;
+	FAR struct mqueue_msg_s *prev;
+	irqstate_t saved_state;
+	ssize_t rcvmsglen;
 
-		btcb->msgwaitq = NULL;
-		msgq->nwaitnotfull--;
-		up_unblock_task(btcb);
+	rcvmsglen = mqmsg->msglen;
 
-		irqrestore(saved_state);
+	if (mqmsg->ref) {
+		*ubuffer = mqmsg->ref;
+	} else {
+		*ubuffer = kumm_malloc(rcvmsglen > 0 ? rcvmsglen : 1);
+		if (*ubuffer == NULL) {
+			/* Put the message back where it was taken from */
+
+			saved_state = irqsave();
+			for (prev = NULL, next = (FAR struct mqueue_msg_s *)msgq->msglist.head; next && mqmsg->priority <= next->priority; prev = next, next = next->next) ;
+
+			if (prev) {
+				sq_addafter((FAR sq_entry_t *)prev, (FAR sq_entry_t *)mqmsg, &msgq->msglist);
+			} else {
+				sq_addfirst((FAR sq_entry_t *)mqmsg, &msgq->msglist);
+			}
+
+			msgq->nmsgs++;
+			irqrestore(saved_state);
+
+			set_errno(ENOMEM);
+			return ERROR;
+		}
+
+		memcpy(*ubuffer, (const void *)mqmsg->mail, rcvmsglen);
 	}
 
-	trace_end(TTRACE_TAG_IPC);
+	if (prio) {
+		*prio = mqmsg->priority;
+	}
 
-	/* Return the length of the message transferred to the user buffer */
+	mq_msgfree(msgq, mqmsg);
+	mq_wakesender(msgq);
 
 	return rcvmsglen;
 }
+#endif
@@ -0,0 +1,115 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * kernel/mqueue/mq_receiveref.c
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <fcntl.h>
+#include <mqueue.h>
+#include <errno.h>
+#include <assert.h>
+#include <debug.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/cancelpt.h>
+
+#include "mqueue/mqueue.h"
+
+#ifdef CONFIG_MQ_REFERENCE
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mq_receive_ref
+ *
+ * Description:
+ *   This function receives the oldest of the highest priority messages
+ *   from the message queue (mqdes) without copying it into a buffer of
+ *   the caller.  The message data is returned in '*buf' and the caller
+ *   owns it: it must be released with free().
+ *
+ *   A message sent with mq_send_ref() is returned as the buffer of the
+ *   sender.  A message sent with mq_send() is returned in a new buffer.
+ *
+ *   Otherwise, mq_receive_ref() behaves like mq_receive().
+ *
+ * Parameters:
+ *   mqdes - Message Queue Descriptor
+ *   buf - Location to return the message data
+ *   prio - If not NULL, the location to store message priority.
+ *
+ * Return Value:
+ *   On success, the length of the selected message in bytes is returned.
+ *   On failure, -1 (ERROR) is returned and the errno is set as by
+ *   mq_receive().  ENOMEM is returned if a buffer for a copied message
+ *   could not be allocated; the message then stays in the queue.
+ *
+ ****************************************************************************/
+
+ssize_t mq_receive_ref(mqd_t mqdes, FAR void **buf, FAR int *prio)
+{
+	FAR struct mqueue_msg_s *mqmsg;
+	irqstate_t saved_state;
+	ssize_t ret = ERROR;
+
+	DEBUGASSERT(up_interrupt_context() == false);
+
+	/* mq_receive_ref() is a cancellation point */
+	(void)enter_cancellation_point();
+
+	if (!buf || !mqdes) {
+		set_errno(EINVAL);
+		leave_cancellation_point();
+		return ERROR;
+	}
+
+	if ((mqdes->oflags & O_RDOK) == 0) {
+		set_errno(EPERM);
+		leave_cancellation_point();
+		return ERROR;
+	}
+
+	/* Pre-emption stays disabled until the message is disposed of so that
+	 * a message which cannot be returned is put back in order.
+	 */
+
+	sched_lock();
+
+	saved_state = irqsave();
+	mqmsg = mq_waitreceive(mqdes);
+	irqrestore(saved_state);
+
+	if (mqmsg) {
+		ret = mq_doreceive_ref(mqdes, mqmsg, buf, prio);
+	}
+
+	sched_unlock();
+	leave_cancellation_point();
+	return ret;
+}
+
+#endif							/* CONFIG_MQ_REFERENCE */
@@ -0,0 +1,121 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * kernel/mqueue/mq_sendref.c
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <mqueue.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/cancelpt.h>
+
+#include "mqueue/mqueue.h"
+
+#ifdef CONFIG_MQ_REFERENCE
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mq_send_ref
+ *
+ * Description:
+ *   This function adds a reference to the message data (buf) to the
+ *   message queue (mqdes) instead of a copy of the data.  On success, the
+ *   ownership of 'buf' moves to the message queue and then to the task
+ *   that receives the message; the sender must not access or free it any
+ *   more.  'buf' must have been allocated with malloc().
+ *
+ *   The length of a message passed by reference is not limited by the
+ *   maxmsgsize attribute of the message queue, but a receiver using
+ *   mq_receive() rather than mq_receive_ref() can only take messages up to
+ *   that size.
+ *
+ *   Otherwise, mq_send_ref() behaves like mq_send().
+ *
+ * Parameters:
+ *   mqdes - Message queue descriptor
+ *   buf - Message data allocated with malloc()
+ *   buflen - The length of the message in bytes
+ *   prio - The priority of the message
+ *
+ * Return Value:
+ *   On success, mq_send_ref() returns 0 (OK); on error, -1 (ERROR)
+ *   is returned, with errno set as by mq_send().  The caller keeps the
+ *   ownership of 'buf' on failure.
+ *
+ ****************************************************************************/
+
+int mq_send_ref(mqd_t mqdes, FAR void *buf, size_t buflen, int prio)
+{
+	FAR struct mqueue_inode_s *msgq;
+	FAR struct mqueue_msg_s *mqmsg = NULL;
+	irqstate_t saved_state;
+	int ret = ERROR;
+
+	DEBUGASSERT(up_interrupt_context() == false);
+
+	/* mq_send_ref() is a cancellation point */
+	(void)enter_cancellation_point();
+
+	/* The size of the referenced data is not checked against maxmsgsize */
+
+	if (mq_verifysend(mqdes, (FAR const char *)buf, 0, prio) != OK) {
+		leave_cancellation_point();
+		return ERROR;
+	}
+
+	msgq = mqdes->msgq;
+
+	/* Allocate a message structure if the message queue is not full or
+	 * after successfully waiting for it to become non-full.
+	 */
+
+	saved_state = irqsave();
+	if (msgq->nmsgs < msgq->maxmsgs || mq_waitsend(mqdes) == OK) {
+		irqrestore(saved_state);
+		mqmsg = mq_msgalloc(msgq);
+	} else {
+		irqrestore(saved_state);
+	}
+
+	sched_lock();
+
+	if (mqmsg) {
+		/* Queue the reference; mq_dosend() does not copy the data */
+
+		mqmsg->ref = buf;
+		ret = mq_dosend(mqdes, mqmsg, NULL, buflen, prio);
+	}
+
+	sched_unlock();
+	leave_cancellation_point();
+	return ret;
+}
+
+#endif							/* CONFIG_MQ_REFERENCE */
@@ -155,7 +155,8 @@ int mq_verifysend(mqd_t mqdes, FAR const char *msg, size_t msglen, int prio)
  * Description:
  *   The mq_msgalloc function will get a free message for use by the
  *   operating system.  The message will be allocated from the g_msgfree
- *   list.
+ *   list or, with CONFIG_MQ_PERQUEUE_POOL, from the free list of the
+ *   message queue.
  *
  *   If the list is empty AND the message is NOT being allocated from the
  *   interrupt level, then the message will be allocated.  If a message
@@ -168,21 +169,36 @@ int mq_verifysend(mqd_t mqdes, FAR const char *msg, size_t msglen, int prio)
  *   handler will be notified.
  *
  * Inputs:
- *   None
+ *   msgq - The message queue which the message will be sent to
  *
  * Return Value:
  *   A reference to the allocated msg structure.
  *   NULL on a failure to allocate,
- *    if from interrupt handler, set the errno as EBUSY,
- *    if from normal thread, set the errno as ENOMEM.
  *
  ****************************************************************************/
 
-FAR struct mqueue_msg_s *mq_msgalloc(void)
+FAR struct mqueue_msg_s *mq_msgalloc(FAR struct mqueue_inode_s *msgq)
 {
 	FAR struct mqueue_msg_s *mqmsg;
 	irqstate_t saved_state;
 
+#ifdef CONFIG_MQ_PERQUEUE_POOL
+	/* Messages sized for this queue come first.  The free list of the queue
+	 * is also used from interrupt handlers.
+	 */
+
+	saved_state = irqsave();
+	mqmsg = (FAR struct mqueue_msg_s *)sq_remfirst(&msgq->msgfree);
+	irqrestore(saved_state);
+
+	if (mqmsg) {
+#ifdef CONFIG_MQ_REFERENCE
+		mqmsg->ref = NULL;
+#endif
+		return mqmsg;
+	}
+#endif
+
 	/* If we were called from an interrupt handler, then try to get the message
 	 * from generally available list of messages. If this fails, then try the
 	 * list of messages reserved for interrupt handlers
@@ -205,6 +221,18 @@ FAR struct mqueue_msg_s *mq_msgalloc(void)
 	/* We were not called from an interrupt handler. */
 
 	else {
+#ifdef CONFIG_MQ_PERQUEUE_POOL
+		/* The pool of the queue is empty.  Grow it by one message sized for
+		 * this queue; the message goes back to the pool when it is freed.
+		 */
+
+		mqmsg = (FAR struct mqueue_msg_s *)kmm_malloc(MQ_MSG_SIZE(msgq->maxmsgsize));
+		if (mqmsg) {
+			mqmsg->type = MQ_ALLOC_QDYN;
+		} else {
+			set_errno(ENOMEM);
+		}
+#else
 		/* Try to get the message from the generally available free list.
 		 * Disable interrupts -- we might be called from an interrupt handler.
 		 */
@@ -225,7 +253,14 @@ FAR struct mqueue_msg_s *mq_msgalloc(void)
 				set_errno(ENOMEM);
 			}
 		}
+#endif
+	}
+
+#ifdef CONFIG_MQ_REFERENCE
+	if (mqmsg) {
+		mqmsg->ref = NULL;
 	}
+#endif
 
 	return mqmsg;
 }
@@ -342,6 +377,8 @@ int mq_waitsend(mqd_t mqdes)
  *
  * Parameters:
  *   mqdes - Message queue descriptor
+ *   mqmsg - Message structure to queue.  A message with a non-NULL 'ref'
+ *           already refers to its data and 'msg' is not used.
  *   msg - Message to send
  *   msglen - The length of the message in bytes
  *   prio - The priority of the message
@@ -373,9 +410,16 @@ int mq_dosend(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR const char *msg,
 	mqmsg->priority = prio;
 	mqmsg->msglen = msglen;
 
-	/* Copy the message data into the message */
+	/* Copy the message data into the message unless the message only
+	 * refers to the data.
+	 */
 
-	memcpy((void *)mqmsg->mail, (FAR const void *)msg, msglen);
+#ifdef CONFIG_MQ_REFERENCE
+	if (mqmsg->ref == NULL)
+#endif
+	{
+		memcpy((void *)mqmsg->mail, (FAR const void *)msg, msglen);
+	}
 
 	/* Insert the new message in the message queue */
 
@@ -60,6 +60,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <unistd.h>
+#include <fcntl.h>
 #include <errno.h>
 #include <mqueue.h>
 #include <debug.h>
@@ -142,6 +143,105 @@ static void mq_rcvtimeout(int argc, uint32_t pid)
 	irqrestore(saved_state);
 }
 
+/****************************************************************************
+ * Name: mq_timedwaitreceive
+ *
+ * Description:
+ *   Wait for a message as mq_waitreceive() does, but no longer than until
+ *   'abstime'.  Called with pre-emption disabled.
+ *
+ * Return Value:
+ *   The message, or NULL with the errno set as by mq_timedreceive().
+ *
+ ****************************************************************************/
+
+static FAR struct mqueue_msg_s *mq_timedwaitreceive(mqd_t mqdes, FAR const struct timespec *abstime)
+{
+	FAR struct tcb_s *rtcb = this_task();
+	FAR struct mqueue_msg_s *mqmsg;
+	irqstate_t saved_state;
+
+	DEBUGASSERT(rtcb->waitdog == NULL);
+
+	if (!abstime || abstime->tv_nsec < 0 || abstime->tv_nsec >= 1000000000) {
+		set_errno(EINVAL);
+		return NULL;
+	}
+
+	/* Create a watchdog.  We will not actually need this watchdog
+	 * unless the queue is not empty, but we will reserve it up front
+	 * before we enter the following critical section.
+	 */
+
+	rtcb->waitdog = wd_create();
+	if (!rtcb->waitdog) {
+		set_errno(ENOMEM);
+		return NULL;
+	}
+
+	/* mq_waitreceive() expects to have interrupts disabled because
+	 * messages can be sent from interrupt level.
+	 */
+
+	saved_state = irqsave();
+
+	/* Check if the message queue is empty.  If it is NOT empty, then we
+	 * will not need to start timer.
+	 */
+
+	if (mqdes->msgq->msglist.head == NULL) {
+		int ticks;
+
+		/* Convert the timespec to clock ticks.  We must have interrupts
+		 * disabled here so that this time stays valid until the wait begins.
+		 */
+
+		int result = clock_abstime2ticks(CLOCK_REALTIME, abstime, &ticks);
+
+		/* If the time has already expired and the message queue is empty,
+		 * return immediately.
+		 */
+
+		if (result == OK && ticks <= 0) {
+			result = ETIMEDOUT;
+		}
+
+		/* Handle any time-related errors */
+
+		if (result != OK) {
+			set_errno(result);
+			irqrestore(saved_state);
+			wd_delete(rtcb->waitdog);
+			rtcb->waitdog = NULL;
+			return NULL;
+		}
+
+		/* Start the watchdog */
+
+		wd_start(rtcb->waitdog, ticks, (wdentry_t)mq_rcvtimeout, 1, getpid());
+	}
+
+	/* Get the message from the message queue.  We might not get one if:
+	 *
+	 * - The message queue is empty and O_NONBLOCK is set in the mqdes
+	 * - The wait was interrupted by a signal
+	 * - The watchdog timeout expired
+	 */
+
+	mqmsg = mq_waitreceive(mqdes);
+
+	/* Stop the watchdog timer (this is not harmful in the case where
+	 * it was never started)
+	 */
+
+	wd_cancel(rtcb->waitdog);
+	irqrestore(saved_state);
+
+	wd_delete(rtcb->waitdog);
+	rtcb->waitdog = NULL;
+	return mqmsg;
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -199,12 +299,10 @@ static void mq_rcvtimeout(int argc, uint32_t pid)
 
 ssize_t mq_timedreceive(mqd_t mqdes, FAR char *msg, size_t msglen, FAR int *prio, FAR const struct timespec *abstime)
 {
-	FAR struct tcb_s *rtcb = this_task();
 	FAR struct mqueue_msg_s *mqmsg;
-	irqstate_t saved_state;
 	int ret = ERROR;
 
-	DEBUGASSERT(up_interrupt_context() == false && rtcb->waitdog == NULL);
+	DEBUGASSERT(up_interrupt_context() == false);
 
 	/* mq_timedreceive() is not a cancellation point */
 	(void)enter_cancellation_point();
@@ -218,24 +316,6 @@ ssize_t mq_timedreceive(mqd_t mqdes, FAR char *msg, size_t msglen, FAR int *prio
 		return ERROR;
 	}
 
-	if (!abstime || abstime->tv_nsec < 0 || abstime->tv_nsec >= 1000000000) {
-		set_errno(EINVAL);
-		leave_cancellation_point();
-		return ERROR;
-	}
-
-	/* Create a watchdog.  We will not actually need this watchdog
-	 * unless the queue is not empty, but we will reserve it up front
-	 * before we enter the following critical section.
-	 */
-
-	rtcb->waitdog = wd_create();
-	if (!rtcb->waitdog) {
-		set_errno(ENOMEM);
-		leave_cancellation_point();
-		return ERROR;
-	}
-
 	/* Get the next message from the message queue.  We will disable
 	 * pre-emption until we have completed the message received.  This
 	 * is not too bad because if the receipt takes a long time, it will
@@ -244,80 +324,72 @@ ssize_t mq_timedreceive(mqd_t mqdes, FAR char *msg, size_t msglen, FAR int *prio
 	 */
 
 	sched_lock();
+	mqmsg = mq_timedwaitreceive(mqdes, abstime);
+	sched_unlock();
 
-	/* Furthermore, mq_waitreceive() expects to have interrupts disabled
-	 * because messages can be sent from interrupt level.
-	 */
-
-	saved_state = irqsave();
-
-	/* Check if the message queue is empty.  If it is NOT empty, then we
-	 * will not need to start timer.
-	 */
-
-	if (mqdes->msgq->msglist.head == NULL) {
-		int ticks;
-
-		/* Convert the timespec to clock ticks.  We must have interrupts
-		 * disabled here so that this time stays valid until the wait begins.
-		 */
-
-		int result = clock_abstime2ticks(CLOCK_REALTIME, abstime, &ticks);
+	if (mqmsg) {
+		ret = mq_doreceive(mqdes, mqmsg, msg, prio);
+	}
 
-		/* If the time has already expired and the message queue is empty,
-		 * return immediately.
-		 */
+	leave_cancellation_point();
+	return ret;
+}
 
-		if (result == OK && ticks <= 0) {
-			result = ETIMEDOUT;
-		}
+#ifdef CONFIG_MQ_REFERENCE
+/****************************************************************************
+ * Name: mq_timedreceive_ref
+ *
+ * Description:
+ *   mq_receive_ref() with the timeout of mq_timedreceive().  The message
+ *   data is returned in '*buf' and the caller releases it with free().
+ *
+ * Parameters:
+ *   mqdes - Message Queue Descriptor
+ *   buf - Location to return the message data
+ *   prio - If not NULL, the location to store message priority.
+ *   abstime - the absolute time to wait until a timeout is declared.
+ *
+ * Return Value:
+ *   On success, the length of the selected message in bytes is returned.
+ *   On failure, -1 (ERROR) is returned and the errno is set as by
+ *   mq_timedreceive() and mq_receive_ref().
+ *
+ ****************************************************************************/
 
-		/* Handle any time-related errors */
+ssize_t mq_timedreceive_ref(mqd_t mqdes, FAR void **buf, FAR int *prio, FAR const struct timespec *abstime)
+{
+	FAR struct mqueue_msg_s *mqmsg;
+	ssize_t ret = ERROR;
 
-		if (result != OK) {
-			set_errno(result);
-			irqrestore(saved_state);
-			sched_unlock();
-			wd_delete(rtcb->waitdog);
-			rtcb->waitdog = NULL;
-			leave_cancellation_point();
-			return ERROR;
-		}
+	DEBUGASSERT(up_interrupt_context() == false);
 
-		/* Start the watchdog */
+	/* mq_timedreceive_ref() is a cancellation point */
+	(void)enter_cancellation_point();
 
-		wd_start(rtcb->waitdog, ticks, (wdentry_t)mq_rcvtimeout, 1, getpid());
+	if (!buf || !mqdes) {
+		set_errno(EINVAL);
+		leave_cancellation_point();
+		return ERROR;
 	}
 
-	/* Get the message from the message queue */
-
-	mqmsg = mq_waitreceive(mqdes);
-
-	/* Stop the watchdog timer (this is not harmful in the case where
-	 * it was never started)
-	 */
-
-	wd_cancel(rtcb->waitdog);
-
-	/* We can now restore interrupts */
-
-	irqrestore(saved_state);
+	if ((mqdes->oflags & O_RDOK) == 0) {
+		set_errno(EPERM);
+		leave_cancellation_point();
+		return ERROR;
+	}
 
-	/* Check if we got a message from the message queue.  We might
-	 * not have a message if:
-	 *
-	 * - The message queue is empty and O_NONBLOCK is set in the mqdes
-	 * - The wait was interrupted by a signal
-	 * - The watchdog timeout expired
+	/* As in mq_receive_ref(), pre-emption stays disabled until the message
+	 * is disposed of.
 	 */
-	sched_unlock();
 
+	sched_lock();
+	mqmsg = mq_timedwaitreceive(mqdes, abstime);
 	if (mqmsg) {
-		ret = mq_doreceive(mqdes, mqmsg, msg, prio);
+		ret = mq_doreceive_ref(mqdes, mqmsg, buf, prio);
 	}
 
-	wd_delete(rtcb->waitdog);
-	rtcb->waitdog = NULL;
+	sched_unlock();
 	leave_cancellation_point();
 	return ret;
 }
+#endif							/* CONFIG_MQ_REFERENCE */
@@ -62,6 +62,7 @@
 
 #include <sys/types.h>
 #include <stdint.h>
+#include <stddef.h>
 #include <stdbool.h>
 #include <limits.h>
 #include <mqueue.h>
@@ -92,6 +93,14 @@
 
 #define NUM_INTERRUPT_MSGS   8
 
+/* The size of a message structure able to hold 'n' bytes of message data.
+ * Messages from the global pools hold MQ_MAX_BYTES; messages from the pool
+ * of a queue hold only the mq_msgsize of that queue.
+ */
+
+#define MQ_MSG_SIZE(n) \
+	(((offsetof(struct mqueue_msg_s, mail) + (n)) + sizeof(uintptr_t) - 1) & ~(sizeof(uintptr_t) - 1))
+
 /****************************************************************************
  * Public Type Definitions
  ****************************************************************************/
@@ -99,7 +108,11 @@
 enum mqalloc_e {
 	MQ_ALLOC_FIXED = 0,			/* pre-allocated; never freed */
 	MQ_ALLOC_DYN,				/* dynamically allocated; free when unused */
-	MQ_ALLOC_IRQ				/* Preallocated, reserved for interrupt handling */
+	MQ_ALLOC_IRQ,				/* Preallocated, reserved for interrupt handling */
+#ifdef CONFIG_MQ_PERQUEUE_POOL
+	MQ_ALLOC_QFIXED,			/* Pre-allocated with the queue; freed with the queue */
+	MQ_ALLOC_QDYN				/* Allocated for the queue; freed with the queue */
+#endif
 };
 
 /* This structure describes one buffered POSIX message. */
@@ -109,6 +122,9 @@ struct mqueue_msg_s {
 	uint8_t type;					/* (Used to manage allocations) */
 	uint8_t priority;				/* priority of message */
 	size_t msglen;					/* Message data length */
+#ifdef CONFIG_MQ_REFERENCE
+	FAR void *ref;					/* Referenced message data (NULL: data in mail) */
+#endif
 	char mail[MQ_MAX_BYTES];		/* Message data */
 };
 
@@ -155,7 +171,7 @@ void weak_function mq_initialize(void);
 void mq_desblockalloc(void);
 
 FAR struct mqueue_inode_s *mq_findnamed(FAR const char *mq_name);
-void mq_msgfree(FAR struct mqueue_msg_s *mqmsg);
+void mq_msgfree(FAR struct mqueue_inode_s *msgq, FAR struct mqueue_msg_s *mqmsg);
 
 /* mq_waitirq.c ************************************************************/
 
@@ -166,11 +182,14 @@ void mq_waitirq(FAR struct tcb_s *wtcb, int errcode);
 int mq_verifyreceive(mqd_t mqdes, FAR char *msg, size_t msglen);
 FAR struct mqueue_msg_s *mq_waitreceive(mqd_t mqdes);
 ssize_t mq_doreceive(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR char *ubuffer, FAR int *prio);
+#ifdef CONFIG_MQ_REFERENCE
+ssize_t mq_doreceive_ref(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR void **ubuffer, FAR int *prio);
+#endif
 
 /* mq_sndinternal.c ********************************************************/
 
 int mq_verifysend(mqd_t mqdes, FAR const char *msg, size_t msglen, int prio);
-FAR struct mqueue_msg_s *mq_msgalloc(void);
+FAR struct mqueue_msg_s *mq_msgalloc(FAR struct mqueue_inode_s *msgq);
 int mq_waitsend(mqd_t mqdes);
 int mq_dosend(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR const char *msg, size_t msglen, int prio);
 
@@ -139,6 +139,11 @@ void pthread_mutex_inconsistent(FAR struct pthread_tcb_s *tcb);
 #define pthread_mutex_give(m)   pthread_sem_give(&(m)->sem)
 #endif
 
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+void pthread_mutex_adopt(FAR struct pthread_mutex_s *mutex);
+void pthread_mutex_disown(FAR struct pthread_mutex_s *mutex);
+#endif
+
 #if defined(CONFIG_CANCELLATION_POINTS) && !defined(CONFIG_PTHREAD_MUTEX_UNSAFE)
 uint16_t pthread_disable_cancel(void);
 void pthread_enable_cancel(uint16_t oldstate);
@@ -72,6 +72,8 @@
 #include <tinyara/ttrace.h>
 
 #include "sched/sched.h"
+#include <tinyara/pthread.h>
+
 #include "pthread/pthread.h"
 #include "clock/clock.h"
 #include "signal/signal.h"
@@ -277,6 +279,9 @@ int pthread_cond_timedwait(FAR pthread_cond_t *cond, FAR pthread_mutex_t *mutex,
 				} else {
 					/* Give up the mutex */
 
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+					pthread_mutex_adopt(mutex);
+#endif
 					mutex->pid = -1;
 					ret = pthread_mutex_give(mutex);
 					if (ret != 0) {
@@ -328,6 +333,13 @@ int pthread_cond_timedwait(FAR pthread_cond_t *cond, FAR pthread_mutex_t *mutex,
 					svdbg("Re-locking...\n");
 
 					oldstate = pthread_disable_cancel();
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+					/* Take the mutex back from the user space fast path,
+					 * which it may have returned to while we waited.
+					 */
+
+					pthread_mutex_adopt(mutex);
+#endif
 					status = pthread_mutex_take(mutex, false);
 					pthread_enable_cancel(oldstate);
 
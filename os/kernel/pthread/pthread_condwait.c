@@ -64,6 +64,8 @@
 #include <debug.h>
 
 #include <tinyara/cancelpt.h>
+#include <tinyara/pthread.h>
+
 #include "pthread/pthread.h"
 
 /****************************************************************************
@@ -114,6 +116,9 @@ int pthread_cond_wait(FAR pthread_cond_t *cond, FAR pthread_mutex_t *mutex)
 		svdbg("Give up mutex / take cond\n");
 
 		sched_lock();
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+		pthread_mutex_adopt(mutex);
+#endif
 		mutex->pid = -1;
 		ret = pthread_mutex_give(mutex);
 
@@ -137,7 +142,19 @@ int pthread_cond_wait(FAR pthread_cond_t *cond, FAR pthread_mutex_t *mutex)
 		svdbg("Reacquire mutex...\n");
 
 		oldstate = pthread_disable_cancel();
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+		/* The mutex may have been given back to the user space fast path
+		 * while we waited.  Take it back first, or a fast locker and this
+		 * thread would both get it.
+		 */
+
+		sched_lock();
+		pthread_mutex_adopt(mutex);
+#endif
 		status = pthread_mutex_take(mutex, false);
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+		sched_unlock();
+#endif
 		pthread_enable_cancel(oldstate);
 
 		if (ret == OK) {
@@ -63,6 +63,8 @@
 
 #include <tinyara/semaphore.h>
 
+#include <tinyara/pthread.h>
+
 #include "pthread/pthread.h"
 
 /****************************************************************************
@@ -115,6 +117,12 @@ int pthread_mutex_consistent(FAR pthread_mutex_t *mutex)
 
 		sched_lock();
 
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+		/* Make the semaphore reflect a holder that locked it in user space */
+
+		pthread_mutex_adopt(mutex);
+#endif
+
 		/* Is the mutex available? */
 
 		DEBUGASSERT(mutex->pid != 0);	/* < 0: available, >0 owned, ==0 error */
@@ -160,6 +168,10 @@ int pthread_mutex_consistent(FAR pthread_mutex_t *mutex)
 #endif
 		}
 
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+		pthread_mutex_disown(mutex);
+#endif
+
 		sched_unlock();
 		ret = OK;
 	}
@@ -67,6 +67,8 @@
 
 #include <tinyara/semaphore.h>
 
+#include <tinyara/pthread.h>
+
 #include "pthread/pthread.h"
 
 /****************************************************************************
@@ -125,6 +127,12 @@ int pthread_mutex_destroy(FAR pthread_mutex_t *mutex)
 
 		sched_lock();
 
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+		/* Make the semaphore reflect a holder that locked it in user space */
+
+		pthread_mutex_adopt(mutex);
+#endif
+
 		/* Is the semaphore available? */
 
 		if (mutex->pid >= 0) {
@@ -0,0 +1,148 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <pthread.h>
+#include <sched.h>
+#include <assert.h>
+
+#include <tinyara/irq.h>
+#include <tinyara/sched.h>
+#include <tinyara/pthread.h>
+
+#include "sched/sched.h"
+#include "semaphore/semaphore.h"
+#include "pthread/pthread.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pthread_mutex_adopt
+ *
+ * Description:
+ *   Hand a mutex that was locked in user space over to its semaphore, so
+ *   that the kernel can block on it and the holder will unlock it with a
+ *   system call.  The holder becomes the holder of the semaphore, which
+ *   gives it the priority of the waiters, and the mutex is added to the
+ *   list of mutexes held by it.  If the holder has exited, the mutex is
+ *   marked inconsistent as pthread_mutex_inconsistent() would have done.
+ *
+ * Parameters:
+ *   mutex - The mutex to be adopted
+ *
+ * Return Value:
+ *   None
+ *
+ * Assumptions:
+ *   The caller holds the scheduler lock.
+ *
+ ****************************************************************************/
+
+void pthread_mutex_adopt(FAR struct pthread_mutex_s *mutex)
+{
+	FAR struct tcb_s *htcb;
+	int owner = mutex->owner;
+#ifndef CONFIG_PTHREAD_MUTEX_UNSAFE
+	FAR struct pthread_tcb_s *ptcb;
+	irqstate_t flags;
+#endif
+
+	if (owner == PTHREAD_MUTEX_OWNER_KERNEL) {
+		return;
+	}
+
+	mutex->owner = PTHREAD_MUTEX_OWNER_KERNEL;
+	if (owner == 0) {
+		return;
+	}
+
+	/* The semaphore was left available while the mutex was held */
+
+	DEBUGASSERT(mutex->sem.semcount == 1);
+	mutex->sem.semcount = 0;
+	mutex->pid = owner;
+
+	/* The PID of a holder that exited may have been given to a new task
+	 * since.  A mutex is private to its task group, so a holder outside the
+	 * group of the caller is a stale PID and is treated as dead.
+	 */
+
+	htcb = sched_gettcb(owner);
+#ifdef HAVE_TASK_GROUP
+	if (htcb != NULL && htcb->group != this_task()->group) {
+		htcb = NULL;
+	}
+#endif
+	if (htcb == NULL) {
+#ifndef CONFIG_PTHREAD_MUTEX_UNSAFE
+		mutex->flags |= _PTHREAD_MFLAGS_INCONSISTENT;
+#endif
+		return;
+	}
+
+	sem_addholder_tcb(htcb, &mutex->sem);
+
+#ifndef CONFIG_PTHREAD_MUTEX_UNSAFE
+	ptcb = (FAR struct pthread_tcb_s *)htcb;
+	DEBUGASSERT(mutex->flink == NULL);
+
+	flags = irqsave();
+	mutex->flink = ptcb->mhead;
+	ptcb->mhead = mutex;
+	irqrestore(flags);
+#endif
+}
+
+/****************************************************************************
+ * Name: pthread_mutex_disown
+ *
+ * Description:
+ *   Return a mutex to the user space fast path once its semaphore is
+ *   available again and no thread is waiting for it.  Robust mutexes stay
+ *   with the kernel, which must find them on the list of their holder when
+ *   it exits.
+ *
+ * Parameters:
+ *   mutex - The mutex to be disowned
+ *
+ * Return Value:
+ *   None
+ *
+ * Assumptions:
+ *   The caller holds the scheduler lock.
+ *
+ ****************************************************************************/
+
+void pthread_mutex_disown(FAR struct pthread_mutex_s *mutex)
+{
+	if (mutex->owner == PTHREAD_MUTEX_OWNER_KERNEL && mutex->sem.semcount == 1
+#ifndef CONFIG_PTHREAD_MUTEX_UNSAFE
+		&& (mutex->flags & (_PTHREAD_MFLAGS_INCONSISTENT | _PTHREAD_MFLAGS_ROBUST)) == 0
+#endif
+		) {
+		mutex->owner = 0;
+	}
+}
@@ -149,6 +149,9 @@ int pthread_mutex_init(FAR pthread_mutex_t *mutex,
 		/* Indicate that the semaphore is not held by any thread. */
 
 		mutex->pid = -1;
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+		mutex->owner = 0;
+#endif
 
 		/* Initialize the mutex like a semaphore with initial count = 1 */
 
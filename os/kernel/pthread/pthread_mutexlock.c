@@ -66,6 +66,8 @@
 
 #include <tinyara/sched.h>
 
+#include <tinyara/pthread.h>
+
 #include "pthread/pthread.h"
 
 /****************************************************************************
@@ -142,7 +144,11 @@
  *
  ****************************************************************************/
 
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+int pthread_mutex_lock_slow(FAR pthread_mutex_t *mutex)
+#else
 int pthread_mutex_lock(FAR pthread_mutex_t *mutex)
+#endif
 {
 	int mypid = (int)getpid();
 	int ret = EINVAL;
@@ -157,6 +163,14 @@ int pthread_mutex_lock(FAR pthread_mutex_t *mutex)
 
 		sched_lock();
 
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+		/* Waiters block on the semaphore, so it must hold the state of a
+		 * mutex that was locked in user space.
+		 */
+
+		pthread_mutex_adopt(mutex);
+#endif
+
 #ifdef CONFIG_PTHREAD_MUTEX_TYPES
 		/* All mutex types except for NORMAL (and DEFAULT) will return
 		 * and an error  error if the caller does not hold the mutex.
@@ -254,3 +268,30 @@ int pthread_mutex_lock(FAR pthread_mutex_t *mutex)
 	svdbg("Returning %d\n", ret);
 	return ret;
 }
+
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+/****************************************************************************
+ * Name: pthread_mutex_lock
+ *
+ * Description:
+ *   Lock the mutex in user space if it is free, otherwise in the kernel.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_lock(FAR pthread_mutex_t *mutex)
+{
+	int ret;
+
+	DEBUGASSERT(mutex != NULL);
+	if (mutex == NULL) {
+		return EINVAL;
+	}
+
+	ret = pthread_mutex_fastlock(mutex, getpid());
+	if (ret == PTHREAD_MUTEX_SLOWPATH) {
+		ret = pthread_mutex_lock_slow(mutex);
+	}
+
+	return ret;
+}
+#endif
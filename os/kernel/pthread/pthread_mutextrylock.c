@@ -65,6 +65,8 @@
 #include <errno.h>
 #include <debug.h>
 
+#include <tinyara/pthread.h>
+
 #include "pthread/pthread.h"
 
 /****************************************************************************
@@ -120,7 +122,11 @@
  *
  ****************************************************************************/
 
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+int pthread_mutex_trylock_slow(FAR pthread_mutex_t *mutex)
+#else
 int pthread_mutex_trylock(FAR pthread_mutex_t *mutex)
+#endif
 {
 	int status;
 	int ret = EINVAL;
@@ -137,6 +143,14 @@ int pthread_mutex_trylock(FAR pthread_mutex_t *mutex)
 
 		sched_lock();
 
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+		/* Waiters block on the semaphore, so it must hold the state of a
+		 * mutex that was locked in user space.
+		 */
+
+		pthread_mutex_adopt(mutex);
+#endif
+
 		/* Try to get the semaphore. */
 
 		status = pthread_mutex_trytake(mutex);
@@ -235,3 +249,30 @@ int pthread_mutex_trylock(FAR pthread_mutex_t *mutex)
 	svdbg("Returning %d\n", ret);
 	return ret;
 }
+
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+/****************************************************************************
+ * Name: pthread_mutex_trylock
+ *
+ * Description:
+ *   Try to lock the mutex in user space, otherwise in the kernel.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_trylock(FAR pthread_mutex_t *mutex)
+{
+	int ret;
+
+	DEBUGASSERT(mutex != NULL);
+	if (mutex == NULL) {
+		return EINVAL;
+	}
+
+	ret = pthread_mutex_fasttrylock(mutex, getpid());
+	if (ret == PTHREAD_MUTEX_SLOWPATH) {
+		ret = pthread_mutex_trylock_slow(mutex);
+	}
+
+	return ret;
+}
+#endif
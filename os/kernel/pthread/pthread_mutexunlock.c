@@ -64,6 +64,8 @@
 #include <errno.h>
 #include <debug.h>
 
+#include <tinyara/pthread.h>
+
 #include "pthread/pthread.h"
 
 /****************************************************************************
@@ -145,7 +147,11 @@ static inline bool pthread_mutex_islocked(FAR pthread_mutex_t *mutex)
  *
  ****************************************************************************/
 
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+int pthread_mutex_unlock_slow(FAR pthread_mutex_t *mutex)
+#else
 int pthread_mutex_unlock(FAR pthread_mutex_t *mutex)
+#endif
 {
 	int ret = EPERM;
 
@@ -160,6 +166,14 @@ int pthread_mutex_unlock(FAR pthread_mutex_t *mutex)
 	 */
 	sched_lock();
 
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+	/* Waiters block on the semaphore, so it must hold the state of a
+	 * mutex that was locked in user space.
+	 */
+
+	pthread_mutex_adopt(mutex);
+#endif
+
 	/* The unlock operation is only performed if the mutex is actually locked.
 	 * EPERM *must* be returned if the mutex type is PTHREAD_MUTEX_ERRORCHECK
 	 * or PTHREAD_MUTEX_RECURSIVE, or the mutex is a robust mutex, and the
@@ -247,7 +261,41 @@ int pthread_mutex_unlock(FAR pthread_mutex_t *mutex)
 			}
 	}
 
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+	/* Let the next locker take the mutex in user space again */
+
+	pthread_mutex_disown(mutex);
+#endif
+
 	sched_unlock();
 	svdbg("Returning %d\n", ret);
 	return ret;
 }
+
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+/****************************************************************************
+ * Name: pthread_mutex_unlock
+ *
+ * Description:
+ *   Unlock a mutex held in user space without the kernel, otherwise unlock
+ *   it in the kernel.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_unlock(FAR pthread_mutex_t *mutex)
+{
+	int ret;
+
+	DEBUGASSERT(mutex != NULL);
+	if (mutex == NULL) {
+		return EINVAL;
+	}
+
+	ret = pthread_mutex_fastunlock(mutex, getpid());
+	if (ret == PTHREAD_MUTEX_SLOWPATH) {
+		ret = pthread_mutex_unlock_slow(mutex);
+	}
+
+	return ret;
+}
+#endif
@@ -64,6 +64,9 @@
 
 #include <tinyara/sched.h>
 #include <tinyara/fs/fs.h>
+#ifdef CONFIG_STACK_HWM
+#include <tinyara/debug/stackhwm.h>
+#endif
 
 #include "sched/sched.h"
 #include "group/group.h"
@@ -562,6 +565,11 @@ void task_exithook(FAR struct tcb_s *tcb, int status, bool nonblocking)
 	dbg_save_termination_info(tcb);
 #endif
 
+#ifdef CONFIG_STACK_HWM
+	/* Record the stack peak of the task for the stack size report */
+	stack_hwm_terminated(tcb);
+#endif
+
 #ifdef CONFIG_CANCELLATION_POINTS
 	/* Mark the task as non-cancelable to avoid additional calls to exit()
 	 * due to any cancellation point logic that might get kicked off by
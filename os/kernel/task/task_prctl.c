@@ -204,10 +204,11 @@ int prctl(int option, ...)
 		char *port_name = va_arg(ap, char *);
 		int *recv_arr = va_arg(ap, int *);
 		int *recv_cnt = va_arg(ap, int *);
+		uint32_t *gen = va_arg(ap, uint32_t *);
 		int total_cnt;
 		static int curr_cnt = 0;
 		int ret;
-		ret = messaging_read_list(port_name, recv_arr, &total_cnt);
+		ret = messaging_read_list(port_name, recv_arr, &total_cnt, gen);
 		if (ret == ERROR) {
 			va_end(ap);
 			return ret;
@@ -243,6 +244,30 @@ int prctl(int option, ...)
 		goto errout;
 	}
 #endif /* CONFIG_MESSAGING_IPC */
+	case PR_GET_GROUP_SERIAL:
+#ifdef HAVE_TASK_GROUP
+	{
+		FAR uint32_t *serial = va_arg(ap, FAR uint32_t *);
+		FAR struct task_group_s *group = this_task()->group;
+
+		if (!serial) {
+			err = EFAULT;
+			goto errout;
+		}
+
+		if (!group) {
+			err = ESRCH;
+			goto errout;
+		}
+
+		*serial = group->tg_serial;
+	}
+	break;
+#else
+		sdbg("Task groups not enabled\n");
+		err = ENOSYS;
+		goto errout;
+#endif
 	case PR_GET_STKLOG:
 	{
 #if defined(CONFIG_ENABLE_STACKMONITOR) && defined(CONFIG_DEBUG)
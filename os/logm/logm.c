@@ -47,6 +47,7 @@ static void logm_putc(FAR struct lib_outstream_s *this, int ch)
 static void logm_outstream(FAR struct lib_outstream_s *outstream)
 {
 	outstream->put = logm_putc;
+	outstream->puts = NULL;
 #ifdef CONFIG_STDIO_LINEBUFFER
 	outstream->flush = lib_noflush;
 #endif
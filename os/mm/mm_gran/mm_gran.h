@@ -72,7 +72,35 @@
 /* Sizes of things */
 
 #define SIZEOF_GAT(n) ((n + 31) >> 5)
-#define SIZEOF_GRAN_S(n) (sizeof(struct gran_s) + sizeof(uint32_t) * (SIZEOF_GAT(n) - 1))
+#define SIZEOF_GSUM(n) ((SIZEOF_GAT(n) + 31) >> 5)
+#define SIZEOF_GRAN_S(n) (sizeof(struct gran_s) + sizeof(uint32_t) * (SIZEOF_GAT(n) + SIZEOF_GSUM(n) - 1))
+
+/* Free run hints are kept for the runs of 1 up to GRAN_NHINTS granules.  The
+ * hint of the longest run is also used for the longer runs, since they
+ * contain a run of that length.
+ */
+
+#define GRAN_NHINTS 8
+
+/* Index of the lowest set bit of a non-zero word.  This is one CLZ with an
+ * RBIT on ARMv7 and one CTZ on most other architectures.
+ */
+
+#ifdef __GNUC__
+#define gran_ctz(w) __builtin_ctz(w)
+#else
+static inline int gran_ctz(uint32_t w)
+{
+	int n = 0;
+
+	while ((w & 1) == 0) {
+		w >>= 1;
+		n++;
+	}
+
+	return n;
+}
+#endif
 
 /* Debug */
 
@@ -98,7 +126,19 @@
  * Public Types
  ****************************************************************************/
 
-/* This structure represents the state of one granule allocation */
+/* This structure represents the state of one granule allocation.
+ *
+ * A set bit of the granule allocation table (GAT) is an allocated granule.
+ * The bits of the last GAT entry past ngranules are set at initialization,
+ * so they are never allocated.  Bit n of the summary (gsum) is set when
+ * GAT entry n has at least one free granule, which lets the search skip
+ * 32 full entries at a time.
+ *
+ * hint[n - 1] is the lowest granule where a run of n free granules may
+ * start: there is no such run before it.  An allocation moves it past the
+ * run it found and a free moves it back if the freed granules may start
+ * a run.
+ */
 
 struct gran_s {
 	uint8_t    log2gran;		/* Log base 2 of the size of one granule */
@@ -109,6 +149,8 @@ struct gran_s {
 	sem_t      exclsem;			/* For exclusive access to the GAT */
 #endif
 	uintptr_t  heapstart;		/* The aligned start of the granule heap */
+	uint16_t   hint[GRAN_NHINTS];	/* Start of the search for each run length */
+	FAR uint32_t *gsum;			/* Summary of the GAT, after the GAT */
 	uint32_t   gat[1];			/* Start of the granule allocation table */
 };
 
@@ -161,4 +203,22 @@ void gran_leave_critical(FAR struct gran_s *priv);
 
 void gran_mark_allocated(FAR struct gran_s *priv, uintptr_t alloc, unsigned int ngranules);
 
+/****************************************************************************
+ * Name: gran_mark_free
+ *
+ * Description:
+ *   Mark a range of granules as free.
+ *
+ * Input Parameters:
+ *   priv  - The granule heap state structure.
+ *   alloc - The address of the allocation.
+ *   ngranules - The number of granules freed
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void gran_mark_free(FAR struct gran_s *priv, uintptr_t alloc, unsigned int ngranules);
+
 #endif							/* __MM_MM_GRAN_MM_GRAN_H */
@@ -72,6 +72,104 @@
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: gran_next_entry
+ *
+ * Description:
+ *   Return the index of the first GAT entry at or after gatidx with a free
+ *   granule, or -1 if there is none.
+ *
+ ****************************************************************************/
+
+static inline int gran_next_entry(FAR struct gran_s *priv, unsigned int gatidx)
+{
+	unsigned int ngat = SIZEOF_GAT(priv->ngranules);
+	unsigned int sumidx;
+	uint32_t     sum;
+
+	while (gatidx < ngat) {
+		sumidx = gatidx >> 5;
+		sum    = priv->gsum[sumidx] & (0xffffffff << (gatidx & 31));
+		if (sum != 0) {
+			return (sumidx << 5) + gran_ctz(sum);
+		}
+
+		gatidx = (sumidx + 1) << 5;
+	}
+
+	return -1;
+}
+
+/****************************************************************************
+ * Name: gran_search
+ *
+ * Description:
+ *   Return the first granule at or after granno that starts a run of
+ *   ngranules free granules, or -1 if there is none.
+ *
+ *   Each step goes to the next free granule with the summary and a CTZ of
+ *   the GAT entry, then looks at the following ngranules bits at once.  If
+ *   one of them is allocated, the search resumes after it.  So the cost
+ *   depends on the number of free runs that are too short rather than on
+ *   the number of granules.
+ *
+ ****************************************************************************/
+
+static inline int gran_search(FAR struct gran_s *priv, unsigned int granno, unsigned int ngranules)
+{
+	unsigned int ngat = SIZEOF_GAT(priv->ngranules);
+	uint32_t     mask;
+	uint32_t     free;
+	uint32_t     used;
+	int          gatidx;
+	int          bitidx;
+
+	mask = 0xffffffff >> (32 - ngranules);
+
+	while (granno + ngranules <= priv->ngranules) {
+		/* Find the first free granule at or after granno */
+
+		gatidx = granno >> 5;
+		free   = ~priv->gat[gatidx] & (0xffffffff << (granno & 31));
+		if (free == 0) {
+			gatidx = gran_next_entry(priv, gatidx + 1);
+			if (gatidx < 0) {
+				break;
+			}
+
+			free = ~priv->gat[gatidx];
+		}
+
+		bitidx = gran_ctz(free);
+		granno = (gatidx << 5) + bitidx;
+
+		/* Get the allocation state of the ngranules granules from granno,
+		 * taking the upper bits from the next GAT entry.  The granules past
+		 * the end of the GAT read as allocated.
+		 */
+
+		used = priv->gat[gatidx] >> bitidx;
+		if (bitidx != 0) {
+			if (gatidx + 1 < ngat) {
+				used |= priv->gat[gatidx + 1] << (32 - bitidx);
+			} else {
+				used |= 0xffffffff << (32 - bitidx);
+			}
+		}
+
+		used &= mask;
+		if (used == 0) {
+			return granno;
+		}
+
+		/* Resume after the first allocated granule of the run */
+
+		granno += gran_ctz(used) + 1;
+	}
+
+	return -1;
+}
+
 /****************************************************************************
  * Name: gran_common_alloc
  *
@@ -90,15 +188,10 @@
 static inline FAR void *gran_common_alloc(FAR struct gran_s *priv, size_t size)
 {
 	unsigned int ngranules;
+	unsigned int hintidx;
 	size_t       tmpmask;
 	uintptr_t    alloc;
-	uint32_t     curr;
-	uint32_t     next;
-	uint32_t     mask;
-	int          granidx;
-	int          gatidx;
-	int          bitidx;
-	int          shift;
+	int          granno;
 
 	DEBUGASSERT(priv && size <= 32 * (1 << priv->log2gran));
 
@@ -112,140 +205,37 @@ static inline FAR void *gran_common_alloc(FAR struct gran_s *priv, size_t size)
 		tmpmask = (1 << priv->log2gran) - 1;
 		ngranules = (size + tmpmask) >> priv->log2gran;
 
-		/* Then create mask for that number of granules */
-
 		DEBUGASSERT(ngranules <= 32);
-		mask = 0xffffffff >> (32 - ngranules);
-
-		/* Now search the granule allocation table for that number of contiguous */
-
-		alloc = priv->heapstart;
 
-		for (granidx = 0; granidx < priv->ngranules; granidx += 32) {
-			/* Get the GAT index associated with the granule table entry */
+		/* Start from the hint of this run length.  The runs longer than the
+		 * hints start from the hint of the longest one.
+		 */
 
-			gatidx = granidx >> 5;
-			curr = priv->gat[gatidx];
+		hintidx = (ngranules < GRAN_NHINTS ? ngranules : GRAN_NHINTS) - 1;
+		granno  = gran_search(priv, priv->hint[hintidx], ngranules);
 
-			/* Handle the case where there are no free granules in the entry */
+		if (granno >= 0) {
+			/* No run of this length starts before the end of this one now */
 
-			if (curr == 0xffffffff) {
-				alloc += (32 << priv->log2gran);
-				continue;
+			if (ngranules <= GRAN_NHINTS) {
+				priv->hint[hintidx] = granno + ngranules;
 			}
 
-			/* Get the next entry from the GAT to support a 64 bit shift */
-
-			if (granidx < priv->ngranules) {
-				next = priv->gat[gatidx + 1];
-			}
-
-			/* Use all ones when are at the last entry in the GAT (meaning
-			 * nothing can be allocated.
+			/* Mark these granules allocated and return the allocation
+			 * address.
 			 */
 
-			else {
-				next = 0xffffffff;
-			}
-
-			/* Search through the allocations in the 'curr' GAT entry
-			 * to see if we can satisfy the allocation starting in that
-			 * entry.
-			 *
-			 * This loop continues until either all of the bits have been
-			 * examined (bitidx >= 32), or until there are insufficient
-			 * granules left to satisfy the allocation.
-			 */
-
-			for (bitidx = 0; bitidx < 32 && (granidx + bitidx + ngranules) <= priv->ngranules;) {
-				/* Break out if there are no further free bits in 'curr'.
-				 * All of the zero bits might have gotten shifted out.
-				 */
-
-				if (curr == 0xffffffff) {
-					break;
-				}
-
-				/* Check for the first zero bit in the lower or upper 16-bits.
-				 * From the test above, we know that at least one of the 32-
-				 * bits in 'curr' is zero.
-				 */
+			alloc = priv->heapstart + ((uintptr_t)granno << priv->log2gran);
+			gran_mark_allocated(priv, alloc, ngranules);
 
-				else if ((curr & 0x0000ffff) == 0x0000ffff) {
-					/* Not in the lower 16 bits.  The first free bit must be
-					 * in the upper 16 bits.
-					 */
-
-					shift = 16;
-				}
-
-				/* We know that the first free bit is now within the lower 16
-				 * bits of 'curr'.  Is it in the upper or lower byte?
-				 */
-
-				else if ((curr & 0x0000ff) == 0x000000ff) {
-					/* Not in the lower 8 bits.  The first free bit must be in
-					 * the upper 8 bits.
-					 */
-
-					shift = 8;
-				}
-
-				/* We know that the first free bit is now within the lower 4
-				 * bits of 'curr'.  Is it in the upper or lower nibble?
-				 */
-
-				else if ((curr & 0x00000f) == 0x0000000f) {
-					/* Not in the lower 4 bits.  The first free bit must be in
-					 * the upper 4 bits.
-					 */
-
-					shift = 4;
-				}
-
-				/* We know that the first free bit is now within the lower 4 bits
-				 * of 'curr'.  Is it in the upper or lower pair?
-				 */
-
-				else if ((curr & 0x000003) == 0x00000003) {
-					/* Not in the lower 2 bits.  The first free bit must be in
-					 * the upper 2 bits.
-					 */
-
-					shift = 2;
-				}
-
-				/* We know that the first free bit is now within the lower 4 bits
-				 * of 'curr'.  Check if we have the allocation at this bit position.
-				 */
-
-				else if ((curr & mask) == 0) {
-					/* Yes.. mark these granules allocated */
-
-					gran_mark_allocated(priv, alloc, ngranules);
-
-					/* And return the allocation address */
-
-					gran_leave_critical(priv);
-					return (FAR void *)alloc;
-				}
-
-				/* The free allocation does not start at this position */
-
-				else {
-					shift = 1;
-				}
+			gran_leave_critical(priv);
+			return (FAR void *)alloc;
+		}
 
-				/* Set up for the next time through the loop.  Perform a 64
-				 * bit shift to move to the next gran position andi ncrement
-				 * to the next candidate allocation address.
-				 */
+		/* There is no run of this length until granules are freed */
 
-				alloc  += (shift << priv->log2gran);
-				curr    = (curr >> shift) | (next << (32 - shift));
-				next  >>= shift;
-				bitidx += shift;
-			}
+		if (ngranules <= GRAN_NHINTS) {
+			priv->hint[hintidx] = priv->ngranules;
 		}
 
 		gran_leave_critical(priv);
@@ -85,13 +85,8 @@
 
 static inline void gran_common_free(FAR struct gran_s *priv, FAR void *memory, size_t size)
 {
-	unsigned int granno;
-	unsigned int gatidx;
-	unsigned int gatbit;
 	unsigned int granmask;
 	unsigned int ngranules;
-	unsigned int avail;
-	uint32_t     gatmask;
 
 	DEBUGASSERT(priv && memory && size <= 32 * (1 << priv->log2gran));
 
@@ -99,17 +94,6 @@ static inline void gran_common_free(FAR struct gran_s *priv, FAR void *memory, s
 
 	gran_enter_critical(priv);
 
-	/* Determine the granule number of the first granule in the allocation */
-
-	granno = ((uintptr_t)memory - priv->heapstart) >> priv->log2gran;
-
-	/* Determine the GAT table index and bit number associated with the
-	 * allocation.
-	 */
-
-	gatidx = granno >> 5;
-	gatbit = granno & 31;
-
 	/* Determine the number of granules in the allocation */
 
 	granmask = (1 << priv->log2gran) - 1;
@@ -117,35 +101,7 @@ static inline void gran_common_free(FAR struct gran_s *priv, FAR void *memory, s
 
 	/* Clear bits in the GAT entry or entries */
 
-	avail = 32 - gatbit;
-	if (ngranules > avail) {
-		/* Clear bits in the first GAT entry */
-
-		gatmask = (0xffffffff << gatbit);
-		DEBUGASSERT((priv->gat[gatidx] & gatmask) == gatmask);
-
-		priv->gat[gatidx] &= ~gatmask;
-		ngranules -= avail;
-
-		/* Clear bits in the second GAT entry */
-
-		gatmask = 0xffffffff >> (32 - ngranules);
-		DEBUGASSERT((priv->gat[gatidx + 1] & gatmask) == gatmask);
-
-		priv->gat[gatidx + 1] &= ~gatmask;
-	}
-
-	/* Handle the case where where all of the granules came from one entry */
-
-	else {
-		/* Clear bits in a single GAT entry */
-
-		gatmask = 0xffffffff >> (32 - ngranules);
-		gatmask <<= gatbit;
-		DEBUGASSERT((priv->gat[gatidx] & gatmask) == gatmask);
-
-		priv->gat[gatidx] &= ~gatmask;
-	}
+	gran_mark_free(priv, (uintptr_t)memory, ngranules);
 
 	gran_leave_critical(priv);
 }
@@ -116,6 +116,8 @@ static inline FAR struct gran_s *gran_common_initialize(FAR void *heapstart, siz
 	unsigned int       mask;
 	unsigned int       alignedsize;
 	unsigned int       ngranules;
+	unsigned int       ngat;
+	unsigned int       i;
 
 	/* Check parameters if debug is on.  Note the size of a granule is
 	 * limited to 2**31 bytes and that the size of the granule must be greater
@@ -127,7 +129,7 @@ static inline FAR struct gran_s *gran_common_initialize(FAR void *heapstart, siz
 	/* Get the aligned start of the heap */
 
 	mask         = (1 << log2align) - 1;
-	alignedstart = ((uintptr_t)heapstart + mask) & ~mask;
+	alignedstart = ((uintptr_t)heapstart + mask) & ~(uintptr_t)mask;
 
 	/* Determine the number of granules */
 
@@ -148,6 +150,22 @@ static inline FAR struct gran_s *gran_common_initialize(FAR void *heapstart, siz
 		priv->ngranules = ngranules;
 		priv->heapstart = alignedstart;
 
+		/* The summary follows the GAT.  The granules past the end of the
+		 * heap in the last GAT entry are marked allocated for good, and
+		 * every other entry starts with free granules.
+		 */
+
+		ngat       = SIZEOF_GAT(ngranules);
+		priv->gsum = &priv->gat[ngat];
+
+		if ((ngranules & 31) != 0) {
+			priv->gat[ngat - 1] = 0xffffffff << (ngranules & 31);
+		}
+
+		for (i = 0; i < ngat; i++) {
+			priv->gsum[i >> 5] |= (uint32_t)1 << (i & 31);
+		}
+
 		/* Initialize mutual exclusion support */
 
 #ifndef CONFIG_GRAN_INTR
@@ -72,6 +72,27 @@
  * Private Functions
  ****************************************************************************/
 
+/****************************************************************************
+ * Name: gran_set_gat
+ *
+ * Description:
+ *   Store a new value in one GAT entry and keep the summary bit of the
+ *   entry up to date.
+ *
+ ****************************************************************************/
+
+static inline void gran_set_gat(FAR struct gran_s *priv, unsigned int gatidx, uint32_t value)
+{
+	uint32_t sumbit = (uint32_t)1 << (gatidx & 31);
+
+	priv->gat[gatidx] = value;
+	if (value == 0xffffffff) {
+		priv->gsum[gatidx >> 5] &= ~sumbit;
+	} else {
+		priv->gsum[gatidx >> 5] |= sumbit;
+	}
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -118,7 +139,7 @@ void gran_mark_allocated(FAR struct gran_s *priv, uintptr_t alloc, unsigned int
 		gatmask = 0xffffffff << gatbit;
 		DEBUGASSERT((priv->gat[gatidx] & gatmask) == 0);
 
-		priv->gat[gatidx] |= gatmask;
+		gran_set_gat(priv, gatidx, priv->gat[gatidx] | gatmask);
 		ngranules -= avail;
 
 		/* Mark bits in the second GAT entry */
@@ -126,7 +147,7 @@ void gran_mark_allocated(FAR struct gran_s *priv, uintptr_t alloc, unsigned int
 		gatmask = 0xffffffff >> (32 - ngranules);
 		DEBUGASSERT((priv->gat[gatidx + 1] & gatmask) == 0);
 
-		priv->gat[gatidx + 1] |= gatmask;
+		gran_set_gat(priv, gatidx + 1, priv->gat[gatidx + 1] | gatmask);
 	}
 
 	/* Handle the case where where all of the granules come from one entry */
@@ -138,9 +159,86 @@ void gran_mark_allocated(FAR struct gran_s *priv, uintptr_t alloc, unsigned int
 		gatmask <<= gatbit;
 		DEBUGASSERT((priv->gat[gatidx] & gatmask) == 0);
 
-		priv->gat[gatidx] |= gatmask;
+		gran_set_gat(priv, gatidx, priv->gat[gatidx] | gatmask);
 		return;
 	}
 }
 
+/****************************************************************************
+ * Name: gran_mark_free
+ *
+ * Description:
+ *   Mark a range of granules as free.
+ *
+ * Input Parameters:
+ *   priv  - The granule heap state structure.
+ *   alloc - The address of the allocation.
+ *   ngranules - The number of granules freed
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void gran_mark_free(FAR struct gran_s *priv, uintptr_t alloc, unsigned int ngranules)
+{
+	unsigned int granno;
+	unsigned int gatidx;
+	unsigned int gatbit;
+	unsigned int avail;
+	uint32_t     gatmask;
+	int          i;
+
+	/* Determine the granule number of the allocation */
+
+	granno = (alloc - priv->heapstart) >> priv->log2gran;
+
+	/* A run of i + 1 free granules may now start as far back as i granules
+	 * before the freed ones.
+	 */
+
+	for (i = 0; i < GRAN_NHINTS; i++) {
+		if (priv->hint[i] + i > granno) {
+			priv->hint[i] = granno > i ? granno - i : 0;
+		}
+	}
+
+	/* Determine the GAT table index associated with the allocation */
+
+	gatidx = granno >> 5;
+	gatbit = granno & 31;
+
+	/* Clear bits in the GAT entry or entries */
+
+	avail = 32 - gatbit;
+	if (ngranules > avail) {
+		/* Clear bits in the first GAT entry */
+
+		gatmask = 0xffffffff << gatbit;
+		DEBUGASSERT((priv->gat[gatidx] & gatmask) == gatmask);
+
+		gran_set_gat(priv, gatidx, priv->gat[gatidx] & ~gatmask);
+		ngranules -= avail;
+
+		/* Clear bits in the second GAT entry */
+
+		gatmask = 0xffffffff >> (32 - ngranules);
+		DEBUGASSERT((priv->gat[gatidx + 1] & gatmask) == gatmask);
+
+		gran_set_gat(priv, gatidx + 1, priv->gat[gatidx + 1] & ~gatmask);
+	}
+
+	/* Handle the case where where all of the granules come from one entry */
+
+	else {
+		/* Clear bits in a single GAT entry */
+
+		gatmask = 0xffffffff >> (32 - ngranules);
+		gatmask <<= gatbit;
+		DEBUGASSERT((priv->gat[gatidx] & gatmask) == gatmask);
+
+		gran_set_gat(priv, gatidx, priv->gat[gatidx] & ~gatmask);
+	}
+}
+
 #endif							/* CONFIG_GRAN */
@@ -133,6 +133,9 @@ void mm_free(FAR struct mm_heap_s *heap, FAR void *mem)
 		return;
 	}
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
+#ifdef CONFIG_MM_HEAPPROF
+	heapprof_free((struct mm_allocnode_s *)node);
+#endif
 	heapinfo_subtract_size(heap, ((struct mm_allocnode_s *)node)->pid, ((struct mm_allocnode_s *)node)->size);
 	heapinfo_update_total_size(heap, ((-1) * ((struct mm_allocnode_s *)node)->size), ((struct mm_allocnode_s *)node)->pid);
 #endif
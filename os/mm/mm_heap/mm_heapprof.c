@@ -0,0 +1,317 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <tinyara/irq.h>
+#include <tinyara/clock.h>
+#include <tinyara/mm/mm.h>
+#include <tinyara/mm/heapprof.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define NCALLSITES   CONFIG_MM_HEAPPROF_NCALLSITES
+#define NSAMPLES     CONFIG_MM_HEAPPROF_NSAMPLES
+
+/* The slot of a sampled chunk is kept in the reserved field of its header */
+
+#if NSAMPLES >= 0xffff
+#error CONFIG_MM_HEAPPROF_NSAMPLES does not fit in mm_allocnode_s.reserved
+#endif
+
+#if NCALLSITES < 1
+#error CONFIG_MM_HEAPPROF_NCALLSITES must be at least 1
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct heapprof_s {
+	struct heapprof_stats_s stats;
+	struct heapprof_callsite_s callsite[NCALLSITES];
+	struct heapprof_sample_s sample[NSAMPLES];
+	uint16_t next_sample;		/* Next slot of the ring buffer */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* One profiler for all heaps, so it is updated in a critical section */
+
+static struct heapprof_s g_heapprof;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: heapprof_lookup
+ *
+ * Description:
+ *   Return the entry of a call site, adding it if create is true and there
+ *   is room in the table.  The table is open addressed and the entries are
+ *   only removed by heapprof_reset(), so a search stops at the first unused
+ *   entry.
+ *
+ ****************************************************************************/
+
+static FAR struct heapprof_callsite_s *heapprof_lookup(size_t addr, bool create)
+{
+	FAR struct heapprof_callsite_s *callsite;
+	int index = (addr >> 1) % NCALLSITES;
+	int i;
+
+	for (i = 0; i < NCALLSITES; i++) {
+		callsite = &g_heapprof.callsite[index];
+		if (callsite->addr == addr) {
+			return callsite;
+		}
+
+		if (callsite->addr == 0) {
+			if (!create) {
+				return NULL;
+			}
+
+			callsite->addr = addr;
+			return callsite;
+		}
+
+		if (++index == NCALLSITES) {
+			index = 0;
+		}
+	}
+
+	return NULL;
+}
+
+/****************************************************************************
+ * Name: heapprof_bucket
+ ****************************************************************************/
+
+static int heapprof_bucket(size_t size)
+{
+	int bucket = 0;
+
+	size >>= HEAPPROF_BUCKET_SHIFT + 1;
+	while (size != 0 && bucket < HEAPPROF_NBUCKETS - 1) {
+		size >>= 1;
+		bucket++;
+	}
+
+	return bucket;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: heapprof_alloc
+ *
+ * Description:
+ *   Account an allocated chunk to its call site and sample its lifetime.
+ *
+ ****************************************************************************/
+
+void heapprof_alloc(FAR struct mm_allocnode_s *node)
+{
+	FAR struct heapprof_callsite_s *callsite;
+	FAR struct heapprof_sample_s *sample;
+	irqstate_t flags;
+
+	flags = irqsave();
+
+	g_heapprof.stats.nallocs++;
+	g_heapprof.stats.hist[heapprof_bucket(node->size)]++;
+
+	callsite = heapprof_lookup(node->alloc_call_addr, true);
+	if (callsite == NULL) {
+		g_heapprof.stats.nlost_allocs++;
+	} else {
+		callsite->nallocs++;
+		callsite->curr_size += node->size;
+		callsite->total_size += node->size;
+		if (callsite->curr_size > callsite->peak_size) {
+			callsite->peak_size = callsite->curr_size;
+		}
+	}
+
+	if (g_heapprof.stats.nallocs % CONFIG_MM_HEAPPROF_SAMPLE_PERIOD == 0) {
+		sample = &g_heapprof.sample[g_heapprof.next_sample];
+		sample->mem = (FAR char *)node + SIZEOF_MM_ALLOCNODE;
+		sample->addr = node->alloc_call_addr;
+		sample->size = node->size;
+		sample->pid = node->pid;
+		sample->freed = false;
+		sample->alloc_time = clock_systimer();
+		sample->free_time = 0;
+
+		node->reserved = g_heapprof.next_sample + 1;
+		if (++g_heapprof.next_sample == NSAMPLES) {
+			g_heapprof.next_sample = 0;
+		}
+	}
+
+	irqrestore(flags);
+}
+
+/****************************************************************************
+ * Name: heapprof_free
+ *
+ * Description:
+ *   Account a chunk that is about to be freed to its call site and complete
+ *   its sample if it was sampled.
+ *
+ ****************************************************************************/
+
+void heapprof_free(FAR struct mm_allocnode_s *node)
+{
+	FAR struct heapprof_callsite_s *callsite;
+	FAR struct heapprof_sample_s *sample = NULL;
+	irqstate_t flags;
+
+	flags = irqsave();
+
+	g_heapprof.stats.nfrees++;
+
+	/* The slot may have been reused for a later allocation */
+
+	if (node->reserved != 0 && node->reserved <= NSAMPLES) {
+		sample = &g_heapprof.sample[node->reserved - 1];
+		if (sample->mem != (FAR char *)node + SIZEOF_MM_ALLOCNODE || sample->freed) {
+			sample = NULL;
+		}
+		node->reserved = 0;
+	}
+
+	/* Complete the sample even if its call site is not found, so that it
+	 * does not look live and its slot can not match a later chunk
+	 */
+
+	if (sample != NULL) {
+		sample->freed = true;
+		sample->free_time = clock_systimer();
+	}
+
+	callsite = heapprof_lookup(node->alloc_call_addr, false);
+	if (callsite == NULL || callsite->curr_size < node->size) {
+		/* Allocated before a reset or by a call site that was not in the table */
+
+		g_heapprof.stats.nlost_frees++;
+	} else {
+		callsite->nfrees++;
+		callsite->curr_size -= node->size;
+		if (sample != NULL) {
+			callsite->nlifetimes++;
+			callsite->lifetime += sample->free_time - sample->alloc_time;
+		}
+	}
+
+	irqrestore(flags);
+}
+
+/****************************************************************************
+ * Name: heapprof_get_stats
+ ****************************************************************************/
+
+void heapprof_get_stats(FAR struct heapprof_stats_s *stats)
+{
+	irqstate_t flags;
+
+	flags = irqsave();
+	memcpy(stats, &g_heapprof.stats, sizeof(struct heapprof_stats_s));
+	irqrestore(flags);
+}
+
+/****************************************************************************
+ * Name: heapprof_get_callsite
+ *
+ * Description:
+ *   Copy entry index of the call site table.  Unused entries are copied
+ *   with an address of 0.
+ *
+ ****************************************************************************/
+
+bool heapprof_get_callsite(int index, FAR struct heapprof_callsite_s *callsite)
+{
+	irqstate_t flags;
+
+	if (index < 0 || index >= NCALLSITES) {
+		return false;
+	}
+
+	flags = irqsave();
+	memcpy(callsite, &g_heapprof.callsite[index], sizeof(struct heapprof_callsite_s));
+	irqrestore(flags);
+
+	return true;
+}
+
+/****************************************************************************
+ * Name: heapprof_get_sample
+ *
+ * Description:
+ *   Copy slot index of the sample ring buffer.  Unused slots are copied
+ *   with a NULL mem.
+ *
+ ****************************************************************************/
+
+bool heapprof_get_sample(int index, FAR struct heapprof_sample_s *sample)
+{
+	irqstate_t flags;
+
+	if (index < 0 || index >= NSAMPLES) {
+		return false;
+	}
+
+	flags = irqsave();
+	memcpy(sample, &g_heapprof.sample[index], sizeof(struct heapprof_sample_s));
+	irqrestore(flags);
+
+	return true;
+}
+
+/****************************************************************************
+ * Name: heapprof_reset
+ *
+ * Description:
+ *   Clear the statistics.  The chunks allocated before are counted as lost
+ *   frees when they are freed.
+ *
+ ****************************************************************************/
+
+void heapprof_reset(void)
+{
+	irqstate_t flags;
+
+	flags = irqsave();
+	memset(&g_heapprof, 0, sizeof(struct heapprof_s));
+	irqrestore(flags);
+}
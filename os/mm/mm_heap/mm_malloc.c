@@ -213,6 +213,9 @@ FAR void *mm_malloc(FAR struct mm_heap_s *heap, size_t size)
 
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 		heapinfo_update_node((struct mm_allocnode_s *)node, caller_retaddr);
+#ifdef CONFIG_MM_HEAPPROF
+		heapprof_alloc((struct mm_allocnode_s *)node);
+#endif
 		heapinfo_add_size(heap, ((struct mm_allocnode_s *)node)->pid, node->size);
 		heapinfo_update_total_size(heap, node->size, ((struct mm_allocnode_s *)node)->pid);
 #endif
@@ -162,6 +162,9 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem, size_t size)
 		if (newsize < oldsize) {
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 			/* modify the current allocated size of old node */
+#ifdef CONFIG_MM_HEAPPROF
+			heapprof_free(oldnode);
+#endif
 			heapinfo_subtract_size(heap, oldnode->pid, oldsize);
 			heapinfo_update_total_size(heap, (-1) * oldsize, oldnode->pid);
 #endif
@@ -170,6 +173,9 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem, size_t size)
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 			/* update the chunk to realloc task information */
 			heapinfo_update_node(oldnode, caller_retaddr);
+#ifdef CONFIG_MM_HEAPPROF
+			heapprof_alloc(oldnode);
+#endif
 
 			heapinfo_add_size(heap, oldnode->pid, oldnode->size);
 			heapinfo_update_total_size(heap, oldnode->size, oldnode->pid);
@@ -207,6 +213,9 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem, size_t size)
 
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 		/* modify the current allocated size of old node */
+#ifdef CONFIG_MM_HEAPPROF
+		heapprof_free(oldnode);
+#endif
 		heapinfo_subtract_size(heap, oldnode->pid, oldsize);
 		heapinfo_update_total_size(heap, (-1) * oldsize, oldnode->pid);
 #endif
@@ -349,6 +358,9 @@ FAR void *mm_realloc(FAR struct mm_heap_s *heap, FAR void *oldmem, size_t size)
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 		/* update the chunk to realloc task information */
 		heapinfo_update_node(oldnode, caller_retaddr);
+#ifdef CONFIG_MM_HEAPPROF
+		heapprof_alloc(oldnode);
+#endif
 
 		heapinfo_add_size(heap, oldnode->pid, oldnode->size);
 		heapinfo_update_total_size(heap, oldnode->size, oldnode->pid);
@@ -771,6 +771,39 @@ err_t netconn_write_partly(struct netconn *conn, const void *dataptr, size_t siz
 	return err;
 }
 
+#if LWIP_TCP && LWIP_SOCKET_ZEROCOPY
+/**
+ * Get the number of bytes written to a TCP netconn that the remote side has
+ * not acknowledged yet. Data written with NETCONN_NOCOPY may be reused once
+ * it is acknowledged.
+ *
+ * @param conn the TCP netconn to query
+ * @param limit if wait is set, wait until no more than limit bytes are unacknowledged
+ * @param wait 1 to wait for the limit, 0 to return at once
+ * @param queued pointer to which to save the number of unacknowledged bytes
+ * @return ERR_OK if the number was retrieved, any other err_t on error
+ */
+err_t netconn_sendq(struct netconn *conn, u32_t limit, u8_t wait, u32_t *queued)
+{
+	API_MSG_VAR_DECLARE(msg);
+	err_t err;
+
+	LWIP_ERROR("netconn_sendq: invalid conn", (conn != NULL), return ERR_ARG;);
+	LWIP_ERROR("netconn_sendq: invalid queued", (queued != NULL), return ERR_ARG;);
+
+	API_MSG_VAR_ALLOC(msg);
+	API_MSG_VAR_REF(msg).conn = conn;
+	API_MSG_VAR_REF(msg).msg.sq.limit = limit;
+	API_MSG_VAR_REF(msg).msg.sq.wait = wait;
+	API_MSG_VAR_REF(msg).msg.sq.queued = 0;
+	err = netconn_apimsg(lwip_netconn_do_sendq, &API_MSG_VAR_REF(msg));
+	*queued = API_MSG_VAR_REF(msg).msg.sq.queued;
+	API_MSG_VAR_FREE(msg);
+
+	return err;
+}
+#endif							/* LWIP_TCP && LWIP_SOCKET_ZEROCOPY */
+
 /**
  * Close ot shutdown a TCP netconn (doesn't delete it).
  *
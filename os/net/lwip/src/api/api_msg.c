@@ -93,6 +93,9 @@
 #endif							/* LWIP_TCPIP_CORE_LOCKING */
 static err_t lwip_netconn_do_writemore(struct netconn *conn WRITE_DELAYED_PARAM);
 static err_t lwip_netconn_do_close_internal(struct netconn *conn WRITE_DELAYED_PARAM);
+#if LWIP_SOCKET_ZEROCOPY
+static err_t lwip_netconn_do_sendq_check(struct netconn *conn WRITE_DELAYED_PARAM);
+#endif
 #endif
 
 #if LWIP_TCPIP_CORE_LOCKING
@@ -363,6 +366,11 @@ static err_t sent_tcp(void *arg, struct tcp_pcb *pcb, u16_t len)
 		} else if (conn->state == NETCONN_CLOSE) {
 			lwip_netconn_do_close_internal(conn WRITE_DELAYED);
 		}
+#if LWIP_SOCKET_ZEROCOPY
+		else if (conn->state == NETCONN_SENDQ) {
+			lwip_netconn_do_sendq_check(conn WRITE_DELAYED);
+		}
+#endif
 
 		/* If the queued byte- or pbuf-count drops below the configured low-water limit,
 		   let select mark this pcb as writable again. */
@@ -425,7 +433,7 @@ static void err_tcp(void *arg, err_t err)
 		sys_mbox_trypost(&conn->acceptmbox, NULL);
 	}
 
-	if ((old_state == NETCONN_WRITE) || (old_state == NETCONN_CLOSE) || (old_state == NETCONN_CONNECT)) {
+	if ((old_state == NETCONN_WRITE) || (old_state == NETCONN_CLOSE) || (old_state == NETCONN_CONNECT) || (old_state == NETCONN_SENDQ)) {
 		/* calling lwip_netconn_do_writemore/lwip_netconn_do_close_internal is not necessary
 		   since the pcb has already been deleted! */
 		int was_nonblocking_connect = IN_NONBLOCKING_CONNECT(conn);
@@ -1027,7 +1035,7 @@ void lwip_netconn_do_delconn(void *m)
 #if LWIP_NETCONN_FULLDUPLEX
 	/* In full duplex mode, blocking write/connect is aborted with ERR_CLSD */
 	if (state != NETCONN_NONE) {
-		if ((state == NETCONN_WRITE) || ((state == NETCONN_CONNECT) && !IN_NONBLOCKING_CONNECT(msg->conn))) {
+		if ((state == NETCONN_WRITE) || (state == NETCONN_SENDQ) || ((state == NETCONN_CONNECT) && !IN_NONBLOCKING_CONNECT(msg->conn))) {
 			/* close requested, abort running write/connect */
 			sys_sem_t *op_completed_sem;
 			LWIP_ASSERT("msg->conn->current_msg != NULL", msg->conn->current_msg != NULL);
@@ -1673,6 +1681,92 @@ void lwip_netconn_do_write(void *m)
 	TCPIP_APIMSG_ACK(msg);
 }
 
+#if LWIP_TCP && LWIP_SOCKET_ZEROCOPY
+/**
+ * See if the unacknowledged data of a netconn dropped to the limit of the
+ * pending lwip_netconn_do_sendq call and wake up the application task if so.
+ * Called from lwip_netconn_do_sendq and sent_tcp.
+ *
+ * @param conn netconn (that is currently in state NETCONN_SENDQ) to check
+ * @return ERR_OK if the limit was reached,
+ *         ERR_INPROGRESS if further ACKs have to be waited for
+ */
+static err_t lwip_netconn_do_sendq_check(struct netconn *conn WRITE_DELAYED_PARAM)
+{
+	struct api_msg *msg = conn->current_msg;
+	sys_sem_t *op_completed_sem;
+
+	LWIP_ASSERT("conn != NULL", conn != NULL);
+	LWIP_ASSERT("conn->state == NETCONN_SENDQ", (conn->state == NETCONN_SENDQ));
+	LWIP_ASSERT("pcb != NULL", conn->pcb.tcp != NULL);
+
+	msg->msg.sq.queued = conn->pcb.tcp->snd_lbb - conn->pcb.tcp->lastack;
+	if (msg->msg.sq.queued > msg->msg.sq.limit) {
+		return ERR_INPROGRESS;
+	}
+
+	/* limit reached: set back connection state and back to application task */
+	op_completed_sem = LWIP_API_MSG_SEM(msg);
+	msg->err = ERR_OK;
+	conn->current_msg = NULL;
+	conn->state = NETCONN_NONE;
+	NETCONN_SET_SAFE_ERR(conn, ERR_OK);
+#if LWIP_TCPIP_CORE_LOCKING
+	if (delayed)
+#endif
+	{
+		sys_sem_signal(op_completed_sem);
+	}
+	return ERR_OK;
+}
+
+/**
+ * Get the number of bytes queued on a TCP pcb that are not acknowledged
+ * yet and optionally wait until it drops to a limit.
+ * Called from netconn_sendq
+ *
+ * @param m the api_msg_msg pointing to the connection
+ */
+void lwip_netconn_do_sendq(void *m)
+{
+	struct api_msg *msg = (struct api_msg *)m;
+
+	if (ERR_IS_FATAL(msg->conn->last_err)) {
+		msg->err = msg->conn->last_err;
+	} else if (NETCONNTYPE_GROUP(msg->conn->type) != NETCONN_TCP) {
+		/* datagrams are handed to the netif before send returns */
+		msg->msg.sq.queued = 0;
+		msg->err = ERR_OK;
+	} else if (msg->conn->pcb.tcp == NULL) {
+		msg->err = ERR_CONN;
+	} else if (!msg->msg.sq.wait) {
+		msg->msg.sq.queued = msg->conn->pcb.tcp->snd_lbb - msg->conn->pcb.tcp->lastack;
+		msg->err = ERR_OK;
+	} else if (msg->conn->state != NETCONN_NONE) {
+		/* netconn is connecting, closing or in blocking write */
+		msg->err = ERR_INPROGRESS;
+	} else {
+		LWIP_ASSERT("already writing or closing", msg->conn->current_msg == NULL);
+		msg->conn->state = NETCONN_SENDQ;
+		msg->conn->current_msg = msg;
+#if LWIP_TCPIP_CORE_LOCKING
+		if (lwip_netconn_do_sendq_check(msg->conn, 0) != ERR_OK) {
+			UNLOCK_TCPIP_CORE();
+			sys_arch_sem_wait(LWIP_API_MSG_SEM(msg), 0);
+			LOCK_TCPIP_CORE();
+			LWIP_ASSERT("state!", msg->conn->state != NETCONN_SENDQ);
+		}
+#else							/* LWIP_TCPIP_CORE_LOCKING */
+		lwip_netconn_do_sendq_check(msg->conn);
+#endif							/* LWIP_TCPIP_CORE_LOCKING */
+		/* for both cases: if lwip_netconn_do_sendq_check was called, don't ACK the APIMSG
+		   since it ACKs it once the limit is reached! */
+		return;
+	}
+	TCPIP_APIMSG_ACK(msg);
+}
+#endif							/* LWIP_TCP && LWIP_SOCKET_ZEROCOPY */
+
 /**
  * Return a connection's local or remote address
  * Called from netconn_getaddr
@@ -1755,7 +1849,7 @@ void lwip_netconn_do_close(void *m)
 		if (state == NETCONN_CONNECT) {
 			/* TCP connect in progress: cannot shutdown */
 			msg->err = ERR_CONN;
-		} else if (state == NETCONN_WRITE) {
+		} else if ((state == NETCONN_WRITE) || (state == NETCONN_SENDQ)) {
 #if LWIP_NETCONN_FULLDUPLEX
 			if (msg->msg.sd.shut & NETCONN_SHUT_WR) {
 				/* close requested, abort running write */
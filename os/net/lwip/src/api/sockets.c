@@ -257,8 +257,12 @@ struct lwip_select_cb {
 #else
 	/** Pointer to semaphore used post output event */
 	sys_sem_t *poll_sem;
+	/** Pointer to the pollfd receiving the output events */
+	struct pollfd *poll_fds;
 	/** Pointer to event-set of requested poll events */
 	pollevent_t events;
+	/** set for pollers that stay registered across events (epoll) */
+	u8_t persist;
 	/** socket descriptor value */
 	int sfd;
 	/** semaphore to wake up a task waiting for select */
@@ -727,6 +731,15 @@ int lwip_sock_close(struct lwip_sock *sock)
 		lwip_socket_drop_registered_memberships(sock);
 #endif                                                  /* LWIP_IGMP */
 		is_tcp = netconn_type(sock->conn) == NETCONN_TCP;
+#if LWIP_TCP && LWIP_SOCKET_ZEROCOPY
+		if (is_tcp && sock->zerocopy) {
+			u32_t queued;
+
+			/* the stack references the caller's data until the peer acknowledged
+			   it, which would not be known any more once the socket is closed */
+			(void)netconn_sendq(sock->conn, 0, 1, &queued);
+		}
+#endif							/* LWIP_TCP && LWIP_SOCKET_ZEROCOPY */
 	} else {
 		LWIP_ASSERT("sock->lastdata == NULL", sock->lastdata == NULL);
 	}
@@ -833,6 +846,144 @@ int lwip_listen(int s, int backlog)
 	return 0;
 }
 
+/**
+ * Store the source address of the received buffer 'buf' of a socket in
+ * 'from', if the caller asked for it.
+ */
+static void lwip_recvfrom_addr(struct lwip_sock *sock, void *buf, struct sockaddr *from, socklen_t *fromlen)
+{
+	u16_t port;
+	ip_addr_t tmpaddr;
+	ip_addr_t *fromaddr;
+	union sockaddr_aligned saddr;
+
+	if (!from || !fromlen) {
+		return;
+	}
+
+	LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_recvfrom: addr="));
+	if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP) {
+		fromaddr = &tmpaddr;
+		netconn_getaddr(sock->conn, fromaddr, &port, 0);
+	} else {
+		port = netbuf_fromport((struct netbuf *)buf);
+		fromaddr = netbuf_fromaddr((struct netbuf *)buf);
+	}
+
+#if LWIP_IPV4 && LWIP_IPV6
+	/* Dual-stack: Map IPv4 addresses to IPv4 mapped IPv6 */
+	if (NETCONNTYPE_ISIPV6(netconn_type(sock->conn)) && IP_IS_V4(fromaddr)) {
+		ip4_2_ipv4_mapped_ipv6(ip_2_ip6(fromaddr), ip_2_ip4(fromaddr));
+		IP_SET_TYPE(fromaddr, IPADDR_TYPE_V6);
+	}
+#endif							/* LWIP_IPV4 && LWIP_IPV6 */
+
+	IPADDR_PORT_TO_SOCKADDR(&saddr, fromaddr, port);
+	ip_addr_debug_print(SOCKETS_DEBUG, fromaddr);
+	LWIP_DEBUGF(SOCKETS_DEBUG, (" port=%" U16_F "\n", port));
+	if (*fromlen > saddr.sa.sa_len) {
+		*fromlen = saddr.sa.sa_len;
+	}
+	MEMCPY(from, &saddr, *fromlen);
+}
+
+#if LWIP_SOCKET_ZEROCOPY
+/**
+ * Hand the pending receive buffer of a socket over to the caller instead of
+ * copying it. The caller owns the returned pbuf chain and frees it with
+ * pbuf_free(), so this works only if the application shares the kernel heap.
+ *
+ * At most 'len' bytes are handed over. The rest of a datagram is discarded
+ * as by a copying recv. TCP data is handed over in whole pbufs as far as
+ * possible; the part of the pbuf that straddles 'len' is copied into a new
+ * pbuf, and the rest stays with the socket for the next recv.
+ */
+static int lwip_recv_zerocopy(struct lwip_sock *sock, void *buf, struct pbuf *p, size_t len, struct pbuf **pp)
+{
+#ifdef CONFIG_BUILD_FLAT
+	struct pbuf *q;
+	struct pbuf *r;
+	struct pbuf *last = NULL;
+	struct pbuf *tail = NULL;
+	u16_t off = sock->lastoffset;
+	size_t taken = 0;
+	u16_t part;
+
+	sock->lastdata = NULL;
+	sock->lastoffset = 0;
+
+	if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) != NETCONN_TCP) {
+		/* keep the pbuf chain, drop the netbuf around it */
+		((struct netbuf *)buf)->p = NULL;
+		netbuf_delete((struct netbuf *)buf);
+		if (p->tot_len > len) {
+			pbuf_realloc(p, (u16_t)len);
+		}
+		*pp = p;
+		sock_set_errno(sock, 0);
+		return p->tot_len;
+	}
+
+	/* drop what previous copying recv calls have already consumed */
+	while (off >= p->len) {
+		off -= p->len;
+		q = p->next;
+		pbuf_ref(q);
+		pbuf_free(p);
+		p = q;
+	}
+	if (off > 0) {
+		pbuf_header(p, -(s16_t)off);
+	}
+
+	if (p->tot_len > len) {
+		for (q = p; taken + q->len <= len; q = q->next) {
+			taken += q->len;
+			last = q;
+		}
+
+		part = (u16_t)(len - taken);
+		if (part > 0) {
+			tail = pbuf_alloc(PBUF_RAW, part, PBUF_RAM);
+			if (tail == NULL) {
+				sock->lastdata = p;
+				sock_set_errno(sock, ENOMEM);
+				return -1;
+			}
+			pbuf_copy_partial(q, tail->payload, part, 0);
+		}
+
+		if (last != NULL) {
+			/* cut the chain in front of q, the reference of last passes to lastdata */
+			for (r = p; r != q; r = r->next) {
+				r->tot_len -= q->tot_len;
+			}
+			last->next = NULL;
+			if (tail != NULL) {
+				pbuf_cat(p, tail);
+			}
+		} else {
+			p = tail;
+		}
+
+		sock->lastdata = q;
+		sock->lastoffset = part;
+	}
+
+	*pp = p;
+	sock_set_errno(sock, 0);
+	return p != NULL ? p->tot_len : 0;
+#else
+	LWIP_UNUSED_ARG(buf);
+	LWIP_UNUSED_ARG(p);
+	LWIP_UNUSED_ARG(len);
+	LWIP_UNUSED_ARG(pp);
+	sock_set_errno(sock, EOPNOTSUPP);
+	return -1;
+#endif
+}
+#endif							/* LWIP_SOCKET_ZEROCOPY */
+
 int lwip_recvfrom(int s, void *mem, size_t len, int flags, struct sockaddr *from, socklen_t *fromlen)
 {
 	struct lwip_sock *sock;
@@ -907,6 +1058,12 @@ int lwip_recvfrom(int s, void *mem, size_t len, int flags, struct sockaddr *from
 		} else {
 			p = ((struct netbuf *)buf)->p;
 		}
+#if LWIP_SOCKET_ZEROCOPY
+		if ((flags & MSG_ZEROCOPY) && ((flags & MSG_PEEK) == 0) && (off == 0)) {
+			lwip_recvfrom_addr(sock, buf, from, fromlen);
+			return lwip_recv_zerocopy(sock, buf, p, len, (struct pbuf **)mem);
+		}
+#endif
 		buflen = p->tot_len;
 		LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_recvfrom: buflen=%" U16_F " len=%" SZT_F " off=%d sock->lastoffset=%" U16_F "\n", buflen, len, off, sock->lastoffset));
 
@@ -936,36 +1093,7 @@ int lwip_recvfrom(int s, void *mem, size_t len, int flags, struct sockaddr *from
 
 		/* Check to see from where the data was. */
 		if (done) {
-			if (from && fromlen) {
-				u16_t port;
-				ip_addr_t tmpaddr;
-				ip_addr_t *fromaddr;
-				union sockaddr_aligned saddr;
-				LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_recvfrom(%d): addr=", s));
-				if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP) {
-					fromaddr = &tmpaddr;
-					netconn_getaddr(sock->conn, fromaddr, &port, 0);
-				} else {
-					port = netbuf_fromport((struct netbuf *)buf);
-					fromaddr = netbuf_fromaddr((struct netbuf *)buf);
-				}
-
-#if LWIP_IPV4 && LWIP_IPV6
-				/* Dual-stack: Map IPv4 addresses to IPv4 mapped IPv6 */
-				if (NETCONNTYPE_ISIPV6(netconn_type(sock->conn)) && IP_IS_V4(fromaddr)) {
-					ip4_2_ipv4_mapped_ipv6(ip_2_ip6(fromaddr), ip_2_ip4(fromaddr));
-					IP_SET_TYPE(fromaddr, IPADDR_TYPE_V6);
-				}
-#endif							/* LWIP_IPV4 && LWIP_IPV6 */
-
-				IPADDR_PORT_TO_SOCKADDR(&saddr, fromaddr, port);
-				ip_addr_debug_print(SOCKETS_DEBUG, fromaddr);
-				LWIP_DEBUGF(SOCKETS_DEBUG, (" port=%" U16_F " len=%d\n", port, off));
-				if (*fromlen > saddr.sa.sa_len) {
-					*fromlen = saddr.sa.sa_len;
-				}
-				MEMCPY(from, &saddr, *fromlen);
-			}
+			lwip_recvfrom_addr(sock, buf, from, fromlen);
 		}
 
 		/* If we don't peek the incoming message... */
@@ -1030,6 +1158,13 @@ int lwip_send(int s, const void *data, size_t size, int flags)
 	}
 
 	write_flags = NETCONN_COPY | ((flags & MSG_MORE) ? NETCONN_MORE : 0) | ((flags & MSG_DONTWAIT) ? NETCONN_DONTBLOCK : 0);
+#if LWIP_SOCKET_ZEROCOPY
+	if (flags & MSG_ZEROCOPY) {
+		/* reference the caller's data, it must not be changed before FIONSENDQ drops */
+		write_flags &= ~NETCONN_COPY;
+		sock->zerocopy = 1;
+	}
+#endif
 	written = 0;
 	err = netconn_write_partly(sock->conn, data, size, write_flags, &written);
 
@@ -1064,6 +1199,12 @@ int lwip_sendmsg(int s, const struct msghdr *msg, int flags)
 	if (NETCONNTYPE_GROUP(netconn_type(sock->conn)) == NETCONN_TCP) {
 #if LWIP_TCP
 		write_flags = NETCONN_COPY | ((flags & MSG_MORE) ? NETCONN_MORE : 0) | ((flags & MSG_DONTWAIT) ? NETCONN_DONTBLOCK : 0);
+#if LWIP_SOCKET_ZEROCOPY
+		if (flags & MSG_ZEROCOPY) {
+			write_flags &= ~NETCONN_COPY;
+			sock->zerocopy = 1;
+		}
+#endif
 
 		for (i = 0; i < msg->msg_iovlen; i++) {
 			u8_t apiflags = write_flags;
@@ -1125,15 +1266,20 @@ int lwip_sendmsg(int s, const struct msghdr *msg, int flags)
 		} else {
 			/* flatten the IO vectors */
 			size_t offset = 0;
+#if LWIP_CHECKSUM_ON_COPY
+			/* sum each IO vector while copying it */
+			u16_t chksum = 0;
 			for (i = 0; i < msg->msg_iovlen; i++) {
-				MEMCPY(&((u8_t *) chain_buf->p->payload)[offset], msg->msg_iov[i].iov_base, msg->msg_iov[i].iov_len);
+				if (msg->msg_iov[i].iov_len > 0) {
+					pbuf_fill_chksum(chain_buf->p, (u16_t) offset, msg->msg_iov[i].iov_base, (u16_t) msg->msg_iov[i].iov_len, &chksum);
+				}
 				offset += msg->msg_iov[i].iov_len;
 			}
-#if LWIP_CHECKSUM_ON_COPY
-			{
-				/* This can be improved by using LWIP_CHKSUM_COPY() and aggregating the checksum for each IO vector */
-				u16_t chksum = ~inet_chksum_pbuf(chain_buf->p);
-				netbuf_set_chksum(chain_buf, chksum);
+			netbuf_set_chksum(chain_buf, chksum);
+#else							/* LWIP_CHECKSUM_ON_COPY */
+			for (i = 0; i < msg->msg_iovlen; i++) {
+				MEMCPY(&((u8_t *) chain_buf->p->payload)[offset], msg->msg_iov[i].iov_base, msg->msg_iov[i].iov_len);
+				offset += msg->msg_iov[i].iov_len;
 			}
 #endif							/* LWIP_CHECKSUM_ON_COPY */
 			err = ERR_OK;
@@ -1665,16 +1811,38 @@ static int lwip_poll_setup(int fd, struct lwip_sock *sock, struct pollfd *fds)
 	}
 #endif
 	SYS_ARCH_DECL_PROTECT(lev);
-	fds->scb = NULL;
-	nready = lwip_poll_scan(fd, sock, fds);
 
-	/* Check if any requested events are already in effect */
-	if (nready > 0 && fds->revents != 0) {
-		/* Yes.. then signal the poll logic */
-		sys_sem_signal(fds->sem);
+	/* A persistent poller sets up a registered pollfd again to have the
+	 * state re-evaluated: rescan and keep the registration.
+	 */
+
+	if ((fds->events & POLLPERSIST) != 0 && fds->scb != NULL) {
+		nready = lwip_poll_scan(fd, sock, fds);
+		if (nready > 0 && fds->revents != 0) {
+			sys_sem_signal(fds->sem);
+		}
 		return 0;
 	}
 
+	fds->scb = NULL;
+
+	/* poll() and select() wake up and tear down on the first event, so they
+	 * need no registration if events are already pending.  Persistent
+	 * pollers (epoll) rely on event_callback() for the events that follow
+	 * and always register; lwip_poll_scan() below reports the current ones.
+	 */
+
+	if ((fds->events & POLLPERSIST) == 0) {
+		nready = lwip_poll_scan(fd, sock, fds);
+
+		/* Check if any requested events are already in effect */
+		if (nready > 0 && fds->revents != 0) {
+			/* Yes.. then signal the poll logic */
+			sys_sem_signal(fds->sem);
+			return 0;
+		}
+	}
+
 	scb_size = LWIP_MEM_ALIGN_SIZE(sizeof(struct lwip_select_cb));
 	select_cb = (struct lwip_select_cb *)mem_malloc(scb_size);
 
@@ -1690,7 +1858,9 @@ static int lwip_poll_setup(int fd, struct lwip_sock *sock, struct pollfd *fds)
 	select_cb->prev = NULL;
 	select_cb->sem_signalled = 0;
 	select_cb->poll_sem = fds->sem;
+	select_cb->poll_fds = fds;
 	select_cb->events = fds->events;
+	select_cb->persist = (fds->events & POLLPERSIST) != 0;
 	select_cb->sfd = fd;
 
 	/* Protect the select_cb_list */
@@ -1736,12 +1906,14 @@ static int lwip_poll_teardown(int fd, struct lwip_sock *sock, struct pollfd *fds
 	select_cb = (struct lwip_select_cb *)fds->scb;
 
 	SYS_ARCH_PROTECT(lev);
-	if (sock->select_waiting > 0) {
-		sock->select_waiting--;
-	}
 
 	/* Take select_cb_list off the list */
 	if (select_cb) {
+		/* Only a registered poll has increased select_waiting */
+		if (sock->select_waiting > 0) {
+			sock->select_waiting--;
+		}
+
 		if (select_cb->next != NULL) {
 			select_cb->next->prev = select_cb->prev;
 		}
@@ -1754,6 +1926,7 @@ static int lwip_poll_teardown(int fd, struct lwip_sock *sock, struct pollfd *fds
 		}
 
 		mem_free((void *)select_cb);
+		fds->scb = NULL;
 		/* Increasing this counter tells event_callback that the list has changed. */
 		select_cb_ctr++;
 	}
@@ -1902,6 +2075,32 @@ again:
 	for (scb = select_cb_list; scb != NULL; scb = scb->next) {
 		/* remember the state of select_cb_list to detect changes */
 		last_select_cb_ctr = select_cb_ctr;
+#if !LWIP_SELECT
+		if (scb->persist) {
+			if (scb->sfd == s) {
+				/* Persistent pollers (epoll) stay registered: report the
+				 * events through the pollfd and signal whenever there are
+				 * events the poller has not consumed yet.
+				 */
+				pollevent_t ev = 0;
+				if (sock->rcvevent > 0) {
+					ev |= POLLIN;
+				}
+				if (sock->sendevent != 0) {
+					ev |= POLLOUT;
+				}
+				if (sock->errevent != 0) {
+					ev |= POLLERR;
+				}
+				ev &= scb->events;
+				if ((ev & ~scb->poll_fds->revents) != 0) {
+					scb->poll_fds->revents |= ev;
+					scb->sem_signalled = 1;
+					sys_sem_signal(scb->poll_sem);
+				}
+			}
+		} else
+#endif
 		if (scb->sem_signalled == 0) {
 			/* semaphore not signalled yet */
 			int do_signal = 0;
@@ -2899,6 +3098,28 @@ int lwip_ioctl(int s, long cmd, void *argp)
 #endif							/* LWIP_SO_RCVBUF */
 #endif							/* LWIP_SO_RCVBUF || LWIP_FIONREAD_LINUXMODE */
 
+#if LWIP_TCP && LWIP_SOCKET_ZEROCOPY
+	case FIONSENDQ:
+	case FIONSENDQWAIT: {
+		u32_t queued = 0;
+		err_t err;
+
+		if (!argp || (cmd == FIONSENDQWAIT && *((int *)argp) < 0)) {
+			sock_set_errno(sock, EINVAL);
+			return -1;
+		}
+		err = netconn_sendq(sock->conn, cmd == FIONSENDQWAIT ? (u32_t)*((int *)argp) : 0, cmd == FIONSENDQWAIT, &queued);
+		if (err != ERR_OK) {
+			sock_set_errno(sock, err_to_errno(err));
+			return -1;
+		}
+		*((int *)argp) = (int)queued;
+		LWIP_DEBUGF(SOCKETS_DEBUG, ("lwip_ioctl(%d, FIONSENDQ, %p) = %" U32_F "\n", s, argp, queued));
+		sock_set_errno(sock, 0);
+		return 0;
+	}
+#endif							/* LWIP_TCP && LWIP_SOCKET_ZEROCOPY */
+
 	case (long)FIONBIO:
 		val = 0;
 		if (argp && *(u32_t *) argp) {
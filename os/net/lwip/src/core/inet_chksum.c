@@ -27,7 +27,7 @@
  * \#define LWIP_CHKSUM your_checksum_routine
  *
  * Or you can select from the implementations below by defining
- * LWIP_CHKSUM_ALGORITHM to 1, 2 or 3.
+ * LWIP_CHKSUM_ALGORITHM to 1, 2, 3 or 4.
  */
 
 /*
@@ -269,6 +269,132 @@ u16_t lwip_standard_chksum(const void *dataptr, int len)
 }
 #endif
 
+#if (LWIP_CHKSUM_ALGORITHM == 4)	/* Alternative version #4 */
+/**
+ * Sum 32-bit words, 16 bytes per iteration.  On ARM the carries are added
+ * back with add-with-carry, elsewhere they collect in the upper half of a
+ * 64-bit accumulator and are folded once at the end.
+ *
+ * @param pl word aligned start of the words to be summed
+ * @param nwords number of words
+ * @return 32-bit one's complement sum of the words
+ */
+static u32_t lwip_chksum_words(const u32_t *pl, int nwords)
+{
+#if defined(__GNUC__) && defined(__arm__) && (defined(__ARM_ARCH_ISA_ARM) || defined(__thumb2__))
+	u32_t sum = 0;
+	u32_t w0, w1, w2, w3;
+
+	while (nwords > 3) {
+		__asm__ volatile("ldr %[w0], [%[pl]], #4\n\t"
+						 "ldr %[w1], [%[pl]], #4\n\t"
+						 "ldr %[w2], [%[pl]], #4\n\t"
+						 "ldr %[w3], [%[pl]], #4\n\t"
+						 "adds %[sum], %[sum], %[w0]\n\t"
+						 "adcs %[sum], %[sum], %[w1]\n\t"
+						 "adcs %[sum], %[sum], %[w2]\n\t"
+						 "adcs %[sum], %[sum], %[w3]\n\t"
+						 "adc %[sum], %[sum], #0"
+						 : [sum] "+r"(sum), [pl] "+r"(pl), [w0] "=&r"(w0), [w1] "=&r"(w1), [w2] "=&r"(w2), [w3] "=&r"(w3)
+						 :
+						 : "cc", "memory");
+		nwords -= 4;
+	}
+
+	while (nwords > 0) {
+		__asm__ volatile("ldr %[w0], [%[pl]], #4\n\t"
+						 "adds %[sum], %[sum], %[w0]\n\t"
+						 "adc %[sum], %[sum], #0"
+						 : [sum] "+r"(sum), [pl] "+r"(pl), [w0] "=&r"(w0)
+						 :
+						 : "cc", "memory");
+		nwords--;
+	}
+
+	return sum;
+#else
+	uint64_t acc = 0;
+
+	/* 2^32 words fit before the accumulator could overflow */
+	while (nwords > 3) {
+		acc += pl[0];
+		acc += pl[1];
+		acc += pl[2];
+		acc += pl[3];
+		pl += 4;
+		nwords -= 4;
+	}
+
+	while (nwords > 0) {
+		acc += *pl++;
+		nwords--;
+	}
+
+	acc = (acc >> 32) + (acc & 0xffffffffUL);
+	acc = (acc >> 32) + (acc & 0xffffffffUL);
+	return (u32_t) acc;
+#endif
+}
+
+/**
+ * Word-at-a-time checksum. Aligns the data to 32 bits, sums the words with
+ * lwip_chksum_words() and handles the head and tail bytes like version #3.
+ *
+ * @param dataptr points to start of data to be summed at any boundary
+ * @param len length of data to be summed
+ * @return host order (!) lwip checksum (non-inverted Internet sum)
+ */
+u16_t lwip_standard_chksum(const void *dataptr, int len)
+{
+	const u8_t *pb = (const u8_t *)dataptr;
+	const u16_t *ps;
+	u16_t t = 0;
+	u32_t sum = 0;
+	/* starts at odd byte address? */
+	int odd = ((mem_ptr_t) pb & 1);
+
+	if (odd && len > 0) {
+		((u8_t *)&t)[1] = *pb++;
+		len--;
+	}
+
+	ps = (const u16_t *)(const void *)pb;
+
+	if (((mem_ptr_t) ps & 3) && len > 1) {
+		sum += *ps++;
+		len -= 2;
+	}
+
+	if (len > 3) {
+		sum = FOLD_U32T(sum) + FOLD_U32T(lwip_chksum_words((const u32_t *)(const void *)ps, len >> 2));
+		ps += (len >> 2) * 2;
+		len &= 3;
+	}
+
+	/* 16-bit aligned word remaining? */
+	if (len > 1) {
+		sum += *ps++;
+		len -= 2;
+	}
+
+	/* dangling tail byte remaining? */
+	if (len > 0) {				/* include odd byte */
+		((u8_t *)&t)[0] = *(const u8_t *)ps;
+	}
+
+	sum += t;					/* add end bytes */
+
+	sum = FOLD_U32T(sum);
+	sum = FOLD_U32T(sum);
+
+	if (odd) {
+		sum = SWAP_BYTES_IN_WORD(sum);
+	}
+
+	return (u16_t) sum;
+}
+#endif
+
 /** Parts of the pseudo checksum which are common to IPv4 and IPv6 */
 static u16_t inet_cksum_pseudo_base(struct pbuf *p, u8_t proto, u16_t proto_len, u32_t acc)
 {
@@ -601,3 +727,77 @@ u16_t lwip_chksum_copy(void *dst, const void *src, u16_t len)
 	return LWIP_CHKSUM(dst, len);
 }
 #endif							/* (LWIP_CHKSUM_COPY_ALGORITHM == 1) */
+
+#if (LWIP_CHKSUM_COPY_ALGORITHM == 2)	/* Version #2 */
+/** Copy and sum in one pass over the data if source and destination are
+ * word aligned (the usual case for pbuf payloads), else fall back to #1.
+ */
+u16_t lwip_chksum_copy(void *dst, const void *src, u16_t len)
+{
+	const u32_t *sl = (const u32_t *)src;
+	u32_t *dl = (u32_t *)dst;
+	const u8_t *sb;
+	u8_t *db;
+	uint64_t acc = 0;
+	u32_t sum;
+	u32_t w;
+	u16_t t = 0;
+
+	if ((((mem_ptr_t) dst | (mem_ptr_t) src) & 3) != 0) {
+		MEMCPY(dst, src, len);
+		return LWIP_CHKSUM(dst, len);
+	}
+
+	while (len > 15) {
+		w = sl[0];
+		dl[0] = w;
+		acc += w;
+		w = sl[1];
+		dl[1] = w;
+		acc += w;
+		w = sl[2];
+		dl[2] = w;
+		acc += w;
+		w = sl[3];
+		dl[3] = w;
+		acc += w;
+		sl += 4;
+		dl += 4;
+		len -= 16;
+	}
+
+	while (len > 3) {
+		w = *sl++;
+		*dl++ = w;
+		acc += w;
+		len -= 4;
+	}
+
+	acc = (acc >> 32) + (acc & 0xffffffffUL);
+	acc = (acc >> 32) + (acc & 0xffffffffUL);
+	sum = FOLD_U32T((u32_t) acc);
+
+	/* at most three tail bytes, summed in host order like LWIP_CHKSUM */
+	sb = (const u8_t *)sl;
+	db = (u8_t *)dl;
+	if (len > 1) {
+		db[0] = sb[0];
+		db[1] = sb[1];
+		sum += *(const u16_t *)(const void *)sb;
+		sb += 2;
+		db += 2;
+		len -= 2;
+	}
+
+	if (len > 0) {
+		db[0] = sb[0];
+		((u8_t *)&t)[0] = sb[0];
+	}
+
+	sum += t;
+	sum = FOLD_U32T(sum);
+	sum = FOLD_U32T(sum);
+
+	return (u16_t) sum;
+}
+#endif							/* (LWIP_CHKSUM_COPY_ALGORITHM == 2) */
@@ -181,6 +181,12 @@ PACK_STRUCT_END
 #if (LWIP_TCP && TCP_LISTEN_BACKLOG && ((TCP_DEFAULT_LISTEN_BACKLOG < 0) || (TCP_DEFAULT_LISTEN_BACKLOG > 0xff)))
 #error "If you want to use TCP backlog, TCP_DEFAULT_LISTEN_BACKLOG must fit into an u8_t"
 #endif
+#if (LWIP_TCP && LWIP_TCP_SACK && !TCP_QUEUE_OOSEQ)
+#error "If you want to use TCP SACK, you have to define TCP_QUEUE_OOSEQ=1 in your lwipopts.h"
+#endif
+#if (LWIP_TCP && LWIP_TCP_TLP && !LWIP_TCP_SACK)
+#error "If you want to use TCP tail loss probes, you have to define LWIP_TCP_SACK=1 in your lwipopts.h"
+#endif
 #if (LWIP_NETIF_API && (NO_SYS == 1))
 #error "If you want to use NETIF API, you have to define NO_SYS=0 in your lwipopts.h"
 #endif
@@ -144,6 +144,18 @@ struct tcp_pcb **const tcp_pcb_lists[] = { &tcp_listen_pcbs.pcbs, &tcp_bound_pcb
 
 u8_t tcp_active_pcbs_changed;
 
+#if LWIP_TCP_PCB_HASH
+#if TCP_PCB_HASH_SIZE < 1 || (TCP_PCB_HASH_SIZE & (TCP_PCB_HASH_SIZE - 1)) != 0
+#error "TCP_PCB_HASH_SIZE must be a power of two"
+#endif
+
+/** Hash tables of tcp_listen_pcbs, tcp_active_pcbs and tcp_tw_pcbs, chained
+    through pcb->hash_next */
+static struct tcp_pcb *tcp_listen_hash[TCP_PCB_HASH_SIZE];
+static struct tcp_pcb *tcp_active_hash[TCP_PCB_HASH_SIZE];
+static struct tcp_pcb *tcp_tw_hash[TCP_PCB_HASH_SIZE];
+#endif							/* LWIP_TCP_PCB_HASH */
+
 /** Timer counter to handle calling slow-timer from tcp_tmr() */
 static u8_t tcp_timer;
 static u8_t tcp_timer_ctr;
@@ -151,6 +163,105 @@ static u16_t tcp_new_port(void);
 
 static err_t tcp_close_shutdown_fin(struct tcp_pcb *pcb);
 
+#if LWIP_TCP_PCB_HASH
+/**
+ * Get the hash table mirroring a PCB list.
+ *
+ * @param pcbs the PCB list
+ * @return the hash table or NULL if the list is not hashed
+ */
+static struct tcp_pcb **tcp_pcb_hash_table(struct tcp_pcb **pcbs)
+{
+	if (pcbs == &tcp_active_pcbs) {
+		return tcp_active_hash;
+	} else if (pcbs == &tcp_tw_pcbs) {
+		return tcp_tw_hash;
+	} else if (pcbs == &tcp_listen_pcbs.pcbs) {
+		return tcp_listen_hash;
+	}
+	/* tcp_bound_pcbs are never looked up per segment */
+	return NULL;
+}
+
+/**
+ * Calculate the bucket of a connection. Listening PCBs are hashed by local
+ * port only (remote_port 0, remote_ip NULL). The local address is not part
+ * of the key so that address changes of a netif do not move PCBs.
+ */
+static u16_t tcp_pcb_hash_index(u16_t local_port, u16_t remote_port, const ip_addr_t *remote_ip)
+{
+	u32_t h = ((u32_t)local_port << 16) | remote_port;
+
+	if (remote_ip != NULL) {
+#if LWIP_IPV4 && LWIP_IPV6
+		h ^= IP_IS_V6(remote_ip) ? ip_2_ip6(remote_ip)->addr[3] : ip_2_ip4(remote_ip)->addr;
+#elif LWIP_IPV6
+		h ^= ip_2_ip6(remote_ip)->addr[3];
+#else
+		h ^= ip_2_ip4(remote_ip)->addr;
+#endif
+	}
+	h ^= h >> 16;
+	h ^= h >> 8;
+	return (u16_t)(h & (TCP_PCB_HASH_SIZE - 1));
+}
+
+static u16_t tcp_pcb_hash_pcb_index(struct tcp_pcb **pcbs, struct tcp_pcb *pcb)
+{
+	if (pcbs == &tcp_listen_pcbs.pcbs) {
+		return tcp_pcb_hash_index(pcb->local_port, 0, NULL);
+	}
+	return tcp_pcb_hash_index(pcb->local_port, pcb->remote_port, &pcb->remote_ip);
+}
+
+/**
+ * Add a PCB to the hash table of the list it was just registered with.
+ */
+void tcp_pcb_hash_add(struct tcp_pcb **pcbs, struct tcp_pcb *pcb)
+{
+	struct tcp_pcb **table = tcp_pcb_hash_table(pcbs);
+	u16_t idx;
+
+	if (table != NULL) {
+		idx = tcp_pcb_hash_pcb_index(pcbs, pcb);
+		pcb->hash_next = table[idx];
+		table[idx] = pcb;
+	}
+}
+
+/**
+ * Remove a PCB from the hash table of the list it was just removed from.
+ * Does nothing if the PCB is not in the table.
+ */
+void tcp_pcb_hash_remove(struct tcp_pcb **pcbs, struct tcp_pcb *pcb)
+{
+	struct tcp_pcb **table = tcp_pcb_hash_table(pcbs);
+	struct tcp_pcb **link;
+
+	if (table != NULL) {
+		for (link = &table[tcp_pcb_hash_pcb_index(pcbs, pcb)]; *link != NULL; link = &(*link)->hash_next) {
+			if (*link == pcb) {
+				*link = pcb->hash_next;
+				break;
+			}
+		}
+		pcb->hash_next = NULL;
+	}
+}
+
+/**
+ * Get the first PCB of the hash chain that may hold a connection. The
+ * chain also holds other connections; callers compare the full key.
+ */
+struct tcp_pcb *tcp_pcb_hash_bucket(struct tcp_pcb **pcbs, u16_t local_port, u16_t remote_port, const ip_addr_t *remote_ip)
+{
+	struct tcp_pcb **table = tcp_pcb_hash_table(pcbs);
+
+	LWIP_ASSERT("tcp_pcb_hash_bucket: list is hashed", table != NULL);
+	return table[tcp_pcb_hash_index(local_port, remote_port, remote_ip)];
+}
+#endif							/* LWIP_TCP_PCB_HASH */
+
 /**
  * Initialize this module.
  */
@@ -1007,6 +1118,15 @@ tcp_slowtmr_start:
 					++pcb->rtime;
 				}
 
+#if LWIP_TCP_TLP
+				/* Probe for a lost tail of the flight after two smoothed
+				   round-trip times (at least two ticks), if that is before
+				   the retransmission time-out */
+				if ((pcb->flags & (TF_SACK | TF_TLP | TF_INFR)) == TF_SACK && pcb->state == ESTABLISHED && pcb->nrtx == 0 && pcb->unacked != NULL && pcb->unsent == NULL && pcb->rtime >= LWIP_MAX(2 * (pcb->sa >> 3), 2) && pcb->rtime < pcb->rto) {
+					tcp_rexmit_tlp(pcb);
+				}
+#endif							/* LWIP_TCP_TLP */
+
 				if (pcb->unacked != NULL && pcb->rtime >= pcb->rto) {
 					/* Time for a retransmission. */
 					LWIP_DEBUGF(TCP_RTO_DEBUG, ("tcp_slowtmr: rtime %" S16_F " pcb->rto %" S16_F "\n", pcb->rtime, pcb->rto));
@@ -1104,6 +1224,7 @@ tcp_slowtmr_start:
 			enum tcp_state last_state;
 			tcp_pcb_purge(pcb);
 			/* Remove PCB from tcp_active_pcbs list. */
+			TCP_HASH_RMV(&tcp_active_pcbs, pcb);
 			if (prev != NULL) {
 				LWIP_ASSERT("tcp_slowtmr: middle tcp != tcp_active_pcbs", pcb != tcp_active_pcbs);
 				prev->next = pcb->next;
@@ -1168,6 +1289,7 @@ tcp_slowtmr_start:
 			struct tcp_pcb *pcb2;
 			tcp_pcb_purge(pcb);
 			/* Remove PCB from tcp_tw_pcbs list. */
+			TCP_HASH_RMV(&tcp_tw_pcbs, pcb);
 			if (prev != NULL) {
 				LWIP_ASSERT("tcp_slowtmr: middle tcp != tcp_tw_pcbs", pcb != tcp_tw_pcbs);
 				prev->next = pcb->next;
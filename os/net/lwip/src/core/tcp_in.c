@@ -99,12 +99,21 @@ static u8_t flags;
 static u8_t recv_flags;
 static struct pbuf *recv_data;
 
+#if LWIP_TCP_SACK
+/* SACK blocks (left and right edges, host order) of the current segment */
+static u32_t tcp_sack_edges[2 * LWIP_TCP_SACK_MAX_BLOCKS];
+static u8_t tcp_sack_nblocks;
+#endif							/* LWIP_TCP_SACK */
+
 struct tcp_pcb *tcp_input_pcb;
 
 /* Forward declarations. */
 static err_t tcp_process(struct tcp_pcb *pcb);
 static void tcp_receive(struct tcp_pcb *pcb);
 static void tcp_parseopt(struct tcp_pcb *pcb);
+#if LWIP_TCP_SACK
+static u8_t tcp_sack_update(struct tcp_pcb *pcb);
+#endif
 
 static void tcp_listen_input(struct tcp_pcb_listen *pcb);
 static void tcp_timewait_input(struct tcp_pcb *pcb);
@@ -236,11 +245,16 @@ void tcp_input(struct pbuf *p, struct netif *inp)
 	   for an active connection. */
 	prev = NULL;
 
+#if LWIP_TCP_PCB_HASH
+	for (pcb = tcp_pcb_hash_bucket(&tcp_active_pcbs, tcphdr->dest, tcphdr->src, ip_current_src_addr()); pcb != NULL; pcb = pcb->hash_next) {
+#else
 	for (pcb = tcp_active_pcbs; pcb != NULL; pcb = pcb->next) {
+#endif
 		LWIP_ASSERT("tcp_input: active pcb->state != CLOSED", pcb->state != CLOSED);
 		LWIP_ASSERT("tcp_input: active pcb->state != TIME-WAIT", pcb->state != TIME_WAIT);
 		LWIP_ASSERT("tcp_input: active pcb->state != LISTEN", pcb->state != LISTEN);
 		if (pcb->remote_port == tcphdr->src && pcb->local_port == tcphdr->dest && ip_addr_cmp(&pcb->remote_ip, ip_current_src_addr()) && ip_addr_cmp(&pcb->local_ip, ip_current_dest_addr())) {
+#if !LWIP_TCP_PCB_HASH
 			/* Move this PCB to the front of the list so that subsequent
 			   lookups will be faster (we exploit locality in TCP segment
 			   arrivals). */
@@ -253,6 +267,7 @@ void tcp_input(struct pbuf *p, struct netif *inp)
 				TCP_STATS_INC(tcp.cachehit);
 			}
 			LWIP_ASSERT("tcp_input: pcb->next != pcb (after cache)", pcb->next != pcb);
+#endif							/* !LWIP_TCP_PCB_HASH */
 			break;
 		}
 		prev = pcb;
@@ -261,7 +276,11 @@ void tcp_input(struct pbuf *p, struct netif *inp)
 	if (pcb == NULL) {
 		/* If it did not go to an active connection, we check the connections
 		   in the TIME-WAIT state. */
+#if LWIP_TCP_PCB_HASH
+		for (pcb = tcp_pcb_hash_bucket(&tcp_tw_pcbs, tcphdr->dest, tcphdr->src, ip_current_src_addr()); pcb != NULL; pcb = pcb->hash_next) {
+#else
 		for (pcb = tcp_tw_pcbs; pcb != NULL; pcb = pcb->next) {
+#endif
 			LWIP_ASSERT("tcp_input: TIME-WAIT pcb->state == TIME-WAIT", pcb->state == TIME_WAIT);
 			if (pcb->remote_port == tcphdr->src && pcb->local_port == tcphdr->dest && ip_addr_cmp(&pcb->remote_ip, ip_current_src_addr()) && ip_addr_cmp(&pcb->local_ip, ip_current_dest_addr())) {
 				/* We don't really care enough to move this PCB to the front
@@ -277,7 +296,11 @@ void tcp_input(struct pbuf *p, struct netif *inp)
 		/* Finally, if we still did not get a match, we check all PCBs that
 		   are LISTENing for incoming connections. */
 		prev = NULL;
+#if LWIP_TCP_PCB_HASH
+		for (lpcb = (struct tcp_pcb_listen *)tcp_pcb_hash_bucket(&tcp_listen_pcbs.pcbs, tcphdr->dest, 0, NULL); lpcb != NULL; lpcb = lpcb->hash_next) {
+#else
 		for (lpcb = tcp_listen_pcbs.listen_pcbs; lpcb != NULL; lpcb = lpcb->next) {
+#endif
 			if (lpcb->local_port == tcphdr->dest) {
 				if (IP_IS_ANY_TYPE_VAL(lpcb->local_ip)) {
 					/* found an ANY TYPE (IPv4/IPv6) match */
@@ -313,6 +336,7 @@ void tcp_input(struct pbuf *p, struct netif *inp)
 		}
 #endif							/* SO_REUSE */
 		if (lpcb != NULL) {
+#if !LWIP_TCP_PCB_HASH
 			/* Move this PCB to the front of the list so that subsequent
 			   lookups will be faster (we exploit locality in TCP segment
 			   arrivals). */
@@ -325,6 +349,9 @@ void tcp_input(struct pbuf *p, struct netif *inp)
 			} else {
 				TCP_STATS_INC(tcp.cachehit);
 			}
+#else							/* !LWIP_TCP_PCB_HASH */
+			LWIP_UNUSED_ARG(prev);
+#endif							/* !LWIP_TCP_PCB_HASH */
 
 			LWIP_DEBUGF(TCP_INPUT_DEBUG, ("tcp_input: packed for LISTENing connection.\n"));
 			tcp_listen_input(lpcb);
@@ -988,6 +1015,10 @@ static void tcp_receive(struct tcp_pcb *pcb)
 	u32_t right_wnd_edge;
 	u16_t new_tot_len;
 	int found_dupack = 0;
+#if LWIP_TCP_SACK
+	u8_t sacked = 0;
+	u8_t partial_ack = 0;
+#endif							/* LWIP_TCP_SACK */
 #if TCP_OOSEQ_MAX_BYTES || TCP_OOSEQ_MAX_PBUFS
 	u32_t ooseq_blen;
 	u16_t ooseq_qlen;
@@ -1027,6 +1058,12 @@ static void tcp_receive(struct tcp_pcb *pcb)
 #endif							/* TCP_WND_DEBUG */
 		}
 
+#if LWIP_TCP_SACK
+		if (pcb->flags & TF_SACK) {
+			sacked = tcp_sack_update(pcb);
+		}
+#endif							/* LWIP_TCP_SACK */
+
 		/* (From Stevens TCP/IP Illustrated Vol II, p970.) Its only a
 		 * duplicate ack if:
 		 * 1) It doesn't ACK new data
@@ -1061,16 +1098,29 @@ static void tcp_receive(struct tcp_pcb *pcb)
 							if ((u8_t)(pcb->dupacks + 1) > pcb->dupacks) {
 								++pcb->dupacks;
 							}
-							if (pcb->dupacks > 3) {
+							if (pcb->dupacks > 3 || (pcb->flags & TF_INFR)) {
 								/* Inflate the congestion window, but not if it means that
-								   the value overflows. */
+								   the value overflows. A partial ACK resets dupacks, but
+								   each further dupack in fast recovery still inflates it. */
 								if ((tcpwnd_size_t)(pcb->cwnd + pcb->mss) > pcb->cwnd) {
 									pcb->cwnd += pcb->mss;
 								}
+#if LWIP_TCP_SACK
+								if (sacked && (pcb->flags & TF_INFR)) {
+									/* Fill the next hole reported by the remote host */
+									tcp_rexmit_sack(pcb);
+								}
+#endif							/* LWIP_TCP_SACK */
 							} else if (pcb->dupacks == 3) {
 								/* Do fast retransmit */
 								tcp_rexmit_fast(pcb);
 							}
+#if LWIP_TCP_TLP
+							else if (sacked && (pcb->flags & TF_TLP)) {
+								/* The tail loss probe arrived but data before it did not */
+								tcp_rexmit_fast(pcb);
+							}
+#endif							/* LWIP_TCP_TLP */
 						}
 					}
 				}
@@ -1087,9 +1137,33 @@ static void tcp_receive(struct tcp_pcb *pcb)
 			   in fast retransmit. Also reset the congestion window to the
 			   slow start threshold. */
 			if (pcb->flags & TF_INFR) {
-				pcb->flags &= ~TF_INFR;
-				pcb->cwnd = pcb->ssthresh;
+#if LWIP_TCP_SACK
+				if ((pcb->flags & TF_SACK) && TCP_SEQ_LT(ackno, pcb->sack_recover)) {
+					tcpwnd_size_t acked = (tcpwnd_size_t)(ackno - pcb->lastack);
+
+					/* Partial ACK: stay in fast recovery and retransmit the
+					   next hole once the ACKed segments are removed. Deflate
+					   the congestion window by the newly ACKed data and add
+					   back one segment (RFC 6582, section 3.2 step 5). */
+					partial_ack = 1;
+					pcb->cwnd = (pcb->cwnd > acked) ? (tcpwnd_size_t)(pcb->cwnd - acked) : 0;
+					if (acked >= pcb->mss) {
+						pcb->cwnd += pcb->mss;
+					}
+					if (pcb->cwnd < pcb->mss) {
+						pcb->cwnd = pcb->mss;
+					}
+				} else
+#endif							/* LWIP_TCP_SACK */
+				{
+					pcb->flags &= ~TF_INFR;
+					pcb->cwnd = pcb->ssthresh;
+				}
 			}
+#if LWIP_TCP_TLP
+			/* New data was ACKed, the next flight may be probed again */
+			pcb->flags &= ~TF_TLP;
+#endif							/* LWIP_TCP_TLP */
 
 			/* Reset the number of retransmissions. */
 			pcb->nrtx = 0;
@@ -1102,8 +1176,8 @@ static void tcp_receive(struct tcp_pcb *pcb)
 			pcb->lastack = ackno;
 
 			/* Update the congestion control variables (cwnd and
-			   ssthresh). */
-			if (pcb->state >= ESTABLISHED) {
+			   ssthresh). The window does not grow during fast recovery. */
+			if (pcb->state >= ESTABLISHED && !(pcb->flags & TF_INFR)) {
 				if (pcb->cwnd < pcb->ssthresh) {
 					if ((tcpwnd_size_t)(pcb->cwnd + pcb->mss) > pcb->cwnd) {
 						pcb->cwnd += pcb->mss;
@@ -1150,6 +1224,12 @@ static void tcp_receive(struct tcp_pcb *pcb)
 
 			pcb->polltmr = 0;
 
+#if LWIP_TCP_SACK
+			if (partial_ack) {
+				tcp_rexmit_sack(pcb);
+			}
+#endif							/* LWIP_TCP_SACK */
+
 #if LWIP_IPV6 && LWIP_ND6_TCP_REACHABILITY_HINTS
 			if (ip_current_is_v6()) {
 				/* Inform neighbor reachability of forward progress. */
@@ -1463,7 +1543,14 @@ static void tcp_receive(struct tcp_pcb *pcb)
 
 			} else {
 				/* We get here if the incoming segment is out-of-sequence. */
+#if LWIP_TCP_SACK
+				/* Let tcp_input() send the ACK once the segment is queued, so
+				   that the SACK option reports it, too. */
+				pcb->rcv_sack_recent = seqno;
+				tcp_ack_now(pcb);
+#else							/* LWIP_TCP_SACK */
 				tcp_send_empty_ack(pcb);
+#endif							/* LWIP_TCP_SACK */
 #if TCP_QUEUE_OOSEQ
 				/* We queue the segment on the ->ooseq queue. */
 				if (pcb->ooseq == NULL) {
@@ -1630,6 +1717,20 @@ static u8_t tcp_getoptbyte(void)
 	}
 }
 
+#if LWIP_TCP_SACK
+/* Read a 32 bit option field in network byte order */
+static u32_t tcp_getopt32(void)
+{
+	u32_t val;
+
+	val = (u32_t) tcp_getoptbyte() << 24;
+	val |= (u32_t) tcp_getoptbyte() << 16;
+	val |= (u32_t) tcp_getoptbyte() << 8;
+	val |= tcp_getoptbyte();
+	return val;
+}
+#endif							/* LWIP_TCP_SACK */
+
 /**
  * Parses the options contained in the incoming segment.
  *
@@ -1645,6 +1746,11 @@ static void tcp_parseopt(struct tcp_pcb *pcb)
 #if LWIP_TCP_TIMESTAMPS
 	u32_t tsval;
 #endif
+#if LWIP_TCP_SACK
+	u32_t left, right;
+
+	tcp_sack_nblocks = 0;
+#endif
 
 	/* Parse the TCP MSS option, if present. */
 	if (tcphdr_optlen != 0) {
@@ -1722,6 +1828,39 @@ static void tcp_parseopt(struct tcp_pcb *pcb)
 				/* Advance to next option (6 bytes already read) */
 				tcp_optidx += LWIP_TCP_OPT_LEN_TS - 6;
 				break;
+#endif
+#if LWIP_TCP_SACK
+			case LWIP_TCP_OPT_SACK_PERM:
+				LWIP_DEBUGF(TCP_INPUT_DEBUG, ("tcp_parseopt: SACK_PERM\n"));
+				if (tcp_getoptbyte() != LWIP_TCP_OPT_LEN_SACK_PERM || (tcp_optidx - 2 + LWIP_TCP_OPT_LEN_SACK_PERM) > tcphdr_optlen) {
+					/* Bad length */
+					LWIP_DEBUGF(TCP_INPUT_DEBUG, ("tcp_parseopt: bad length\n"));
+					return;
+				}
+				/* Only valid in a SYN: enable SACK for this connection */
+				if (flags & TCP_SYN) {
+					pcb->flags |= TF_SACK;
+				}
+				break;
+			case LWIP_TCP_OPT_SACK:
+				LWIP_DEBUGF(TCP_INPUT_DEBUG, ("tcp_parseopt: SACK\n"));
+				data = tcp_getoptbyte();
+				if (data < 10 || ((data - 2) % 8) != 0 || (tcp_optidx - 2 + data) > tcphdr_optlen) {
+					/* Bad length */
+					LWIP_DEBUGF(TCP_INPUT_DEBUG, ("tcp_parseopt: bad length\n"));
+					return;
+				}
+				/* Blocks are only used if SACK was negotiated */
+				for (data = (data - 2) / 8; data > 0; data--) {
+					left = tcp_getopt32();
+					right = tcp_getopt32();
+					if ((pcb->flags & TF_SACK) && tcp_sack_nblocks < LWIP_TCP_SACK_MAX_BLOCKS) {
+						tcp_sack_edges[2 * tcp_sack_nblocks] = left;
+						tcp_sack_edges[2 * tcp_sack_nblocks + 1] = right;
+						tcp_sack_nblocks++;
+					}
+				}
+				break;
 #endif
 			default:
 				LWIP_DEBUGF(TCP_INPUT_DEBUG, ("tcp_parseopt: other\n"));
@@ -1740,6 +1879,52 @@ static void tcp_parseopt(struct tcp_pcb *pcb)
 	}
 }
 
+#if LWIP_TCP_SACK
+/**
+ * Update the SACK scoreboard from the blocks of the incoming segment.
+ *
+ * Unacked segments covered by a block are marked TF_SEG_SACKED, and
+ * pcb->sack_high follows the right edge of the highest block.
+ *
+ * @param pcb the tcp_pcb for which a segment arrived
+ * @return 1 if the blocks reported data that was not SACKed before
+ */
+static u8_t tcp_sack_update(struct tcp_pcb *pcb)
+{
+	struct tcp_seg *seg;
+	u32_t left, right, segno;
+	u8_t sacked = 0;
+	u8_t i;
+
+	if (!TCP_SEQ_BETWEEN(pcb->sack_high, pcb->lastack, pcb->snd_nxt)) {
+		pcb->sack_high = pcb->lastack;
+	}
+
+	for (i = 0; i < tcp_sack_nblocks; i++) {
+		left = tcp_sack_edges[2 * i];
+		right = tcp_sack_edges[2 * i + 1];
+		/* Ignore bogus blocks and blocks below the cumulative ACK (D-SACK) */
+		if (!TCP_SEQ_LT(left, right) || TCP_SEQ_LEQ(right, ackno) || TCP_SEQ_GT(right, pcb->snd_nxt)) {
+			continue;
+		}
+		for (seg = pcb->unacked; seg != NULL; seg = seg->next) {
+			segno = lwip_ntohl(seg->tcphdr->seqno);
+			if (TCP_SEQ_GEQ(segno, right)) {
+				break;
+			}
+			if (!(seg->flags & TF_SEG_SACKED) && TCP_SEQ_GEQ(segno, left) && TCP_SEQ_LEQ(segno + TCP_TCPLEN(seg), right)) {
+				seg->flags |= TF_SEG_SACKED;
+				sacked = 1;
+			}
+		}
+		if (TCP_SEQ_GT(right, pcb->sack_high)) {
+			pcb->sack_high = right;
+		}
+	}
+	return sacked;
+}
+#endif							/* LWIP_TCP_SACK */
+
 void tcp_trigger_input_pcb_close(void)
 {
 	recv_flags |= TF_CLOSED;
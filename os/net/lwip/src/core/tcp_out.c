@@ -781,6 +781,12 @@ err_t tcp_enqueue_flags(struct tcp_pcb *pcb, u8_t flags)
 			optflags |= TF_SEG_OPTS_WND_SCALE;
 		}
 #endif							/* LWIP_WND_SCALE */
+#if LWIP_TCP_SACK
+		if ((pcb->state != SYN_RCVD) || (pcb->flags & TF_SACK)) {
+			/* Same as window scaling: only answer a SACK permitted option */
+			optflags |= TF_SEG_OPTS_SACK_PERM;
+		}
+#endif							/* LWIP_TCP_SACK */
 	}
 #if LWIP_TCP_TIMESTAMPS
 	if ((pcb->flags & TF_TIMESTAMP)) {
@@ -869,6 +875,76 @@ static void tcp_build_wnd_scale_option(u32_t *opts)
 }
 #endif
 
+#if LWIP_TCP_SACK
+/** Build a SACK permitted option (2 bytes long) at the specified options pointer
+ *
+ * @param opts option pointer where to store the SACK permitted option
+ */
+static void tcp_build_sack_perm_option(u32_t *opts)
+{
+	/* Pad with two NOP options to make everything nicely aligned */
+	opts[0] = PP_HTONL(0x01010402);
+}
+
+/** Collect the SACK blocks describing the out-of-sequence queue
+ *
+ * Adjacent segments are merged into one block. The block holding the most
+ * recently received segment comes first as RFC 2018 requires, the others
+ * follow in sequence order.
+ *
+ * @param pcb tcp_pcb
+ * @param blocks receives the left and right edge of each block (host order)
+ * @param max maximum number of blocks to collect
+ * @return number of blocks collected
+ */
+static u8_t tcp_sack_collect(struct tcp_pcb *pcb, u32_t *blocks, u8_t max)
+{
+	struct tcp_seg *seg;
+	u32_t left, right;
+	u8_t recent, pass;
+	u8_t n = 0;
+
+	if (!(pcb->flags & TF_SACK)) {
+		return 0;
+	}
+
+	for (pass = 0; pass < 2; pass++) {
+		seg = pcb->ooseq;
+		while (seg != NULL && n < max) {
+			left = seg->tcphdr->seqno;
+			right = left + TCP_TCPLEN(seg);
+			for (seg = seg->next; seg != NULL && seg->tcphdr->seqno == right; seg = seg->next) {
+				right += TCP_TCPLEN(seg);
+			}
+			recent = TCP_SEQ_BETWEEN(pcb->rcv_sack_recent, left, right - 1);
+			if (recent == (pass == 0)) {
+				blocks[2 * n] = left;
+				blocks[2 * n + 1] = right;
+				n++;
+			}
+		}
+	}
+	return n;
+}
+
+/** Build a SACK option (4 + 8 * n bytes long including padding)
+ *
+ * @param opts option pointer where to store the SACK option
+ * @param blocks left and right edges of the blocks (host order)
+ * @param n number of blocks
+ */
+static void tcp_build_sack_option(u32_t *opts, const u32_t *blocks, u8_t n)
+{
+	u8_t i;
+
+	/* Pad with two NOP options to make everything nicely aligned */
+	opts[0] = lwip_htonl(0x01010500 | (2 + 8 * n));
+	for (i = 0; i < 2 * n; i++) {
+		opts[i + 1] = lwip_htonl(blocks[i]);
+	}
+}
+#endif							/* LWIP_TCP_SACK */
+
 /**
  * Send an ACK without data.
  *
@@ -880,15 +956,26 @@ err_t tcp_send_empty_ack(struct tcp_pcb *pcb)
 	struct pbuf *p;
 	u8_t optlen = 0;
 	struct netif *netif;
-#if LWIP_TCP_TIMESTAMPS || CHECKSUM_GEN_TCP
+#if LWIP_TCP_TIMESTAMPS || CHECKSUM_GEN_TCP || LWIP_TCP_SACK
 	struct tcp_hdr *tcphdr;
-#endif							/* LWIP_TCP_TIMESTAMPS || CHECKSUM_GEN_TCP */
+#endif							/* LWIP_TCP_TIMESTAMPS || CHECKSUM_GEN_TCP || LWIP_TCP_SACK */
+#if LWIP_TCP_SACK
+	u32_t sack[2 * LWIP_TCP_SACK_MAX_BLOCKS];
+	u8_t nsack;
+#endif							/* LWIP_TCP_SACK */
 
 #if LWIP_TCP_TIMESTAMPS
 	if (pcb->flags & TF_TIMESTAMP) {
 		optlen = LWIP_TCP_OPT_LENGTH(TF_SEG_OPTS_TS);
 	}
 #endif
+#if LWIP_TCP_SACK
+	/* Report out-of-sequence data in the remaining option space */
+	nsack = tcp_sack_collect(pcb, sack, (u8_t)LWIP_MIN(LWIP_TCP_SACK_MAX_BLOCKS, (40 - optlen - 4) / 8));
+	if (nsack > 0) {
+		optlen += LWIP_TCP_OPT_LEN_SACK_OUT(nsack);
+	}
+#endif
 
 	p = tcp_output_alloc_header(pcb, optlen, 0, lwip_htonl(pcb->snd_nxt));
 	if (p == NULL) {
@@ -897,9 +984,9 @@ err_t tcp_send_empty_ack(struct tcp_pcb *pcb)
 		LWIP_DEBUGF(TCP_OUTPUT_DEBUG, ("tcp_output: (ACK) could not allocate pbuf\n"));
 		return ERR_BUF;
 	}
-#if LWIP_TCP_TIMESTAMPS || CHECKSUM_GEN_TCP
+#if LWIP_TCP_TIMESTAMPS || CHECKSUM_GEN_TCP || LWIP_TCP_SACK
 	tcphdr = (struct tcp_hdr *)p->payload;
-#endif							/* LWIP_TCP_TIMESTAMPS || CHECKSUM_GEN_TCP */
+#endif							/* LWIP_TCP_TIMESTAMPS || CHECKSUM_GEN_TCP || LWIP_TCP_SACK */
 	LWIP_DEBUGF(TCP_OUTPUT_DEBUG, ("tcp_output: sending ACK for %" U32_F "\n", pcb->rcv_nxt));
 
 	/* NB. MSS option is only sent on SYNs, so ignore it here */
@@ -910,6 +997,12 @@ err_t tcp_send_empty_ack(struct tcp_pcb *pcb)
 		tcp_build_timestamp_option(pcb, (u32_t *)(tcphdr + 1));
 	}
 #endif
+#if LWIP_TCP_SACK
+	if (nsack > 0) {
+		/* The SACK option follows the timestamp option, if any */
+		tcp_build_sack_option((u32_t *)(tcphdr + 1) + (optlen - LWIP_TCP_OPT_LEN_SACK_OUT(nsack)) / 4, sack, nsack);
+	}
+#endif
 
 	netif = ip_route(&pcb->local_ip, &pcb->remote_ip);
 	if (netif == NULL) {
@@ -1173,6 +1266,12 @@ static err_t tcp_output_segment(struct tcp_seg *seg, struct tcp_pcb *pcb, struct
 		opts += 1;
 	}
 #endif
+#if LWIP_TCP_SACK
+	if (seg->flags & TF_SEG_OPTS_SACK_PERM) {
+		tcp_build_sack_perm_option(opts);
+		opts += 1;
+	}
+#endif
 
 	/* Set retransmission timer running if it is not currently enabled
 	   This must be set before checking the route. */
@@ -1318,6 +1417,21 @@ void tcp_rexmit_rto(struct tcp_pcb *pcb)
 		return;
 	}
 
+#if LWIP_TCP_SACK
+	/* The remote host may discard data it has SACKed (RFC 2018), so
+	   forget the scoreboard and leave fast recovery */
+	for (seg = pcb->unacked; seg != NULL; seg = seg->next) {
+		seg->flags &= ~(TF_SEG_SACKED | TF_SEG_SACK_REXMIT);
+	}
+	pcb->sack_high = pcb->lastack;
+	if (pcb->flags & TF_SACK) {
+		pcb->flags &= ~TF_INFR;
+	}
+#endif							/* LWIP_TCP_SACK */
+#if LWIP_TCP_TLP
+	pcb->flags &= ~TF_TLP;
+#endif
+
 	/* Move all unacked segments to the head of the unsent queue */
 	for (seg = pcb->unacked; seg->next != NULL; seg = seg->next) ;
 	/* concatenate unsent queue after unacked queue */
@@ -1402,7 +1516,23 @@ void tcp_rexmit_fast(struct tcp_pcb *pcb)
 	if (pcb->unacked != NULL && !(pcb->flags & TF_INFR)) {
 		/* This is fast retransmit. Retransmit the first unacked segment. */
 		LWIP_DEBUGF(TCP_FR_DEBUG, ("tcp_receive: dupacks %" U16_F " (%" U32_F "), fast retransmit %" U32_F "\n", (u16_t) pcb->dupacks, pcb->lastack, lwip_ntohl(pcb->unacked->tcphdr->seqno)));
-		tcp_rexmit(pcb);
+#if LWIP_TCP_SACK
+		if (pcb->flags & TF_SACK) {
+			struct tcp_seg *seg;
+
+			/* Start a new recovery: nothing retransmitted in it yet */
+			for (seg = pcb->unacked; seg != NULL; seg = seg->next) {
+				seg->flags &= ~TF_SEG_SACK_REXMIT;
+			}
+			pcb->sack_recover = pcb->snd_nxt;
+			if (!tcp_rexmit_sack(pcb)) {
+				tcp_rexmit(pcb);
+			}
+		} else
+#endif							/* LWIP_TCP_SACK */
+		{
+			tcp_rexmit(pcb);
+		}
 
 		/* Set ssthresh to half of the minimum of the current
 		 * cwnd and the advertised window */
@@ -1422,6 +1552,111 @@ void tcp_rexmit_fast(struct tcp_pcb *pcb)
 	}
 }
 
+#if LWIP_TCP_SACK
+/**
+ * Requeue the next hole of the SACK scoreboard for retransmission
+ *
+ * Called by tcp_receive() during fast recovery on connections using SACK.
+ * A hole is an unacked segment that the remote host has not SACKed and
+ * that lies below the highest SACKed sequence number; the first unacked
+ * segment always counts as a hole. Each hole is retransmitted once per
+ * recovery.
+ *
+ * @param pcb the tcp_pcb for which to retransmit the next hole
+ * @return 1 if a segment was requeued, 0 if there is no hole
+ */
+u8_t tcp_rexmit_sack(struct tcp_pcb *pcb)
+{
+	struct tcp_seg *seg;
+	struct tcp_seg **pseg;
+	struct tcp_seg **cur_seg;
+
+	for (pseg = &pcb->unacked; *pseg != NULL; pseg = &((*pseg)->next)) {
+		seg = *pseg;
+		if (seg != pcb->unacked && !TCP_SEQ_LT(lwip_ntohl(seg->tcphdr->seqno), pcb->sack_high)) {
+			/* nothing above this segment was SACKed: not known to be lost */
+			return 0;
+		}
+		if ((seg->flags & (TF_SEG_SACKED | TF_SEG_SACK_REXMIT)) == 0) {
+			break;
+		}
+	}
+	if (*pseg == NULL) {
+		return 0;
+	}
+
+	/* Move the hole to the unsent queue, keeping it sorted */
+	seg = *pseg;
+	*pseg = seg->next;
+	seg->flags |= TF_SEG_SACK_REXMIT;
+
+	cur_seg = &(pcb->unsent);
+	while (*cur_seg && TCP_SEQ_LT(lwip_ntohl((*cur_seg)->tcphdr->seqno), lwip_ntohl(seg->tcphdr->seqno))) {
+		cur_seg = &((*cur_seg)->next);
+	}
+	seg->next = *cur_seg;
+	*cur_seg = seg;
+#if TCP_OVERSIZE
+	if (seg->next == NULL) {
+		/* the retransmitted segment is last in unsent, so reset unsent_oversize */
+		pcb->unsent_oversize = 0;
+	}
+#endif							/* TCP_OVERSIZE */
+
+	LWIP_DEBUGF(TCP_FR_DEBUG, ("tcp_rexmit_sack: retransmit %" U32_F " (sack_high %" U32_F ")\n", lwip_ntohl(seg->tcphdr->seqno), pcb->sack_high));
+
+	if (pcb->nrtx < 0xFF) {
+		++pcb->nrtx;
+	}
+
+	/* Don't take any rtt measurements after retransmitting. */
+	pcb->rttest = 0;
+
+	MIB2_STATS_INC(mib2.tcpretranssegs);
+	/* tcp_output is called by tcp_input() when input processing is done */
+	return 1;
+}
+#endif							/* LWIP_TCP_SACK */
+
+#if LWIP_TCP_TLP
+/**
+ * Send a tail loss probe: retransmit the last unacked segment
+ *
+ * Called by tcp_slowtmr() when the connection has been waiting for an ACK
+ * for about two round-trip times. If the segments before the probe were
+ * lost, the SACK in the reply to the probe starts fast recovery.
+ *
+ * @param pcb the tcp_pcb for which to send the probe
+ */
+void tcp_rexmit_tlp(struct tcp_pcb *pcb)
+{
+	struct tcp_seg *seg;
+	struct netif *netif;
+
+	if (pcb->unacked == NULL) {
+		return;
+	}
+
+	netif = ip_route(&pcb->local_ip, &pcb->remote_ip);
+	if (netif == NULL) {
+		return;
+	}
+
+	for (seg = pcb->unacked; seg->next != NULL; seg = seg->next) ;
+
+	LWIP_DEBUGF(TCP_FR_DEBUG, ("tcp_rexmit_tlp: probe %" U32_F "\n", lwip_ntohl(seg->tcphdr->seqno)));
+
+	/* Don't take any rtt measurements after retransmitting. */
+	pcb->rttest = 0;
+
+	/* The segment stays on the unacked queue; only one probe per flight */
+	if (tcp_output_segment(seg, pcb, netif) == ERR_OK) {
+		pcb->flags |= TF_TLP;
+		MIB2_STATS_INC(mib2.tcpretranssegs);
+	}
+}
+#endif							/* LWIP_TCP_TLP */
+
 /**
  * Send keepalive packets to keep a connection active although
  * no data is sent over it.
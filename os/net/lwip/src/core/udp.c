@@ -97,6 +97,24 @@ static u16_t udp_port = UDP_LOCAL_PORT_RANGE_START;
 /* exported in udp.h (was static) */
 struct udp_pcb *udp_pcbs = NULL;
 
+#if LWIP_UDP_PCB_HASH
+#if UDP_PCB_HASH_SIZE < 1 || (UDP_PCB_HASH_SIZE & (UDP_PCB_HASH_SIZE - 1)) != 0
+#error "UDP_PCB_HASH_SIZE must be a power of two"
+#endif
+
+/* udp_pcbs hashed by local port, chained through pcb->hash_next */
+static struct udp_pcb *udp_hash[UDP_PCB_HASH_SIZE];
+
+#define UDP_HASH_INDEX(port) (((port) ^ ((port) >> 8)) & (UDP_PCB_HASH_SIZE - 1))
+
+/* First PCB of the chain holding the PCBs bound to 'port' (and others) */
+#define UDP_HASH_FIRST(port) udp_hash[UDP_HASH_INDEX(port)]
+#define UDP_HASH_NEXT(pcb)   ((pcb)->hash_next)
+#else
+#define UDP_HASH_FIRST(port) udp_pcbs
+#define UDP_HASH_NEXT(pcb)   ((pcb)->next)
+#endif							/* LWIP_UDP_PCB_HASH */
+
 /**
  * Initialize this module.
  */
@@ -107,6 +125,36 @@ void udp_init(void)
 #endif							/* LWIP_RANDOMIZE_INITIAL_LOCAL_PORTS && defined(LWIP_RAND) */
 }
 
+#if LWIP_UDP_PCB_HASH
+/**
+ * Add a PCB on udp_pcbs to the hash table.
+ */
+static void udp_hash_add(struct udp_pcb *pcb)
+{
+	u16_t idx = UDP_HASH_INDEX(pcb->local_port);
+
+	pcb->hash_next = udp_hash[idx];
+	udp_hash[idx] = pcb;
+}
+
+/**
+ * Remove a PCB from the hash table. Must be called before the local port
+ * of the PCB changes. Does nothing if the PCB is not in the table.
+ */
+static void udp_hash_remove(struct udp_pcb *pcb)
+{
+	struct udp_pcb **link;
+
+	for (link = &udp_hash[UDP_HASH_INDEX(pcb->local_port)]; *link != NULL; link = &(*link)->hash_next) {
+		if (*link == pcb) {
+			*link = pcb->hash_next;
+			break;
+		}
+	}
+	pcb->hash_next = NULL;
+}
+#endif							/* LWIP_UDP_PCB_HASH */
+
 /**
  * Allocate a new local UDP port.
  *
@@ -122,7 +170,7 @@ again:
 		udp_port = UDP_LOCAL_PORT_RANGE_START;
 	}
 	/* Check all PCBs. */
-	for (pcb = udp_pcbs; pcb != NULL; pcb = pcb->next) {
+	for (pcb = UDP_HASH_FIRST(udp_port); pcb != NULL; pcb = UDP_HASH_NEXT(pcb)) {
 		if (pcb->local_port == udp_port) {
 			if (++n > (UDP_LOCAL_PORT_RANGE_END - UDP_LOCAL_PORT_RANGE_START)) {
 				return 0;
@@ -246,7 +294,7 @@ void udp_input(struct pbuf *p, struct netif *inp)
 	 * 'Perfect match' pcbs (connected to the remote port & ip address) are
 	 * preferred. If no perfect match is found, the first unconnected pcb that
 	 * matches the local port and ip address gets the datagram. */
-	for (pcb = udp_pcbs; pcb != NULL; pcb = pcb->next) {
+	for (pcb = UDP_HASH_FIRST(dest); pcb != NULL; pcb = UDP_HASH_NEXT(pcb)) {
 		/* print the PCB local and remote address */
 		LWIP_DEBUGF(UDP_DEBUG, ("pcb ("));
 		ip_addr_debug_print(UDP_DEBUG, &pcb->local_ip);
@@ -269,6 +317,7 @@ void udp_input(struct pbuf *p, struct netif *inp)
 			/* compare PCB remote addr+port to UDP source addr+port */
 			if ((pcb->remote_port == src) && (ip_addr_isany_val(pcb->remote_ip) || ip_addr_cmp(&pcb->remote_ip, ip_current_src_addr()))) {
 				/* the first fully matching PCB */
+#if !LWIP_UDP_PCB_HASH
 				if (prev != NULL) {
 					/* move the pcb to the front of udp_pcbs so that is
 					   found faster next time */
@@ -278,12 +327,16 @@ void udp_input(struct pbuf *p, struct netif *inp)
 				} else {
 					UDP_STATS_INC(udp.cachehit);
 				}
+#endif							/* !LWIP_UDP_PCB_HASH */
 				break;
 			}
 		}
 
 		prev = pcb;
 	}
+#if LWIP_UDP_PCB_HASH
+	LWIP_UNUSED_ARG(prev);
+#endif							/* LWIP_UDP_PCB_HASH */
 	/* no fully matching pcb found? then look for an unconnected pcb */
 	if (pcb == NULL) {
 		pcb = uncon_pcb;
@@ -356,7 +409,7 @@ void udp_input(struct pbuf *p, struct netif *inp)
 				struct udp_pcb *mpcb;
 				u8_t p_header_changed = 0;
 				s16_t hdrs_len = (s16_t)(ip_current_header_tot_len() + UDP_HLEN);
-				for (mpcb = udp_pcbs; mpcb != NULL; mpcb = mpcb->next) {
+				for (mpcb = UDP_HASH_FIRST(dest); mpcb != NULL; mpcb = UDP_HASH_NEXT(mpcb)) {
 					if (mpcb != pcb) {
 						/* compare PCB local addr+port to UDP destination addr+port */
 						if ((mpcb->local_port == dest) && (udp_input_local_match(mpcb, inp, broadcast) != 0)) {
@@ -884,7 +937,7 @@ err_t udp_bind(struct udp_pcb *pcb, const ip_addr_t *ipaddr, u16_t port)
 			return ERR_USE;
 		}
 	} else {
-		for (ipcb = udp_pcbs; ipcb != NULL; ipcb = ipcb->next) {
+		for (ipcb = UDP_HASH_FIRST(port); ipcb != NULL; ipcb = UDP_HASH_NEXT(ipcb)) {
 			if (pcb != ipcb) {
 				/* By default, we don't allow to bind to a port that any other udp
 				   PCB is already bound to, unless *all* PCBs with that port have tha
@@ -908,6 +961,12 @@ err_t udp_bind(struct udp_pcb *pcb, const ip_addr_t *ipaddr, u16_t port)
 
 	ip_addr_set_ipaddr(&pcb->local_ip, ipaddr);
 
+#if LWIP_UDP_PCB_HASH
+	if (rebind != 0) {
+		/* rehash with the new port */
+		udp_hash_remove(pcb);
+	}
+#endif							/* LWIP_UDP_PCB_HASH */
 	pcb->local_port = port;
 	mib2_udp_bind(pcb);
 	/* pcb not active yet? */
@@ -916,6 +975,9 @@ err_t udp_bind(struct udp_pcb *pcb, const ip_addr_t *ipaddr, u16_t port)
 		pcb->next = udp_pcbs;
 		udp_pcbs = pcb;
 	}
+#if LWIP_UDP_PCB_HASH
+	udp_hash_add(pcb);
+#endif							/* LWIP_UDP_PCB_HASH */
 	LWIP_DEBUGF(UDP_DEBUG | LWIP_DBG_TRACE | LWIP_DBG_STATE, ("udp_bind: bound to "));
 	ip_addr_debug_print(UDP_DEBUG | LWIP_DBG_TRACE | LWIP_DBG_STATE, &pcb->local_ip);
 	LWIP_DEBUGF(UDP_DEBUG | LWIP_DBG_TRACE | LWIP_DBG_STATE, (", port %" U16_F ")\n", pcb->local_port));
@@ -972,6 +1034,9 @@ err_t udp_connect(struct udp_pcb *pcb, const ip_addr_t *ipaddr, u16_t port)
 	/* PCB not yet on the list, add PCB now */
 	pcb->next = udp_pcbs;
 	udp_pcbs = pcb;
+#if LWIP_UDP_PCB_HASH
+	udp_hash_add(pcb);
+#endif							/* LWIP_UDP_PCB_HASH */
 	return ERR_OK;
 }
 
@@ -1026,6 +1091,9 @@ void udp_remove(struct udp_pcb *pcb)
 	struct udp_pcb *pcb2;
 
 	mib2_udp_unbind(pcb);
+#if LWIP_UDP_PCB_HASH
+	udp_hash_remove(pcb);
+#endif							/* LWIP_UDP_PCB_HASH */
 	/* pcb to be removed is first in list? */
 	if (udp_pcbs == pcb) {
 		/* make list start at 2nd pcb */
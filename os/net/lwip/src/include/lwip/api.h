@@ -163,7 +163,8 @@ enum netconn_state {
 	NETCONN_WRITE,
 	NETCONN_LISTEN,
 	NETCONN_CONNECT,
-	NETCONN_CLOSE
+	NETCONN_CLOSE,
+	NETCONN_SENDQ
 };
 
 /*
@@ -356,6 +357,10 @@ err_t netconn_write_partly(struct netconn *conn, const void *dataptr, size_t siz
 err_t netconn_close(struct netconn *conn);
 err_t netconn_shutdown(struct netconn *conn, u8_t shut_rx, u8_t shut_tx);
 
+#if LWIP_TCP && LWIP_SOCKET_ZEROCOPY
+err_t netconn_sendq(struct netconn *conn, u32_t limit, u8_t wait, u32_t *queued);
+#endif							/* LWIP_TCP && LWIP_SOCKET_ZEROCOPY */
+
 #if LWIP_IGMP || (LWIP_IPV6 && LWIP_IPV6_MLD)
 err_t netconn_join_leave_group(struct netconn *conn, const ip_addr_t *multiaddr, const ip_addr_t *netif_addr, enum netconn_igmp join_or_leave);
 #endif							/* LWIP_IGMP || (LWIP_IPV6 && LWIP_IPV6_MLD) */
@@ -227,6 +227,16 @@
 #define LWIP_IPV6_DHCP6			0
 #endif
 
+/* ---------- Checksum options ---------- */
+#ifdef CONFIG_NET_LWIP_CHKSUM_WORD
+#define LWIP_CHKSUM_ALGORITHM           4
+#endif
+#ifdef CONFIG_NET_LWIP_CHECKSUM_ON_COPY
+#define LWIP_CHECKSUM_ON_COPY           1
+#define LWIP_CHKSUM_COPY_ALGORITHM      2
+#endif
+/* ---------- Checksum options ---------- */
+
 /* ---------- VLAN options ---------- */
 #ifdef CONFIG_NET_LWIP_VLAN
 #define ETHARP_SUPPORT_VLAN             1
@@ -450,6 +460,19 @@
 #define TCP_RCV_SCALE CONFIG_NET_TCP_RCV_SCALE
 #endif
 
+#ifdef CONFIG_NET_TCP_PCB_HASH
+#define LWIP_TCP_PCB_HASH	1
+#define TCP_PCB_HASH_SIZE	CONFIG_NET_TCP_PCB_HASH_SIZE
+#endif
+
+#ifdef CONFIG_NET_TCP_SACK
+#define LWIP_TCP_SACK	1
+#endif
+
+#ifdef CONFIG_NET_TCP_TLP
+#define LWIP_TCP_TLP	1
+#endif
+
 /* ---------- TCP options ---------- */
 
 /* ---------- UDP options ---------- */
@@ -471,6 +494,11 @@
 #define LWIP_NETBUF_RECVINFO	CONFIG_NET_NETBUF_RECVINFO
 #endif
 
+#ifdef CONFIG_NET_UDP_PCB_HASH
+#define LWIP_UDP_PCB_HASH	1
+#define UDP_PCB_HASH_SIZE	CONFIG_NET_UDP_PCB_HASH_SIZE
+#endif
+
 /* ---------- UDP options ---------- */
 
 /* ---------- SNMP options ---------- */
@@ -687,6 +715,10 @@
 #define LWIP_SO_RCVBUF	CONFIG_NET_SO_RCVBUF
 #endif
 
+#ifdef CONFIG_NET_SOCKET_ZEROCOPY
+#define LWIP_SOCKET_ZEROCOPY	1
+#endif
+
 #ifdef CONFIG_NET_SO_REUSE
 #define SO_REUSE	CONFIG_NET_SO_REUSE
 #endif
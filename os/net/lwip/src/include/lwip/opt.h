@@ -1099,6 +1099,22 @@
 #ifndef LWIP_NETBUF_RECVINFO
 #define LWIP_NETBUF_RECVINFO            0
 #endif
+
+/**
+ * LWIP_UDP_PCB_HASH==1: Find the PCBs of an incoming datagram in a hash
+ * table keyed by local port instead of walking the whole udp_pcbs list.
+ */
+#ifndef LWIP_UDP_PCB_HASH
+#define LWIP_UDP_PCB_HASH               0
+#endif
+
+/**
+ * UDP_PCB_HASH_SIZE: Number of buckets of the UDP PCB hash table.
+ * Must be a power of two.
+ */
+#ifndef UDP_PCB_HASH_SIZE
+#define UDP_PCB_HASH_SIZE               32
+#endif
 /**
  * @}
  */
@@ -1249,6 +1265,24 @@
 #define TCP_DEFAULT_LISTEN_BACKLOG      0xff
 #endif
 
+/**
+ * LWIP_TCP_PCB_HASH==1: Find the PCB of an incoming segment in hash tables
+ * (keyed by the ports and the remote address for active and TIME-WAIT
+ * PCBs, by the local port for listening PCBs) instead of walking the PCB
+ * lists.
+ */
+#ifndef LWIP_TCP_PCB_HASH
+#define LWIP_TCP_PCB_HASH               0
+#endif
+
+/**
+ * TCP_PCB_HASH_SIZE: Number of buckets of each TCP PCB hash table.
+ * Must be a power of two.
+ */
+#ifndef TCP_PCB_HASH_SIZE
+#define TCP_PCB_HASH_SIZE               32
+#endif
+
 /**
  * TCP_OVERSIZE: The maximum number of bytes that tcp_write may
  * allocate ahead of time in an attempt to create shorter pbuf chains
@@ -1277,6 +1311,27 @@
 #define LWIP_TCP_TIMESTAMPS             0
 #endif
 
+/**
+ * LWIP_TCP_SACK==1: support the TCP selective acknowledgement option
+ * (RFC 2018). Out-of-order data is reported in empty ACKs, and fast
+ * recovery retransmits the holes reported by the remote host only.
+ * The option is used on a connection if both hosts send it in their SYN.
+ * Reporting received blocks requires TCP_QUEUE_OOSEQ.
+ */
+#ifndef LWIP_TCP_SACK
+#define LWIP_TCP_SACK                   0
+#endif
+
+/**
+ * LWIP_TCP_TLP==1: send a tail loss probe (retransmit the last unacked
+ * segment) after two round-trip times without an ACK, so that the loss of
+ * the last segments of a flight is repaired by fast recovery instead of a
+ * retransmission timeout. Used on connections with SACK only.
+ */
+#ifndef LWIP_TCP_TLP
+#define LWIP_TCP_TLP                    0
+#endif
+
 /**
  * TCP_WND_UPDATE_THRESHOLD: difference in window to trigger an
  * explicit window update
@@ -1804,6 +1859,15 @@
 #define LWIP_SO_LINGER                  0
 #endif
 
+/**
+ * LWIP_SOCKET_ZEROCOPY==1: Enable MSG_ZEROCOPY for send and recv and the
+ * FIONSENDQ/FIONSENDQWAIT ioctls reporting when referenced data was
+ * acknowledged.
+ */
+#ifndef LWIP_SOCKET_ZEROCOPY
+#define LWIP_SOCKET_ZEROCOPY            0
+#endif
+
 /**
  * If LWIP_SO_RCVBUF is used, this is the default value for recv_bufsize.
  */
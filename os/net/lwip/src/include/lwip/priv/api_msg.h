@@ -141,6 +141,14 @@ struct api_msg {
 			u8_t polls_left;
 #endif							/* LWIP_SO_SNDTIMEO || LWIP_SO_LINGER */
 		} sd;
+#if LWIP_SOCKET_ZEROCOPY
+		/** used for lwip_netconn_do_sendq */
+		struct {
+			u32_t limit;
+			u32_t queued;
+			u8_t wait;
+		} sq;
+#endif							/* LWIP_SOCKET_ZEROCOPY */
 #endif							/* LWIP_TCP */
 #if LWIP_IGMP || (LWIP_IPV6 && LWIP_IPV6_MLD)
 		/** used for lwip_netconn_do_join_leave_group */
@@ -209,6 +217,9 @@ void lwip_netconn_do_recv(void *m);
 void lwip_netconn_do_accepted(void *m);
 #endif							/* TCP_LISTEN_BACKLOG */
 void lwip_netconn_do_write(void *m);
+#if LWIP_TCP && LWIP_SOCKET_ZEROCOPY
+void lwip_netconn_do_sendq(void *m);
+#endif
 void lwip_netconn_do_getaddr(void *m);
 void lwip_netconn_do_close(void *m);
 void lwip_netconn_do_shutdown(void *m);
@@ -99,6 +99,12 @@ err_t tcp_send_empty_ack(struct tcp_pcb *pcb);
 void tcp_rexmit(struct tcp_pcb *pcb);
 void tcp_rexmit_rto(struct tcp_pcb *pcb);
 void tcp_rexmit_fast(struct tcp_pcb *pcb);
+#if LWIP_TCP_SACK
+u8_t tcp_rexmit_sack(struct tcp_pcb *pcb);
+#endif
+#if LWIP_TCP_TLP
+void tcp_rexmit_tlp(struct tcp_pcb *pcb);
+#endif
 u32_t tcp_update_rcv_ann_wnd(struct tcp_pcb *pcb);
 err_t tcp_process_refused_data(struct tcp_pcb *pcb);
 
@@ -279,6 +285,9 @@ struct tcp_seg {
 #define TF_SEG_DATA_CHECKSUMMED (u8_t)0x04U	/* ALL data (not the header) is
 											   checksummed into 'chksum' */
 #define TF_SEG_OPTS_WND_SCALE   (u8_t)0x08U	/* Include WND SCALE option */
+#define TF_SEG_OPTS_SACK_PERM   (u8_t)0x10U	/* Include SACK permitted option */
+#define TF_SEG_SACKED           (u8_t)0x20U	/* Reported received by a SACK block */
+#define TF_SEG_SACK_REXMIT      (u8_t)0x40U	/* Retransmitted in the current fast recovery */
 	struct tcp_hdr *tcphdr;	/* the TCP header */
 };
 
@@ -287,6 +296,8 @@ struct tcp_seg {
 #define LWIP_TCP_OPT_MSS        2
 #define LWIP_TCP_OPT_WS         3
 #define LWIP_TCP_OPT_TS         8
+#define LWIP_TCP_OPT_SACK_PERM  4
+#define LWIP_TCP_OPT_SACK       5
 
 #define LWIP_TCP_OPT_LEN_MSS    4
 #if LWIP_TCP_TIMESTAMPS
@@ -301,11 +312,20 @@ struct tcp_seg {
 #else
 #define LWIP_TCP_OPT_LEN_WS_OUT 0
 #endif
+#if LWIP_TCP_SACK
+#define LWIP_TCP_OPT_LEN_SACK_PERM     2
+#define LWIP_TCP_OPT_LEN_SACK_PERM_OUT 4	/* aligned for output (includes NOP padding) */
+#define LWIP_TCP_SACK_MAX_BLOCKS       4	/* what fits into the 40 bytes of options */
+#define LWIP_TCP_OPT_LEN_SACK_OUT(n)   (4 + 8 * (n))	/* n blocks, includes NOP padding */
+#else
+#define LWIP_TCP_OPT_LEN_SACK_PERM_OUT 0
+#endif
 
 #define LWIP_TCP_OPT_LENGTH(flags) \
 		(flags & TF_SEG_OPTS_MSS       ? LWIP_TCP_OPT_LEN_MSS    : 0) + \
 		(flags & TF_SEG_OPTS_TS        ? LWIP_TCP_OPT_LEN_TS_OUT : 0) + \
-		(flags & TF_SEG_OPTS_WND_SCALE ? LWIP_TCP_OPT_LEN_WS_OUT : 0)
+		(flags & TF_SEG_OPTS_WND_SCALE ? LWIP_TCP_OPT_LEN_WS_OUT : 0) + \
+		(flags & TF_SEG_OPTS_SACK_PERM ? LWIP_TCP_OPT_LEN_SACK_PERM_OUT : 0)
 
 /** This returns a TCP header option for MSS in an u32_t */
 #define TCP_BUILD_MSS_OPTION(mss) lwip_htonl(0x02040000 | ((mss) & 0xFFFF))
@@ -349,6 +369,20 @@ extern struct tcp_pcb **const tcp_pcb_lists[NUM_TCP_PCB_LISTS];
    3) All PCBs in the tcp_listen_pcbs list is in LISTEN state.
    4) All PCBs in the tcp_tw_pcbs list is in TIME-WAIT state.
 */
+#if LWIP_TCP_PCB_HASH
+/* Hash tables mirroring tcp_listen_pcbs, tcp_active_pcbs and tcp_tw_pcbs
+   for the demultiplexing in tcp_input(). TCP_REG and TCP_RMV keep them
+   in sync with the lists. */
+void tcp_pcb_hash_add(struct tcp_pcb **pcbs, struct tcp_pcb *pcb);
+void tcp_pcb_hash_remove(struct tcp_pcb **pcbs, struct tcp_pcb *pcb);
+struct tcp_pcb *tcp_pcb_hash_bucket(struct tcp_pcb **pcbs, u16_t local_port, u16_t remote_port, const ip_addr_t *remote_ip);
+#define TCP_HASH_ADD(pcbs, npcb) tcp_pcb_hash_add(pcbs, npcb)
+#define TCP_HASH_RMV(pcbs, npcb) tcp_pcb_hash_remove(pcbs, npcb)
+#else
+#define TCP_HASH_ADD(pcbs, npcb)
+#define TCP_HASH_RMV(pcbs, npcb)
+#endif							/* LWIP_TCP_PCB_HASH */
+
 /* Define two macros, TCP_REG and TCP_RMV that registers a TCP PCB
    with a PCB list or removes a PCB from a list, respectively. */
 #ifndef TCP_DEBUG_PCB_LISTS
@@ -367,6 +401,7 @@ extern struct tcp_pcb **const tcp_pcb_lists[NUM_TCP_PCB_LISTS];
 		(npcb)->next = *(pcbs); \
 		LWIP_ASSERT("TCP_REG: npcb->next != npcb", (npcb)->next != (npcb)); \
 		*(pcbs) = (npcb); \
+		TCP_HASH_ADD(pcbs, npcb); \
 		LWIP_ASSERT("TCP_RMV: tcp_pcbs sane", tcp_pcbs_sane()); \
 		tcp_timer_needed(); \
 	} while (0)
@@ -383,6 +418,7 @@ extern struct tcp_pcb **const tcp_pcb_lists[NUM_TCP_PCB_LISTS];
 			} \
 		} \
 		(npcb)->next = NULL; \
+		TCP_HASH_RMV(pcbs, npcb); \
 		LWIP_ASSERT("TCP_RMV: tcp_pcbs sane", tcp_pcbs_sane()); \
 		LWIP_DEBUGF(TCP_DEBUG, ("TCP_RMV: removed %p from %p\n", (npcb), *(pcbs))); \
 	} while (0)
@@ -393,6 +429,7 @@ extern struct tcp_pcb **const tcp_pcb_lists[NUM_TCP_PCB_LISTS];
 	do {                                             \
 		(npcb)->next = *pcbs;                          \
 		*(pcbs) = (npcb);                              \
+		TCP_HASH_ADD(pcbs, npcb);                      \
 		tcp_timer_needed();                            \
 	} while (0)
 
@@ -413,6 +450,7 @@ extern struct tcp_pcb **const tcp_pcb_lists[NUM_TCP_PCB_LISTS];
 			}                                            \
 		}                                              \
 		(npcb)->next = NULL;                           \
+		TCP_HASH_RMV(pcbs, npcb);                      \
 	} while (0)
 
 #endif							/* LWIP_DEBUG */
@@ -289,6 +289,8 @@ struct linger {
 #define MSG_OOB        0x04		/* Unimplemented: Requests out-of-band data. The significance and semantics of out-of-band data are protocol-specific */
 #define MSG_DONTWAIT   0x08		/* Nonblocking i/o for this operation only */
 #define MSG_MORE       0x10		/* Sender will send more */
+#define MSG_ZEROCOPY   0x20		/* send: data stays owned by the caller until acknowledged (FIONSENDQ)
+					   recv: hand over the received pbuf chain (struct pbuf **) */
 
 /*
  * Options for level IPPROTO_IP
@@ -495,6 +497,10 @@ struct lwip_sock {
 	u8_t err;
 	/** counter of how many threads are waiting for this socket using select */
 	SELWAIT_T select_waiting;
+#if LWIP_SOCKET_ZEROCOPY
+	/** data was sent with MSG_ZEROCOPY, close waits until it was acknowledged */
+	u8_t zerocopy;
+#endif
 	u32_t pid;
 	u8_t pname[CONFIG_TASK_NAME_SIZE];
 };
@@ -154,7 +154,7 @@ typedef u32_t tcpwnd_size_t;
 typedef u16_t tcpwnd_size_t;
 #endif
 
-#if LWIP_WND_SCALE || TCP_LISTEN_BACKLOG || LWIP_TCP_TIMESTAMPS
+#if LWIP_WND_SCALE || TCP_LISTEN_BACKLOG || LWIP_TCP_TIMESTAMPS || LWIP_TCP_SACK
 typedef u16_t tcpflags_t;
 #else
 typedef u8_t tcpflags_t;
@@ -177,8 +177,16 @@ enum tcp_state {
 /**
  * members common to struct tcp_pcb and struct tcp_listen_pcb
  */
+#if LWIP_TCP_PCB_HASH
+#define TCP_PCB_HASH_NEXT(type) \
+		type *hash_next; /* for the hash chain */
+#else
+#define TCP_PCB_HASH_NEXT(type)
+#endif
+
 #define TCP_PCB_COMMON(type) \
 		type *next; /* for the linked list */ \
+		TCP_PCB_HASH_NEXT(type) \
 		void *callback_arg; \
 		enum tcp_state state; /* TCP state */ \
 		u8_t prio; \
@@ -230,6 +238,12 @@ struct tcp_pcb {
 #endif
 #if LWIP_TCP_TIMESTAMPS
 #define TF_TIMESTAMP   0x0400U	/* Timestamp option enabled */
+#endif
+#if LWIP_TCP_SACK
+#define TF_SACK        0x0800U	/* SACK option enabled */
+#endif
+#if LWIP_TCP_TLP
+#define TF_TLP         0x1000U	/* Tail loss probe sent for the current flight */
 #endif
 
 	/* the rest of the fields are in host byte order
@@ -262,6 +276,11 @@ struct tcp_pcb {
 	/* fast retransmit/recovery */
 	u8_t dupacks;
 	u32_t lastack;			/* Highest acknowledged seqno. */
+#if LWIP_TCP_SACK
+	u32_t sack_recover;		/* snd_nxt when fast recovery was entered */
+	u32_t sack_high;		/* Highest seqno SACKed by the remote host */
+	u32_t rcv_sack_recent;	/* seqno of the latest out-of-sequence segment */
+#endif							/* LWIP_TCP_SACK */
 
 	/* congestion avoidance/control variables */
 	tcpwnd_size_t cwnd;
@@ -0,0 +1,135 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#include "test_chksum.h"
+
+#include "lwip/inet_chksum.h"
+#include "lwip/def.h"
+
+#include <string.h>
+
+#define TEST_CHKSUM_BUFSIZE 1600
+
+static u8_t chksum_src[TEST_CHKSUM_BUFSIZE + 8];
+static u8_t chksum_dst[TEST_CHKSUM_BUFSIZE + 8];
+
+/* Setups/teardown functions */
+
+static void chksum_setup(void)
+{
+	size_t i;
+	u32_t x = 0x12345678;
+
+	for (i = 0; i < sizeof(chksum_src); i++) {
+		x = x * 1103515245 + 12345;
+		chksum_src[i] = (u8_t)(x >> 16);
+	}
+}
+
+static void chksum_teardown(void)
+{
+}
+
+/** Reference checksum: RFC 1071 over network order 16-bit words */
+static u16_t chksum_reference(const u8_t *data, int len)
+{
+	u32_t acc = 0;
+
+	while (len > 1) {
+		acc += ((u32_t)data[0] << 8) | data[1];
+		data += 2;
+		len -= 2;
+	}
+	if (len > 0) {
+		acc += (u32_t)data[0] << 8;
+	}
+	while (acc >> 16) {
+		acc = (acc >> 16) + (acc & 0xffff);
+	}
+	return (u16_t)~acc;
+}
+
+/* Test functions */
+
+/** inet_chksum at every alignment and every length up to a full frame */
+START_TEST(test_chksum_lengths)
+{
+	int off;
+	int len;
+	LWIP_UNUSED_ARG(_i);
+
+	for (off = 0; off < 8; off++) {
+		for (len = 0; len <= TEST_CHKSUM_BUFSIZE; len++) {
+			fail_unless(lwip_ntohs(inet_chksum(&chksum_src[off], (u16_t)len)) == chksum_reference(&chksum_src[off], len));
+		}
+	}
+}
+
+END_TEST
+
+/** Sums of all-ones words must carry correctly */
+START_TEST(test_chksum_carry)
+{
+	u8_t ones[TEST_CHKSUM_BUFSIZE];
+	int len;
+	LWIP_UNUSED_ARG(_i);
+
+	memset(ones, 0xff, sizeof(ones));
+	for (len = 0; len <= TEST_CHKSUM_BUFSIZE; len += 7) {
+		fail_unless(lwip_ntohs(inet_chksum(ones, (u16_t)len)) == chksum_reference(ones, len));
+	}
+}
+
+END_TEST
+#if LWIP_CHKSUM_COPY_ALGORITHM
+/** LWIP_CHKSUM_COPY copies like MEMCPY and sums like LWIP_CHKSUM */
+START_TEST(test_chksum_copy)
+{
+	int soff;
+	int doff;
+	int len;
+	u16_t sum;
+	LWIP_UNUSED_ARG(_i);
+
+	for (soff = 0; soff < 4; soff++) {
+		for (doff = 0; doff < 8; doff += 4) {
+			for (len = 0; len <= TEST_CHKSUM_BUFSIZE; len += 3) {
+				memset(chksum_dst, 0, sizeof(chksum_dst));
+				sum = LWIP_CHKSUM_COPY(&chksum_dst[doff], &chksum_src[soff], (u16_t)len);
+				fail_unless(memcmp(&chksum_dst[doff], &chksum_src[soff], len) == 0);
+				fail_unless(chksum_dst[doff + len] == 0);
+				fail_unless(lwip_ntohs((u16_t)~sum) == chksum_reference(&chksum_src[soff], len));
+			}
+		}
+	}
+}
+
+END_TEST
+#endif
+/** Create the suite including all tests for this module */
+Suite *chksum_suite(void)
+{
+	TFun tests[] = {
+		test_chksum_lengths,
+		test_chksum_carry,
+#if LWIP_CHKSUM_COPY_ALGORITHM
+		test_chksum_copy,
+#endif
+	};
+	return create_suite("CHKSUM", tests, sizeof(tests) / sizeof(TFun), chksum_setup, chksum_teardown);
+}
@@ -65,4 +65,21 @@
 /* Minimal changes to opt.h required for etharp unit tests: */
 #define ETHARP_SUPPORT_STATIC_ENTRIES   1
 
+/* Small PCB hash tables so that the demux tests hit bucket collisions: */
+#define LWIP_TCP_PCB_HASH               1
+#define TCP_PCB_HASH_SIZE               4
+#define LWIP_UDP_PCB_HASH               1
+#define UDP_PCB_HASH_SIZE               4
+#define MEMP_NUM_TCP_PCB                8
+#define MEMP_NUM_UDP_PCB                8
+
+/* Selective acknowledgements and tail loss probes: */
+#define LWIP_TCP_SACK                   1
+#define LWIP_TCP_TLP                    1
+
+/* Word-at-a-time checksum and checksum on copy: */
+#define LWIP_CHKSUM_ALGORITHM           4
+#define LWIP_CHECKSUM_ON_COPY           1
+#define LWIP_CHKSUM_COPY_ALGORITHM      2
+
 #endif							/* __LWIPOPTS_H__ */
@@ -131,6 +131,77 @@ START_TEST(test_tcp_recv_inseq)
 	EXPECT(lwip_stats.memp[MEMP_TCP_PCB].used == 0);
 }
 
+END_TEST
+/** Create several ESTABLISHED pcbs sharing the local port (more than there are
+ * hash buckets) and check that every segment reaches only its own pcb */
+START_TEST(test_tcp_demux)
+{
+#define TEST_TCP_DEMUX_NPCBS 6
+	struct test_tcp_counters counters[TEST_TCP_DEMUX_NPCBS];
+	struct tcp_pcb *pcbs[TEST_TCP_DEMUX_NPCBS];
+	struct pbuf *p;
+	char data[] = { 1, 2, 3, 4 };
+	ip_addr_t remote_ip, local_ip;
+	u16_t local_port = 0x101;
+	struct netif netif;
+	int i, j;
+	LWIP_UNUSED_ARG(_i);
+
+	/* initialize local vars */
+	memset(&netif, 0, sizeof(netif));
+	IP4_ADDR(&local_ip, 192, 168, 1, 1);
+	IP4_ADDR(&remote_ip, 192, 168, 1, 2);
+	memset(counters, 0, sizeof(counters));
+
+	for (i = 0; i < TEST_TCP_DEMUX_NPCBS; i++) {
+		pcbs[i] = test_tcp_new_counters_pcb(&counters[i]);
+		EXPECT_RET(pcbs[i] != NULL);
+		tcp_set_state(pcbs[i], ESTABLISHED, &local_ip, &remote_ip, local_port, (u16_t)(0x200 + i));
+	}
+
+	/* one segment per pcb, each must only reach its own pcb */
+	for (i = 0; i < TEST_TCP_DEMUX_NPCBS; i++) {
+		p = tcp_create_rx_segment(pcbs[i], data, sizeof(data), 0, 0, 0);
+		EXPECT_RET(p != NULL);
+		test_tcp_input(p, &netif);
+		for (j = 0; j < TEST_TCP_DEMUX_NPCBS; j++) {
+			EXPECT(counters[j].recv_calls == (u32_t)(j <= i ? 1 : 0));
+		}
+	}
+
+	/* an aborted pcb must not be found any more */
+	tcp_abort(pcbs[2]);
+	pcbs[2] = NULL;
+	EXPECT(counters[2].err_calls == 1);
+	p = tcp_create_segment(&remote_ip, &local_ip, 0x202, local_port, data, sizeof(data), 0, 0, 0);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	for (j = 0; j < TEST_TCP_DEMUX_NPCBS; j++) {
+		EXPECT(counters[j].recv_calls == 1);
+	}
+
+	/* the remaining pcbs are still found */
+	for (i = 0; i < TEST_TCP_DEMUX_NPCBS; i++) {
+		if (pcbs[i] == NULL) {
+			continue;
+		}
+		p = tcp_create_rx_segment(pcbs[i], data, sizeof(data), 0, 0, 0);
+		EXPECT_RET(p != NULL);
+		test_tcp_input(p, &netif);
+		EXPECT(counters[i].recv_calls == 2);
+	}
+
+	/* make sure the pcbs are freed */
+	EXPECT(lwip_stats.memp[MEMP_TCP_PCB].used == TEST_TCP_DEMUX_NPCBS - 1);
+	for (i = 0; i < TEST_TCP_DEMUX_NPCBS; i++) {
+		if (pcbs[i] != NULL) {
+			tcp_abort(pcbs[i]);
+		}
+	}
+	EXPECT(lwip_stats.memp[MEMP_TCP_PCB].used == 0);
+#undef TEST_TCP_DEMUX_NPCBS
+}
+
 END_TEST
 /** Provoke fast retransmission by duplicate ACKs and then recover by ACKing all sent data.
  * At the end, send more data. */
@@ -662,17 +733,408 @@ END_TEST START_TEST(test_tcp_tx_full_window_lost_from_unacked)
 }
 
 END_TEST
+#if LWIP_TCP_SACK
+/** Return the sequence number of the first packet sent and drop the copies */
+static u32_t test_tcp_sack_tx_seqno(struct test_tcp_txcounters *txcounters)
+{
+	struct tcp_hdr tcphdr;
+	u32_t seqno = 0;
+
+	if (txcounters->tx_packets != NULL) {
+		EXPECT(pbuf_copy_partial(txcounters->tx_packets, &tcphdr, sizeof(tcphdr), IP_HLEN) == sizeof(tcphdr));
+		seqno = ntohl(tcphdr.seqno);
+		pbuf_free(txcounters->tx_packets);
+	}
+	memset(txcounters, 0, sizeof(struct test_tcp_txcounters));
+	txcounters->copy_tx_packets = 1;
+	return seqno;
+}
+
+/** Out-of-sequence data is reported with SACK blocks, the most recent block first */
+START_TEST(test_tcp_sack_rx)
+{
+	struct netif netif;
+	struct test_tcp_txcounters txcounters;
+	struct test_tcp_counters counters;
+	struct tcp_pcb *pcb;
+	struct pbuf *p;
+	ip_addr_t remote_ip, local_ip, netmask;
+	u16_t remote_port = 0x100, local_port = 0x101;
+	u32_t opts[5];
+	u32_t base;
+	LWIP_UNUSED_ARG(_i);
+
+	/* initialize local vars */
+	IP4_ADDR(&local_ip, 192, 168, 1, 1);
+	IP4_ADDR(&remote_ip, 192, 168, 1, 2);
+	IP4_ADDR(&netmask, 255, 255, 255, 0);
+	test_tcp_init_netif(&netif, &txcounters, &local_ip, &netmask);
+	memset(&counters, 0, sizeof(counters));
+	memset(&txcounters, 0, sizeof(txcounters));
+	txcounters.copy_tx_packets = 1;
+
+	/* create and initialize the pcb */
+	pcb = test_tcp_new_counters_pcb(&counters);
+	EXPECT_RET(pcb != NULL);
+	tcp_set_state(pcb, ESTABLISHED, &local_ip, &remote_ip, local_port, remote_port);
+	pcb->flags |= TF_SACK;
+	base = pcb->rcv_nxt;
+
+	/* [100, 200) arrives first: one block */
+	p = tcp_create_rx_segment(pcb, tx_data, 100, 100, 0, TCP_ACK);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	EXPECT_RET(txcounters.num_tx_calls == 1);
+	EXPECT_RET(txcounters.num_tx_bytes == IP_HLEN + TCP_HLEN + 12);
+	EXPECT(pbuf_copy_partial(txcounters.tx_packets, opts, 12, IP_HLEN + TCP_HLEN) == 12);
+	EXPECT(ntohl(opts[0]) == 0x0101050a);
+	EXPECT(ntohl(opts[1]) == base + 100);
+	EXPECT(ntohl(opts[2]) == base + 200);
+	test_tcp_sack_tx_seqno(&txcounters);
+
+	/* [300, 400) arrives: reported before [100, 200) */
+	p = tcp_create_rx_segment(pcb, tx_data, 100, 300, 0, TCP_ACK);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	EXPECT_RET(txcounters.num_tx_calls == 1);
+	EXPECT_RET(txcounters.num_tx_bytes == IP_HLEN + TCP_HLEN + 20);
+	EXPECT(pbuf_copy_partial(txcounters.tx_packets, opts, 20, IP_HLEN + TCP_HLEN) == 20);
+	EXPECT(ntohl(opts[1]) == base + 300);
+	EXPECT(ntohl(opts[2]) == base + 400);
+	EXPECT(ntohl(opts[3]) == base + 100);
+	EXPECT(ntohl(opts[4]) == base + 200);
+	test_tcp_sack_tx_seqno(&txcounters);
+
+	/* [200, 300) closes the gap between both blocks */
+	p = tcp_create_rx_segment(pcb, tx_data, 100, 200, 0, TCP_ACK);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	EXPECT_RET(txcounters.num_tx_calls == 1);
+	EXPECT(pbuf_copy_partial(txcounters.tx_packets, opts, 12, IP_HLEN + TCP_HLEN) == 12);
+	EXPECT(ntohl(opts[1]) == base + 100);
+	EXPECT(ntohl(opts[2]) == base + 400);
+	test_tcp_sack_tx_seqno(&txcounters);
+
+	/* the missing data delivers everything */
+	p = tcp_create_rx_segment(pcb, tx_data, 100, 0, 0, TCP_ACK);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	EXPECT(counters.recved_bytes == 400);
+	EXPECT(pcb->rcv_nxt == base + 400);
+	EXPECT(pcb->ooseq == NULL);
+	test_tcp_sack_tx_seqno(&txcounters);
+
+	/* make sure the pcb is freed */
+	EXPECT_RET(lwip_stats.memp[MEMP_TCP_PCB].used == 1);
+	tcp_abort(pcb);
+	EXPECT_RET(lwip_stats.memp[MEMP_TCP_PCB].used == 0);
+}
+
+END_TEST
+/** Segments 0 and 2 of 6 are lost: SACK recovery repairs both holes */
+START_TEST(test_tcp_sack_rexmit)
+{
+	struct netif netif;
+	struct test_tcp_txcounters txcounters;
+	struct test_tcp_counters counters;
+	struct tcp_pcb *pcb;
+	struct pbuf *p;
+	ip_addr_t remote_ip, local_ip, netmask;
+	u16_t remote_port = 0x100, local_port = 0x101;
+	u32_t sack[4];
+	u32_t iss;
+	err_t err;
+	LWIP_UNUSED_ARG(_i);
+
+	/* initialize local vars */
+	IP4_ADDR(&local_ip, 192, 168, 1, 1);
+	IP4_ADDR(&remote_ip, 192, 168, 1, 2);
+	IP4_ADDR(&netmask, 255, 255, 255, 0);
+	test_tcp_init_netif(&netif, &txcounters, &local_ip, &netmask);
+	memset(&counters, 0, sizeof(counters));
+	memset(&txcounters, 0, sizeof(txcounters));
+
+	/* create and initialize the pcb */
+	pcb = test_tcp_new_counters_pcb(&counters);
+	EXPECT_RET(pcb != NULL);
+	tcp_set_state(pcb, ESTABLISHED, &local_ip, &remote_ip, local_port, remote_port);
+	pcb->flags |= TF_SACK;
+	pcb->mss = TCP_MSS;
+	/* disable initial congestion window (we don't send a SYN here...) */
+	pcb->cwnd = pcb->snd_wnd;
+	iss = pcb->lastack;
+
+	err = tcp_write(pcb, tx_data, 6 * TCP_MSS, TCP_WRITE_FLAG_COPY);
+	EXPECT_RET(err == ERR_OK);
+	err = tcp_output(pcb);
+	EXPECT_RET(err == ERR_OK);
+	EXPECT_RET(txcounters.num_tx_calls == 6);
+	test_tcp_sack_tx_seqno(&txcounters);
+
+	/* three duplicate ACKs with growing SACK information */
+	sack[0] = iss + TCP_MSS;
+	sack[1] = iss + 2 * TCP_MSS;
+	p = tcp_create_rx_segment_sack(pcb, NULL, 0, 0, 0, TCP_ACK, sack, 1);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	sack[0] = iss + 3 * TCP_MSS;
+	sack[1] = iss + 4 * TCP_MSS;
+	sack[2] = iss + TCP_MSS;
+	sack[3] = iss + 2 * TCP_MSS;
+	p = tcp_create_rx_segment_sack(pcb, NULL, 0, 0, 0, TCP_ACK, sack, 2);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	EXPECT_RET(txcounters.num_tx_calls == 0);
+	sack[1] = iss + 5 * TCP_MSS;
+	p = tcp_create_rx_segment_sack(pcb, NULL, 0, 0, 0, TCP_ACK, sack, 2);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+
+	/* fast retransmission of the first hole only */
+	EXPECT_RET(txcounters.num_tx_calls == 1);
+	EXPECT(test_tcp_sack_tx_seqno(&txcounters) == iss);
+	EXPECT(pcb->flags & TF_INFR);
+
+	/* new SACK information: the second hole is retransmitted */
+	sack[1] = iss + 6 * TCP_MSS;
+	p = tcp_create_rx_segment_sack(pcb, NULL, 0, 0, 0, TCP_ACK, sack, 2);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	EXPECT_RET(txcounters.num_tx_calls == 1);
+	EXPECT(test_tcp_sack_tx_seqno(&txcounters) == iss + 2 * TCP_MSS);
+
+	/* nothing new: no further retransmission */
+	p = tcp_create_rx_segment_sack(pcb, NULL, 0, 0, 0, TCP_ACK, sack, 2);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	EXPECT_RET(txcounters.num_tx_calls == 0);
+
+	/* everything is acknowledged: recovery ends */
+	p = tcp_create_rx_segment(pcb, NULL, 0, 0, 6 * TCP_MSS, TCP_ACK);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	EXPECT(!(pcb->flags & TF_INFR));
+	EXPECT(pcb->unacked == NULL);
+	test_tcp_sack_tx_seqno(&txcounters);
+
+	/* make sure the pcb is freed */
+	EXPECT_RET(lwip_stats.memp[MEMP_TCP_PCB].used == 1);
+	tcp_abort(pcb);
+	EXPECT_RET(lwip_stats.memp[MEMP_TCP_PCB].used == 0);
+}
+
+END_TEST
+/** Segments 0, 2 and 4 of 7 are lost: after a partial ACK, cwnd is deflated
+ * and a single dupack with new SACK information repairs the next hole */
+START_TEST(test_tcp_sack_partial_ack)
+{
+	struct netif netif;
+	struct test_tcp_txcounters txcounters;
+	struct test_tcp_counters counters;
+	struct tcp_pcb *pcb;
+	struct pbuf *p;
+	ip_addr_t remote_ip, local_ip, netmask;
+	u16_t remote_port = 0x100, local_port = 0x101;
+	u32_t sack[4];
+	u32_t iss;
+	tcpwnd_size_t cwnd;
+	err_t err;
+	LWIP_UNUSED_ARG(_i);
+
+	/* initialize local vars */
+	IP4_ADDR(&local_ip, 192, 168, 1, 1);
+	IP4_ADDR(&remote_ip, 192, 168, 1, 2);
+	IP4_ADDR(&netmask, 255, 255, 255, 0);
+	test_tcp_init_netif(&netif, &txcounters, &local_ip, &netmask);
+	memset(&counters, 0, sizeof(counters));
+	memset(&txcounters, 0, sizeof(txcounters));
+
+	/* create and initialize the pcb */
+	pcb = test_tcp_new_counters_pcb(&counters);
+	EXPECT_RET(pcb != NULL);
+	tcp_set_state(pcb, ESTABLISHED, &local_ip, &remote_ip, local_port, remote_port);
+	pcb->flags |= TF_SACK;
+	pcb->mss = TCP_MSS;
+	/* disable initial congestion window (we don't send a SYN here...) */
+	pcb->cwnd = pcb->snd_wnd;
+	iss = pcb->lastack;
+
+	err = tcp_write(pcb, tx_data, 7 * TCP_MSS, TCP_WRITE_FLAG_COPY);
+	EXPECT_RET(err == ERR_OK);
+	err = tcp_output(pcb);
+	EXPECT_RET(err == ERR_OK);
+	EXPECT_RET(txcounters.num_tx_calls == 7);
+	test_tcp_sack_tx_seqno(&txcounters);
+
+	/* three duplicate ACKs SACKing segments 1, 3 and 5 */
+	sack[0] = iss + TCP_MSS;
+	sack[1] = iss + 2 * TCP_MSS;
+	p = tcp_create_rx_segment_sack(pcb, NULL, 0, 0, 0, TCP_ACK, sack, 1);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	sack[0] = iss + 3 * TCP_MSS;
+	sack[1] = iss + 4 * TCP_MSS;
+	sack[2] = iss + TCP_MSS;
+	sack[3] = iss + 2 * TCP_MSS;
+	p = tcp_create_rx_segment_sack(pcb, NULL, 0, 0, 0, TCP_ACK, sack, 2);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	sack[0] = iss + 5 * TCP_MSS;
+	sack[1] = iss + 6 * TCP_MSS;
+	sack[2] = iss + 3 * TCP_MSS;
+	sack[3] = iss + 4 * TCP_MSS;
+	p = tcp_create_rx_segment_sack(pcb, NULL, 0, 0, 0, TCP_ACK, sack, 2);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	EXPECT_RET(txcounters.num_tx_calls == 1);
+	EXPECT(test_tcp_sack_tx_seqno(&txcounters) == iss);
+	EXPECT(pcb->flags & TF_INFR);
+
+	/* partial ACK of segments 0 and 1: cwnd drops by the two ACKed
+	   segments less one, and the next hole is retransmitted */
+	cwnd = pcb->cwnd;
+	p = tcp_create_rx_segment_sack(pcb, NULL, 0, 0, 2 * TCP_MSS, TCP_ACK, sack, 2);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	EXPECT(pcb->flags & TF_INFR);
+	EXPECT(pcb->cwnd == cwnd - TCP_MSS);
+	EXPECT_RET(txcounters.num_tx_calls == 1);
+	EXPECT(test_tcp_sack_tx_seqno(&txcounters) == iss + 2 * TCP_MSS);
+
+	/* the first dupack after the partial ACK SACKs segment 6: the last
+	   hole is retransmitted although dupacks was reset */
+	sack[1] = iss + 7 * TCP_MSS;
+	p = tcp_create_rx_segment_sack(pcb, NULL, 0, 0, 0, TCP_ACK, sack, 2);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	EXPECT_RET(txcounters.num_tx_calls == 1);
+	EXPECT(test_tcp_sack_tx_seqno(&txcounters) == iss + 4 * TCP_MSS);
+
+	/* everything is acknowledged: recovery ends */
+	p = tcp_create_rx_segment(pcb, NULL, 0, 0, 5 * TCP_MSS, TCP_ACK);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	EXPECT(!(pcb->flags & TF_INFR));
+	EXPECT(pcb->unacked == NULL);
+	test_tcp_sack_tx_seqno(&txcounters);
+
+	/* make sure the pcb is freed */
+	EXPECT_RET(lwip_stats.memp[MEMP_TCP_PCB].used == 1);
+	tcp_abort(pcb);
+	EXPECT_RET(lwip_stats.memp[MEMP_TCP_PCB].used == 0);
+}
+
+END_TEST
+#if LWIP_TCP_TLP
+/** The tail of a flight is lost: a probe draws SACK feedback that starts recovery */
+START_TEST(test_tcp_tlp)
+{
+	struct netif netif;
+	struct test_tcp_txcounters txcounters;
+	struct test_tcp_counters counters;
+	struct tcp_pcb *pcb;
+	struct pbuf *p;
+	ip_addr_t remote_ip, local_ip, netmask;
+	u16_t remote_port = 0x100, local_port = 0x101;
+	u32_t sack[2];
+	u32_t iss;
+	err_t err;
+	LWIP_UNUSED_ARG(_i);
+
+	/* initialize local vars */
+	IP4_ADDR(&local_ip, 192, 168, 1, 1);
+	IP4_ADDR(&remote_ip, 192, 168, 1, 2);
+	IP4_ADDR(&netmask, 255, 255, 255, 0);
+	test_tcp_init_netif(&netif, &txcounters, &local_ip, &netmask);
+	memset(&counters, 0, sizeof(counters));
+	memset(&txcounters, 0, sizeof(txcounters));
+
+	/* create and initialize the pcb */
+	pcb = test_tcp_new_counters_pcb(&counters);
+	EXPECT_RET(pcb != NULL);
+	tcp_set_state(pcb, ESTABLISHED, &local_ip, &remote_ip, local_port, remote_port);
+	pcb->flags |= TF_SACK;
+	pcb->mss = TCP_MSS;
+	/* disable initial congestion window (we don't send a SYN here...) */
+	pcb->cwnd = pcb->snd_wnd;
+	iss = pcb->lastack;
+
+	err = tcp_write(pcb, tx_data, 3 * TCP_MSS, TCP_WRITE_FLAG_COPY);
+	EXPECT_RET(err == ERR_OK);
+	err = tcp_output(pcb);
+	EXPECT_RET(err == ERR_OK);
+	EXPECT_RET(txcounters.num_tx_calls == 3);
+	test_tcp_sack_tx_seqno(&txcounters);
+
+	/* the probe (last segment) goes out well before the RTO */
+	test_tcp_tmr();
+	test_tcp_tmr();
+	EXPECT_RET(txcounters.num_tx_calls == 0);
+	test_tcp_tmr();
+	test_tcp_tmr();
+	EXPECT_RET(txcounters.num_tx_calls == 1);
+	EXPECT(test_tcp_sack_tx_seqno(&txcounters) == iss + 2 * TCP_MSS);
+	EXPECT(pcb->flags & TF_TLP);
+	EXPECT(pcb->nrtx == 0);
+
+	/* only one probe per flight */
+	test_tcp_tmr();
+	test_tcp_tmr();
+	EXPECT_RET(txcounters.num_tx_calls == 0);
+
+	/* the probe is SACKed: the first hole is retransmitted at once */
+	sack[0] = iss + 2 * TCP_MSS;
+	sack[1] = iss + 3 * TCP_MSS;
+	p = tcp_create_rx_segment_sack(pcb, NULL, 0, 0, 0, TCP_ACK, sack, 1);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	EXPECT_RET(txcounters.num_tx_calls == 1);
+	EXPECT(test_tcp_sack_tx_seqno(&txcounters) == iss);
+	EXPECT(pcb->flags & TF_INFR);
+
+	/* a partial ACK retransmits the next hole */
+	p = tcp_create_rx_segment_sack(pcb, NULL, 0, 0, TCP_MSS, TCP_ACK, sack, 1);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	EXPECT_RET(txcounters.num_tx_calls == 1);
+	EXPECT(test_tcp_sack_tx_seqno(&txcounters) == iss + TCP_MSS);
+
+	p = tcp_create_rx_segment(pcb, NULL, 0, 0, 2 * TCP_MSS, TCP_ACK);
+	EXPECT_RET(p != NULL);
+	test_tcp_input(p, &netif);
+	EXPECT(!(pcb->flags & (TF_INFR | TF_TLP)));
+	EXPECT(pcb->unacked == NULL);
+	test_tcp_sack_tx_seqno(&txcounters);
+
+	/* make sure the pcb is freed */
+	EXPECT_RET(lwip_stats.memp[MEMP_TCP_PCB].used == 1);
+	tcp_abort(pcb);
+	EXPECT_RET(lwip_stats.memp[MEMP_TCP_PCB].used == 0);
+}
+
+END_TEST
+#endif							/* LWIP_TCP_TLP */
+#endif							/* LWIP_TCP_SACK */
 /** Create the suite including all tests for this module */
 Suite *tcp_suite(void)
 {
 	TFun tests[] = {
 		test_tcp_new_abort,
 		test_tcp_recv_inseq,
+		test_tcp_demux,
 		test_tcp_fast_retx_recover,
 		test_tcp_fast_rexmit_wraparound,
 		test_tcp_rto_rexmit_wraparound,
 		test_tcp_tx_full_window_lost_from_unacked,
-		test_tcp_tx_full_window_lost_from_unsent
+		test_tcp_tx_full_window_lost_from_unsent,
+#if LWIP_TCP_SACK
+		test_tcp_sack_rx,
+		test_tcp_sack_rexmit,
+		test_tcp_sack_partial_ack,
+#if LWIP_TCP_TLP
+		test_tcp_tlp,
+#endif
+#endif
 	};
 	return create_suite("TCP", tests, sizeof(tests) / sizeof(TFun), tcp_setup, tcp_teardown);
 }
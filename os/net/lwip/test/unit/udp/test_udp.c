@@ -18,7 +18,11 @@
 
 #include "test_udp.h"
 
+#include <string.h>
+
 #include "lwip/udp.h"
+#include "lwip/ip.h"
+#include "lwip/prot/udp.h"
 #include "lwip/stats.h"
 
 #if !LWIP_STATS || !UDP_STATS || !MEMP_STATS
@@ -39,6 +43,44 @@ static void udp_remove_all(void)
 	fail_unless(lwip_stats.memp[MEMP_UDP_PCB].used == 0);
 }
 
+/** Pass a datagram with an empty payload from src_port to dst_port to udp_input() */
+static void test_udp_input(struct netif *inp, u16_t src_port, u16_t dst_port)
+{
+	struct pbuf *p;
+	struct udp_hdr *udphdr;
+
+	p = pbuf_alloc(PBUF_RAW, UDP_HLEN, PBUF_RAM);
+	EXPECT_RET(p != NULL);
+	udphdr = (struct udp_hdr *)p->payload;
+	udphdr->src = lwip_htons(src_port);
+	udphdr->dest = lwip_htons(dst_port);
+	udphdr->len = lwip_htons(UDP_HLEN);
+	udphdr->chksum = 0;
+
+	ip_data.current_netif = inp;
+	ip_data.current_input_netif = inp;
+	ip_addr_copy(ip_data.current_iphdr_dest, inp->ip_addr);
+	IP_ADDR4(&ip_data.current_iphdr_src, 192, 168, 1, 2);
+
+	udp_input(p, inp);
+
+	ip_addr_set_zero(&ip_data.current_iphdr_dest);
+	ip_addr_set_zero(&ip_data.current_iphdr_src);
+	ip_data.current_netif = NULL;
+	ip_data.current_input_netif = NULL;
+}
+
+static void test_udp_recv(void *arg, struct udp_pcb *pcb, struct pbuf *p, const ip_addr_t *addr, u16_t port)
+{
+	u32_t *recv_calls = (u32_t *)arg;
+	LWIP_UNUSED_ARG(pcb);
+	LWIP_UNUSED_ARG(addr);
+	LWIP_UNUSED_ARG(port);
+
+	(*recv_calls)++;
+	pbuf_free(p);
+}
+
 /* Setups/teardown functions */
 
 static void udp_setup(void)
@@ -69,12 +111,100 @@ START_TEST(test_udp_new_remove)
 	}
 }
 
+END_TEST
+/** A port in use can't be bound again until its pcb is rebound or removed */
+START_TEST(test_udp_bind_rebind)
+{
+	struct udp_pcb *pcb1, *pcb2, *pcb3;
+	LWIP_UNUSED_ARG(_i);
+
+	pcb1 = udp_new();
+	pcb2 = udp_new();
+	pcb3 = udp_new();
+	fail_unless(pcb1 != NULL && pcb2 != NULL && pcb3 != NULL);
+
+	fail_unless(udp_bind(pcb1, IP_ADDR_ANY, 1000) == ERR_OK);
+	fail_unless(udp_bind(pcb2, IP_ADDR_ANY, 1000) == ERR_USE);
+
+	/* rebinding moves pcb1 off port 1000 */
+	fail_unless(udp_bind(pcb1, IP_ADDR_ANY, 1001) == ERR_OK);
+	fail_unless(udp_bind(pcb2, IP_ADDR_ANY, 1000) == ERR_OK);
+	fail_unless(udp_bind(pcb3, IP_ADDR_ANY, 1001) == ERR_USE);
+
+	/* removing pcb1 frees port 1001 */
+	udp_remove(pcb1);
+	fail_unless(udp_bind(pcb3, IP_ADDR_ANY, 1001) == ERR_OK);
+
+	/* a bind to port 0 never collides with a bound pcb */
+	pcb1 = udp_new();
+	fail_unless(pcb1 != NULL);
+	fail_unless(udp_bind(pcb1, IP_ADDR_ANY, 0) == ERR_OK);
+	fail_unless(pcb1->local_port != 0 && pcb1->local_port != 1000 && pcb1->local_port != 1001);
+
+	udp_remove(pcb1);
+	udp_remove(pcb2);
+	udp_remove(pcb3);
+	fail_unless(lwip_stats.memp[MEMP_UDP_PCB].used == 0);
+}
+
+END_TEST
+/** Bind more pcbs than there are hash buckets and check that every
+ * datagram reaches only the pcb bound to its destination port */
+START_TEST(test_udp_demux)
+{
+#define TEST_UDP_DEMUX_NPCBS 6
+	struct udp_pcb *pcbs[TEST_UDP_DEMUX_NPCBS];
+	u32_t recv_calls[TEST_UDP_DEMUX_NPCBS];
+	struct netif netif;
+	ip_addr_t peer;
+	int i, j;
+	LWIP_UNUSED_ARG(_i);
+
+	memset(&netif, 0, sizeof(netif));
+	IP_ADDR4(&netif.ip_addr, 192, 168, 1, 1);
+	IP_ADDR4(&netif.netmask, 255, 255, 255, 0);
+	IP_ADDR4(&peer, 192, 168, 1, 2);
+	memset(recv_calls, 0, sizeof(recv_calls));
+
+	for (i = 0; i < TEST_UDP_DEMUX_NPCBS; i++) {
+		pcbs[i] = udp_new();
+		fail_unless(pcbs[i] != NULL);
+		fail_unless(udp_bind(pcbs[i], IP_ADDR_ANY, (u16_t)(2000 + i)) == ERR_OK);
+		udp_recv(pcbs[i], test_udp_recv, &recv_calls[i]);
+	}
+
+	for (i = 0; i < TEST_UDP_DEMUX_NPCBS; i++) {
+		test_udp_input(&netif, 3000, (u16_t)(2000 + i));
+		for (j = 0; j < TEST_UDP_DEMUX_NPCBS; j++) {
+			fail_unless(recv_calls[j] == (u32_t)(j <= i ? 1 : 0));
+		}
+	}
+
+	/* a rebound pcb is found under its new port */
+	fail_unless(udp_bind(pcbs[1], IP_ADDR_ANY, 2100) == ERR_OK);
+	test_udp_input(&netif, 3000, 2100);
+	fail_unless(recv_calls[1] == 2);
+
+	/* a connected pcb still receives from its peer */
+	fail_unless(udp_connect(pcbs[2], &peer, 3000) == ERR_OK);
+	test_udp_input(&netif, 3000, 2002);
+	fail_unless(recv_calls[2] == 2);
+
+	for (i = 0; i < TEST_UDP_DEMUX_NPCBS; i++) {
+		udp_remove(pcbs[i]);
+	}
+	fail_unless(lwip_stats.memp[MEMP_UDP_PCB].used == 0);
+#undef TEST_UDP_DEMUX_NPCBS
+}
+
 END_TEST
 /** Create the suite including all tests for this module */
 Suite *udp_suite(void)
 {
 	TFun tests[] = {
 		test_udp_new_remove,
+		test_udp_bind_rebind,
+		test_udp_demux,
 	};
 	return create_suite("UDP", tests, sizeof(tests) / sizeof(TFun), udp_setup, udp_teardown);
 }
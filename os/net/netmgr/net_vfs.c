@@ -25,6 +25,7 @@
 #include <debug.h>
 #include <net/if.h>
 #include <tinyara/net/net.h>
+#include <tinyara/fs/fs.h>
 #include "netstack.h"
 #include <tinyara/net/netlog.h>
 
@@ -108,6 +109,12 @@ int net_dupsd2(int sd1, int sd2)
 
 int net_close(int sd)
 {
+#if defined(CONFIG_FS_EPOLL) && !defined(CONFIG_DISABLE_POLL)
+	/* Drop the epoll registrations before the socket is freed */
+
+	epoll_sockclose(sd);
+#endif
+
 	NETSTACK_CALL_BYFD(sd, close, (sd));
 }
 
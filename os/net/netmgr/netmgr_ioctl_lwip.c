@@ -560,7 +560,7 @@ int netdev_lwipioctl(int sockfd, int cmd, void *arg)
 	int ret = -ENOTTY;
 	NET_LOGKV(TAG, "cmd %d\n", cmd);
 
-	if (cmd == FIONREAD || cmd == FIONBIO) {
+	if (cmd == FIONREAD || cmd == FIONBIO || cmd == FIONSENDQ || cmd == FIONSENDQWAIT) {
 		ret = lwip_ioctl(sockfd, (long)cmd, arg);
 		if (ret == -1) {
 			return -get_errno();
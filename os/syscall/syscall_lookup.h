@@ -204,6 +204,12 @@ SYSCALL_LOOKUP(aio_cancel,              2, SYS_aio_cancel)
 #  ifndef CONFIG_DISABLE_POLL
 SYSCALL_LOOKUP(poll,                    3, STUB_poll)
 SYSCALL_LOOKUP(select,                  5, STUB_select)
+#    ifdef CONFIG_FS_EPOLL
+SYSCALL_LOOKUP(epoll_create,            1, STUB_epoll_create)
+SYSCALL_LOOKUP(epoll_create1,           1, STUB_epoll_create1)
+SYSCALL_LOOKUP(epoll_ctl,               4, STUB_epoll_ctl)
+SYSCALL_LOOKUP(epoll_wait,              4, STUB_epoll_wait)
+#    endif
 #  endif
 #endif
 
@@ -282,9 +288,15 @@ SYSCALL_LOOKUP(pthread_key_create,      2, STUB_pthread_key_create)
 SYSCALL_LOOKUP(pthread_key_delete,      1, STUB_pthread_key_delete)
 SYSCALL_LOOKUP(pthread_mutex_destroy,   1, STUB_pthread_mutex_destroy)
 SYSCALL_LOOKUP(pthread_mutex_init,      2, STUB_pthread_mutex_init)
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+SYSCALL_LOOKUP(pthread_mutex_lock_slow, 1, STUB_pthread_mutex_lock_slow)
+SYSCALL_LOOKUP(pthread_mutex_trylock_slow, 1, STUB_pthread_mutex_trylock_slow)
+SYSCALL_LOOKUP(pthread_mutex_unlock_slow, 1, STUB_pthread_mutex_unlock_slow)
+#else
 SYSCALL_LOOKUP(pthread_mutex_lock,      1, STUB_pthread_mutex_lock)
 SYSCALL_LOOKUP(pthread_mutex_trylock,   1, STUB_pthread_mutex_trylock)
 SYSCALL_LOOKUP(pthread_mutex_unlock,    1, STUB_pthread_mutex_unlock)
+#endif
 #ifndef CONFIG_PTHREAD_MUTEX_UNSAFE
 SYSCALL_LOOKUP(pthread_mutex_consistent, 1, STUB_pthread_mutex_consistent)
 #endif
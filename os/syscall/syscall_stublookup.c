@@ -197,6 +197,12 @@ uintptr_t STUB_poll(int nbr, uintptr_t parm1, uintptr_t parm2,
 					uintptr_t parm3);
 uintptr_t STUB_select(int nbr, uintptr_t parm1, uintptr_t parm2,
 					  uintptr_t parm3, uintptr_t parm4, uintptr_t parm5);
+uintptr_t STUB_epoll_create(int nbr, uintptr_t parm1);
+uintptr_t STUB_epoll_create1(int nbr, uintptr_t parm1);
+uintptr_t STUB_epoll_ctl(int nbr, uintptr_t parm1, uintptr_t parm2,
+						 uintptr_t parm3, uintptr_t parm4);
+uintptr_t STUB_epoll_wait(int nbr, uintptr_t parm1, uintptr_t parm2,
+						  uintptr_t parm3, uintptr_t parm4);
 
 uintptr_t STUB_aio_read(int nbr, uintptr_t parm1);
 uintptr_t STUB_aio_write(int nbr, uintptr_t parm1);
@@ -284,6 +290,9 @@ uintptr_t STUB_pthread_mutex_init(int nbr, uintptr_t parm1,
 uintptr_t STUB_pthread_mutex_lock(int nbr, uintptr_t parm1);
 uintptr_t STUB_pthread_mutex_trylock(int nbr, uintptr_t parm1);
 uintptr_t STUB_pthread_mutex_unlock(int nbr, uintptr_t parm1);
+uintptr_t STUB_pthread_mutex_lock_slow(int nbr, uintptr_t parm1);
+uintptr_t STUB_pthread_mutex_trylock_slow(int nbr, uintptr_t parm1);
+uintptr_t STUB_pthread_mutex_unlock_slow(int nbr, uintptr_t parm1);
 uintptr_t STUB_pthread_mutex_consistent(int nbr, uintptr_t parm1);
 uintptr_t STUB_pthread_setschedparam(int nbr, uintptr_t parm1,
 									 uintptr_t parm2, uintptr_t parm3);
@@ -41,6 +41,7 @@
 #include <tinyara/userspace.h>
 #include <tinyara/init.h>
 #include <tinyara/arch.h>
+#include <tinyara/pthread.h>
 
 #if defined(CONFIG_BUILD_PROTECTED) && !defined(__KERNEL__)
 
@@ -61,6 +62,10 @@ const struct userspace_s userspace __attribute__((section(".userspace"))) = {
 #ifndef CONFIG_DISABLE_SIGNALS
 	.signal_handler = up_signal_handler,
 #endif
+	/* PID of the running thread for the mutex fast path */
+#ifdef CONFIG_PTHREAD_MUTEX_FASTPATH
+	.curr_pid = &g_pthread_curr_pid,
+#endif
 
 };
 
@@ -75,6 +75,33 @@ genromfs -h 1>/dev/null 2>&1 || { \
   exit 1; \
 }
 
+# Compile the IoT.js application scripts to snapshots in a copy of the contents
+
+if grep -q "^CONFIG_IOTJS_SNAPSHOT_APPS=y" ${OS_PATH}/.config 2>/dev/null; then
+  IOTJS_PATH=${OS_PATH}/../external/iotjs
+  if grep -q "^CONFIG_DEBUG=y" ${OS_PATH}/.config; then
+    IOTJS_BUILDTYPE=debug
+  else
+    IOTJS_BUILDTYPE=release
+  fi
+  JERRY_HOST=${IOTJS_PATH}/build/arm-tizenrt/${IOTJS_BUILDTYPE}/deps/jerry-host/bin/jerry
+  if [ ! -x "${JERRY_HOST}" ]; then
+    echo "ERROR: ${JERRY_HOST} does not exist, build IoT.js first"
+    exit 1
+  fi
+
+  SNAPSHOT_OPTION=
+  if grep -q "^CONFIG_IOTJS_SNAPSHOT_APPS_KEEP_SOURCE=y" ${OS_PATH}/.config; then
+    SNAPSHOT_OPTION=--keep-source
+  fi
+
+  STAGING_PATH=${BIN_PATH}/contents-romfs
+  rm -rf ${STAGING_PATH}
+  cp -r ${CONTENTS_PATH} ${STAGING_PATH}
+  python ${IOTJS_PATH}/tools/js2snapshot.py --snapshot-generator=${JERRY_HOST} ${SNAPSHOT_OPTION} ${STAGING_PATH} || { echo "js2snapshot failed" ; exit 1 ; }
+  CONTENTS_PATH=${STAGING_PATH}
+fi
+
 # Now we are ready to make the ROMFS image
 
 genromfs -f ${ROMFS_IMG} -d ${CONTENTS_PATH} -x .gitignore -V "TinyAraROMVol" || { echo "genromfs failed" ; exit 1 ; }
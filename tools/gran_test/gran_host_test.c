@@ -0,0 +1,443 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * tools/gran_test/gran_host_test.c
+ *
+ *   Check the granule allocator of os/mm/mm_gran against a model which
+ *   searches a byte per granule for the first fit, and time both.
+ *
+ ****************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <tinyara/config.h>
+#include <tinyara/mm/gran.h>
+
+#include "mm_gran/mm_gran.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define MAXGRAN		4200
+#define MAXLOG2		6
+#define MAXRUN		32
+#define RANDOPS		20000
+#define BENCHOPS	200000
+#define MAXREPORT	20
+
+#define CHECK(cond, ...) \
+	do { \
+		if (!(cond)) { \
+			if (g_nerrors++ < MAXREPORT) { \
+				printf(__VA_ARGS__); \
+			} \
+		} \
+	} while (0)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct alloc_s {
+	unsigned int granno;
+	unsigned int ngranules;
+};
+
+/* The allocator under test and the model it is compared with */
+
+struct heap_s {
+	GRAN_HANDLE handle;
+	unsigned int ngranules;
+	uint8_t log2gran;
+	unsigned int nused;
+	unsigned int nallocs;
+	uint8_t used[MAXGRAN];
+	struct alloc_s allocs[MAXGRAN];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static uint64_t g_mem[(MAXGRAN << MAXLOG2) / sizeof(uint64_t)];
+static struct heap_s g_heap;
+static struct alloc_s g_start[MAXGRAN];
+static struct alloc_s g_result[MAXGRAN];
+static int g_nerrors;
+static unsigned int g_sink;
+
+static const int g_fill[] = { 25, 50, 75, 90, 98 };
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void heap_init(struct heap_s *heap, unsigned int ngranules, uint8_t log2gran)
+{
+	if (heap->handle) {
+		free(heap->handle);
+	}
+
+	memset(heap, 0, sizeof(*heap));
+	heap->handle = gran_initialize(g_mem, (size_t)ngranules << log2gran, log2gran, 0);
+	heap->ngranules = ngranules;
+	heap->log2gran = log2gran;
+}
+
+/* First granule of the model that starts a run of n free granules, or -1 */
+
+static int model_first_fit(struct heap_s *heap, unsigned int n)
+{
+	unsigned int run = 0;
+	unsigned int i;
+
+	for (i = 0; i < heap->ngranules; i++) {
+		run = heap->used[i] ? 0 : run + 1;
+		if (run == n) {
+			return i + 1 - n;
+		}
+	}
+
+	return -1;
+}
+
+/* Compare the GAT, its summary and the hints with the model */
+
+static void check_state(struct heap_s *heap, const char *what)
+{
+	FAR struct gran_s *priv = (FAR struct gran_s *)heap->handle;
+	unsigned int ngat = SIZEOF_GAT(heap->ngranules);
+	unsigned int first[GRAN_NHINTS];
+	unsigned int run = 0;
+	unsigned int granno;
+	unsigned int i;
+	uint32_t expect;
+	uint32_t sumbit;
+
+	for (i = 0; i < ngat; i++) {
+		expect = 0;
+		for (granno = i << 5; granno < (i + 1) << 5; granno++) {
+			if (granno >= heap->ngranules || heap->used[granno]) {
+				expect |= (uint32_t)1 << (granno & 31);
+			}
+		}
+
+		CHECK(priv->gat[i] == expect, "%s: gat[%u] %08x, expected %08x\n", what, i, priv->gat[i], expect);
+
+		sumbit = (priv->gsum[i >> 5] >> (i & 31)) & 1;
+		CHECK(sumbit == (expect != 0xffffffff), "%s: summary bit %u is %u\n", what, i, sumbit);
+	}
+
+	/* No run of n free granules may start before hint[n - 1] */
+
+	for (i = 0; i < GRAN_NHINTS; i++) {
+		first[i] = heap->ngranules;
+	}
+
+	for (granno = 0; granno < heap->ngranules; granno++) {
+		run = heap->used[granno] ? 0 : run + 1;
+		for (i = 0; i < GRAN_NHINTS && i < run; i++) {
+			if (first[i] > granno - i) {
+				first[i] = granno - i;
+			}
+		}
+	}
+
+	for (i = 0; i < GRAN_NHINTS; i++) {
+		CHECK(priv->hint[i] <= first[i], "%s: hint[%u] %u is past a free run at %u\n", what, i, priv->hint[i], first[i]);
+	}
+}
+
+/* Allocate n granules, which must come from the first fit of the model */
+
+static int do_alloc(struct heap_s *heap, unsigned int n, const char *what)
+{
+	struct alloc_s *alloc;
+	uintptr_t base = (uintptr_t)g_mem;
+	FAR void *mem;
+	int expect;
+	int granno;
+
+	expect = model_first_fit(heap, n);
+	mem = gran_alloc(heap->handle, (size_t)n << heap->log2gran);
+	granno = mem ? (int)(((uintptr_t)mem - base) >> heap->log2gran) : -1;
+
+	CHECK(granno == expect, "%s: %u granules at %d, expected %d\n", what, n, granno, expect);
+	if (granno < 0 || granno != expect) {
+		return -1;
+	}
+
+	memset(&heap->used[granno], 1, n);
+	heap->nused += n;
+
+	alloc = &heap->allocs[heap->nallocs++];
+	alloc->granno = granno;
+	alloc->ngranules = n;
+	return granno;
+}
+
+static void do_free(struct heap_s *heap, unsigned int idx)
+{
+	struct alloc_s *alloc = &heap->allocs[idx];
+
+	gran_free(heap->handle, (FAR uint8_t *)g_mem + ((size_t)alloc->granno << heap->log2gran), (size_t)alloc->ngranules << heap->log2gran);
+	memset(&heap->used[alloc->granno], 0, alloc->ngranules);
+	heap->nused -= alloc->ngranules;
+	*alloc = heap->allocs[--heap->nallocs];
+}
+
+/* Free the allocation of one granule which starts at granno */
+
+static void free_granule(struct heap_s *heap, unsigned int granno)
+{
+	unsigned int i;
+
+	for (i = 0; i < heap->nallocs; i++) {
+		if (heap->allocs[i].granno == granno) {
+			do_free(heap, i);
+			return;
+		}
+	}
+
+	CHECK(0, "no allocation at granule %u\n", granno);
+}
+
+/* Mostly short runs, which have their own hints, and some long ones */
+
+static unsigned int rand_run(void)
+{
+	return (rand() & 3) == 0 ? 1 + rand() % MAXRUN : 1 + rand() % GRAN_NHINTS;
+}
+
+/* A full heap with one free granule near its end and one free pair across
+ * a GAT entry boundary, found through the summary
+ */
+
+static void test_summary(void)
+{
+	unsigned int i;
+
+	heap_init(&g_heap, 3005, 4);
+	for (i = 0; i < g_heap.ngranules; i++) {
+		do_alloc(&g_heap, 1, "fill");
+	}
+
+	check_state(&g_heap, "full");
+	CHECK(gran_alloc(g_heap.handle, 16) == NULL, "full heap: allocated\n");
+
+	free_granule(&g_heap, 2999);
+	check_state(&g_heap, "free 2999");
+	do_alloc(&g_heap, 1, "summary 1");
+
+	free_granule(&g_heap, 1024);
+	free_granule(&g_heap, 1023);
+	check_state(&g_heap, "free 1023-1024");
+	do_alloc(&g_heap, 2, "summary 2 across entries");
+
+	/* The granules past the end of the heap are never free */
+
+	free_granule(&g_heap, 3004);
+	do_alloc(&g_heap, 2, "past the end");
+	do_alloc(&g_heap, 1, "last granule");
+	check_state(&g_heap, "summary");
+}
+
+/* Runs freed behind the hints, granule by granule and out of order, must
+ * be found by the next allocation of their length
+ */
+
+static void test_hint_rollback(void)
+{
+	unsigned int n;
+	unsigned int i;
+
+	for (n = 1; n <= GRAN_NHINTS + 1; n++) {
+		heap_init(&g_heap, 1000, 4);
+		for (i = 0; i < g_heap.ngranules; i++) {
+			do_alloc(&g_heap, 1, "fill");
+		}
+
+		/* Every hint is at the end of the heap now */
+
+		do_alloc(&g_heap, n, "full");
+
+		/* Free n granules from 300, the middle one last */
+
+		for (i = 0; i < n; i++) {
+			if (i != n / 2) {
+				free_granule(&g_heap, 300 + i);
+			}
+		}
+
+		free_granule(&g_heap, 300 + n / 2);
+		check_state(&g_heap, "rollback");
+		do_alloc(&g_heap, n, "rollback");
+
+		/* A longer run just before an allocated granule */
+
+		free_granule(&g_heap, 100);
+		free_granule(&g_heap, 99);
+		do_alloc(&g_heap, 2, "rollback pair");
+		check_state(&g_heap, "rollback pair");
+	}
+}
+
+/* Random allocations and frees around a fill level, checked after each */
+
+static void test_random(unsigned int ngranules, uint8_t log2gran)
+{
+	char what[48];
+	unsigned int target;
+	unsigned int f;
+	int op;
+
+	heap_init(&g_heap, ngranules, log2gran);
+	for (f = 0; f < sizeof(g_fill) / sizeof(g_fill[0]); f++) {
+		target = ngranules * g_fill[f] / 100;
+		snprintf(what, sizeof(what), "%u granules %d%% full", ngranules, g_fill[f]);
+		for (op = 0; op < RANDOPS; op++) {
+			if (g_heap.nused < target || g_heap.nallocs == 0) {
+				do_alloc(&g_heap, rand_run(), what);
+			} else {
+				do_free(&g_heap, rand() % g_heap.nallocs);
+			}
+
+			check_state(&g_heap, what);
+		}
+	}
+
+	while (g_heap.nallocs > 0) {
+		do_free(&g_heap, g_heap.nallocs - 1);
+	}
+
+	check_state(&g_heap, "empty");
+}
+
+static double elapsed_ns(struct timespec *start)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec - start->tv_sec) * 1e9 + (now.tv_nsec - start->tv_nsec);
+}
+
+/* Time alloc and free pairs at each fill level, against the first fit
+ * search of the model.  Both replay the same operations from the same
+ * allocations, so they must end with the same allocations.
+ */
+
+static void bench(unsigned int ngranules)
+{
+	struct timespec start;
+	struct alloc_s *alloc;
+	unsigned int target;
+	unsigned int f;
+	unsigned int n;
+	double granns;
+	double modelns;
+	FAR void *mem;
+	int granno;
+	int op;
+
+	printf("%u granules   gran   first fit  (ns per alloc and free)\n", ngranules);
+	heap_init(&g_heap, ngranules, 4);
+	for (f = 0; f < sizeof(g_fill) / sizeof(g_fill[0]); f++) {
+		target = ngranules * g_fill[f] / 100;
+		while (g_heap.nused < target) {
+			if (do_alloc(&g_heap, rand_run(), "bench fill") < 0) {
+				break;
+			}
+		}
+
+		/* Free a random allocation and allocate the same length again */
+
+		memcpy(g_start, g_heap.allocs, g_heap.nallocs * sizeof(struct alloc_s));
+		srand(f);
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (op = 0; op < BENCHOPS; op++) {
+			alloc = &g_heap.allocs[rand() % g_heap.nallocs];
+			gran_free(g_heap.handle, (FAR uint8_t *)g_mem + ((size_t)alloc->granno << 4), (size_t)alloc->ngranules << 4);
+			mem = gran_alloc(g_heap.handle, (size_t)alloc->ngranules << 4);
+			alloc->granno = ((uintptr_t)mem - (uintptr_t)g_mem) >> 4;
+		}
+
+		granns = elapsed_ns(&start) / BENCHOPS;
+
+		memcpy(g_result, g_heap.allocs, g_heap.nallocs * sizeof(struct alloc_s));
+		memcpy(g_heap.allocs, g_start, g_heap.nallocs * sizeof(struct alloc_s));
+
+		srand(f);
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (op = 0; op < BENCHOPS; op++) {
+			alloc = &g_heap.allocs[rand() % g_heap.nallocs];
+			memset(&g_heap.used[alloc->granno], 0, alloc->ngranules);
+			granno = model_first_fit(&g_heap, alloc->ngranules);
+			memset(&g_heap.used[granno], 1, alloc->ngranules);
+			alloc->granno = granno;
+			g_sink += granno;
+		}
+
+		modelns = elapsed_ns(&start) / BENCHOPS;
+
+		for (n = 0; n < g_heap.nallocs; n++) {
+			CHECK(g_result[n].granno == g_heap.allocs[n].granno, "bench %d%%: allocation %u at %u, expected %u\n", g_fill[f], n, g_result[n].granno, g_heap.allocs[n].granno);
+		}
+
+		printf("  %3d%% full %8.1f %8.1f\n", g_fill[f], granns, modelns);
+		check_state(&g_heap, "bench");
+	}
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/* The allocator is only used by one thread here */
+
+void gran_enter_critical(FAR struct gran_s *priv)
+{
+}
+
+void gran_leave_critical(FAR struct gran_s *priv)
+{
+}
+
+int main(int argc, char *argv[])
+{
+	srand(1);
+
+	test_summary();
+	test_hint_rollback();
+	test_random(100, 4);
+	test_random(1007, 5);
+	test_random(2048, 4);
+	test_random(4111, 6);
+
+	printf("%d-bit words: %s, %d errors\n", (int)(sizeof(uintptr_t) * 8), g_nerrors ? "FAIL" : "PASS", g_nerrors);
+	if (g_nerrors == 0) {
+		bench(1024);
+		bench(4096);
+	}
+
+	return g_nerrors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
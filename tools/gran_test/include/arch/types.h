@@ -0,0 +1,30 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * tools/gran_test/include/arch/types.h
+ *
+ *   Types of the architecture the os/mm/mm_gran sources need on the host.
+ *
+ ****************************************************************************/
+
+#ifndef __TOOLS_GRAN_TEST_INCLUDE_ARCH_TYPES_H
+#define __TOOLS_GRAN_TEST_INCLUDE_ARCH_TYPES_H
+
+typedef unsigned long irqstate_t;
+
+#endif							/* __TOOLS_GRAN_TEST_INCLUDE_ARCH_TYPES_H */
@@ -0,0 +1,34 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * tools/gran_test/include/assert.h
+ *
+ *   The host assert.h with the TinyAra assertions, which stay enabled so
+ *   that the consistency checks of the allocator run.
+ *
+ ****************************************************************************/
+
+#ifndef __TOOLS_GRAN_TEST_INCLUDE_ASSERT_H
+#define __TOOLS_GRAN_TEST_INCLUDE_ASSERT_H
+
+#include_next <assert.h>
+
+#define ASSERT(f)      assert(f)
+#define DEBUGASSERT(f) assert(f)
+
+#endif							/* __TOOLS_GRAN_TEST_INCLUDE_ASSERT_H */
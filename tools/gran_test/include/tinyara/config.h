@@ -0,0 +1,36 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * tools/gran_test/include/tinyara/config.h
+ *
+ *   Configuration the os/mm/mm_gran sources are built with on the host.
+ *
+ ****************************************************************************/
+
+#ifndef __TOOLS_GRAN_TEST_INCLUDE_TINYARA_CONFIG_H
+#define __TOOLS_GRAN_TEST_INCLUDE_TINYARA_CONFIG_H
+
+#include <stddef.h>				/* NULL, from sys/types.h on TinyAra */
+
+#define CONFIG_GRAN 1
+#define CONFIG_GRAN_INTR 1
+
+#define FAR
+#define OK 0
+
+#endif							/* __TOOLS_GRAN_TEST_INCLUDE_TINYARA_CONFIG_H */
@@ -0,0 +1,34 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * tools/libc_string_test/include/tinyara/config.h
+ *
+ *   Configuration the lib/libc/string sources are built with on the host.
+ *
+ ****************************************************************************/
+
+#ifndef __TOOLS_LIBC_STRING_TEST_INCLUDE_TINYARA_CONFIG_H
+#define __TOOLS_LIBC_STRING_TEST_INCLUDE_TINYARA_CONFIG_H
+
+#define CONFIG_LIBC_STRING_OPTSPEED 1
+#define CONFIG_MEMSET_OPTSPEED 1
+#define CONFIG_STDIO_BUFFER_SIZE 0
+
+#define FAR
+
+#endif							/* __TOOLS_LIBC_STRING_TEST_INCLUDE_TINYARA_CONFIG_H */
@@ -0,0 +1,29 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * tools/libc_string_test/include/tinyara/streams.h
+ *
+ *   Empty stand-in, lib_internal.h only needs the stream types as
+ *   incomplete types for the string functions.
+ *
+ ****************************************************************************/
+
+#ifndef __TOOLS_LIBC_STRING_TEST_INCLUDE_TINYARA_STREAMS_H
+#define __TOOLS_LIBC_STRING_TEST_INCLUDE_TINYARA_STREAMS_H
+
+#endif							/* __TOOLS_LIBC_STRING_TEST_INCLUDE_TINYARA_STREAMS_H */
@@ -0,0 +1,276 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * tools/libc_string_test/string_host_test.c
+ *
+ *   Compare the lib/libc string functions, renamed to tr_<name>, with the
+ *   host C library.
+ *
+ ****************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define ALIGNS		8
+#define MAXSIZE		300
+#define BUFSIZE		(MAXSIZE + 2 * ALIGNS + 16)
+#define GUARD		0xa5
+#define MAXREPORT	20
+
+#define BENCHSIZE	4096
+#define BENCHLOOPS	20000
+
+#define CHECK(cond, ...) \
+	do { \
+		if (!(cond)) { \
+			if (g_nerrors++ < MAXREPORT) { \
+				printf(__VA_ARGS__); \
+			} \
+		} \
+	} while (0)
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+void *tr_memcpy(void *dest, const void *src, size_t n);
+void *tr_memmove(void *dest, const void *src, size_t n);
+void *tr_memset(void *s, int c, size_t n);
+int tr_memcmp(const void *s1, const void *s2, size_t n);
+void *tr_memchr(const void *s, int c, size_t n);
+size_t tr_strlen(const char *s);
+char *tr_strchr(const char *s, int c);
+int tr_strcmp(const char *s1, const char *s2);
+char *tr_strcpy(char *dest, const char *src);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static unsigned char g_a[BUFSIZE];
+static unsigned char g_b[BUFSIZE];
+static unsigned char g_c[BUFSIZE];
+static int g_nerrors;
+static volatile size_t g_sink;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static int sign(int result)
+{
+	return (result > 0) - (result < 0);
+}
+
+/* Non-zero bytes, the high bit set in some of them */
+
+static void fill(unsigned char *buf, int len, int seed)
+{
+	int i;
+
+	for (i = 0; i < len; i++) {
+		buf[i] = (unsigned char)(seed * 31 + i * 7) | 1;
+	}
+}
+
+static void check_mem(int sa, int da, int n)
+{
+	unsigned char *a = g_a + sa;
+	int k;
+
+	/* memcpy, and memset with an int outside of the char range */
+
+	fill(g_a, BUFSIZE, n);
+	memset(g_b, GUARD, BUFSIZE);
+	memset(g_c, GUARD, BUFSIZE);
+	CHECK(tr_memcpy(g_b + da, a, n) == g_b + da, "memcpy  returns wrong pointer\n");
+	memcpy(g_c + da, a, n);
+	CHECK(memcmp(g_b, g_c, BUFSIZE) == 0, "memcpy  src+%d dst+%d %d bytes\n", sa, da, n);
+
+	CHECK(tr_memset(g_b + da, 0x1c3, n) == g_b + da, "memset  returns wrong pointer\n");
+	memset(g_c + da, 0x1c3, n);
+	CHECK(memcmp(g_b, g_c, BUFSIZE) == 0, "memset  dst+%d %d bytes\n", da, n);
+
+	/* memmove within one buffer, overlapping both ways and not at all */
+
+	fill(g_b, BUFSIZE, n);
+	memcpy(g_c, g_b, BUFSIZE);
+	tr_memmove(g_b + da + ALIGNS, g_b + sa, n);
+	memmove(g_c + da + ALIGNS, g_c + sa, n);
+	CHECK(memcmp(g_b, g_c, BUFSIZE) == 0, "memmove up   src+%d dst+%d %d bytes\n", sa, da, n);
+
+	fill(g_b, BUFSIZE, n);
+	memcpy(g_c, g_b, BUFSIZE);
+	tr_memmove(g_b + da, g_b + sa + ALIGNS, n);
+	memmove(g_c + da, g_c + sa + ALIGNS, n);
+	CHECK(memcmp(g_b, g_c, BUFSIZE) == 0, "memmove down src+%d dst+%d %d bytes\n", sa, da, n);
+
+	fill(g_b, BUFSIZE, n);
+	memcpy(g_c, g_b, BUFSIZE);
+	tr_memmove(g_b + da, g_b + sa, n);
+	memmove(g_c + da, g_c + sa, n);
+	CHECK(memcmp(g_b, g_c, BUFSIZE) == 0, "memmove near src+%d dst+%d %d bytes\n", sa, da, n);
+
+	/* memcmp of equal buffers, then with each byte changed up and down */
+
+	memcpy(g_b + da, a, n);
+	CHECK(tr_memcmp(a, g_b + da, n) == 0, "memcmp  src+%d dst+%d %d bytes equal\n", sa, da, n);
+	for (k = 0; k < n; k++) {
+		g_b[da + k] = a[k] ^ 0x80;
+		CHECK(sign(tr_memcmp(a, g_b + da, n)) == sign(memcmp(a, g_b + da, n)), "memcmp  src+%d dst+%d %d bytes, differs at %d\n", sa, da, n, k);
+		g_b[da + k] = a[k] - 1;
+		CHECK(sign(tr_memcmp(a, g_b + da, n)) == sign(memcmp(a, g_b + da, n)), "memcmp  src+%d dst+%d %d bytes, lower at %d\n", sa, da, n, k);
+		g_b[da + k] = a[k];
+	}
+
+	/* memchr of every byte, a missing one and one outside the char range */
+
+	if (da == 0) {
+		for (k = 0; k < n; k++) {
+			CHECK(tr_memchr(a, a[k], n) == memchr(a, a[k], n), "memchr  src+%d %d bytes, at %d\n", sa, n, k);
+		}
+
+		CHECK(tr_memchr(a, 0, n) == memchr(a, 0, n), "memchr  src+%d %d bytes, missing\n", sa, n);
+		CHECK(tr_memchr(a, 0x100 | a[n / 2], n) == memchr(a, 0x100 | a[n / 2], n), "memchr  src+%d %d bytes, int\n", sa, n);
+	}
+}
+
+static void check_str(int sa, int da, int n)
+{
+	char *a = (char *)g_a + sa;
+	char *b = (char *)g_b + da;
+	int k;
+
+	fill(g_a, BUFSIZE, n);
+	a[n] = '\0';
+
+	CHECK(tr_strlen(a) == (size_t)n, "strlen  src+%d %d bytes\n", sa, n);
+
+	memset(g_b, GUARD, BUFSIZE);
+	memset(g_c, GUARD, BUFSIZE);
+	CHECK(tr_strcpy(b, a) == b, "strcpy  returns wrong pointer\n");
+	strcpy((char *)g_c + da, a);
+	CHECK(memcmp(g_b, g_c, BUFSIZE) == 0, "strcpy  src+%d dst+%d %d bytes\n", sa, da, n);
+
+	/* strcmp of equal strings, then with each byte changed to a higher,
+	 * a lower and a NUL byte
+	 */
+
+	CHECK(tr_strcmp(a, b) == 0, "strcmp  src+%d dst+%d %d bytes equal\n", sa, da, n);
+	for (k = 0; k < n; k++) {
+		b[k] = a[k] ^ 0x80;
+		CHECK(sign(tr_strcmp(a, b)) == sign(strcmp(a, b)), "strcmp  src+%d dst+%d %d bytes, differs at %d\n", sa, da, n, k);
+		CHECK(sign(tr_strcmp(b, a)) == sign(strcmp(b, a)), "strcmp  dst+%d src+%d %d bytes, differs at %d\n", da, sa, n, k);
+		b[k] = '\0';
+		CHECK(sign(tr_strcmp(a, b)) == sign(strcmp(a, b)), "strcmp  src+%d dst+%d %d bytes, ends at %d\n", sa, da, n, k);
+		b[k] = a[k];
+	}
+
+	/* strchr of every byte, the NUL, a missing one and an int */
+
+	if (da == 0) {
+		for (k = 0; k < n; k++) {
+			CHECK(tr_strchr(a, a[k]) == strchr(a, a[k]), "strchr  src+%d %d bytes, at %d\n", sa, n, k);
+		}
+
+		CHECK(tr_strchr(a, '\0') == strchr(a, '\0'), "strchr  src+%d %d bytes, NUL\n", sa, n);
+		CHECK(tr_strchr(a, 0x80) == strchr(a, 0x80), "strchr  src+%d %d bytes, missing\n", sa, n);
+		if (n > 0) {
+			CHECK(tr_strchr(a, 0x100 | (unsigned char)a[0]) == strchr(a, 0x100 | (unsigned char)a[0]), "strchr  src+%d %d bytes, int\n", sa, n);
+		}
+	}
+}
+
+static double elapsed_ms(clock_t start)
+{
+	return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+#define BENCH(name, trexpr, hostexpr) \
+	do { \
+		clock_t start; \
+		double trms; \
+		int r; \
+		start = clock(); \
+		for (r = 0; r < BENCHLOOPS; r++) { \
+			g_sink += (size_t)(trexpr); \
+		} \
+		trms = elapsed_ms(start); \
+		start = clock(); \
+		for (r = 0; r < BENCHLOOPS; r++) { \
+			g_sink += (size_t)(hostexpr); \
+		} \
+		printf("%-16s %8.1f ms %8.1f ms\n", name, trms, elapsed_ms(start)); \
+	} while (0)
+
+static void bench(void)
+{
+	static char src[BENCHSIZE + 16];
+	static char dst[BENCHSIZE + 16];
+
+	memset(src, 'x', sizeof(src));
+	src[BENCHSIZE + 1] = '\0';
+	memcpy(dst, src, sizeof(dst));
+
+	printf("%d calls on %d bytes  TinyAra     host\n", BENCHLOOPS, BENCHSIZE);
+	BENCH("memcpy", tr_memcpy(dst, src, BENCHSIZE), memcpy(dst, src, BENCHSIZE));
+	BENCH("memcpy unaligned", tr_memcpy(dst + 1, src + 2, BENCHSIZE), memcpy(dst + 1, src + 2, BENCHSIZE));
+	BENCH("memmove", tr_memmove(dst + 1, dst, BENCHSIZE), memmove(dst + 1, dst, BENCHSIZE));
+	BENCH("memset", tr_memset(dst, 0, BENCHSIZE), memset(dst, 0, BENCHSIZE));
+	memcpy(dst, src, sizeof(dst));
+	BENCH("memcmp", tr_memcmp(dst, src, BENCHSIZE), memcmp(dst, src, BENCHSIZE));
+	BENCH("memchr", tr_memchr(src, 'y', BENCHSIZE), memchr(src, 'y', BENCHSIZE));
+	BENCH("strlen", tr_strlen(src + 1), strlen(src + 1));
+	BENCH("strchr", tr_strchr(src + 1, 'y'), strchr(src + 1, 'y'));
+	BENCH("strcmp", tr_strcmp(src + 1, dst + 1), strcmp(src + 1, dst + 1));
+	BENCH("strcpy", tr_strcpy(dst + 1, src + 1), strcpy(dst + 1, src + 1));
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+int main(int argc, char *argv[])
+{
+	int sa;
+	int da;
+	int n;
+
+	for (sa = 0; sa < ALIGNS; sa++) {
+		for (da = 0; da < ALIGNS; da++) {
+			for (n = 0; n <= MAXSIZE; n++) {
+				check_mem(sa, da, n);
+				check_str(sa, da, n);
+			}
+		}
+	}
+
+	printf("%d-bit words: %s, %d errors\n", (int)(sizeof(uintptr_t) * 8), g_nerrors ? "FAIL" : "PASS", g_nerrors);
+	if (g_nerrors == 0) {
+		bench();
+	}
+
+	return g_nerrors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,188 @@
+#!/usr/bin/env python
+###########################################################################
+#
+# Copyright 2026 Samsung Electronics All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+# either express or implied. See the License for the specific
+# language governing permissions and limitations under the License.
+#
+###########################################################################
+#
+# Report of the heap allocation profiler (CONFIG_MM_HEAPPROF).
+# The input is a log which contains the output of "cat /proc/heapprof".
+# See HowToUseHeapProfiler.md.
+
+from __future__ import print_function
+
+import argparse
+import subprocess
+import sys
+
+# A call site is the return address of the allocation call.  It has the
+# thumb bit set and points after the branch, so the branch is looked up.
+def call_address(addr):
+    return (addr & ~1) - 2
+
+class Callsite(object):
+    def __init__(self, fields):
+        self.addr = int(fields[0], 16)
+        (self.nallocs, self.nfrees, self.curr_size, self.peak_size,
+         self.total_size, self.nlifetimes, self.lifetime) = [int(x) for x in fields[1:8]]
+        self.name = '0x%08x' % self.addr
+
+    def mean_lifetime(self):
+        if self.nlifetimes == 0:
+            return None
+        return float(self.lifetime) / self.nlifetimes
+
+class Sample(object):
+    def __init__(self, fields):
+        self.mem = int(fields[0], 16)
+        self.addr = int(fields[1], 16)
+        self.size = int(fields[2])
+        self.pid = int(fields[3])
+        self.alloc_time = int(fields[4])
+        self.free_time = None if fields[5] == '-' else int(fields[5])
+
+class Profile(object):
+    def __init__(self):
+        self.now = 0
+        self.hz = 100
+        self.callsites = []
+        self.hist = []
+        self.samples = []
+        self.totals = None
+
+def parse(lines):
+    prof = None
+    for line in lines:
+        # Skip the shell prompt or log prefixes before the keywords
+        fields = line.split()
+        for i, word in enumerate(fields):
+            if word in ('heapprof', 'callsite', 'hist', 'sample', 'total'):
+                fields = fields[i:]
+                break
+        else:
+            continue
+
+        try:
+            if fields[0] == 'heapprof' and len(fields) == 3:
+                # The last dump of the log is reported
+                prof = Profile()
+                prof.now = int(fields[1])
+                prof.hz = int(fields[2])
+            elif prof is None:
+                continue
+            elif fields[0] == 'callsite' and len(fields) == 9:
+                prof.callsites.append(Callsite(fields[1:]))
+            elif fields[0] == 'hist' and len(fields) == 3:
+                prof.hist.append((int(fields[1]), int(fields[2])))
+            elif fields[0] == 'sample' and len(fields) == 7:
+                prof.samples.append(Sample(fields[1:]))
+            elif fields[0] == 'total' and len(fields) == 5:
+                prof.totals = [int(x) for x in fields[1:]]
+        except ValueError:
+            continue
+    return prof
+
+def symbolize(callsites, elf, prefix):
+    if elf is None or not callsites:
+        return
+    cmd = [prefix + 'addr2line', '-f', '-C', '-e', elf]
+    cmd += ['0x%x' % call_address(c.addr) for c in callsites]
+    try:
+        out = subprocess.check_output(cmd).decode('utf-8', 'replace').splitlines()
+    except (OSError, subprocess.CalledProcessError) as e:
+        print('addr2line failed: %s' % e, file=sys.stderr)
+        return
+    # Two lines per address: function, then file:line
+    for i, c in enumerate(callsites):
+        if 2 * i + 1 >= len(out):
+            break
+        func = out[2 * i]
+        where = out[2 * i + 1].split(' ')[0]
+        if func != '??':
+            c.name = '%s %s' % (func, where)
+
+def ticks_to_ms(ticks, hz):
+    return 1000.0 * ticks / hz
+
+def print_table(title, callsites, hz):
+    print(title)
+    print('%10s %10s %10s %8s %8s %10s  %s' % ('PEAK', 'TOTAL', 'LIVE', 'ALLOCS', 'FREES', 'LIFE(ms)', 'CALLSITE'))
+    for c in callsites:
+        life = c.mean_lifetime()
+        life = '-' if life is None else '%.1f' % ticks_to_ms(life, hz)
+        print('%10d %10d %10d %8d %8d %10s  %s' % (c.peak_size, c.total_size, c.curr_size, c.nallocs, c.nfrees, life, c.name))
+    print('')
+
+def report(prof, top, small):
+    hz = prof.hz
+    if prof.totals is not None:
+        nallocs, nfrees, nlost_allocs, nlost_frees = prof.totals
+        print('Allocations %d, frees %d, not accounted: %d allocations, %d frees' % (nallocs, nfrees, nlost_allocs, nlost_frees))
+        if nlost_allocs:
+            print('The call site table is full, increase CONFIG_MM_HEAPPROF_NCALLSITES')
+        print('')
+
+    cs = prof.callsites
+    print_table('Top call sites by peak bytes', sorted(cs, key=lambda c: c.peak_size, reverse=True)[:top], hz)
+    print_table('Top call sites by total bytes', sorted(cs, key=lambda c: c.total_size, reverse=True)[:top], hz)
+    print_table('Top call sites by allocations', sorted(cs, key=lambda c: c.nallocs, reverse=True)[:top], hz)
+
+    live = [c for c in cs if c.curr_size > 0]
+    print_table('Live bytes (leak candidates)', sorted(live, key=lambda c: c.curr_size, reverse=True)[:top], hz)
+
+    print('Chunk size histogram')
+    total = sum(n for _, n in prof.hist) or 1
+    for lo, n in prof.hist:
+        if n:
+            print('%8d+ %10d %5.1f%% %s' % (lo, n, 100.0 * n / total, '#' * int(50 * n / total)))
+    print('')
+
+    # Small chunks which stay allocated for long split the free space.  The
+    # sampled chunks still allocated are ranked by their age.
+    names = dict((c.addr, c.name) for c in cs)
+    frag = {}
+    for s in prof.samples:
+        if s.free_time is not None or s.size > small:
+            continue
+        age = prof.now - s.alloc_time
+        entry = frag.setdefault(s.addr, [0, 0])
+        entry[0] += 1
+        entry[1] = max(entry[1], age)
+    print('Fragmentation candidates: live sampled chunks of up to %d bytes' % small)
+    print('%8s %12s  %s' % ('SAMPLES', 'MAXAGE(ms)', 'CALLSITE'))
+    for addr, (n, age) in sorted(frag.items(), key=lambda kv: kv[1][1], reverse=True)[:top]:
+        print('%8d %12.1f  %s' % (n, ticks_to_ms(age, hz), names.get(addr, '0x%08x' % addr)))
+
+def main():
+    parser = argparse.ArgumentParser(description='Report the output of /proc/heapprof')
+    parser.add_argument('log', help='log file with the output of "cat /proc/heapprof"')
+    parser.add_argument('-e', '--elf', default=None, help='ELF with debug symbols, e.g. ../../build/output/bin/tinyara')
+    parser.add_argument('-p', '--prefix', default='arm-none-eabi-', help='toolchain prefix of addr2line (default: arm-none-eabi-)')
+    parser.add_argument('-n', '--top', type=int, default=10, help='number of call sites in each table (default: 10)')
+    parser.add_argument('-s', '--small', type=int, default=256, help='largest chunk counted for fragmentation (default: 256)')
+    args = parser.parse_args()
+
+    with open(args.log) as f:
+        prof = parse(f)
+    if prof is None:
+        print('No heapprof output in %s' % args.log, file=sys.stderr)
+        return 1
+
+    symbolize(prof.callsites, args.elf, args.prefix)
+    report(prof, args.top, args.small)
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,195 @@
+#!/usr/bin/env python
+###########################################################################
+#
+# Copyright 2026 Samsung Electronics All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+# either express or implied. See the License for the specific
+# language governing permissions and limitations under the License.
+#
+###########################################################################
+#
+# Stack size recommendations from the stack high water marks
+# (CONFIG_STACK_HWM).  The input is a log which contains the output of
+# "cat /proc/stackhwm".  See HowToUseStackSizeReport.md.
+
+from __future__ import print_function
+
+import argparse
+import re
+import sys
+
+# Stack size options of the tasks started by the kernel, which can not be
+# guessed from the task names.
+KNOWN_OPTIONS = {
+    'Idle Task': 'CONFIG_IDLETHREAD_STACKSIZE',
+    'hpwork': 'CONFIG_SCHED_HPWORKSTACKSIZE',
+    'lpwork': 'CONFIG_SCHED_LPWORKSTACKSIZE',
+    'appinit': 'CONFIG_BOARD_INITTHREAD_STACKSIZE',
+    'appmain': 'CONFIG_USERMAIN_STACKSIZE',
+}
+
+# Slack of the stack size of a task over its option: the stack is aligned
+# and may lose a few words to the architecture.
+SIZE_SLACK = 64
+
+class Task(object):
+    def __init__(self, name):
+        self.name = name
+        self.stack_size = 0
+        self.peak = 0
+        self.nlive = 0
+        self.nexits = 0
+        self.option = None
+        self.guessed = False
+
+    def update(self, stack_size, peak):
+        self.stack_size = max(self.stack_size, stack_size)
+        self.peak = max(self.peak, peak)
+
+def parse(lines):
+    tasks = None
+    for line in lines:
+        # Skip the shell prompt or log prefixes before the keywords
+        fields = line.split()
+        for i, word in enumerate(fields):
+            if word in ('stackhwm', 'task', 'exited'):
+                fields = fields[i:]
+                break
+        else:
+            continue
+
+        try:
+            if fields[0] == 'stackhwm' and len(fields) == 1:
+                # The last dump of the log is reported
+                tasks = {}
+            elif tasks is None or len(fields) < 5:
+                continue
+            else:
+                count, stack_size, peak = [int(x) for x in fields[1:4]]
+                name = ' '.join(fields[4:])
+                task = tasks.setdefault(name, Task(name))
+                task.update(stack_size, peak)
+                if fields[0] == 'task':
+                    task.nlive += 1
+                else:
+                    task.nexits += count
+        except ValueError:
+            continue
+    return tasks
+
+def read_config(path):
+    options = {}
+    with open(path) as f:
+        for line in f:
+            m = re.match(r'(CONFIG_\w*STACK_?SIZE)=(\d+)\s*$', line)
+            if m:
+                options[m.group(1)] = int(m.group(2))
+    return options
+
+def words(text):
+    return set(w for w in re.split(r'[^a-z0-9]+', text.lower()) if len(w) > 1)
+
+def candidates(task, options):
+    return [o for o, v in options.items() if abs(v - task.stack_size) <= SIZE_SLACK]
+
+def match_options(tasks, options, mapping):
+    # The option of a task is given by the mapping, else it is the option of
+    # the task stack size whose name shares most words with the task name.
+    # A task whose name matches no option gets the only option of its stack
+    # size which is not taken by another task, if there is one.
+    unmatched = []
+    for task in tasks:
+        if task.name in mapping:
+            task.option = mapping[task.name]
+            continue
+        if KNOWN_OPTIONS.get(task.name) in options:
+            task.option = KNOWN_OPTIONS[task.name]
+            continue
+        best = 0
+        for option in candidates(task, options):
+            common = len(words(task.name) & (words(option) - set(['config', 'stacksize', 'stack', 'size'])))
+            if common > best:
+                best = common
+                task.option = option
+        if task.option is None:
+            unmatched.append(task)
+
+    taken = set(t.option for t in tasks if t.option)
+    for task in unmatched:
+        free = [o for o in candidates(task, options) if o not in taken]
+        if len(free) == 1:
+            task.option = free[0]
+            task.guessed = True
+
+def propose(task, margin, minimum, align):
+    size = max(task.peak * (100 + margin) // 100, task.peak + minimum)
+    return (size + align - 1) // align * align
+
+def report(tasks, margin, minimum, align):
+    print('%-24s %8s %8s %5s %9s %8s  %s' % ('TASK', 'SIZE', 'PEAK', 'USE', 'PROPOSED', 'SAVING', 'OPTION'))
+    saving = 0
+    options = {}
+    for task in sorted(tasks, key=lambda t: t.stack_size - t.peak, reverse=True):
+        proposed = propose(task, margin, minimum, align)
+        use = 100 * task.peak // task.stack_size if task.stack_size else 0
+        diff = task.stack_size - proposed
+        option = task.option or '-'
+        if task.guessed:
+            option += ' (only option of this size)'
+        print('%-24s %8d %8d %4d%% %9d %8d  %s' % (task.name[:24], task.stack_size, task.peak, use, proposed, diff, option))
+        # A task with several instances allocates its stack several times
+        saving += diff * max(task.nlive, 1)
+        if task.option:
+            options[task.option] = max(options.get(task.option, 0), proposed)
+    print('')
+    print('Stack memory which can be reclaimed, once per live instance: %d bytes' % saving)
+    print('')
+
+    if options:
+        print('Proposed options, with a margin of %d%% and at least %d bytes over the peak:' % (margin, minimum))
+        for option in sorted(options):
+            print('%s=%d' % (option, options[option]))
+    print('')
+    print('The peaks are the deepest use seen since boot.  Run every scenario of the')
+    print('product, including error paths, before reading /proc/stackhwm.')
+
+def main():
+    parser = argparse.ArgumentParser(description='Propose stack sizes from the output of /proc/stackhwm')
+    parser.add_argument('log', help='log file with the output of "cat /proc/stackhwm"')
+    parser.add_argument('-c', '--config', default=None, help='.config of the build, e.g. ../../os/.config')
+    parser.add_argument('-m', '--map', default=None, help='file of "task name=CONFIG_OPTION" lines for the tasks not matched')
+    parser.add_argument('-p', '--margin', type=int, default=25, help='margin over the peak in percent (default: 25)')
+    parser.add_argument('-s', '--minimum', type=int, default=256, help='minimum margin over the peak in bytes (default: 256)')
+    parser.add_argument('-a', '--align', type=int, default=256, help='alignment of the proposed sizes (default: 256)')
+    args = parser.parse_args()
+
+    with open(args.log) as f:
+        tasks = parse(f)
+    if not tasks:
+        print('No stackhwm output in %s' % args.log, file=sys.stderr)
+        return 1
+
+    mapping = {}
+    if args.map:
+        with open(args.map) as f:
+            for line in f:
+                if '=' in line and not line.startswith('#'):
+                    name, option = line.rsplit('=', 1)
+                    mapping[name.strip()] = option.strip()
+
+    options = read_config(args.config) if args.config else {}
+    match_options(tasks.values(), options, mapping)
+    report(tasks.values(), args.margin, args.minimum, args.align)
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())